@@ -0,0 +1,112 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#ifndef x_COMMON_INCLUDE_UTIL_SLIDINGDFT_HPP_
+#define x_COMMON_INCLUDE_UTIL_SLIDINGDFT_HPP_
+
+#include <complex>
+#include <cstdint>
+#include <tuple>
+#include <vector>
+
+namespace x::Util {
+
+/**
+ * @brief Incremental spectrum estimator over a sliding window of the last W samples.
+ *
+ * Every push() updates all W DFT bins in O(W) with the sliding DFT recurrence
+ *     X_k <- (X_k + x_new - x_old) * e^(j*2*pi*k/W)
+ * instead of recomputing a full FFT over the window. All storage (window, twiddles,
+ * spectrum, psd) is allocated once in the c-tor, so updates and queries are allocation-free.
+ *
+ * The recurrence accumulates rounding error, so the spectrum is recomputed from the
+ * window every resyncPeriod samples. Until the window is full, the spectrum is not
+ * defined for W bins and computeNyquistAndEnergy falls back to Util::computeNyquistAndEnergy.
+ *
+ * Detrending by the window mean only affects the DC bin, so it is applied by ignoring bin 0.
+ * The psd magnitudes do not depend on the order of the window, hence the results match
+ * Util::computeNyquistAndEnergy on the same set of values.
+ */
+class SlidingDFT {
+  public:
+    /**
+     * @brief c-tor of the estimator
+     * @param windowSize number of samples (and bins) W in the window
+     * @param resyncPeriod number of pushes after which the spectrum is recomputed from the window
+     */
+    explicit SlidingDFT(uint64_t windowSize, uint64_t resyncPeriod = 1024);
+
+    /**
+     * @brief adds a sample to the window and evicts the oldest one if the window is full
+     * @param value the new sample
+     */
+    void push(double value);
+
+    /**
+     * @brief removes all samples and resets the spectrum
+     */
+    void clear();
+
+    /**
+     * @brief Check the window, infer its nyq. and decide if it's aliased/non-aliased.
+     * Same semantics as Util::computeNyquistAndEnergy, but on the incrementally maintained spectrum.
+     * @param intervalInSeconds the current avg. of the interval in the window
+     * @return 2-tuple of (true/false if oversampled), proposed nyquist in s)
+     */
+    std::tuple<bool, double> computeNyquistAndEnergy(double intervalInSeconds);
+
+    /**
+     * @brief psd of the detrended window, valid once the window is full
+     * @return the squared magnitudes of all W bins, bin 0 is zero
+     */
+    const std::vector<double>& getPsd();
+
+    /**
+     * @brief total energy of the detrended window, valid once the window is full
+     * @return the sum of energies across all frequencies divided by W
+     */
+    double getTotalEnergy();
+
+    [[nodiscard]] uint64_t size() const { return currentSize; }
+    [[nodiscard]] uint64_t capacity() const { return windowSize; }
+    [[nodiscard]] bool full() const { return currentSize == windowSize; }
+
+  private:
+    /**
+     * @brief recomputes all bins from the window with a direct DFT, O(W^2) but without allocations
+     */
+    void resync();
+
+    /**
+     * @brief refreshes psd and energy from the spectrum if new samples arrived since the last refresh
+     */
+    void refreshPsd();
+
+    uint64_t windowSize;
+    uint64_t resyncPeriod;
+    uint64_t currentSize{0};
+    uint64_t head{0};// position of the oldest sample in window
+    uint64_t pushesSinceResync{0};
+    bool psdIsStale{true};
+    double totalEnergy{0};
+
+    std::vector<double> window;
+    std::vector<std::complex<double>> twiddles;// e^(j*2*pi*k/W)
+    std::vector<std::complex<double>> spectrum;
+    std::vector<double> psd;
+};
+
+}// namespace x::Util
+
+#endif// x_COMMON_INCLUDE_UTIL_SLIDINGDFT_HPP_
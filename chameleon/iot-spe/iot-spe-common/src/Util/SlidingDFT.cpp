@@ -0,0 +1,127 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+#include <Util/Common.hpp>
+#include <Util/SlidingDFT.hpp>
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+namespace x::Util {
+
+SlidingDFT::SlidingDFT(uint64_t windowSize, uint64_t resyncPeriod)
+    : windowSize(windowSize), resyncPeriod(resyncPeriod), window(windowSize, 0.), twiddles(windowSize),
+      spectrum(windowSize), psd(windowSize, 0.) {
+    for (uint64_t k = 0; k < windowSize; ++k) {
+        twiddles[k] = std::polar(1.0, 2 * std::numbers::pi * k / windowSize);
+    }
+}
+
+void SlidingDFT::push(double value) {
+    psdIsStale = true;
+    if (!full()) {
+        window[(head + currentSize) % windowSize] = value;
+        ++currentSize;
+        if (full()) {
+            resync();
+        }
+        return;
+    }
+
+    // the window is full, so the oldest sample is overwritten by the new one
+    double delta = value - window[head];
+    window[head] = value;
+    head = (head + 1) % windowSize;
+    for (uint64_t k = 0; k < windowSize; ++k) {
+        spectrum[k] = (spectrum[k] + delta) * twiddles[k];
+    }
+
+    if (++pushesSinceResync >= resyncPeriod) {
+        resync();
+    }
+}
+
+void SlidingDFT::clear() {
+    currentSize = 0;
+    head = 0;
+    pushesSinceResync = 0;
+    psdIsStale = true;
+    totalEnergy = 0;
+    std::fill(window.begin(), window.end(), 0.);
+    std::fill(spectrum.begin(), spectrum.end(), std::complex<double>(0., 0.));
+    std::fill(psd.begin(), psd.end(), 0.);
+}
+
+void SlidingDFT::resync() {
+    for (uint64_t k = 0; k < windowSize; ++k) {
+        std::complex<double> bin(0., 0.);
+        for (uint64_t n = 0; n < windowSize; ++n) {
+            // e^(-j*2*pi*k*n/W) is the conjugate of the (k*n mod W)-th twiddle
+            bin += window[(head + n) % windowSize] * std::conj(twiddles[(k * n) % windowSize]);
+        }
+        spectrum[k] = bin;
+    }
+    pushesSinceResync = 0;
+}
+
+void SlidingDFT::refreshPsd() {
+    if (!psdIsStale) {
+        return;
+    }
+    // detrending by the mean zeroes the DC bin and leaves all other bins untouched
+    psd[0] = 0.;
+    double energy = 0.;
+    for (uint64_t k = 1; k < windowSize; ++k) {
+        psd[k] = std::norm(spectrum[k]);
+        energy += psd[k];
+    }
+    totalEnergy = energy / windowSize;
+    psdIsStale = false;
+}
+
+const std::vector<double>& SlidingDFT::getPsd() {
+    refreshPsd();
+    return psd;
+}
+
+double SlidingDFT::getTotalEnergy() {
+    refreshPsd();
+    return totalEnergy;
+}
+
+std::tuple<bool, double> SlidingDFT::computeNyquistAndEnergy(double intervalInSeconds) {
+    if (!full()) {
+        // too few samples for W bins, use the full computation during warm-up
+        std::vector<double> currentSignal(currentSize);
+        for (uint64_t idx = 0; idx < currentSize; ++idx) {
+            currentSignal[idx] = window[(head + idx) % windowSize];
+        }
+        return Util::computeNyquistAndEnergy(currentSignal, intervalInSeconds);
+    }
+
+    refreshPsd();
+    double frequency = 1. / intervalInSeconds;
+    double currentNyq = 1. / intervalInSeconds;
+    auto aliasingResult = Util::is_aliased_and_nyq_freq(psd, totalEnergy);
+    auto isAliased = std::get<0>(aliasingResult);
+    auto nyqIdx = std::get<1>(aliasingResult);
+    if (!isAliased && totalEnergy > 0.) {
+        // same bin layout as Util::fftfreq(windowSize, frequency), without materializing it
+        auto signedIdx = nyqIdx < static_cast<int>((windowSize - 1) / 2 + 1) ? nyqIdx : nyqIdx - static_cast<int>(windowSize);
+        currentNyq = 2 * (signedIdx / (windowSize * frequency));
+    }
+
+    return std::make_tuple(currentNyq < frequency, 1. / currentNyq);
+}
+
+}// namespace x::Util
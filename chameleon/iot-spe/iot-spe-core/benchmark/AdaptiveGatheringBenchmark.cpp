@@ -0,0 +1,520 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+#include <API/Schema.hpp>
+#include <Common/DataTypes/DataTypeFactory.hpp>
+#include <Configurations/Worker/WorkerConfiguration.hpp>
+#include <Listeners/QueryStatusListener.hpp>
+#include <Runtime/Execution/ExecutableQueryPlan.hpp>
+#include <Runtime/NodeEngine.hpp>
+#include <Runtime/NodeEngineBuilder.hpp>
+#include <Runtime/QueryManager.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Sinks/Mediums/NullOutputSink.hpp>
+#include <Sources/LambdaSource.hpp>
+#include <Util/FixedSizeKalmanFilter.hpp>
+#include <Util/GatheringMode.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/SlidingDFT.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Replays a sensor dataset through a LambdaSource in each gathering mode and reports the accuracy and cost of
+ * adaptive gathering as csv, one line per mode:
+ *  - tuplesEmitted: the number of tuples that arrived at the sink,
+ *  - fftNsPerTuple / filterNsPerTuple: the thread cpu time of the spectrum analysis and the kalman filter per tuple,
+ *  - windowMeanAbsoluteError / windowRootMeanSquareError: the error of tumbling window averages of the gathered stream,
+ *    reconstructed by sample and hold, against the window averages of the full-rate stream,
+ *  - latencyMeanInUs / latencyP99InUs: the time from the generation of a tuple in the source to its arrival at the sink.
+ *
+ * The source runs on a virtual clock: every gathering reads the dataset value at the current virtual time and then advances
+ * the clock by the current gathering interval, so the replay runs as fast as the engine processes the tuples.
+ *
+ * Arguments (all optional):
+ *  --dataset=<path>                csv file with one sample per line, a synthetic signal is replayed otherwise
+ *  --valueColumn=<index>           column of the sample in the dataset, default 0
+ *  --numberOfSamples=<n>           number of samples of the synthetic signal, default 100000
+ *  --fullRateIntervalInMs=<ms>     interval between two samples of the dataset, default 10
+ *  --gatheringIntervalInMs=<ms>    initial gathering interval of all modes, default fullRateIntervalInMs
+ *  --windowSizeInMs=<ms>           size of the tumbling windows of the error, default 1000
+ *  --repetitions=<n>               repetitions of the cost measurement, default 10
+ *  --output=<path>                 additionally writes the results to a csv file
+ *  --baseline=<path>               compares the results to an earlier output and fails on regressions
+ *  --tolerance=<fraction>          allowed relative regression against the baseline, default 0.2
+ */
+
+namespace x::Benchmark {
+
+namespace {
+/// the window size of the spectrum analysis of DataSource
+constexpr uint64_t SPECTRUM_WINDOW_SIZE = 20;
+constexpr uint64_t NUMBER_OF_SOURCE_LOCAL_BUFFERS = 64;
+constexpr auto REPLAY_TIMEOUT = std::chrono::minutes(10);
+const std::string FUSED_GATHERING_GROUP = "adaptive-gathering-benchmark";
+
+uint64_t threadCpuTimeInNs() {
+    timespec time{};
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time);
+    return static_cast<uint64_t>(time.tv_sec) * 1'000'000'000 + static_cast<uint64_t>(time.tv_nsec);
+}
+
+uint64_t steadyTimeInNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+}// namespace
+
+struct ReplayConfiguration {
+    uint64_t fullRateIntervalInMs = 10;
+    uint64_t gatheringIntervalInMs = 10;
+    uint64_t windowSizeInMs = 1000;
+    uint64_t repetitions = 10;
+};
+
+/// the layout of the replayed tuples, matches the schema created by createReplaySchema()
+struct ReplayTuple {
+    uint64_t timestamp;
+    double value;
+    uint64_t generationTimeInNs;
+};
+
+SchemaPtr createReplaySchema() {
+    return Schema::create()
+        ->addField("timestamp", DataTypeFactory::createUInt64())
+        ->addField("value", DataTypeFactory::createDouble())
+        ->addField("generationTime", DataTypeFactory::createUInt64());
+}
+
+/**
+ * @brief Virtual clock of a replay, shared between the ReplaySource and its generation function.
+ */
+struct ReplayClock {
+    const std::vector<double>& dataset;
+    uint64_t fullRateIntervalInMs;
+    uint64_t timestamp{0};
+};
+
+/**
+ * @brief LambdaSource that produces one tuple per gathering and advances the virtual clock by its gathering interval.
+ */
+class ReplaySource : public LambdaSource {
+  public:
+    ReplaySource(const SchemaPtr& schema,
+                 const Runtime::NodeEnginePtr& nodeEngine,
+                 std::shared_ptr<ReplayClock> clock,
+                 uint64_t gatheringIntervalInMs,
+                 GatheringMode gatheringMode,
+                 OperatorId operatorId,
+                 const DataSinkPtr& sink)
+        : LambdaSource(
+            schema,
+            nodeEngine->getBufferManager(),
+            nodeEngine->getQueryManager(),
+            0,
+            gatheringIntervalInMs,
+            [clock](Runtime::TupleBuffer& buffer, uint64_t) {
+                auto* tuple = buffer.getBuffer<ReplayTuple>();
+                tuple->timestamp = clock->timestamp;
+                tuple->value = clock->dataset[clock->timestamp / clock->fullRateIntervalInMs];
+                tuple->generationTimeInNs = steadyTimeInNs();
+            },
+            operatorId,
+            0,
+            NUMBER_OF_SOURCE_LOCAL_BUFFERS,
+            gatheringMode,
+            0,
+            0,
+            "replay",
+            {sink}),
+          clock(std::move(clock)) {
+        numberOfTuplesToProduce = 1;
+    }
+
+    std::optional<Runtime::TupleBuffer> receiveData() override {
+        if (started) {
+            clock->timestamp += gatheringInterval.count();
+        }
+        started = true;
+        if (clock->timestamp / clock->fullRateIntervalInMs >= clock->dataset.size()) {
+            return std::nullopt;// the dataset is exhausted, the source terminates
+        }
+        return LambdaSource::receiveData();
+    }
+
+  private:
+    std::shared_ptr<ReplayClock> clock;
+    bool started{false};
+};
+
+/**
+ * @brief Sink that keeps all received tuples and their latency.
+ */
+class ReplaySink : public NullOutputSink {
+  public:
+    ReplaySink(const Runtime::NodeEnginePtr& nodeEngine, QueryId queryId) : NullOutputSink(nodeEngine, 1, queryId, queryId) {}
+
+    bool writeData(Runtime::TupleBuffer& inputBuffer, Runtime::WorkerContextRef workerContext) override {
+        auto now = steadyTimeInNs();
+        std::unique_lock lock(tuplesMutex);
+        auto* tuple = inputBuffer.getBuffer<ReplayTuple>();
+        for (uint64_t i = 0; i < inputBuffer.getNumberOfTuples(); ++i) {
+            tuples.emplace_back(tuple[i]);
+            latenciesInNs.emplace_back(now - tuple[i].generationTimeInNs);
+        }
+        lock.unlock();
+        return NullOutputSink::writeData(inputBuffer, workerContext);
+    }
+
+    std::mutex tuplesMutex;
+    std::vector<ReplayTuple> tuples;
+    std::vector<uint64_t> latenciesInNs;
+};
+
+class BenchmarkQueryListener : public AbstractQueryStatusListener {
+  public:
+    bool canTriggerEndOfStream(QueryId, QuerySubPlanId, OperatorId, Runtime::QueryTerminationType) override { return true; }
+    bool notifySourceTermination(QueryId, QuerySubPlanId, OperatorId, Runtime::QueryTerminationType) override { return true; }
+    bool notifyQueryFailure(QueryId queryId, QuerySubPlanId, std::string errorMsg) override {
+        x_ERROR("AdaptiveGatheringBenchmark: query {} failed with {}", queryId, errorMsg);
+        return true;
+    }
+    bool notifyQueryStatusChange(QueryId, QuerySubPlanId, Runtime::Execution::ExecutableQueryPlanStatus) override { return true; }
+    bool notifyEpochTermination(uint64_t, uint64_t) override { return false; }
+};
+
+struct ReplayResult {
+    GatheringMode gatheringMode;
+    uint64_t tuplesEmitted{0};
+    double fftNsPerTuple{0};
+    double filterNsPerTuple{0};
+    double windowMeanAbsoluteError{0};
+    double windowRootMeanSquareError{0};
+    double latencyMeanInUs{0};
+    double latencyP99InUs{0};
+
+    static std::string header() {
+        return "mode,tuplesEmitted,fftNsPerTuple,filterNsPerTuple,windowMeanAbsoluteError,windowRootMeanSquareError,"
+               "latencyMeanInUs,latencyP99InUs";
+    }
+
+    [[nodiscard]] std::string toCsv() const {
+        std::stringstream ss;
+        ss << GatheringModeString(gatheringMode) << ',' << tuplesEmitted << ',' << fftNsPerTuple << ',' << filterNsPerTuple << ','
+           << windowMeanAbsoluteError << ',' << windowRootMeanSquareError << ',' << latencyMeanInUs << ',' << latencyP99InUs;
+        return ss.str();
+    }
+};
+
+/**
+ * @brief reads one column of a csv file, lines without a number in the column (e.g., the header) are skipped
+ */
+std::vector<double> loadDataset(const std::string& path, uint64_t valueColumn) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        x_THROW_RUNTIME_ERROR("AdaptiveGatheringBenchmark: cannot open dataset " << path);
+    }
+    std::vector<double> dataset;
+    std::string line;
+    while (std::getline(file, line)) {
+        std::stringstream lineStream(line);
+        std::string cell;
+        for (uint64_t column = 0; column <= valueColumn && std::getline(lineStream, cell, ','); ++column) {
+        }
+        char* end = nullptr;
+        auto value = std::strtod(cell.c_str(), &end);
+        if (end != cell.c_str()) {
+            dataset.emplace_back(value);
+        }
+    }
+    return dataset;
+}
+
+/**
+ * @brief a slow oscillation with bursts of a fast one and steps, so that the adaptive modes speed up and slow down
+ */
+std::vector<double> generateDataset(uint64_t numberOfSamples) {
+    std::vector<double> dataset(numberOfSamples);
+    for (uint64_t i = 0; i < numberOfSamples; ++i) {
+        auto burst = (i / 5000) % 4 == 1 ? 0.5 * std::sin(0.8 * i) : 0.0;
+        auto step = (i / 20000) % 2 == 0 ? 0.0 : 2.0;
+        dataset[i] = std::sin(0.002 * i) + burst + step;
+    }
+    return dataset;
+}
+
+/**
+ * @brief replays the gathered values through the spectrum analysis and the kalman filter of the adaptive modes,
+ * the same way DataSource processes them, and measures the cpu time of both
+ */
+void measureAdaptiveCost(const std::vector<ReplayTuple>& tuples, const ReplayConfiguration& configuration, ReplayResult& result) {
+    if (tuples.size() < 2) {
+        return;
+    }
+    std::vector<std::tuple<bool, double>> spectra(tuples.size());
+    uint64_t fftTimeInNs = 0;
+    uint64_t filterTimeInNs = 0;
+    volatile int64_t intervalSum = 0;// keeps the filter from being optimized away
+    for (uint64_t repetition = 0; repetition < configuration.repetitions; ++repetition) {
+        Util::SlidingDFT spectrum(SPECTRUM_WINDOW_SIZE);
+        auto start = threadCpuTimeInNs();
+        for (uint64_t i = 0; i < tuples.size(); ++i) {
+            auto intervalInMs = i == 0 ? configuration.gatheringIntervalInMs : tuples[i].timestamp - tuples[i - 1].timestamp;
+            spectrum.push(tuples[i].value);
+            spectra[i] = spectrum.computeNyquistAndEnergy(intervalInMs / 1000.);
+        }
+        fftTimeInNs += threadCpuTimeInNs() - start;
+
+        FixedSizeKalmanFilter<3, 1> filter;
+        filter.init();
+        filter.setGatheringInterval(std::chrono::milliseconds(configuration.gatheringIntervalInMs));
+        filter.setGatheringIntervalRange(std::chrono::milliseconds(8000));
+        start = threadCpuTimeInNs();
+        for (uint64_t i = 0; i < tuples.size(); ++i) {
+            if (std::get<0>(spectra[i])) {
+                filter.setSlowestInterval(
+                    std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::duration<double>(std::get<1>(spectra[i]))));
+            }
+            filter.updateFromValues(&tuples[i].value, 1);
+            intervalSum = intervalSum + filter.getNewGatheringInterval().count();
+        }
+        filterTimeInNs += threadCpuTimeInNs() - start;
+    }
+    auto numberOfTuples = static_cast<double>(tuples.size() * configuration.repetitions);
+    result.fftNsPerTuple = fftTimeInNs / numberOfTuples;
+    result.filterNsPerTuple = filterTimeInNs / numberOfTuples;
+}
+
+/**
+ * @brief compares the averages of tumbling windows over the full-rate dataset with the averages over the gathered tuples,
+ * which are reconstructed on the full-rate grid by sample and hold
+ */
+void computeWindowError(const std::vector<double>& dataset,
+                        const std::vector<ReplayTuple>& tuples,
+                        const ReplayConfiguration& configuration,
+                        ReplayResult& result) {
+    if (tuples.empty()) {
+        return;
+    }
+    auto samplesPerWindow = std::max<uint64_t>(1, configuration.windowSizeInMs / configuration.fullRateIntervalInMs);
+    auto numberOfWindows = dataset.size() / samplesPerWindow;
+    uint64_t nextTuple = 0;
+    double heldValue = tuples.front().value;
+    double absoluteErrorSum = 0;
+    double squaredErrorSum = 0;
+    for (uint64_t window = 0; window < numberOfWindows; ++window) {
+        double fullRateSum = 0;
+        double gatheredSum = 0;
+        for (uint64_t i = window * samplesPerWindow; i < (window + 1) * samplesPerWindow; ++i) {
+            auto timestamp = i * configuration.fullRateIntervalInMs;
+            while (nextTuple < tuples.size() && tuples[nextTuple].timestamp <= timestamp) {
+                heldValue = tuples[nextTuple++].value;
+            }
+            fullRateSum += dataset[i];
+            gatheredSum += heldValue;
+        }
+        auto error = (gatheredSum - fullRateSum) / samplesPerWindow;
+        absoluteErrorSum += std::abs(error);
+        squaredErrorSum += error * error;
+    }
+    if (numberOfWindows > 0) {
+        result.windowMeanAbsoluteError = absoluteErrorSum / numberOfWindows;
+        result.windowRootMeanSquareError = std::sqrt(squaredErrorSum / numberOfWindows);
+    }
+}
+
+ReplayResult replay(const Runtime::NodeEnginePtr& nodeEngine,
+                    const std::vector<double>& dataset,
+                    const ReplayConfiguration& configuration,
+                    GatheringMode gatheringMode,
+                    QueryId queryId) {
+    auto sink = std::make_shared<ReplaySink>(nodeEngine, queryId);
+    auto clock = std::make_shared<ReplayClock>(ReplayClock{dataset, configuration.fullRateIntervalInMs});
+    auto source = std::make_shared<ReplaySource>(createReplaySchema(),
+                                                 nodeEngine,
+                                                 clock,
+                                                 configuration.gatheringIntervalInMs,
+                                                 gatheringMode,
+                                                 queryId,
+                                                 sink);
+    if (gatheringMode == GatheringMode::FUSED_ADAPTIVE_MODE) {
+        source->setFusedGatheringGroup(FUSED_GATHERING_GROUP);
+    }
+    auto plan = Runtime::Execution::ExecutableQueryPlan::create(queryId,
+                                                                queryId,
+                                                                {source},
+                                                                {sink},
+                                                                {},
+                                                                nodeEngine->getQueryManager(),
+                                                                nodeEngine->getBufferManager());
+    if (!nodeEngine->registerQueryInNodeEngine(plan) || !nodeEngine->startQuery(queryId)) {
+        x_THROW_RUNTIME_ERROR("AdaptiveGatheringBenchmark: cannot start the replay in mode " << GatheringModeString(gatheringMode));
+    }
+
+    auto deadline = std::chrono::steady_clock::now() + REPLAY_TIMEOUT;
+    auto status = nodeEngine->getQueryStatus(queryId);
+    while (status != Runtime::Execution::ExecutableQueryPlanStatus::Finished) {
+        if (status == Runtime::Execution::ExecutableQueryPlanStatus::ErrorState || std::chrono::steady_clock::now() > deadline) {
+            x_THROW_RUNTIME_ERROR("AdaptiveGatheringBenchmark: replay in mode " << GatheringModeString(gatheringMode)
+                                                                                << " did not finish");
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        status = nodeEngine->getQueryStatus(queryId);
+    }
+    [[maybe_unused]] auto unregistered = nodeEngine->unregisterQuery(queryId);
+
+    ReplayResult result{gatheringMode};
+    std::unique_lock lock(sink->tuplesMutex);
+    auto& tuples = sink->tuples;
+    // worker threads may deliver buffers out of order
+    std::sort(tuples.begin(), tuples.end(), [](const ReplayTuple& left, const ReplayTuple& right) {
+        return left.timestamp < right.timestamp;
+    });
+    result.tuplesEmitted = tuples.size();
+    measureAdaptiveCost(tuples, configuration, result);
+    computeWindowError(dataset, tuples, configuration, result);
+    auto& latencies = sink->latenciesInNs;
+    if (!latencies.empty()) {
+        std::sort(latencies.begin(), latencies.end());
+        uint64_t latencySum = 0;
+        for (auto latency : latencies) {
+            latencySum += latency;
+        }
+        result.latencyMeanInUs = latencySum / 1000. / latencies.size();
+        result.latencyP99InUs = latencies[(latencies.size() - 1) * 99 / 100] / 1000.;
+    }
+    return result;
+}
+
+/**
+ * @brief compares the results with the results of an earlier run
+ * @return false if the error or the cost of a mode grew by more than the tolerance
+ */
+bool checkBaseline(const std::vector<ReplayResult>& results, const std::string& path, double tolerance) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        x_THROW_RUNTIME_ERROR("AdaptiveGatheringBenchmark: cannot open baseline " << path);
+    }
+    std::map<std::string, std::vector<double>> baseline;
+    std::string line;
+    std::getline(file, line);// header
+    while (std::getline(file, line)) {
+        std::stringstream lineStream(line);
+        std::string mode;
+        std::string cell;
+        std::getline(lineStream, mode, ',');
+        while (std::getline(lineStream, cell, ',')) {
+            baseline[mode].emplace_back(std::stod(cell));
+        }
+    }
+
+    bool passed = true;
+    auto check = [&](const ReplayResult& result, const std::string& metric, double current, double previous) {
+        // absolute slack for metrics that are close to zero, e.g., the error of the interval mode
+        if (current > previous * (1 + tolerance) + 1e-9) {
+            std::cerr << "Regression in mode " << GatheringModeString(result.gatheringMode) << ": " << metric << " " << current
+                      << " > baseline " << previous << std::endl;
+            passed = false;
+        }
+    };
+    for (const auto& result : results) {
+        auto entry = baseline.find(GatheringModeString(result.gatheringMode));
+        if (entry == baseline.end() || entry->second.size() < 4) {
+            continue;
+        }
+        const auto& previous = entry->second;
+        check(result, "fftNsPerTuple", result.fftNsPerTuple, previous[1]);
+        check(result, "filterNsPerTuple", result.filterNsPerTuple, previous[2]);
+        check(result, "windowMeanAbsoluteError", result.windowMeanAbsoluteError, previous[3]);
+    }
+    return passed;
+}
+
+}// namespace x::Benchmark
+
+int main(int argc, char** argv) {
+    using namespace x;
+    using namespace x::Benchmark;
+    x::Logger::setupLogging("AdaptiveGatheringBenchmark.log", x::LogLevel::LOG_WARNING);
+
+    std::map<std::string, std::string> commandLineParams;
+    for (int i = 1; i < argc; ++i) {
+        commandLineParams.insert(std::pair<std::string, std::string>(
+            std::string(argv[i]).substr(0, std::string(argv[i]).find('=')),
+            std::string(argv[i]).substr(std::string(argv[i]).find('=') + 1, std::string(argv[i]).length() - 1)));
+    }
+    auto param = [&commandLineParams](const std::string& name, const std::string& defaultValue) {
+        auto it = commandLineParams.find(name);
+        return it == commandLineParams.end() ? defaultValue : it->second;
+    };
+
+    try {
+        ReplayConfiguration configuration;
+        configuration.fullRateIntervalInMs = std::max<uint64_t>(1, std::stoull(param("--fullRateIntervalInMs", "10")));
+        configuration.gatheringIntervalInMs =
+            std::stoull(param("--gatheringIntervalInMs", std::to_string(configuration.fullRateIntervalInMs)));
+        configuration.windowSizeInMs = std::stoull(param("--windowSizeInMs", "1000"));
+        configuration.repetitions = std::max<uint64_t>(1, std::stoull(param("--repetitions", "10")));
+
+        auto datasetPath = param("--dataset", "");
+        auto dataset = datasetPath.empty() ? generateDataset(std::stoull(param("--numberOfSamples", "100000")))
+                                           : loadDataset(datasetPath, std::stoull(param("--valueColumn", "0")));
+        if (dataset.empty()) {
+            x_THROW_RUNTIME_ERROR("AdaptiveGatheringBenchmark: the dataset is empty");
+        }
+
+        auto nodeEngine = Runtime::NodeEngineBuilder::create(Configurations::WorkerConfiguration::create())
+                              .setQueryStatusListener(std::make_shared<BenchmarkQueryListener>())
+                              .build();
+
+        std::vector<ReplayResult> results;
+        QueryId queryId = 1;
+        for (auto gatheringMode : {GatheringMode::INTERVAL_MODE,
+                                   GatheringMode::ADAPTIVE_MODE,
+                                   GatheringMode::ADAPTIVE_MODE_OVERSAMPLER,
+                                   GatheringMode::FUSED_ADAPTIVE_MODE}) {
+            results.emplace_back(replay(nodeEngine, dataset, configuration, gatheringMode, queryId++));
+        }
+        [[maybe_unused]] auto stopped = nodeEngine->stop();
+
+        std::cout << ReplayResult::header() << std::endl;
+        for (const auto& result : results) {
+            std::cout << result.toCsv() << std::endl;
+        }
+        auto outputPath = param("--output", "");
+        if (!outputPath.empty()) {
+            std::ofstream output(outputPath, std::ios::trunc);
+            output << ReplayResult::header() << std::endl;
+            for (const auto& result : results) {
+                output << result.toCsv() << std::endl;
+            }
+        }
+
+        auto baselinePath = param("--baseline", "");
+        if (!baselinePath.empty() && !checkBaseline(results, baselinePath, std::stod(param("--tolerance", "0.2")))) {
+            return 1;
+        }
+    } catch (std::exception const& ex) {
+        std::cerr << "AdaptiveGatheringBenchmark failed: " << ex.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
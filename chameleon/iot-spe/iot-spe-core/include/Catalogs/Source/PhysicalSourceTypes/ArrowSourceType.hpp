@@ -125,6 +125,16 @@ class ArrowSourceType : public PhysicalSourceType {
      */
     void setNumberOfTuplesToProducePerBuffer(const uint32_t numberOfTuplesToProducePerBuffer);
 
+    /**
+     * @brief gets a ConfigurationOption object with the number of reader threads
+     */
+    [[nodiscard]] std::shared_ptr<Configurations::ConfigurationOption<uint32_t>> getNumberOfReaderThreads() const;
+
+    /**
+     * @brief set the number of threads that parse the file in parallel
+     */
+    void setNumberOfReaderThreads(uint32_t numberOfReaderThreads);
+
   private:
     /**
      * @brief constructor to create a new Arrow source config object initialized with values from sourceConfigMap
@@ -146,6 +156,7 @@ class ArrowSourceType : public PhysicalSourceType {
     Configurations::IntConfigOption numberOfTuplesToProducePerBuffer;
     Configurations::IntConfigOption sourceGatheringInterval;
     Configurations::GatheringModeConfigOption gatheringMode;
+    Configurations::IntConfigOption numberOfReaderThreads;
 };
 
 }// namespace x
@@ -141,11 +141,41 @@ class CSVSourceType : public PhysicalSourceType {
      */
     void setGatheringMode(GatheringMode inputGatheringMode);
 
+    /**
+     * @brief gets a ConfigurationOption object with the comma separated fields of the adaptive gathering mode
+     */
+    [[nodiscard]] std::shared_ptr<Configurations::ConfigurationOption<std::string>> getAdaptiveValueFields() const;
+
+    /**
+     * @brief set the comma separated fields of the adaptive gathering mode
+     */
+    void setAdaptiveValueFields(std::string adaptiveValueFields);
+
+    /**
+     * @brief gets a ConfigurationOption object with the group of the fused adaptive gathering mode
+     */
+    [[nodiscard]] std::shared_ptr<Configurations::ConfigurationOption<std::string>> getFusedGatheringGroup() const;
+
+    /**
+     * @brief set the group of the fused adaptive gathering mode
+     */
+    void setFusedGatheringGroup(std::string fusedGatheringGroup);
+
     /**
      * @brief set the value for numberOfTuplesToProducePerBuffer with the appropriate data format
      */
     void setNumberOfTuplesToProducePerBuffer(uint32_t numberOfTuplesToProducePerBuffer);
 
+    /**
+     * @brief gets a ConfigurationOption object with the number of reader threads
+     */
+    [[nodiscard]] std::shared_ptr<Configurations::ConfigurationOption<uint32_t>> getNumberOfReaderThreads() const;
+
+    /**
+     * @brief set the number of threads that parse the file in parallel
+     */
+    void setNumberOfReaderThreads(uint32_t numberOfReaderThreads);
+
   private:
     /**
      * @brief constructor to create a new CSV source config object initialized with values from sourceConfigMap
@@ -168,6 +198,9 @@ class CSVSourceType : public PhysicalSourceType {
     Configurations::IntConfigOption numberOfTuplesToProducePerBuffer;
     Configurations::IntConfigOption sourceGatheringInterval;
     Configurations::GatheringModeConfigOption gatheringMode;
+    Configurations::StringConfigOption adaptiveValueFields;
+    Configurations::StringConfigOption fusedGatheringGroup;
+    Configurations::IntConfigOption numberOfReaderThreads;
 };
 
 }// namespace x
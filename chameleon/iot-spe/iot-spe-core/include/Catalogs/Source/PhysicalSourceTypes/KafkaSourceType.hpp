@@ -155,6 +155,27 @@ class KafkaSourceType : public PhysicalSourceType {
      */
     void setInputFormat(Configurations::InputFormat inputFormatValue);
 
+    /**
+     * @brief gets a ConfigurationOption object that selects the OnDemandJSONParser for JSON input
+     */
+    [[nodiscard]] std::shared_ptr<Configurations::ConfigurationOption<bool>> getOnDemandJSONParsing() const;
+
+    /**
+     * @brief set if JSON input is parsed by the OnDemandJSONParser, which also accepts payloads with
+     * several newline-delimited records
+     */
+    void setOnDemandJSONParsing(bool onDemandJSONParsing);
+
+    /**
+     * @brief gets a ConfigurationOption object with the comma-separated partitions of the topic that one source consumes
+     */
+    [[nodiscard]] std::shared_ptr<Configurations::ConfigurationOption<std::string>> getPartitions() const;
+
+    /**
+     * @brief set the comma-separated partitions of the topic, if empty the groupId is used as the only partition
+     */
+    void setPartitions(std::string partitions);
+
   private:
     /**
      * @brief constructor to create a new Kafka source config object initialized with values from sourceConfigMap
@@ -180,6 +201,8 @@ class KafkaSourceType : public PhysicalSourceType {
     Configurations::IntConfigOption numberOfBuffersToProduce;
     Configurations::IntConfigOption batchSize;
     Configurations::InputFormatConfigOption inputFormat;
+    Configurations::BoolConfigOption onDemandJSONParsing;
+    Configurations::StringConfigOption partitions;
 };
 }// namespace x
 #endif// x_CORE_INCLUDE_CATALOGS_SOURCE_PHYSICALSOURCETYPES_KAFKASOURCETYPE_HPP_
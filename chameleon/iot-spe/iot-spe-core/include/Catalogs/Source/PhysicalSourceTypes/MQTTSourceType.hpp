@@ -145,6 +145,27 @@ class MQTTSourceType : public PhysicalSourceType {
      */
     void setInputFormat(Configurations::InputFormat inputFormatValue);
 
+    /**
+     * @brief gets a ConfigurationOption object that selects the OnDemandJSONParser for JSON input
+     */
+    [[nodiscard]] std::shared_ptr<Configurations::ConfigurationOption<bool>> getOnDemandJSONParsing() const;
+
+    /**
+     * @brief set if JSON input is parsed by the OnDemandJSONParser, which also accepts payloads with
+     * several newline-delimited records
+     */
+    void setOnDemandJSONParsing(bool onDemandJSONParsing);
+
+    /**
+     * @brief gets a ConfigurationOption object that enables batched consumption
+     */
+    [[nodiscard]] std::shared_ptr<Configurations::ConfigurationOption<bool>> getBatchedConsumption() const;
+
+    /**
+     * @brief set if the source drains all queued messages at once and parses them in a batch
+     */
+    void setBatchedConsumption(bool batchedConsumption);
+
     /**
      * @brief gets a ConfigurationOption object with sourceGatheringInterval
      */
@@ -171,6 +192,26 @@ class MQTTSourceType : public PhysicalSourceType {
      */
     void setGatheringMode(GatheringMode inputGatheringMode);
 
+    /**
+     * @brief gets a ConfigurationOption object with the comma separated fields of the adaptive gathering mode
+     */
+    [[nodiscard]] std::shared_ptr<Configurations::ConfigurationOption<std::string>> getAdaptiveValueFields() const;
+
+    /**
+     * @brief set the comma separated fields of the adaptive gathering mode
+     */
+    void setAdaptiveValueFields(std::string adaptiveValueFields);
+
+    /**
+     * @brief gets a ConfigurationOption object with the group of the fused adaptive gathering mode
+     */
+    [[nodiscard]] std::shared_ptr<Configurations::ConfigurationOption<std::string>> getFusedGatheringGroup() const;
+
+    /**
+     * @brief set the group of the fused adaptive gathering mode
+     */
+    void setFusedGatheringGroup(std::string fusedGatheringGroup);
+
     /**
      * @brief gets a ConfigurationOption object with numberOfBuffersToProduce
      */
@@ -217,8 +258,12 @@ class MQTTSourceType : public PhysicalSourceType {
     Configurations::BoolConfigOption cleanSession;
     Configurations::FloatConfigOption flushIntervalMS;
     Configurations::InputFormatConfigOption inputFormat;
+    Configurations::BoolConfigOption onDemandJSONParsing;
+    Configurations::BoolConfigOption batchedConsumption;
     Configurations::IntConfigOption sourceGatheringInterval;
     Configurations::GatheringModeConfigOption gatheringMode;
+    Configurations::StringConfigOption adaptiveValueFields;
+    Configurations::StringConfigOption fusedGatheringGroup;
     Configurations::IntConfigOption numberOfBuffersToProduce;
     Configurations::IntConfigOption numberOfTuplesToProducePerBuffer;
 };
@@ -68,6 +68,81 @@ class SenseSourceType : public PhysicalSourceType {
      */
     void setUdfs(std::string udfs);
 
+    /**
+     * @brief Get the type of the sensor bus (I2C or SIMULATED), no bus is polled if empty
+     */
+    [[nodiscard]] std::shared_ptr<Configurations::ConfigurationOption<std::string>> getBusType() const;
+
+    /**
+     * @brief Set the type of the sensor bus
+     */
+    void setBusType(std::string busType);
+
+    /**
+     * @brief Get the path of the sensor bus, e.g., /dev/i2c-1, or the file of a simulated bus
+     */
+    [[nodiscard]] std::shared_ptr<Configurations::ConfigurationOption<std::string>> getBusPath() const;
+
+    /**
+     * @brief Set the path of the sensor bus
+     */
+    void setBusPath(std::string busPath);
+
+    /**
+     * @brief Get the address of the sensor on the bus
+     */
+    [[nodiscard]] std::shared_ptr<Configurations::ConfigurationOption<uint32_t>> getBusAddress() const;
+
+    /**
+     * @brief Set the address of the sensor on the bus
+     */
+    void setBusAddress(uint32_t busAddress);
+
+    /**
+     * @brief Get the interval in ms between two samples in the file of a simulated bus
+     */
+    [[nodiscard]] std::shared_ptr<Configurations::ConfigurationOption<uint32_t>> getBusSampleInterval() const;
+
+    /**
+     * @brief Set the interval in ms between two samples in the file of a simulated bus
+     */
+    void setBusSampleInterval(uint32_t busSampleInterval);
+
+    /**
+     * @brief Get the gathering interval, i.e., the initial polling interval of the bus
+     */
+    [[nodiscard]] std::shared_ptr<Configurations::ConfigurationOption<uint32_t>> getGatheringInterval() const;
+
+    /**
+     * @brief Set the gathering interval
+     */
+    void setGatheringInterval(uint32_t sourceGatheringInterval);
+
+    /**
+     * @brief Get gathering mode
+     */
+    [[nodiscard]] std::shared_ptr<Configurations::ConfigurationOption<GatheringMode>> getGatheringMode() const;
+
+    /**
+     * @brief Set gathering mode
+     */
+    void setGatheringMode(std::string inputGatheringMode);
+
+    /**
+     * @brief Sets the gathering mode given as GatheringMode
+     */
+    void setGatheringMode(GatheringMode inputGatheringMode);
+
+    /**
+     * @brief Get the number of bus reads per buffer
+     */
+    [[nodiscard]] std::shared_ptr<Configurations::ConfigurationOption<uint32_t>> getNumberOfTuplesToProducePerBuffer() const;
+
+    /**
+     * @brief Set the number of bus reads per buffer
+     */
+    void setNumberOfTuplesToProducePerBuffer(uint32_t numberOfTuplesToProducePerBuffer);
+
     void reset() override;
 
   private:
@@ -87,6 +162,13 @@ class SenseSourceType : public PhysicalSourceType {
     SenseSourceType();
 
     Configurations::StringConfigOption udfs;
+    Configurations::StringConfigOption busType;
+    Configurations::StringConfigOption busPath;
+    Configurations::IntConfigOption busAddress;
+    Configurations::IntConfigOption busSampleInterval;
+    Configurations::IntConfigOption sourceGatheringInterval;
+    Configurations::GatheringModeConfigOption gatheringMode;
+    Configurations::IntConfigOption numberOfTuplesToProducePerBuffer;
 };
 }// namespace x
 #endif// x_CORE_INCLUDE_CATALOGS_SOURCE_PHYSICALSOURCETYPES_SENSESOURCETYPE_HPP_
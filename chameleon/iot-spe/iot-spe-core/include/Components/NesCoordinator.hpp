@@ -57,6 +57,9 @@ using QueryServicePtr = std::shared_ptr<QueryService>;
 class ReplicationService;
 using ReplicationServicePtr = std::shared_ptr<ReplicationService>;
 
+class GatheringPolicyService;
+using GatheringPolicyServicePtr = std::shared_ptr<GatheringPolicyService>;
+
 class MonitoringService;
 using MonitoringServicePtr = std::shared_ptr<MonitoringService>;
 
@@ -146,6 +149,12 @@ class xCoordinator : public detail::virtual_enable_shared_from_this<xCoordinator
      */
     ReplicationServicePtr getReplicationService() const;
 
+    /**
+     * @brief getter of the service that controls the adaptive gathering of the sources
+     * @return gathering policy service
+     */
+    GatheringPolicyServicePtr getGatheringPolicyService() const;
+
     /**
      * @brief get topology of coordinator
      * @return topology
@@ -250,6 +259,7 @@ class xCoordinator : public detail::virtual_enable_shared_from_this<xCoordinator
     QueryServicePtr queryService;
     MonitoringServicePtr monitoringService;
     ReplicationServicePtr replicationService;
+    GatheringPolicyServicePtr gatheringPolicyService;
     RequestQueuePtr queryRequestQueue;
     GlobalQueryPlanPtr globalQueryPlan;
     Catalogs::UDF::UDFCatalogPtr udfCatalog;
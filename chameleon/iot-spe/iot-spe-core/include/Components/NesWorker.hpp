@@ -285,6 +285,7 @@ class xWorker : public detail::virtual_enable_shared_from_this<xWorker>,
     std::unique_ptr<grpc::Server> rpcServer;
     std::shared_ptr<std::thread> rpcThread;
     std::shared_ptr<std::thread> statisticOutputThread;
+    std::shared_ptr<std::thread> gatheringIntervalReportThread;
     std::unique_ptr<grpc::ServerCompletionQueue> completionQueue;
     Runtime::NodeEnginePtr nodeEngine;
     Monitoring::MonitoringAgentPtr monitoringAgent;
@@ -145,6 +145,8 @@ class ConfigurationOption {
             this->value = InputFormat::CSV;
         } else if (inputFormat == "JSON") {
             this->value = InputFormat::JSON;
+        } else if (inputFormat == "BINARY") {
+            this->value = InputFormat::BINARY;
         } else {
             x_ERROR("InputFormatEnum: value unknown.");
         }
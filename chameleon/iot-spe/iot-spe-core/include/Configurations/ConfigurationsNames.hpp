@@ -18,9 +18,10 @@
 
 namespace x::Configurations {
 /**
- * @brief input format enum gives information whether a JSON or CSV was used to transfer data
+ * @brief input format enum gives information whether a JSON or CSV was used to transfer data,
+ * BINARY transfers tuples in the row layout of the schema without text encoding
  */
-enum class InputFormat : uint8_t { JSON, CSV };
+enum class InputFormat : uint8_t { JSON, CSV, BINARY };
 
 /**
  * NOTE: this is not related to the network stack at all. Do not mix it up.
@@ -44,6 +45,8 @@ const std::string LOGICAL_SOURCES = "logicalSources";
 const std::string NUMBER_OF_BUFFERS_IN_GLOBAL_BUFFER_MANAGER_CONFIG = "numberOfBuffersInGlobalBufferManager";
 const std::string NUMBER_OF_BUFFERS_PER_WORKER_CONFIG = "numberOfBuffersPerWorker";
 const std::string NUMBER_OF_BUFFERS_IN_SOURCE_LOCAL_BUFFER_POOL_CONFIG = "numberOfBuffersInSourceLocalBufferPool";
+const std::string NUMBER_OF_SOURCE_EXECUTOR_THREADS_CONFIG = "numberOfSourceExecutorThreads";
+const std::string GATHERING_INTERVAL_REPORT_PERIOD_CONFIG = "gatheringIntervalReportPeriod";
 const std::string BUFFERS_SIZE_IN_BYTES_CONFIG = "bufferSizeInBytes";
 const std::string ENABLE_MONITORING_CONFIG = "enableMonitoring";
 const std::string MONITORING_WAIT_TIME = "monitoringWaitTime";
@@ -156,12 +159,22 @@ const std::string NUMBER_OF_BUFFERS_TO_PRODUCE_CONFIG = "numberOfBuffersToProduc
 const std::string NUMBER_OF_TUPLES_TO_PRODUCE_PER_BUFFER_CONFIG = "numberOfTuplesToProducePerBuffer";
 const std::string SOURCE_GATHERING_INTERVAL_CONFIG = "sourceGatheringInterval";
 const std::string INPUT_FORMAT_CONFIG = "inputFormat";
+const std::string ON_DEMAND_JSON_PARSING_CONFIG = "onDemandJSONParsing";
+const std::string BATCHED_CONSUMPTION_CONFIG = "batchedConsumption";
 const std::string UDFS_CONFIG = "udfs";
 const std::string FILE_PATH_CONFIG = "filePath";
 
 const std::string SKIP_HEADER_CONFIG = "skipHeader";
 const std::string DELIMITER_CONFIG = "delimiter";
 const std::string SOURCE_GATHERING_MODE_CONFIG = "sourceGatheringMode";
+const std::string SOURCE_ADAPTIVE_VALUE_FIELDS_CONFIG = "adaptiveValueFields";
+const std::string SOURCE_FUSED_GATHERING_GROUP_CONFIG = "fusedGatheringGroup";
+const std::string SOURCE_NUMBER_OF_READER_THREADS_CONFIG = "numberOfReaderThreads";
+
+const std::string SENSOR_BUS_TYPE_CONFIG = "busType";
+const std::string SENSOR_BUS_PATH_CONFIG = "busPath";
+const std::string SENSOR_BUS_ADDRESS_CONFIG = "busAddress";
+const std::string SENSOR_BUS_SAMPLE_INTERVAL_CONFIG = "busSampleInterval";
 
 const std::string URL_CONFIG = "url";
 const std::string CLIENT_ID_CONFIG = "clientId";
@@ -175,6 +188,7 @@ const std::string FLUSH_INTERVAL_MS_CONFIG = "flushIntervalMS";
 const std::string BROKERS_CONFIG = "brokers";
 const std::string AUTO_COMMIT_CONFIG = "autoCommit";
 const std::string GROUP_ID_CONFIG = "groupId";
+const std::string PARTITIONS_CONFIG = "partitions";
 const std::string CONNECTION_TIMEOUT_CONFIG = "connectionTimeout";
 const std::string NUMBER_OF_BUFFER_TO_PRODUCE = "numberOfBuffersToProduce";
 const std::string BATCH_SIZE = "batchSize";
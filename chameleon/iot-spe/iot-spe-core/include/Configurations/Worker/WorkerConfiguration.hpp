@@ -133,6 +133,22 @@ class WorkerConfiguration : public BaseConfiguration {
                                                          64,
                                                          "Number buffers in source local buffer pool."};
 
+    /**
+     * @brief Number of threads that drive all data sources of the worker through an event loop.
+     * With 0, every data source runs on its own thread.
+     */
+    UIntOption numberOfSourceExecutorThreads = {NUMBER_OF_SOURCE_EXECUTOR_THREADS_CONFIG,
+                                                0,
+                                                "Number of threads shared by all data sources (0 = one thread per source)."};
+
+    /**
+     * @brief Period in which the worker reports the gathering intervals of its adaptive sources to the coordinator.
+     * With 0, the worker does not report them.
+     */
+    UIntOption gatheringIntervalReportPeriod = {GATHERING_INTERVAL_REPORT_PERIOD_CONFIG,
+                                                1000,
+                                                "Period of gathering interval reports to the coordinator (ms, 0 = disabled)."};
+
     /**
      * @brief Configures the wait time for collecting metrics in the monitoring streams.
      * Monitoring has to be enabled for it to work.
@@ -282,6 +298,8 @@ class WorkerConfiguration : public BaseConfiguration {
                 &numberOfBuffersInGlobalBufferManager,
                 &numberOfBuffersPerWorker,
                 &numberOfBuffersInSourceLocalBufferPool,
+                &numberOfSourceExecutorThreads,
+                &gatheringIntervalReportPeriod,
                 &bufferSizeInBytes,
                 &parentId,
                 &logLevel,
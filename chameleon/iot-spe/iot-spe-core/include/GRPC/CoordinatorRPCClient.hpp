@@ -35,6 +35,10 @@ namespace Monitoring {
 class RegistrationMetrics;
 }// namespace Monitoring
 
+namespace Runtime {
+struct GatheringIntervalSample;
+}// namespace Runtime
+
 namespace Spatial::DataTypes::Experimental {
 class GeoLocation;
 class Waypoint;
@@ -177,6 +181,14 @@ class CoordinatorRPCClient {
      */
     bool sendErrors(uint64_t workerId, std::string errorMsg);
 
+    /**
+     * @brief method to report the gathering intervals that the adaptive sources of a worker chose in one batch
+     * @param workerId
+     * @param samples
+     * @return bool indicating success
+     */
+    bool reportGatheringIntervals(uint64_t workerId, const std::vector<Runtime::GatheringIntervalSample>& samples);
+
     /**
      * Checks and mark the query for soft stop
      * @param queryId : the query id for which soft stop to be performed
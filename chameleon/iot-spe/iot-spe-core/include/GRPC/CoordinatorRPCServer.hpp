@@ -49,6 +49,9 @@ using ReplicationServicePtr = std::shared_ptr<ReplicationService>;
 class LocationService;
 using LocationServicePtr = std::shared_ptr<LocationService>;
 
+class GatheringPolicyService;
+using GatheringPolicyServicePtr = std::shared_ptr<GatheringPolicyService>;
+
 /**
  * @brief Coordinator RPC server responsible for receiving requests over GRPC interface
  */
@@ -62,6 +65,7 @@ class CoordinatorRPCServer final : public CoordinatorRPCService::Service {
      * @param queryCatalogService : the instance of monitoring service
      * @param monitoringService : the instance of monitoring service
      * @param replicationService : the instance of monitoring service
+     * @param gatheringPolicyService : the instance of the gathering policy service
      */
     explicit CoordinatorRPCServer(QueryServicePtr queryService,
                                   TopologyManagerServicePtr topologyManagerService,
@@ -69,7 +73,8 @@ class CoordinatorRPCServer final : public CoordinatorRPCService::Service {
                                   QueryCatalogServicePtr queryCatalogService,
                                   Monitoring::MonitoringManagerPtr monitoringManager,
                                   ReplicationServicePtr replicationService,
-                                  LocationServicePtr locationService);
+                                  LocationServicePtr locationService,
+                                  GatheringPolicyServicePtr gatheringPolicyService);
     /**
      * @brief RPC Call to register a node
      * @param context: the server context
@@ -234,6 +239,17 @@ class CoordinatorRPCServer final : public CoordinatorRPCService::Service {
                                    const ::SoftStopCompletionMessage* request,
                                    ::SoftStopCompletionReply* response) override;
 
+    /**
+     * @brief receives the gathering intervals that the adaptive sources of a worker chose since its last report
+     * @param context : the server context
+     * @param request : the id of the worker and the samples of its sources
+     * @param reply : true if the samples were stored
+     * @return success
+     */
+    Status ReportGatheringIntervals(ServerContext* context,
+                                    const GatheringIntervalReport* request,
+                                    GatheringIntervalReportReply* reply) override;
+
     /**
      * @brief inform the coordinator that a mobile devices reconnect prediction has changed
      * @param request : sent from worker to coordinator containing the id of the mobile device and a list of the old scheduled
@@ -266,6 +282,7 @@ class CoordinatorRPCServer final : public CoordinatorRPCService::Service {
     Monitoring::MonitoringManagerPtr monitoringManager;
     ReplicationServicePtr replicationService;
     LocationServicePtr locationService;
+    GatheringPolicyServicePtr gatheringPolicyService;
 };
 }// namespace x
 
@@ -0,0 +1,51 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#ifndef x_CORE_INCLUDE_GRPC_SERIALIZATION_GATHERINGPOLICYSERIALIZATIONUTIL_HPP_
+#define x_CORE_INCLUDE_GRPC_SERIALIZATION_GATHERINGPOLICYSERIALIZATIONUTIL_HPP_
+
+#include <string>
+
+class SerializableGatheringPolicy;
+
+namespace x {
+
+struct GatheringPolicy;
+
+/**
+ * @brief The GatheringPolicySerializationUtil offers functionality to serialize and de-serialize gathering policies to the
+ * corresponding protobuffer object. Fields that are not set in the policy are serialized as 0.
+ */
+class GatheringPolicySerializationUtil {
+  public:
+    /**
+     * @brief Serializes the gathering policy of a physical source
+     * @param physicalSourceName the name of the physical source the policy is set for
+     * @param policy the policy
+     * @param serializedPolicy The corresponding protobuff object, which is used to capture the state of the object.
+     */
+    static void serializeGatheringPolicy(const std::string& physicalSourceName,
+                                         const GatheringPolicy& policy,
+                                         SerializableGatheringPolicy* serializedPolicy);
+
+    /**
+     * @brief De-serializes a gathering policy, the physical source name is read from the protobuff object directly
+     * @param serializedPolicy the serialized policy
+     * @return the policy
+     */
+    static GatheringPolicy deserializeGatheringPolicy(const SerializableGatheringPolicy& serializedPolicy);
+};
+}// namespace x
+
+#endif// x_CORE_INCLUDE_GRPC_SERIALIZATION_GATHERINGPOLICYSERIALIZATIONUTIL_HPP_
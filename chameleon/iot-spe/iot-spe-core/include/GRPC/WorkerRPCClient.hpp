@@ -22,6 +22,7 @@
 #include <WorkerRPCService.grpc.pb.h>
 #include <WorkerRPCService.pb.h>
 #include <grpcpp/grpcpp.h>
+#include <optional>
 #include <string>
 #include <thread>
 
@@ -48,6 +49,8 @@ using MonitoringPlanPtr = std::shared_ptr<MonitoringPlan>;
 class QueryPlan;
 using QueryPlanPtr = std::shared_ptr<QueryPlan>;
 
+struct GatheringPolicy;
+
 using CompletionQueuePtr = std::shared_ptr<CompletionQueue>;
 
 namespace Spatial::DataTypes::Experimental {
@@ -213,6 +216,15 @@ class WorkerRPCClient {
      */
     bool injectEpochBarrier(uint64_t timestamp, uint64_t queryId, const std::string& address);
 
+    /**
+     * @brief method to set the adaptive gathering settings of physical sources on a worker
+     * @param address: ip address of the worker
+     * @param policies: the policy for each physical source name
+     * @return the number of sources on the worker that received a policy or an empty optional if the call failed
+     */
+    std::optional<uint64_t> setGatheringPolicy(const std::string& address,
+                                               const std::vector<std::pair<std::string, GatheringPolicy>>& policies);
+
     /**
      * @brief method to check the health of the worker
      * @param address: ip address of the source
@@ -63,6 +63,15 @@ class WorkerRPCServer final : public WorkerRPCService::Service {
 
     Status InjectEpochBarrier(ServerContext*, const EpochBarrierNotification* request, EpochBarrierReply* reply) override;
 
+    /**
+     * @brief sets the adaptive gathering settings of the sources that read from the physical sources in the request
+     * @param context
+     * @param request: one policy per physical source
+     * @param reply: the number of sources that received a policy
+     * @return success
+     */
+    Status SetGatheringPolicy(ServerContext*, const GatheringPolicyRequest* request, GatheringPolicyReply* reply) override;
+
     Status BeginBuffer(ServerContext* context, const BufferRequest* request, BufferReply* reply) override;
 
     Status UpdateNetworkSink(ServerContext*, const UpdateNetworkSinkRequest* request, UpdateNetworkSinkReply* reply) override;
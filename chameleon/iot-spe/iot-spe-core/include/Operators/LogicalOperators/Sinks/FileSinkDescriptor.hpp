@@ -17,6 +17,7 @@
 
 #include <Operators/LogicalOperators/Sinks/SinkDescriptor.hpp>
 #include <Util/FaultToleranceType.hpp>
+#include <Util/FileSinkWriteMode.hpp>
 #include <string>
 
 class SinkMedium;
@@ -35,6 +36,7 @@ class FileSinkDescriptor : public SinkDescriptor {
      * @param addTimestamp flat to indicate if timestamp shall be add when writing to file
      * @param faultToleranceType: fault tolerance type of a query
      * @param numberOfOrigins: number of origins of a given query
+     * @param writeMode: if workers write synchronously or hand their buffers to a group-committing writer thread
      * @return descriptor for file sink
      */
     static SinkDescriptorPtr create(std::string fileName,
@@ -42,7 +44,8 @@ class FileSinkDescriptor : public SinkDescriptor {
                                     const std::string& append,
                                     bool addTimestamp,
                                     FaultToleranceType faultToleranceType,
-                                    uint64_t numberOfOrigins);
+                                    uint64_t numberOfOrigins,
+                                    FileSinkWriteMode writeMode = FileSinkWriteMode::SYNCHRONOUS);
 
     /**
      * @brief Factory method to create a new file sink descriptor
@@ -90,16 +93,20 @@ class FileSinkDescriptor : public SinkDescriptor {
 
     bool getAppend() const;
 
+    FileSinkWriteMode getWriteMode() const;
+
   private:
     explicit FileSinkDescriptor(std::string fileName,
                                 std::string sinkFormat,
                                 bool append,
                                 bool addTimestamp,
                                 FaultToleranceType faultToleranceType,
-                                uint64_t numberOfOrigins);
+                                uint64_t numberOfOrigins,
+                                FileSinkWriteMode writeMode);
     std::string fileName;
     std::string sinkFormat;
     bool append;
+    FileSinkWriteMode writeMode;
 };
 
 using FileSinkDescriptorPtr = std::shared_ptr<FileSinkDescriptor>;
@@ -15,6 +15,8 @@
 #ifndef x_CORE_INCLUDE_OPERATORS_LOGICALOPERATORS_SINKS_KAFKASINKDESCRIPTOR_HPP_
 #define x_CORE_INCLUDE_OPERATORS_LOGICALOPERATORS_SINKS_KAFKASINKDESCRIPTOR_HPP_
 #include <Operators/LogicalOperators/Sinks/SinkDescriptor.hpp>
+#include <cstdint>
+#include <string>
 
 namespace x {
 
@@ -24,14 +26,31 @@ namespace x {
 class KafkaSinkDescriptor : public SinkDescriptor {
 
   public:
+    constexpr static uint64_t DEFAULT_MAX_IN_FLIGHT_MESSAGES = 1024;
+    constexpr static uint64_t DEFAULT_LINGER_TIME_IN_MS = 5;
+    constexpr static uint64_t DEFAULT_BATCH_SIZE_IN_BYTES = 1024 * 1024;
+
     /**
      * @brief Factory method to create a new Kafka sink.
      * @param topic kafka topic name
      * @param brokers kafka broker list
      * @param timeout Kafka producer timeout
+     * @param maxInFlightMessages number of messages the sink hands to the producer before it waits for their delivery
+     * @param lingerTimeInMs time the producer waits for further messages to batch them into one request
+     * @param batchSizeInBytes maximal size of the messages that are batched into one request
+     * @param faultToleranceType fault tolerance type of a query
+     * @param numberOfOrigins number of origins of a given query
      * @return descriptor for kafka sink
      */
-    static SinkDescriptorPtr create(std::string sinkFormat, std::string topic, std::string brokers, uint64_t timeout);
+    static SinkDescriptorPtr create(std::string sinkFormat,
+                                    std::string topic,
+                                    std::string brokers,
+                                    uint64_t timeout,
+                                    uint64_t maxInFlightMessages = DEFAULT_MAX_IN_FLIGHT_MESSAGES,
+                                    uint64_t lingerTimeInMs = DEFAULT_LINGER_TIME_IN_MS,
+                                    uint64_t batchSizeInBytes = DEFAULT_BATCH_SIZE_IN_BYTES,
+                                    FaultToleranceType faultToleranceType = FaultToleranceType::NONE,
+                                    uint64_t numberOfOrigins = 1);
 
     /**
      * @brief Get Kafka topic where data is to be written
@@ -48,16 +67,42 @@ class KafkaSinkDescriptor : public SinkDescriptor {
      */
     uint64_t getTimeout() const;
 
+    /**
+     * @brief Number of messages the sink hands to the producer before it waits for their delivery
+     */
+    uint64_t getMaxInFlightMessages() const;
+
+    /**
+     * @brief Time the producer waits for further messages to batch them into one request
+     */
+    uint64_t getLingerTimeInMs() const;
+
+    /**
+     * @brief Maximal size of the messages that are batched into one request
+     */
+    uint64_t getBatchSizeInBytes() const;
+
     std::string toString() const override;
     [[nodiscard]] bool equal(SinkDescriptorPtr const& other) override;
-    std::string getSinkFormatAsString();
+    std::string getSinkFormatAsString() const;
 
   private:
-    explicit KafkaSinkDescriptor(std::string sinkFormat, std::string topic, std::string brokers, uint64_t timeout);
+    explicit KafkaSinkDescriptor(std::string sinkFormat,
+                                 std::string topic,
+                                 std::string brokers,
+                                 uint64_t timeout,
+                                 uint64_t maxInFlightMessages,
+                                 uint64_t lingerTimeInMs,
+                                 uint64_t batchSizeInBytes,
+                                 FaultToleranceType faultToleranceType,
+                                 uint64_t numberOfOrigins);
     std::string sinkFormat;
     std::string topic;
     std::string brokers;
     uint64_t timeout;
+    uint64_t maxInFlightMessages;
+    uint64_t lingerTimeInMs;
+    uint64_t batchSizeInBytes;
 };
 
 typedef std::shared_ptr<KafkaSinkDescriptor> KafkaSinkDescriptorPtr;
@@ -44,6 +44,7 @@ class MQTTSinkDescriptor : public SinkDescriptor {
      * @param asynchronousClient: determine whether client is async- or synchronous
      * @param faultToleranceType: fault tolerance type of a query
      * @param numberOfOrigins: number of origins of a given query
+     * @param tuplesPerMessage: number of tuples that are packed into one message, one tuple per line
      * @return descriptor for MQTT sink
      */
     static SinkDescriptorPtr create(std::string&& address,
@@ -56,7 +57,8 @@ class MQTTSinkDescriptor : public SinkDescriptor {
                                     bool asynchronousClient,
                                     std::string&& clientId = "",
                                     FaultToleranceType faultToleranceType = FaultToleranceType::NONE,
-                                    uint64_t numberOfOrigins = 1);
+                                    uint64_t numberOfOrigins = 1,
+                                    uint64_t tuplesPerMessage = 1);
 
     /**
      * @brief get address information from a MQTT sink client
@@ -124,6 +126,12 @@ class MQTTSinkDescriptor : public SinkDescriptor {
      */
     uint64_t getNumberOfOrigins() const;
 
+    /**
+     * @brief get the number of tuples that are packed into one message
+     * @return number of tuples per message
+     */
+    uint64_t getTuplesPerMessage() const;
+
     [[nodiscard]] std::string toString() const override;
     [[nodiscard]] bool equal(SinkDescriptorPtr const& other) override;
 
@@ -140,6 +148,7 @@ class MQTTSinkDescriptor : public SinkDescriptor {
      * @param asynchronousClient: determine whether client is async- or synchronous
      * @param faultToleranceType: fault tolerance type of a query
      * @param numberOfOrigins: number of origins of a given query
+     * @param tuplesPerMessage: number of tuples that are packed into one message, one tuple per line
      * @return MQTT sink
      */
     explicit MQTTSinkDescriptor(std::string&& address,
@@ -152,7 +161,8 @@ class MQTTSinkDescriptor : public SinkDescriptor {
                                 ServiceQualities qualityOfService,
                                 bool asynchronousClient,
                                 FaultToleranceType faultToleranceType,
-                                uint64_t numberOfOrigins);
+                                uint64_t numberOfOrigins,
+                                uint64_t tuplesPerMessage = 1);
 
   private:
     std::string address;
@@ -164,6 +174,7 @@ class MQTTSinkDescriptor : public SinkDescriptor {
     uint64_t messageDelay;
     ServiceQualities qualityOfService;
     bool asynchronousClient;
+    uint64_t tuplesPerMessage;
 };
 
 using MQTTSinkDescriptorPtr = std::shared_ptr<MQTTSinkDescriptor>;
@@ -15,6 +15,7 @@
 #ifndef x_CORE_INCLUDE_OPERATORS_LOGICALOPERATORS_SOURCES_SENSESOURCEDESCRIPTOR_HPP_
 #define x_CORE_INCLUDE_OPERATORS_LOGICALOPERATORS_SOURCES_SENSESOURCEDESCRIPTOR_HPP_
 
+#include <Catalogs/Source/PhysicalSourceTypes/SenseSourceType.hpp>
 #include <Operators/LogicalOperators/Sources/SourceDescriptor.hpp>
 
 namespace x {
@@ -27,6 +28,12 @@ class SenseSourceDescriptor : public SourceDescriptor {
   public:
     static SourceDescriptorPtr create(SchemaPtr schema, std::string udfs);
     static SourceDescriptorPtr create(SchemaPtr schema, std::string sourceName, std::string udfs);
+    static SourceDescriptorPtr create(SchemaPtr schema, std::string sourceName, SenseSourceTypePtr senseSourceType);
+
+    /**
+     * @brief get the sensor bus and gathering configuration, nullptr if the descriptor only carries udfs
+     */
+    SenseSourceTypePtr getSourceConfig() const;
 
     /**
      * @brief Get the udf for the sense node
@@ -41,6 +48,7 @@ class SenseSourceDescriptor : public SourceDescriptor {
     explicit SenseSourceDescriptor(SchemaPtr schema, std::string sourceName, std::string udfs);
 
     std::string udfs;
+    SenseSourceTypePtr senseSourceType;
 };
 
 using SenseSourceDescriptorPtr = std::shared_ptr<SenseSourceDescriptor>;
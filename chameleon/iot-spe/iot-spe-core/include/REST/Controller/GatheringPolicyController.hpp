@@ -0,0 +1,239 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#ifndef x_CORE_INCLUDE_REST_CONTROLLER_GATHERINGPOLICYCONTROLLER_HPP_
+#define x_CORE_INCLUDE_REST_CONTROLLER_GATHERINGPOLICYCONTROLLER_HPP_
+
+#include <Exceptions/MapEntryNotFoundException.hpp>
+#include <REST/Controller/BaseRouterPrefix.hpp>
+#include <REST/Handlers/ErrorHandler.hpp>
+#include <Runtime/GatheringIntervalCollector.hpp>
+#include <Services/GatheringPolicyService.hpp>
+#include <Util/GatheringPolicy.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <nlohmann/json.hpp>
+#include <oatpp/core/macro/codegen.hpp>
+#include <oatpp/core/macro/component.hpp>
+#include <oatpp/web/server/api/ApiController.hpp>
+#include <chrono>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include OATPP_CODEGEN_BEGIN(ApiController)
+
+namespace x::REST::Controller {
+class GatheringPolicyController : public oatpp::web::server::api::ApiController {
+
+  public:
+    /**
+     * Constructor with object mapper.
+     * @param objectMapper - default object mapper used to serialize/deserialize DTOs.
+     * @param gatheringPolicyService - sends the policies to the workers and keeps their reported gathering intervals
+     * @param errorHandler - for sending error messages via DTO
+     * @param completeRouterPrefix - url consisting of base router prefix (e.g "v1/x/") and controller specific router prefix
+     */
+    GatheringPolicyController(const std::shared_ptr<ObjectMapper>& objectMapper,
+                              const GatheringPolicyServicePtr& gatheringPolicyService,
+                              const ErrorHandlerPtr& errorHandler,
+                              const oatpp::String& completeRouterPrefix)
+        : oatpp::web::server::api::ApiController(objectMapper, completeRouterPrefix),
+          gatheringPolicyService(gatheringPolicyService), errorHandler(errorHandler) {}
+
+    /**
+     * Create a shared object of the API controller
+     * @param objectMapper - default object mapper used to serialize/deserialize DTOs.
+     * @param gatheringPolicyService
+     * @param errorHandler - for sending error messages via DTO
+     * @param routerPrefixAddition - controller specific router prefix (e.g "gatheringPolicy/")
+     * @return GatheringPolicyController
+     */
+    static std::shared_ptr<GatheringPolicyController> create(const std::shared_ptr<ObjectMapper>& objectMapper,
+                                                             const GatheringPolicyServicePtr& gatheringPolicyService,
+                                                             const ErrorHandlerPtr& errorHandler,
+                                                             const std::string& routerPrefixAddition) {
+        oatpp::String completeRouterPrefix = BASE_ROUTER_PREFIX + routerPrefixAddition;
+        return std::make_shared<GatheringPolicyController>(objectMapper,
+                                                           gatheringPolicyService,
+                                                           errorHandler,
+                                                           completeRouterPrefix);
+    }
+
+    /**
+     * @brief sets a policy for all or some physical sources of a logical source. The body contains the logicalSourceName,
+     * optionally the physicalSourceNames, and at least one of gatheringInterval, gatheringIntervalRange, slowestInterval,
+     * fastestInterval (all in ms) and lambda.
+     */
+    ENDPOINT("POST", "/policy", setGatheringPolicy, BODY_STRING(String, request)) {
+        x_DEBUG("GatheringPolicyController: setGatheringPolicy: REST received request to set a gathering policy.");
+        try {
+            std::string req = request.getValue("{}");
+            if (!nlohmann::json::accept(req)) {
+                return errorHandler->handleError(Status::CODE_400, "Invalid JSON");
+            }
+            nlohmann::json reqJson = nlohmann::json::parse(req);
+            if (!reqJson.contains("logicalSourceName") || !reqJson["logicalSourceName"].is_string()) {
+                return errorHandler->handleError(Status::CODE_400, "Request body must contain 'logicalSourceName'");
+            }
+            std::string logicalSourceName = reqJson["logicalSourceName"];
+
+            GatheringPolicy policy;
+            if (auto error = parseGatheringPolicy(reqJson, policy)) {
+                return errorHandler->handleError(Status::CODE_400, error.value());
+            }
+
+            uint64_t numberOfUpdatedSources;
+            if (reqJson.contains("physicalSourceNames")) {
+                if (!reqJson["physicalSourceNames"].is_array() || reqJson["physicalSourceNames"].empty()) {
+                    return errorHandler->handleError(Status::CODE_400, "'physicalSourceNames' must be a non-empty array");
+                }
+                std::vector<std::string> physicalSourceNames;
+                for (const auto& physicalSourceName : reqJson["physicalSourceNames"]) {
+                    if (!physicalSourceName.is_string()) {
+                        return errorHandler->handleError(Status::CODE_400, "'physicalSourceNames' must contain strings");
+                    }
+                    physicalSourceNames.emplace_back(physicalSourceName.get<std::string>());
+                }
+                numberOfUpdatedSources =
+                    gatheringPolicyService->setGatheringPolicy(logicalSourceName, physicalSourceNames, policy);
+            } else {
+                numberOfUpdatedSources = gatheringPolicyService->setGatheringPolicy(logicalSourceName, policy);
+            }
+
+            nlohmann::json response;
+            response["success"] = true;
+            response["numberOfUpdatedSources"] = numberOfUpdatedSources;
+            return createResponse(Status::CODE_200, response.dump());
+        } catch (const MapEntryNotFoundException& e) {
+            return errorHandler->handleError(Status::CODE_404, "Resource Not Found: " + std::string(e.what()));
+        } catch (const std::exception& exc) {
+            x_ERROR("GatheringPolicyController: setGatheringPolicy: Exception occurred while setting a gathering policy {}",
+                    exc.what());
+            return errorHandler->handleError(Status::CODE_500, exc.what());
+        } catch (...) {
+            return errorHandler->handleError(Status::CODE_500, "GatheringPolicyController: unknown exception.");
+        }
+    }
+
+    /**
+     * @brief returns the merged policy that was set for all physical sources of a logical source
+     */
+    ENDPOINT("GET", "/policy", getGatheringPolicy, QUERY(String, logicalSourceName, "logicalSourceName")) {
+        try {
+            auto policy = gatheringPolicyService->getGatheringPolicy(logicalSourceName);
+            if (!policy) {
+                return errorHandler->handleError(Status::CODE_404,
+                                                 "Resource Not Found: No gathering policy set for " + logicalSourceName);
+            }
+            nlohmann::json response;
+            response["logicalSourceName"] = logicalSourceName.getValue("");
+            if (policy->gatheringInterval) {
+                response["gatheringInterval"] = policy->gatheringInterval->count();
+            }
+            if (policy->gatheringIntervalRange) {
+                response["gatheringIntervalRange"] = policy->gatheringIntervalRange->count();
+            }
+            if (policy->slowestInterval) {
+                response["slowestInterval"] = policy->slowestInterval->count();
+            }
+            if (policy->fastestInterval) {
+                response["fastestInterval"] = policy->fastestInterval->count();
+            }
+            if (policy->lambda) {
+                response["lambda"] = policy->lambda.value();
+            }
+            return createResponse(Status::CODE_200, response.dump());
+        } catch (...) {
+            return errorHandler->handleError(Status::CODE_500, "Internal Error");
+        }
+    }
+
+    /**
+     * @brief returns the latest gathering intervals that the workers reported for a physical source, oldest first
+     */
+    ENDPOINT("GET", "/intervals", getGatheringIntervals, QUERY(String, physicalSourceName, "physicalSourceName")) {
+        try {
+            nlohmann::json::array_t samples = {};
+            for (const auto& sample : gatheringPolicyService->getGatheringIntervalSamples(physicalSourceName)) {
+                samples.push_back(toJson(sample));
+            }
+            nlohmann::json response;
+            response["physicalSourceName"] = physicalSourceName.getValue("");
+            response["samples"] = samples;
+            return createResponse(Status::CODE_200, response.dump());
+        } catch (...) {
+            return errorHandler->handleError(Status::CODE_500, "Internal Error");
+        }
+    }
+
+  private:
+    /**
+     * @brief reads the fields of a policy from a request body
+     * @return an error message if a field is invalid or no field is set
+     */
+    static std::optional<std::string> parseGatheringPolicy(const nlohmann::json& reqJson, GatheringPolicy& policy) {
+        auto parseInterval = [&reqJson](const std::string& key,
+                                        std::optional<std::chrono::milliseconds>& interval) -> std::optional<std::string> {
+            if (!reqJson.contains(key)) {
+                return std::nullopt;
+            }
+            const auto& value = reqJson.at(key);
+            if (!value.is_number_unsigned() || value.get<uint64_t>() == 0) {
+                return "'" + key + "' must be a positive number of milliseconds";
+            }
+            interval = std::chrono::milliseconds(value.get<uint64_t>());
+            return std::nullopt;
+        };
+        for (auto error : {parseInterval("gatheringInterval", policy.gatheringInterval),
+                           parseInterval("gatheringIntervalRange", policy.gatheringIntervalRange),
+                           parseInterval("slowestInterval", policy.slowestInterval),
+                           parseInterval("fastestInterval", policy.fastestInterval)}) {
+            if (error) {
+                return error;
+            }
+        }
+        if (reqJson.contains("lambda")) {
+            const auto& lambda = reqJson.at("lambda");
+            if (!lambda.is_number() || lambda.get<float>() <= 0) {
+                return std::string("'lambda' must be a positive number");
+            }
+            policy.lambda = lambda.get<float>();
+        }
+        if (policy.fastestInterval && policy.slowestInterval && policy.fastestInterval > policy.slowestInterval) {
+            return std::string("'fastestInterval' must not be greater than 'slowestInterval'");
+        }
+        if (policy.empty()) {
+            return std::string("Request body must contain at least one setting of the gathering policy");
+        }
+        return std::nullopt;
+    }
+
+    static nlohmann::json toJson(const Runtime::GatheringIntervalSample& sample) {
+        nlohmann::json json;
+        json["operatorId"] = sample.operatorId;
+        json["timestamp"] = sample.timestampInMs;
+        json["gatheringInterval"] = sample.gatheringInterval.count();
+        json["estimationError"] = sample.estimationError;
+        return json;
+    }
+
+    GatheringPolicyServicePtr gatheringPolicyService;
+    ErrorHandlerPtr errorHandler;
+};
+}// namespace x::REST::Controller
+
+#include OATPP_CODEGEN_END(ApiController)
+
+#endif// x_CORE_INCLUDE_REST_CONTROLLER_GATHERINGPOLICYCONTROLLER_HPP_
@@ -51,6 +51,9 @@ using GlobalQueryPlanPtr = std::shared_ptr<GlobalQueryPlan>;
 class LocationService;
 using LocationServicePtr = std::shared_ptr<LocationService>;
 
+class GatheringPolicyService;
+using GatheringPolicyServicePtr = std::shared_ptr<GatheringPolicyService>;
+
 namespace Catalogs {
 
 namespace Source {
@@ -91,6 +94,7 @@ class RestServer {
                Catalogs::UDF::UDFCatalogPtr udfCatalog,
                Runtime::BufferManagerPtr bufferManager,
                LocationServicePtr locationServicePtr,
+               GatheringPolicyServicePtr gatheringPolicyService,
                std::optional<std::string> corsAllowedOrigin);
 
     /**
@@ -124,6 +128,7 @@ class RestServer {
     Catalogs::UDF::UDFCatalogPtr udfCatalog;
     LocationServicePtr locationService;
     MonitoringServicePtr monitoringService;
+    GatheringPolicyServicePtr gatheringPolicyService;
     Runtime::BufferManagerPtr bufferManager;
     std::condition_variable cvar;
     std::mutex mutex;
@@ -0,0 +1,129 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#ifndef x_CORE_INCLUDE_RUNTIME_FUSEDGATHERINGGROUP_HPP_
+#define x_CORE_INCLUDE_RUNTIME_FUSEDGATHERINGGROUP_HPP_
+
+#include <Util/KalmanFilter.hpp>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace x::Runtime {
+
+/**
+ * @brief Shares one multi-dimensional Kalman filter between a group of correlated sources, e.g., the axes of an
+ * accelerometer that are exposed as separate physical sources, and takes one gathering-interval decision for all of them.
+ *
+ * Every member owns a range of the observation vector, the ranges of active members are kept contiguous, so the filter
+ * always has the dimension of the active members. A member submits its latest values after each read;
+ * once all active members have submitted, the group runs one predict-and-update step over the fused observation
+ * and computes the next gathering interval. Submitting never blocks, a member that is ahead of the others gathers
+ * on the last decision until the group catches up. The slowest interval of the group is the smallest slowest
+ * (nyquist) interval reported by its members, so no member is sampled below its own rate.
+ */
+class FusedGatheringGroup {
+  public:
+    /**
+     * @brief Creates an empty group
+     * @param name the name of the group, i.e., the fusedGatheringGroup of the member sources
+     */
+    explicit FusedGatheringGroup(std::string name);
+
+    /**
+     * @brief Adds a member to the group. The filter is rebuilt with the new dimension on the next update.
+     * The ids of members that left are reused.
+     * @param numberOfValues the number of values the member submits per update
+     * @param gatheringInterval the configured gathering interval of the member
+     * @return the id of the member
+     */
+    uint64_t join(uint64_t numberOfValues, std::chrono::milliseconds gatheringInterval);
+
+    /**
+     * @brief Removes a member from the group, the group no longer waits for its values. The values of the member are
+     * removed from the observation vector and the filter is rebuilt with the smaller dimension on the next update.
+     * @param memberId
+     */
+    void leave(uint64_t memberId);
+
+    /**
+     * @brief Submits the latest values of a member and runs the group update if all active members submitted
+     * @param memberId
+     * @param values numberOfValues values as passed to join()
+     * @return the current gathering interval of the group
+     */
+    std::chrono::milliseconds submit(uint64_t memberId, const double* values);
+
+    /**
+     * @brief Reports the slowest (nyquist) interval that a member can be sampled at
+     * @param memberId
+     * @param slowestInterval
+     */
+    void setSlowestInterval(uint64_t memberId, std::chrono::milliseconds slowestInterval);
+
+    /**
+     * @return the current gathering interval of the group
+     */
+    [[nodiscard]] std::chrono::milliseconds getGatheringInterval() const;
+
+    /**
+     * @return the number of group updates, i.e., gathering-interval decisions
+     */
+    [[nodiscard]] uint64_t getNumberOfUpdates() const;
+
+    /**
+     * @return the number of active members
+     */
+    [[nodiscard]] uint64_t getNumberOfMembers() const;
+
+    /**
+     * @return the dimension of the fused observation vector
+     */
+    [[nodiscard]] uint64_t getMeasurementSize() const;
+
+    /**
+     * @brief returns the fused estimate of the values of one member
+     * @param memberId
+     * @return numberOfValues estimated values, zeros before the first update with the current members
+     */
+    [[nodiscard]] std::vector<double> getEstimate(uint64_t memberId) const;
+
+    [[nodiscard]] const std::string& getName() const;
+
+  private:
+    struct Member {
+        uint64_t offset;
+        uint64_t numberOfValues;
+        std::chrono::milliseconds slowestInterval{0};
+        bool active{true};
+        bool submitted{false};
+    };
+
+    /// runs the predict-and-update step if every active member submitted, requires mutex
+    void updateIfComplete();
+
+    const std::string name;
+    mutable std::mutex mutex;
+    std::vector<Member> members;
+    std::vector<double> observation;
+    std::unique_ptr<KalmanFilter> filter;
+    std::chrono::milliseconds gatheringInterval{0};
+    uint64_t numberOfUpdates{0};
+};
+
+}// namespace x::Runtime
+
+#endif// x_CORE_INCLUDE_RUNTIME_FUSEDGATHERINGGROUP_HPP_
@@ -0,0 +1,78 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#ifndef x_CORE_INCLUDE_RUNTIME_GATHERINGINTERVALCOLLECTOR_HPP_
+#define x_CORE_INCLUDE_RUNTIME_GATHERINGINTERVALCOLLECTOR_HPP_
+
+#include <Common/Identifiers.hpp>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace x::Runtime {
+
+/**
+ * @brief a gathering interval that an adaptive source chose
+ */
+struct GatheringIntervalSample {
+    std::string physicalSourceName;
+    OperatorId operatorId;
+    uint64_t timestampInMs;
+    std::chrono::milliseconds gatheringInterval;
+    double estimationError;
+};
+
+/**
+ * @brief Collects the gathering intervals that the adaptive sources of a node choose, until the worker
+ * reports them to the coordinator in one batch. The collector keeps at most capacity samples and drops
+ * the oldest ones, so a worker that cannot reach the coordinator does not grow without bounds.
+ */
+class GatheringIntervalCollector {
+  public:
+    /**
+     * @brief Creates an empty collector
+     * @param capacity the maximum number of samples between two drains
+     */
+    explicit GatheringIntervalCollector(uint64_t capacity = 4096);
+
+    /**
+     * @brief Adds a sample, called by the source threads
+     * @param sample
+     */
+    void record(GatheringIntervalSample sample);
+
+    /**
+     * @brief Removes and returns all collected samples, oldest first
+     * @return the samples
+     */
+    std::vector<GatheringIntervalSample> drain();
+
+    /**
+     * @return the number of samples dropped since the collector was created
+     */
+    [[nodiscard]] uint64_t getNumberOfDroppedSamples() const;
+
+  private:
+    const uint64_t capacity;
+    mutable std::mutex mutex;
+    std::deque<GatheringIntervalSample> samples;
+    uint64_t numberOfDroppedSamples{0};
+};
+
+}// namespace x::Runtime
+
+#endif// x_CORE_INCLUDE_RUNTIME_GATHERINGINTERVALCOLLECTOR_HPP_
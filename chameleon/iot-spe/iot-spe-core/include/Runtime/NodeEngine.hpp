@@ -46,6 +46,8 @@ using QueryPlanPtr = std::shared_ptr<QueryPlan>;
 class PhysicalSource;
 using PhysicalSourcePtr = std::shared_ptr<PhysicalSource>;
 
+struct GatheringPolicy;
+
 namespace Monitoring {
 class AbstractMetricStore;
 using MetricStorePtr = std::shared_ptr<AbstractMetricStore>;
@@ -239,6 +241,14 @@ class NodeEngine : public Network::ExchangeProtocolListener,
      */
     void injectEpochBarrier(uint64_t timestamp, uint64_t queryId) const;
 
+    /**
+     * @brief method to set the adaptive gathering settings of all deployed sources that read from a physical source
+     * @param physicalSourceName: the name of the physical source
+     * @param policy: the settings to change
+     * @return the number of sources that received the policy
+     */
+    uint64_t setGatheringPolicy(const std::string& physicalSourceName, const GatheringPolicy& policy) const;
+
     /**
     * @brief method to return the query statistics
     * @param id of the query
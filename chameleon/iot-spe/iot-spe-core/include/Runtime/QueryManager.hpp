@@ -43,6 +43,7 @@
 #include <thread>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 
 #ifdef ENABLE_PAPI_PROFILER
 #include <Runtime/Profiler/PAPIProfiler.hpp>
@@ -221,6 +222,46 @@ class AbstractQueryManager : public x::detail::virtual_enable_shared_from_this<A
      */
     BufferManagerPtr getBufferManager() { return *bufferManagers.begin(); }
 
+    /**
+     * @brief sets the executor that drives data sources instead of one thread per source
+     * @param sourceExecutor the executor or nullptr to use one thread per source
+     */
+    void setSourceExecutor(SourceExecutorPtr sourceExecutor);
+
+    /**
+     * @return the executor that drives data sources or nullptr if every source runs its own thread
+     */
+    SourceExecutorPtr getSourceExecutor() const;
+
+    /**
+     * @brief adds a source to the group of sources that share one Kalman filter in the fused adaptive mode
+     * @param name the name of the group, the group is created on first use
+     * @param numberOfValues the number of values the source submits per update
+     * @param gatheringInterval the configured gathering interval of the source
+     * @return the group and the member id of the source
+     */
+    std::pair<FusedGatheringGroupPtr, uint64_t>
+    joinFusedGatheringGroup(const std::string& name, uint64_t numberOfValues, std::chrono::milliseconds gatheringInterval);
+
+    /**
+     * @brief removes a source from its fused gathering group, the group is dropped when its last member left
+     * @param group the group returned by joinFusedGatheringGroup
+     * @param memberId the member id returned by joinFusedGatheringGroup
+     */
+    void leaveFusedGatheringGroup(const FusedGatheringGroupPtr& group, uint64_t memberId);
+
+    /**
+     * @param name the name of the group
+     * @return the group or nullptr if no source is a member of it
+     */
+    FusedGatheringGroupPtr getFusedGatheringGroup(const std::string& name);
+
+    /**
+     * @brief returns the collector of the gathering intervals that the adaptive sources of this node chose
+     * @return the collector
+     */
+    GatheringIntervalCollector& getGatheringIntervalCollector();
+
   private:
     /**
      * @brief this methods adds a reconfiguration task on the worker queue
@@ -428,6 +469,16 @@ class AbstractQueryManager : public x::detail::virtual_enable_shared_from_this<A
     /// worker thread for async maintenance task, e.g., fail queryIdAndCatalogEntryMapping
     AsyncTaskExecutorPtr asyncTaskExecutor;
 
+    /// event loop and threads that drive data sources, nullptr if every source runs its own thread
+    SourceExecutorPtr sourceExecutor{nullptr};
+
+    /// groups of sources in the fused adaptive mode, by name
+    std::mutex fusedGatheringGroupsMutex;
+    std::unordered_map<std::string, FusedGatheringGroupPtr> fusedGatheringGroups;
+
+    /// gathering intervals of adaptive sources that are not yet reported to the coordinator
+    std::unique_ptr<GatheringIntervalCollector> gatheringIntervalCollector;
+
     std::unordered_map<QuerySubPlanId, Execution::ExecutableQueryPlanPtr> runningQEPs;
 
     //TODO:check if it would be better to put it in the thread context
@@ -92,6 +92,14 @@ using NodeEnginePtr = std::shared_ptr<NodeEngine>;
 class AbstractQueryManager;
 using QueryManagerPtr = std::shared_ptr<AbstractQueryManager>;
 
+class SourceExecutor;
+using SourceExecutorPtr = std::shared_ptr<SourceExecutor>;
+
+class FusedGatheringGroup;
+using FusedGatheringGroupPtr = std::shared_ptr<FusedGatheringGroup>;
+
+class GatheringIntervalCollector;
+
 class StateManager;
 using StateManagerPtr = std::shared_ptr<StateManager>;
 
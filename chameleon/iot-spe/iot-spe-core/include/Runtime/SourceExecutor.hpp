@@ -0,0 +1,140 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#ifndef x_CORE_INCLUDE_RUNTIME_SOURCEEXECUTOR_HPP_
+#define x_CORE_INCLUDE_RUNTIME_SOURCEEXECUTOR_HPP_
+
+#include <Runtime/RuntimeForwardRefs.hpp>
+#include <Util/TimerWheel.hpp>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace x::Runtime {
+
+/**
+ * @brief Drives many data sources from a small, fixed number of threads, instead of one thread per source.
+ *
+ * Sources are scheduled one iteration at a time, see DataSource::runningRoutineIteration():
+ *  - a source without a readiness file descriptor is queued again behind the other ready sources, as a dedicated
+ *    source thread loops without sleeping on the gathering interval. Delays that an iteration returns are kept in
+ *    a hashed timer wheel with a resolution of one tick,
+ *  - a source that exposes a readiness file descriptor is registered in an epoll set and runs its next iteration
+ *    as soon as the descriptor becomes readable.
+ * One event loop thread owns the timer wheel and waits on epoll, numberOfThreads worker threads run the iterations.
+ * A source is never processed by two threads at the same time, so receiveData() and emitWorkFromSource()
+ * keep the same single-threaded contract as in the dedicated source thread.
+ */
+class SourceExecutor {
+  public:
+    /**
+     * @brief Creates a SourceExecutor and starts its threads
+     * @param numberOfThreads the number of worker threads that run source iterations
+     * @param tickDuration the resolution of the timer wheel
+     * @param numberOfSlots the number of slots of the timer wheel
+     */
+    explicit SourceExecutor(uint32_t numberOfThreads,
+                            std::chrono::milliseconds tickDuration = std::chrono::milliseconds(1),
+                            uint64_t numberOfSlots = 1024);
+
+    SourceExecutor(const SourceExecutor&) = delete;
+    SourceExecutor& operator=(const SourceExecutor&) = delete;
+
+    /// destructor to clean up inner resources
+    ~SourceExecutor();
+
+    /**
+     * @brief Stops all threads. Sources that are still registered are not completed.
+     * Only the first invocation has an effect.
+     * @return true if the executor was running
+     */
+    bool destroy();
+
+    /**
+     * @brief Registers a source, its first iteration runs as soon as a worker thread is free
+     * @param source the source to drive, has to be started already
+     */
+    void registerSource(const DataSourcePtr& source);
+
+    /**
+     * @brief Runs the next iteration of a registered source as soon as possible, regardless of its
+     * pending delay or readiness, e.g., to let it observe a stop request
+     * @param source the source to wake up
+     */
+    void wakeUp(const DataSource* source);
+
+    /**
+     * @return the number of registered sources
+     */
+    [[nodiscard]] uint64_t getNumberOfSources() const;
+
+  private:
+    enum class SourceState : uint8_t { Ready, Running, WaitingForTimer, WaitingForData };
+
+    /**
+     * @brief scheduling state of a registered source, protected by scheduleMutex
+     */
+    struct ScheduledSource {
+        DataSourcePtr source;
+        uint64_t id;
+        int readinessFileDescriptor;
+        SourceState state{SourceState::Ready};
+        uint64_t timerGeneration{0};// timers of older generations are outdated
+        bool wakeUpPending{false};
+    };
+
+    struct TimerEntry {
+        uint64_t id;
+        uint64_t generation;
+    };
+
+    /// the event loop that advances the timer wheel and waits for readiness
+    void eventLoop();
+
+    /// the worker routine that runs source iterations
+    void workerRoutine();
+
+    /// puts a source into the ready queue, requires scheduleMutex
+    void makeReady(ScheduledSource& scheduledSource);
+
+    /// interrupts epoll_wait of the event loop
+    void notifyEventLoop();
+
+    std::chrono::milliseconds tickDuration;
+    std::atomic<bool> running{true};
+
+    int epollFileDescriptor{-1};
+    int eventFileDescriptor{-1};
+
+    mutable std::mutex scheduleMutex;
+    std::condition_variable readyCondition;
+    std::deque<uint64_t> readyQueue;
+    std::unordered_map<uint64_t, std::unique_ptr<ScheduledSource>> sources;
+    std::unordered_map<const DataSource*, uint64_t> sourceToId;
+    Util::TimerWheel<TimerEntry> timerWheel;
+    uint64_t nextSourceId{1};
+
+    std::vector<std::shared_ptr<std::promise<bool>>> completionPromises;
+};
+
+}// namespace x::Runtime
+
+#endif// x_CORE_INCLUDE_RUNTIME_SOURCEEXECUTOR_HPP_
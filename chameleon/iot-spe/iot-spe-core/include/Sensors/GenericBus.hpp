@@ -15,6 +15,8 @@
 #ifndef x_CORE_INCLUDE_SENSORS_GENERICBUS_HPP_
 #define x_CORE_INCLUDE_SENSORS_GENERICBUS_HPP_
 
+#include <atomic>
+#include <chrono>
 #include <memory>
 #include <string>
 
@@ -24,7 +26,7 @@ namespace Sensors {
 /**
  * @brief types of sensor buses we suppprt
  */
-enum class BusType : int8_t { I2C, SPI, UART };
+enum class BusType : int8_t { I2C, SPI, UART, SIMULATED };
 
 /**
  * @brief Utility class for performing I/O on top of known sensor buses.
@@ -68,6 +70,31 @@ class GenericBus {
      */
     bool read(int address, int size, unsigned char* buffer);
 
+    /**
+     * @brief waits for the next slot of the polling schedule and reads from the bus
+     * @param address, the address to read from
+     * @param size, the size of data we want to read
+     * @param buffer, the data container
+     * @return the result of `readdata`
+     */
+    bool poll(int address, int size, unsigned char* buffer);
+
+    /**
+     * @brief sets the interval between two polls, applies from the next poll on
+     * @param pollingInterval, the new interval
+     */
+    void setPollingInterval(std::chrono::milliseconds pollingInterval);
+
+    /**
+     * @return the interval between two polls
+     */
+    std::chrono::milliseconds getPollingInterval() const;
+
+    /**
+     * @return the number of read transactions on the bus
+     */
+    uint64_t getNumberOfReads() const;
+
     /**
      * @brief return the necessary type of bus
      * @return BusType
@@ -90,6 +117,15 @@ class GenericBus {
      */
     BusType busType;
 
+    /**
+     * @brief waits until the polling interval passed since the last poll, a simulated bus advances its clock instead
+     */
+    virtual void waitForNextPoll();
+
+    std::atomic<int64_t> pollingIntervalInMs{0};
+    std::chrono::steady_clock::time_point lastPoll{};
+    std::atomic<uint64_t> numberOfReads{0};
+
   private:
     /**
      * Initialize the file and check if the address behind the file exists
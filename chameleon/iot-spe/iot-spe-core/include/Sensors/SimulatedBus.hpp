@@ -0,0 +1,100 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#ifndef x_CORE_INCLUDE_SENSORS_SIMULATEDBUS_HPP_
+#define x_CORE_INCLUDE_SENSORS_SIMULATEDBUS_HPP_
+
+#include <Sensors/GenericBus.hpp>
+#include <chrono>
+#include <vector>
+
+namespace x {
+namespace Sensors {
+
+/**
+ * @brief A sensor bus that replays a recording instead of talking to a device.
+ *
+ * The file holds fixed-size binary samples that the sensor produced every sampleInterval, e.g.,
+ * the register block of an accelerometer dumped at its highest rate. The bus keeps a simulated
+ * clock: every poll advances it by the polling interval, so a slower polling schedule skips
+ * samples and needs fewer read transactions for the same recording, without sleeping.
+ * A read copies bytes of the current sample starting at the register address.
+ */
+class SimulatedBus : public GenericBus {
+  public:
+    /**
+     * @brief constructor of a simulated bus
+     * @param filename, the path of the recording
+     * @param sampleSize, the size of one sample in bytes
+     * @param sampleInterval, the interval between two samples of the recording
+     */
+    SimulatedBus(const char* filename, uint64_t sampleSize, std::chrono::milliseconds sampleInterval);
+
+    /**
+     * destructor
+     */
+    ~SimulatedBus() override;
+
+    /**
+     * @return the number of samples in the recording
+     */
+    uint64_t getNumberOfSamples() const;
+
+    /**
+     * @return the simulated time since the start of the recording, i.e., the sum of the polling intervals
+     */
+    std::chrono::milliseconds getSimulatedTime() const;
+
+  private:
+    /**
+     * @brief overrides the initBus method, loads the recording
+     * @return true if the recording holds at least one sample
+     */
+    bool initBus(int address) override;
+
+    /**
+     * @brief overrides the writeData method, overwrites bytes of the current sample
+     * @return true if the bytes are within the current sample
+     */
+    bool writeData(int address, int size, unsigned char* buffer) override;
+
+    /**
+     * @brief overrides the readData method, copies bytes of the current sample
+     * @return true if the bytes are within the current sample
+     */
+    bool readData(int address, int size, unsigned char* buffer) override;
+
+    /**
+     * @brief advances the simulated clock by the polling interval
+     */
+    void waitForNextPoll() override;
+
+    /**
+     * @brief checks that [address, address + size) lies within the current sample
+     */
+    bool isValidRange(int address, int size) const;
+
+    uint64_t sampleSize;
+    std::chrono::milliseconds sampleInterval;
+    std::vector<unsigned char> samples;
+    std::chrono::milliseconds simulatedTime{0};
+    uint64_t currentSample{0};
+    bool polled{false};
+};
+
+using SimulatedBusPtr = std::shared_ptr<SimulatedBus>;
+
+}//namespace Sensors
+}//namespace x
+#endif// x_CORE_INCLUDE_SENSORS_SIMULATEDBUS_HPP_
@@ -0,0 +1,127 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#ifndef x_CORE_INCLUDE_SERVICES_GATHERINGPOLICYSERVICE_HPP_
+#define x_CORE_INCLUDE_SERVICES_GATHERINGPOLICYSERVICE_HPP_
+
+#include <Runtime/GatheringIntervalCollector.hpp>
+#include <Util/GatheringPolicy.hpp>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace x {
+
+class WorkerRPCClient;
+using WorkerRPCClientPtr = std::shared_ptr<WorkerRPCClient>;
+
+namespace Catalogs::Source {
+class SourceCatalog;
+using SourceCatalogPtr = std::shared_ptr<SourceCatalog>;
+}// namespace Catalogs::Source
+
+/**
+ * @brief: This class is located at the coordinator side and controls the adaptive gathering of the sources in the fleet.
+ * A group of sources is a logical source: a policy set for a logical source is sent to the workers of all its physical
+ * sources, which apply it to the Kalman filters of the running sources without redeploying queries.
+ * The service also keeps the gathering intervals that the workers report, a bounded history per physical source.
+ */
+class GatheringPolicyService {
+  public:
+    /**
+     * @brief Creates the service
+     * @param sourceCatalog the catalog that maps logical sources to physical sources and their workers
+     * @param numberOfSamplesPerSource the number of reported gathering intervals kept per physical source
+     */
+    explicit GatheringPolicyService(Catalogs::Source::SourceCatalogPtr sourceCatalog, uint64_t numberOfSamplesPerSource = 128);
+
+    /**
+     * @brief sets a policy for all physical sources of a logical source
+     * @param logicalSourceName the group of sources
+     * @param policy the settings to change
+     * @return the number of running sources on the workers that received the policy
+     * @throws MapEntryNotFoundException if the logical source has no physical sources
+     */
+    uint64_t setGatheringPolicy(const std::string& logicalSourceName, const GatheringPolicy& policy);
+
+    /**
+     * @brief sets a policy for some physical sources of a logical source
+     * @param logicalSourceName the logical source of the physical sources
+     * @param physicalSourceNames the physical sources that receive the policy
+     * @param policy the settings to change
+     * @return the number of running sources on the workers that received the policy
+     * @throws MapEntryNotFoundException if the logical source has no physical sources
+     */
+    uint64_t setGatheringPolicy(const std::string& logicalSourceName,
+                                const std::vector<std::string>& physicalSourceNames,
+                                const GatheringPolicy& policy);
+
+    /**
+     * @brief returns the merged policies that were set for all physical sources of a logical source
+     * @param logicalSourceName
+     * @return the policy or an empty optional if none was set
+     */
+    std::optional<GatheringPolicy> getGatheringPolicy(const std::string& logicalSourceName) const;
+
+    /**
+     * @brief stores the gathering intervals reported by a worker
+     * @param workerId the id of the reporting worker
+     * @param samples the reported samples, oldest first
+     */
+    void addGatheringIntervalSamples(uint64_t workerId, std::vector<Runtime::GatheringIntervalSample> samples);
+
+    /**
+     * @brief returns the latest reported gathering intervals of a physical source
+     * @param physicalSourceName
+     * @return the samples, oldest first
+     */
+    std::vector<Runtime::GatheringIntervalSample> getGatheringIntervalSamples(const std::string& physicalSourceName) const;
+
+    /**
+     * @brief returns the latest reported gathering interval of every physical source
+     * @return the sample per physical source name
+     */
+    std::map<std::string, Runtime::GatheringIntervalSample> getLatestGatheringIntervals() const;
+
+  private:
+    /**
+     * @brief sends a policy to the workers of the physical sources of a logical source
+     * @param logicalSourceName
+     * @param filter the physical sources to send the policy to, all if empty
+     * @param policy
+     * @return the number of running sources on the workers that received the policy
+     */
+    uint64_t sendGatheringPolicy(const std::string& logicalSourceName,
+                                 const std::vector<std::string>& filter,
+                                 const GatheringPolicy& policy);
+
+    Catalogs::Source::SourceCatalogPtr sourceCatalog;
+    WorkerRPCClientPtr workerRpcClient;
+    const uint64_t numberOfSamplesPerSource;
+
+    mutable std::mutex policyMutex;
+    std::unordered_map<std::string, GatheringPolicy> logicalSourceToPolicy;
+
+    mutable std::mutex sampleMutex;
+    std::unordered_map<std::string, std::deque<Runtime::GatheringIntervalSample>> physicalSourceToSamples;
+};
+using GatheringPolicyServicePtr = std::shared_ptr<GatheringPolicyService>;
+}// namespace x
+
+#endif// x_CORE_INCLUDE_SERVICES_GATHERINGPOLICYSERVICE_HPP_
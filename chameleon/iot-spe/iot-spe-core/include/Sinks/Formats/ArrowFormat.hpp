@@ -57,12 +57,32 @@ class ArrowFormat : public SinkFormat {
     std::shared_ptr<arrow::Schema> getArrowSchema();
 
     /**
-    * @brief method to get the arrow arrays from tuple buffer
+    * @brief method to get the arrow arrays from tuple buffer, requires that no record batch is pending
     * @param a reference to input TupleBuffer
     * @return a vector of Arrow Arrays
     */
     std::vector<std::shared_ptr<arrow::Array>> getArrowArrays(Runtime::TupleBuffer& inputBuffer);
 
+    /**
+    * @brief method to append the tuples of a tuple buffer to the record batch that is built across tuple buffers.
+    * Numeric columns of the column layout are copied at once, all other columns value by value.
+    * @param a reference to input TupleBuffer
+    * @throws RuntimeException if a field cannot be converted
+    */
+    void appendToRecordBatch(Runtime::TupleBuffer& inputBuffer);
+
+    /**
+    * @brief method to get the number of tuples appended since the last record batch was finished
+    * @return number of pending tuples
+    */
+    uint64_t getNumberOfPendingTuples() const;
+
+    /**
+    * @brief method to finish the record batch of all tuples appended since the last record batch was finished
+    * @return the record batch, which may be empty
+    */
+    std::shared_ptr<arrow::RecordBatch> finishRecordBatch();
+
     /**
      * @brief method to return the format as a string
      * @return format as string
@@ -77,10 +97,19 @@ class ArrowFormat : public SinkFormat {
 
   private:
     /**
-    * @brief method that creates arrow arrays based on the schema
-    * @return a vector of empty arrow arrays
+    * @brief method that creates one arrow builder per field of the schema, if they do not exist yet
     */
-    std::vector<std::shared_ptr<arrow::Array>> buildArrowArrays();
+    void initializeArrayBuilders();
+
+    /**
+    * @brief method that appends one field of all tuples of a tuple buffer to its arrow builder
+    */
+    arrow::Status appendColumn(Runtime::TupleBuffer& inputBuffer, uint64_t fieldIndex, uint64_t numberOfTuples);
+
+    std::shared_ptr<arrow::Schema> arrowSchema;
+    std::vector<std::unique_ptr<arrow::ArrayBuilder>> arrayBuilders;
+    Runtime::MemoryLayouts::MemoryLayoutPtr memoryLayout;
+    uint64_t numberOfPendingTuples{0};
 };
 }// namespace x
 #endif// ENABLE_ARROW_BUILD
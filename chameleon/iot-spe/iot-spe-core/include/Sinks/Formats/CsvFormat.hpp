@@ -43,6 +43,13 @@ class CsvFormat : public SinkFormat {
      */
     std::string getFormattedBuffer(Runtime::TupleBuffer& inputBuffer) override;
 
+    /**
+    * @brief method to format a TupleBuffer into a reusable output, one line per tuple
+    * @param inputBuffer a tuple buffer
+    * @param output the formatted content of the TupleBuffer is appended, contains timestamp if specified
+     */
+    void appendFormattedBuffer(Runtime::TupleBuffer& inputBuffer, std::string& output) override;
+
     /**
     * @brief method to write a TupleBuffer
     * @param a tuple buffers pointer
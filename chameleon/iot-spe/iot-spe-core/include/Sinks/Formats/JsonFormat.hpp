@@ -24,17 +24,24 @@ class JsonFormat : public SinkFormat {
 
     /**
      * @brief Returns the schema of formatted according to the specific SinkFormat represented as string.
-     * @return The formatted schema as string
+     * @return an empty string, JSON lines have no header
      */
     std::string getFormattedSchema() override;
 
     /**
-    * @brief method to write a TupleBuffer
+    * @brief method to format a TupleBuffer as JSON lines, i.e., one JSON object per tuple and line
     * @param a tuple buffers pointer
-    * @return vector of Tuple buffer containing the content of the tuplebuffer
+    * @return formatted content of TupleBuffer
      */
     std::string getFormattedBuffer(Runtime::TupleBuffer& inputBuffer) override;
 
+    /**
+    * @brief method to format a TupleBuffer as JSON lines into a reusable output
+    * @param inputBuffer a tuple buffer
+    * @param output the formatted content of the TupleBuffer is appended
+     */
+    void appendFormattedBuffer(Runtime::TupleBuffer& inputBuffer, std::string& output) override;
+
     //TODO implement this function with an SinkFormatIterator
     /**
     * @brief method to write a TupleBuffer
@@ -17,6 +17,7 @@
 #include <Runtime/RuntimeForwardRefs.hpp>
 #include <Runtime/TupleBuffer.hpp>
 #include <Sinks/Formats/FormatIterators/FormatIterator.hpp>
+#include <Sinks/Formats/TupleBufferFormatter.hpp>
 #include <fstream>
 #include <optional>
 /**
@@ -56,6 +57,13 @@ class SinkFormat {
      */
     virtual std::string getFormattedBuffer(Runtime::TupleBuffer& inputBuffer) = 0;
 
+    /**
+    * @brief method to format a TupleBuffer into a reusable output
+    * @param inputBuffer a tuple buffer
+    * @param output the formatted content of the TupleBuffer is appended, the output is not cleared
+     */
+    virtual void appendFormattedBuffer(Runtime::TupleBuffer& inputBuffer, std::string& output);
+
     /**
     * @brief depending on the SinkFormat type, returns an iterator that can be used to retrieve tuples from the TupleBuffer
     * @param a tuple buffer pointer
@@ -81,9 +89,19 @@ class SinkFormat {
     void setAddTimestamp(bool addTimestamp);
 
   protected:
+    /**
+     * @brief returns the formatter for buffers of the size of the input buffer, it is created once and shared by all threads
+     * @param inputBuffer a tuple buffer
+     * @return the formatter for the schema of this sink format
+     */
+    TupleBufferFormatterPtr getTupleBufferFormatter(const Runtime::TupleBuffer& inputBuffer);
+
     SchemaPtr schema;
     Runtime::BufferManagerPtr bufferManager;
     bool addTimestamp;
+
+  private:
+    TupleBufferFormatterPtr tupleBufferFormatter;
 };
 
 using SinkFormatPtr = std::shared_ptr<SinkFormat>;
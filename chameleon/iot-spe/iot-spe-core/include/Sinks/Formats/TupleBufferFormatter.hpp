@@ -0,0 +1,93 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#ifndef x_CORE_INCLUDE_SINKS_FORMATS_TUPLEBUFFERFORMATTER_HPP_
+#define x_CORE_INCLUDE_SINKS_FORMATS_TUPLEBUFFERFORMATTER_HPP_
+
+#include <Common/PhysicalTypes/BasicPhysicalType.hpp>
+#include <Runtime/RuntimeForwardRefs.hpp>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace x {
+
+/**
+ * @brief Formats all tuples of a tuple buffer as CSV lines or as JSON objects, one per line.
+ * Field types, first offsets, strides, and JSON keys are resolved once against the memory layout, so that formatting
+ * a buffer only appends to the output with std::to_chars and never allocates per tuple or per value.
+ * Numbers are written as by std::to_string, so the CSV output equals the output of Util::printTupleBufferAsCSV.
+ * The formatter is immutable after construction and can be used by several threads at the same time.
+ */
+class TupleBufferFormatter {
+  public:
+    /**
+     * @brief Creates a formatter for buffers of the given memory layout
+     * @param memoryLayout the row or column layout of the buffers that are formatted
+     */
+    explicit TupleBufferFormatter(const Runtime::MemoryLayouts::MemoryLayoutPtr& memoryLayout);
+
+    /**
+     * @brief Appends one CSV line per tuple to the output, fields are separated by ","
+     * @param buffer the tuple buffer, TEXT fields are read from its child buffers
+     * @param output the output, is not cleared
+     * @param timestamp if set, is appended as the last value of every line
+     */
+    void appendCsv(Runtime::TupleBuffer& buffer, std::string& output, std::optional<uint64_t> timestamp = std::nullopt) const;
+
+    /**
+     * @brief Appends one JSON object per tuple to the output, each terminated by a new line
+     * @param buffer the tuple buffer, TEXT fields are read from its child buffers
+     * @param output the output, is not cleared
+     * @param timestamp if set, is appended as the value of the key "timestamp" of every object
+     */
+    void appendJson(Runtime::TupleBuffer& buffer, std::string& output, std::optional<uint64_t> timestamp = std::nullopt) const;
+
+    /**
+     * @return the size of the buffers this formatter was created for
+     */
+    [[nodiscard]] uint64_t getBufferSize() const;
+
+  private:
+    struct Field {
+        BasicPhysicalType::NativeType nativeType;
+        uint64_t offset;
+        uint64_t stride;
+        PhysicalTypePtr physicalType;// only used for types that are not basic types, e.g., arrays
+        std::string jsonKey;         // the quoted and escaped field name followed by ":"
+    };
+
+    /// appends one value in its CSV representation
+    static void appendCsvValue(const Field& field, const uint8_t* value, Runtime::TupleBuffer& buffer, std::string& output);
+
+    /// appends one value in its JSON representation
+    static void appendJsonValue(const Field& field, const uint8_t* value, Runtime::TupleBuffer& buffer, std::string& output);
+
+    /// appends the string as quoted JSON string and escapes quotes, backslashes, and control characters
+    static void appendJsonString(std::string_view value, std::string& output);
+
+    /// reads the TEXT value whose child buffer key is stored at value
+    static std::string_view readText(const uint8_t* value, Runtime::TupleBuffer& buffer);
+
+    std::vector<Field> fields;
+    uint64_t bufferSize;
+    uint64_t estimatedCsvTupleSize;
+};
+
+using TupleBufferFormatterPtr = std::shared_ptr<const TupleBufferFormatter>;
+
+}// namespace x
+
+#endif// x_CORE_INCLUDE_SINKS_FORMATS_TUPLEBUFFERFORMATTER_HPP_
@@ -17,10 +17,12 @@
 
 #include <Sinks/Mediums/SinkMedium.hpp>
 #include <Util/FaultToleranceType.hpp>
+#include <Util/FileSinkWriteMode.hpp>
 
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 #ifdef ENABLE_ARROW_BUILD
 #include <arrow/api.h>
@@ -29,6 +31,9 @@
 #endif
 
 namespace x {
+namespace Util {
+class GroupCommitFileWriter;
+}
 
 /**
  * @brief this class implements the File sing
@@ -43,6 +48,7 @@ class FileSink : public SinkMedium {
      * @param modus of writting (overwrite or append)
      * @param faultToleranceType: fault tolerance type of a query
      * @param numberOfOrigins: number of origins of a given query
+     * @param writeMode: if workers write synchronously or hand their buffers to a group-committing writer thread
      */
     explicit FileSink(SinkFormatPtr format,
                       Runtime::NodeEnginePtr nodeEngine,
@@ -52,7 +58,8 @@ class FileSink : public SinkMedium {
                       QueryId queryId,
                       QuerySubPlanId querySubPlanId,
                       FaultToleranceType faultToleranceType = FaultToleranceType::NONE,
-                      uint64_t numberOfOrigins = 1);
+                      uint64_t numberOfOrigins = 1,
+                      FileSinkWriteMode writeMode = FileSinkWriteMode::SYNCHRONOUS);
 
     /**
      * @brief dtor
@@ -67,12 +74,13 @@ class FileSink : public SinkMedium {
 
     /**
      * @brief method to override virtual shutdown function
-     * @Note currently the method does nothing
+     * @Note in the group commit modes, it writes all pending buffers and stops the writer thread
      */
     void shutdown() override;
 
     /**
-     * @brief method to write a TupleBuffer
+     * @brief method to write a TupleBuffer. In the group commit write modes, workers format their buffers in parallel
+     * and the writer orders the writes, the other modes acquire the writeMutex.
      * @param a tuple buffers pointer
      * @return bool indicating if the write was complete
      */
@@ -107,6 +115,12 @@ class FileSink : public SinkMedium {
      */
     std::string getAppendAsString() const;
 
+    /**
+     * @brief method to return the write mode of the sink
+     * @return write mode
+     */
+    FileSinkWriteMode getWriteMode() const;
+
   private:
     /**
      * @brief method to write a TupleBuffer to a local file system file
@@ -115,29 +129,60 @@ class FileSink : public SinkMedium {
      */
     bool writeDataToFile(Runtime::TupleBuffer& inputBuffer);
 
+    /**
+     * @brief method to format a TupleBuffer and hand it to the group commit writer, the watermark of the buffer
+     * is updated once the writer wrote it
+     * @param a tuple buffers pointer
+     * @return bool indicating if the buffer was accepted by the writer
+     */
+    bool writeDataToGroupCommitWriter(Runtime::TupleBuffer& inputBuffer);
+
   protected:
     std::string filePath;
     std::ofstream outputFile;
+    /// the output of the sink format, reused for all buffers that are written synchronously
+    std::string formattedBuffer;
     bool append{false};
+    FileSinkWriteMode writeMode{FileSinkWriteMode::SYNCHRONOUS};
+    std::unique_ptr<Util::GroupCommitFileWriter> groupCommitWriter;
 
 #ifdef ENABLE_ARROW_BUILD
+    /// the number of tuples that are accumulated into one arrow record batch
+    static constexpr uint64_t ARROW_RECORD_BATCH_SIZE = 64 * 1024;
+    /// the number of buffers after which a record batch is written, if their watermarks wait for it
+    static constexpr uint64_t ARROW_MAX_PENDING_BUFFERS = 64;
+
     /**
-     * @brief method to write a TupleBuffer to an Arrow File. Arrow opens its own filestream to write the file and therefore
-     * we require and abstraction to be able to obtain this object, or otherwise we need to write our own Arrow writer.
+     * @brief method to append a TupleBuffer to the pending record batch of the Arrow File. The record batch is written
+     * once it holds ARROW_RECORD_BATCH_SIZE tuples, the writer stays open until the sink shuts down.
      * @param a tuple buffers pointer
      * @return bool indicating if the write was complete
      */
     bool writeDataToArrowFile(Runtime::TupleBuffer& inputBuffer);
 
     /**
-     * @brief method to write a TupleBuffer to an Arrow File. Arrow opens its own filestream to write the file and therefore
-     * we require and abstraction to be able to obtain this object, or otherwise we need to write our own Arrow writer.
-     * @param a tuple buffers pointer
+     * @brief method to write the pending record batch to the Arrow File and to update the watermarks of its buffers,
+     * requires the writeMutex
      * @return bool indicating if the write was complete
      */
-    arrow::Status openArrowFile(std::shared_ptr<arrow::io::FileOutputStream> arrowFileOutputStream,
-                                std::shared_ptr<arrow::Schema> arrowSchema,
-                                std::shared_ptr<arrow::ipc::RecordBatchWriter> arrowWriter);
+    bool writeArrowRecordBatch();
+
+    /**
+     * @brief method to open the Arrow File and its writer once per sink. Paths with the ".arrow" or ".feather" extension
+     * are written in the Arrow IPC file format (Feather V2), all other paths in the Arrow IPC streaming format.
+     * @param arrowSchema the schema of the record batches
+     * @return status of opening the file
+     */
+    arrow::Status openArrowFile(const std::shared_ptr<arrow::Schema>& arrowSchema);
+
+    /**
+     * @brief method to write the pending record batch and to close the writer and the Arrow File
+     */
+    void closeArrowFile();
+
+    std::shared_ptr<arrow::io::FileOutputStream> arrowFileOutputStream;
+    std::shared_ptr<arrow::ipc::RecordBatchWriter> arrowRecordBatchWriter;
+    std::vector<Runtime::TupleBuffer> pendingArrowBuffers;
 #endif
 };
 using FileSinkPtr = std::shared_ptr<FileSink>;
@@ -14,24 +14,40 @@
 #ifdef ENABLE_KAFKA_BUILD
 #ifndef x_CORE_INCLUDE_SINKS_MEDIUMS_KAFKASINK_HPP_
 #define x_CORE_INCLUDE_SINKS_MEDIUMS_KAFKASINK_HPP_
+#include <atomic>
 #include <chrono>
 #include <cstdint>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 
+#include <Operators/LogicalOperators/Sinks/KafkaSinkDescriptor.hpp>
 #include <Sinks/Mediums/SinkMedium.hpp>
 
 namespace cppkafka {
 class Configuration;
 class Producer;
-class MessageBuilder;
+class Message;
 }// namespace cppkafka
 namespace x {
 
+/**
+ * @brief Publishes every tuple buffer as one Kafka message through an asynchronous producer.
+ * Worker threads format and produce their buffers in parallel and never wait for the brokers. At most maxInFlightMessages
+ * messages are produced but not yet acknowledged, further buffers wait in order until acknowledgements free the window.
+ * Every buffer is kept until its message is acknowledged, so slow brokers hold back buffers of the buffer pool, which applies
+ * backpressure to the sources. A delivery thread serves the acknowledgements and updates the watermarks.
+ */
 class KafkaSink : public SinkMedium {
     constexpr static uint64_t INVALID_PARTITION_NUMBER = -1;
 
   public:
+    constexpr static uint64_t DEFAULT_MAX_IN_FLIGHT_MESSAGES = KafkaSinkDescriptor::DEFAULT_MAX_IN_FLIGHT_MESSAGES;
+    constexpr static uint64_t DEFAULT_LINGER_TIME_IN_MS = KafkaSinkDescriptor::DEFAULT_LINGER_TIME_IN_MS;
+    constexpr static uint64_t DEFAULT_BATCH_SIZE_IN_BYTES = KafkaSinkDescriptor::DEFAULT_BATCH_SIZE_IN_BYTES;
+
     /**
     * Constructor for a kafka Sink
     * @param format format of the sink
@@ -44,6 +60,9 @@ class KafkaSink : public SinkMedium {
     * @param kafkaProducerTimeout timeout how long to wait until the push fails
     * @param faultToleranceType
     * @param numberOfOrigins
+    * @param maxInFlightMessages maximal number of messages that are produced but not acknowledged by the brokers
+    * @param lingerTimeInMs time the producer waits for further messages to batch them into one request
+    * @param batchSizeInBytes maximal size of the messages that are batched into one request
     */
     KafkaSink(SinkFormatPtr format,
               Runtime::NodeEnginePtr nodeEngine,
@@ -54,7 +73,10 @@ class KafkaSink : public SinkMedium {
               QuerySubPlanId querySubPlanId,
               const uint64_t kafkaProducerTimeout = 10 * 1000,
               FaultToleranceType faultToleranceType = FaultToleranceType::NONE,
-              uint64_t numberOfOrigins = 1);
+              uint64_t numberOfOrigins = 1,
+              uint64_t maxInFlightMessages = DEFAULT_MAX_IN_FLIGHT_MESSAGES,
+              uint64_t lingerTimeInMs = DEFAULT_LINGER_TIME_IN_MS,
+              uint64_t batchSizeInBytes = DEFAULT_BATCH_SIZE_IN_BYTES);
 
     ~KafkaSink() override;
 
@@ -63,9 +85,19 @@ class KafkaSink : public SinkMedium {
      */
     SinkMediumTypes getSinkMediumType() override;
 
+    /**
+     * @brief formats the buffer and produces it as one message, or queues it if the in-flight window is full.
+     * Workers format and produce their buffers in parallel, only the in-flight window is synchronized.
+     * @param inputBuffer the buffer to publish
+     * @return true if the message was produced or queued
+     */
     bool writeData(Runtime::TupleBuffer& inputBuffer, Runtime::WorkerContextRef) override;
 
     void setup() override;
+
+    /**
+     * @brief produces the queued messages and waits up to the producer timeout for the acknowledgement of all messages
+     */
     void shutdown() override;
 
     /**
@@ -82,19 +114,83 @@ class KafkaSink : public SinkMedium {
      * @brief Get kafka producer timeout
      */
     uint64_t getKafkaProducerTimeout() const;
+
+    /**
+     * @brief Get maximal number of messages that are produced but not acknowledged
+     */
+    uint64_t getMaxInFlightMessages() const;
+
+    /**
+     * @brief Get number of messages that are produced but not acknowledged
+     */
+    uint64_t getNumberOfInFlightMessages() const;
+
+    /**
+     * @brief Get number of messages that wait for a free slot in the in-flight window
+     */
+    uint64_t getNumberOfQueuedMessages() const;
+
+    /**
+     * @brief Get time the producer waits for further messages to batch them into one request
+     */
+    uint64_t getLingerTimeInMs() const;
+
+    /**
+     * @brief Get maximal size of the messages that are batched into one request
+     */
+    uint64_t getBatchSizeInBytes() const;
+
+    /**
+     * @brief Get number of messages that could not be delivered
+     */
+    uint64_t getNumberOfFailedMessages() const;
     std::string toString() const override;
 
   private:
+    /**
+     * @brief a formatted buffer whose message is queued or in flight
+     */
+    struct PendingMessage {
+        std::string payload;
+        Runtime::TupleBuffer buffer;
+    };
+
     void connect();
 
+    /**
+     * @brief hands the message to the producer, which references the payload until it is acknowledged.
+     * Requires the pendingMutex, so that messages are produced in the order of the queue.
+     * @param message the message, is released to the producer if it was produced
+     * @return true if the message was produced, false if the queue of the producer is full
+     */
+    bool produce(std::unique_ptr<PendingMessage>& message);
+
+    /// produces queued messages while the in-flight window is not full, acquires the pendingMutex
+    void produceQueuedMessages();
+
+    /// called by the producer for every acknowledged or failed message
+    void onDelivery(const cppkafka::Message& message);
+
+    /// serves the acknowledgements of the producer until the sink shuts down
+    void deliveryRoutine();
+
     std::string brokers;
     std::string topic;
 
     std::unique_ptr<cppkafka::Configuration> config;
     std::unique_ptr<cppkafka::Producer> producer;
-    std::unique_ptr<cppkafka::MessageBuilder> msgBuilder;
 
     std::chrono::milliseconds kafkaProducerTimeout;
+    uint64_t maxInFlightMessages;
+    uint64_t lingerTimeInMs;
+    uint64_t batchSizeInBytes;
+
+    mutable std::mutex pendingMutex;
+    std::deque<std::unique_ptr<PendingMessage>> queuedMessages;
+    std::atomic<uint64_t> numberOfInFlightMessages{0};
+    std::atomic<uint64_t> numberOfFailedMessages{0};
+    std::atomic<bool> running{false};
+    std::thread deliveryThread;
 };
 using KafkaSinkPtr = std::shared_ptr<KafkaSink>;
 
@@ -20,8 +20,13 @@
 #include <Sinks/Mediums/SinkMedium.hpp>
 #include <Util/MQTTClientWrapper.hpp>
 #include <cstdint>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 namespace x {
 /**
@@ -42,6 +47,7 @@ class MQTTSink : public SinkMedium {
      * @param asynchronousClient: determine whether client is async- or synchronous
      * @param faultToleranceType: fault-tolerance guarantee chosen by a user
      * @param numberOfOrigins: number of origins of a given query
+     * @param tuplesPerMessage: number of tuples that are packed into one message, one tuple per line
      * @return MQTT sink
      */
     // TODO change MSGS to Messages
@@ -60,12 +66,25 @@ class MQTTSink : public SinkMedium {
                       MQTTSinkDescriptor::ServiceQualities qualityOfService,
                       bool asynchronousClient,
                       FaultToleranceType faultToleranceType = FaultToleranceType::NONE,
-                      uint64_t numberOfOrigins = 1);
+                      uint64_t numberOfOrigins = 1,
+                      uint64_t tuplesPerMessage = 1);
     ~MQTTSink() x_NOEXCEPT(false) override;
 
+    /**
+     * @brief formats the buffer and publishes its tuples in messages of tuplesPerMessage tuples.
+     * The asynchronous client does not wait for the delivery, instead the sink keeps the buffer until its last message
+     * is delivered and releases it from the delivery callback of the client. Slow brokers thus hold back buffers of the
+     * buffer pool, which applies backpressure to the sources.
+     * @param inputBuffer the buffer to publish
+     * @return true if all messages were handed to the client
+     */
     bool writeData(Runtime::TupleBuffer& inputBuffer, Runtime::WorkerContextRef) override;
     void setup() override { connect(); };
-    void shutdown() override{};
+
+    /**
+     * @brief waits for the delivery of all messages that are in flight
+     */
+    void shutdown() override;
 
     /**
      * @brief connect to a MQTT broker
@@ -133,6 +152,27 @@ class MQTTSink : public SinkMedium {
      */
     bool getAsynchronousClient() const;
 
+    /**
+     * @brief get the number of tuples that are packed into one message (default is 1)
+     * @return number of tuples per message
+     */
+    uint64_t getTuplesPerMessage() const;
+
+    /**
+     * @brief get the number of buffers whose messages were published but not delivered yet
+     * @return number of buffers in flight
+     */
+    uint64_t getNumberOfBuffersInFlight();
+
+    /**
+     * @brief splits formatted tuples, one tuple per line, into the payloads of messages with tuplesPerMessage tuples each.
+     * The payloads omit the line break after their last tuple, the last payload may contain fewer tuples.
+     * @param formattedTuples the formatted tuples, the last line may lack its line break
+     * @param tuplesPerMessage the number of tuples per message
+     * @return the payloads, which reference formattedTuples
+     */
+    static std::vector<std::string_view> splitIntoMessages(std::string_view formattedTuples, uint64_t tuplesPerMessage);
+
     /**
      * @brief Print MQTT Sink (schema, address, port, clientId, topic, user)
      */
@@ -145,6 +185,31 @@ class MQTTSink : public SinkMedium {
     SinkMediumTypes getSinkMediumType() override;
 
   private:
+    /**
+     * @brief the client calls the listener on the delivery or failure of every message of the asynchronous client
+     */
+    class DeliveryListener : public mqtt::iaction_listener {
+      public:
+        explicit DeliveryListener(MQTTSink& sink) : sink(sink) {}
+        void on_success(const mqtt::token&) override { sink.onDelivery(); }
+        void on_failure(const mqtt::token&) override { sink.onDelivery(); }
+
+      private:
+        MQTTSink& sink;
+    };
+
+    /// releases the delivered buffers from the delivery callback, acquires the inFlightMutex
+    void onDelivery();
+
+    /**
+     * @brief releases the buffers in flight whose last message was delivered and updates their watermarks in publishing
+     * order, requires the inFlightMutex
+     */
+    void releaseDeliveredBuffers();
+
+    /// waits for the delivery of all buffers in flight, acquires the inFlightMutex only in between the waits
+    void waitForDelivery();
+
     [[maybe_unused]] QuerySubPlanId querySubPlanId{};
     std::string address;
     std::string clientId;
@@ -156,8 +221,17 @@ class MQTTSink : public SinkMedium {
     MQTTSinkDescriptor::ServiceQualities qualityOfService;
     bool asynchronousClient;
     bool connected;
+    uint64_t tuplesPerMessage;
     std::chrono::duration<int64_t, std::ratio<1, 1000000000>> minDelayBetweenSends{};
 
+    /// the formatted tuples of the current buffer, reused for all buffers
+    std::string formattedBuffer;
+    /// protects the buffers in flight, which the delivery callback releases concurrently to writeData
+    std::mutex inFlightMutex;
+    /// buffers in publishing order together with the delivery token of their last message
+    std::deque<std::pair<mqtt::delivery_token_ptr, Runtime::TupleBuffer>> buffersInFlight;
+    DeliveryListener deliveryListener{*this};
+    /// declared last, so that the client is destroyed before the delivery callback loses its state
     MQTTClientWrapperPtr client;
 };
 using MQTTSinkPtr = std::shared_ptr<MQTTSink>;
@@ -55,7 +55,8 @@ class MaterializedViewSink : public SinkMedium {
     void shutdown() override;
 
     /**
-     * @brief method to write the content of a tuple buffer to the materialized view
+     * @brief method to write the content of a tuple buffer to the materialized view, which synchronizes itself,
+     * thus the writeMutex is not acquired
      * @param tuple buffer to write
      * @param worker context currently not used
      * @return bool indicating success of the write
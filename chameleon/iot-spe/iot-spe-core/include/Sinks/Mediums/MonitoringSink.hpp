@@ -69,7 +69,8 @@ class MonitoringSink : public SinkMedium {
     void shutdown() override;
 
     /**
-     * @brief method to write the content of a tuple buffer to output console
+     * @brief method to write the content of a tuple buffer to the metric store, which synchronizes itself,
+     * thus the writeMutex is not acquired
      * @param tuple buffer to write
      * @return bool indicating success of the write
      */
@@ -21,6 +21,7 @@
 #include <string>
 
 #include <Sinks/Mediums/SinkMedium.hpp>
+#include <Sinks/Mediums/WorkerLocalShards.hpp>
 #include <iostream>
 
 namespace x {
@@ -61,11 +62,21 @@ class NullOutputSink : public SinkMedium {
     void shutdown() override;
 
     /**
-     * @brief method to write the content of a tuple buffer to output console
+     * @brief discards the tuple buffer and counts it in the shard of the worker, does not acquire the writeMutex
      * @param tuple buffer to write
      * @return bool indicating success of the write
      */
-    bool writeData(Runtime::TupleBuffer& inputBuffer, Runtime::WorkerContextRef) override;
+    bool writeData(Runtime::TupleBuffer& inputBuffer, Runtime::WorkerContextRef workerContext) override;
+
+    /**
+     * @brief Get the number of buffers received by all workers
+     */
+    uint64_t getNumberOfReceivedBuffers();
+
+    /**
+     * @brief Get the number of tuples received by all workers
+     */
+    uint64_t getNumberOfReceivedTuples();
 
     /**
      * @brief override the toString method for the print sink
@@ -80,6 +91,12 @@ class NullOutputSink : public SinkMedium {
     SinkMediumTypes getSinkMediumType() override;
 
   private:
+    struct ReceivedCounters {
+        uint64_t buffers;
+        uint64_t tuples;
+    };
+
+    WorkerLocalShards<ReceivedCounters> receivedCounters;
 };
 using NullOutputSinkPtr = std::shared_ptr<NullOutputSink>;
 }// namespace x
@@ -19,6 +19,7 @@
 #include <Sinks/Formats/SinkFormat.hpp>
 #include <Util/FaultToleranceType.hpp>
 #include <Windowing/Watermark/MultiOriginWatermarkProcessor.hpp>
+#include <atomic>
 #include <mutex>
 
 namespace x {
@@ -38,7 +39,10 @@ enum class SinkMediumTypes : uint8_t {
 
 /**
  * @brief Base class for all data sinks in x
- * @note this code is not thread safe
+ * @note writeData is called by all worker threads at the same time, the sink itself decides how to synchronize it.
+ * Sinks that write to a shared stream or connection acquire the writeMutex in writeData. Sinks whose medium accepts
+ * concurrent writes, e.g., per-worker shards (see WorkerLocalShards) or a store that synchronizes itself, do not acquire
+ * it and document this at their writeData. The written buffer and tuple counters as well as updateWatermark are thread safe.
  */
 class SinkMedium : public Runtime::Reconfigurable {
 
@@ -173,7 +177,7 @@ class SinkMedium : public Runtime::Reconfigurable {
 
   protected:
     SinkFormatPtr sinkFormat;
-    uint32_t bufferCount;
+    std::atomic<uint64_t> bufferCount;
     uint32_t buffersPerEpoch;
     bool schemaWritten;
 
@@ -187,8 +191,8 @@ class SinkMedium : public Runtime::Reconfigurable {
     Windowing::MultiOriginWatermarkProcessorPtr watermarkProcessor;
     std::function<void(Runtime::TupleBuffer&)> updateWatermarkCallback;
 
-    uint64_t sentBuffer{0};
-    uint64_t sentTuples{0};
+    std::atomic<uint64_t> sentBuffer{0};
+    std::atomic<uint64_t> sentTuples{0};
     std::recursive_mutex writeMutex;
 };
 
@@ -0,0 +1,81 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#ifndef x_CORE_INCLUDE_SINKS_MEDIUMS_WORKERLOCALSHARDS_HPP_
+#define x_CORE_INCLUDE_SINKS_MEDIUMS_WORKERLOCALSHARDS_HPP_
+
+#include <Runtime/WorkerContext.hpp>
+#include <Runtime/xThread.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <memory>
+#include <mutex>
+
+namespace x {
+
+/**
+ * @brief Holds one shard of sink state per worker thread, e.g., output that is merged or flushed later.
+ * A worker only accesses the shard of its WorkerContext id, so writes of different workers never contend with each other.
+ * Every shard has its own mutex, which is only contended while forEachShard merges or flushes that shard, e.g., from
+ * a background thread or from shutdown. Shards are cache line aligned to avoid false sharing between workers.
+ * @tparam T the state of one shard, has to be default constructible
+ */
+template<typename T>
+class WorkerLocalShards {
+  public:
+    /// worker ids are recycled xThread ids and thus smaller than xThread::MaxNumThreads
+    static constexpr uint64_t NUMBER_OF_SHARDS = Runtime::xThread::MaxNumThreads;
+
+    WorkerLocalShards() : shards(std::make_unique<Shard[]>(NUMBER_OF_SHARDS)) {}
+
+    /**
+     * @brief calls function with the shard of the worker while holding the lock of that shard
+     * @param workerContext the context of the calling worker
+     * @param function is called with T&
+     * @return the result of function
+     */
+    template<typename Function>
+    decltype(auto) withLocalShard(Runtime::WorkerContext& workerContext, Function&& function) {
+        auto workerId = workerContext.getId();
+        x_ASSERT(workerId < NUMBER_OF_SHARDS, "WorkerLocalShards: invalid worker id " << workerId);
+        auto& shard = shards[workerId];
+        std::unique_lock lock(shard.mutex);
+        return function(shard.value);
+    }
+
+    /**
+     * @brief calls function for every shard one after another while holding the lock of the current shard,
+     * so that the shards can be merged or flushed while the workers keep writing to the other shards
+     * @param function is called with T&
+     */
+    template<typename Function>
+    void forEachShard(Function&& function) {
+        for (uint64_t shardIndex = 0; shardIndex < NUMBER_OF_SHARDS; ++shardIndex) {
+            auto& shard = shards[shardIndex];
+            std::unique_lock lock(shard.mutex);
+            function(shard.value);
+        }
+    }
+
+  private:
+    struct alignas(64) Shard {
+        std::mutex mutex;
+        T value{};
+    };
+
+    std::unique_ptr<Shard[]> shards;
+};
+
+}// namespace x
+
+#endif// x_CORE_INCLUDE_SINKS_MEDIUMS_WORKERLOCALSHARDS_HPP_
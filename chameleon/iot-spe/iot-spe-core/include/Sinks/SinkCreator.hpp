@@ -17,6 +17,7 @@
 #include <Monitoring/MonitoringForwardRefs.hpp>
 #include <Runtime/RuntimeForwardRefs.hpp>
 #include <Util/FaultToleranceType.hpp>
+#include <Util/FileSinkWriteMode.hpp>
 #ifdef ENABLE_OPC_BUILD
 #include <open62541/client_config_default.h>
 #include <open62541/client_highlevel.h>
@@ -35,6 +36,7 @@ namespace x {
  * @param bool indicating if data is appended (true) or overwritten (false)
  * @param faultToleranceType: fault tolerance type of a query
  * @param numberOfOrigins: number of origins of a given query
+ * @param writeMode: if workers write synchronously or hand their buffers to a group-committing writer thread
  * @return a data sink pointer
  */
 
@@ -47,7 +49,8 @@ DataSinkPtr createCSVFileSink(const SchemaPtr& schema,
                               bool append,
                               bool addTimestamp = false,
                               FaultToleranceType faultToleranceType = FaultToleranceType::NONE,
-                              uint64_t numberOfOrigins = 1);
+                              uint64_t numberOfOrigins = 1,
+                              FileSinkWriteMode writeMode = FileSinkWriteMode::SYNCHRONOUS);
 
 /**
  * @brief create a binary test sink with a schema into the x
@@ -57,6 +60,7 @@ DataSinkPtr createCSVFileSink(const SchemaPtr& schema,
  * @param bool indicating if data is appended (true) or overwritten (false)
  * @param faultToleranceType: fault tolerance type of a query
  * @param numberOfOrigins: number of origins of a given query
+ * @param writeMode: if workers write synchronously or hand their buffers to a group-committing writer thread
  * @return a data sink pointer
  */
 DataSinkPtr createBinaryxFileSink(const SchemaPtr& schema,
@@ -67,7 +71,8 @@ DataSinkPtr createBinaryxFileSink(const SchemaPtr& schema,
                                     const std::string& filePath,
                                     bool append,
                                     FaultToleranceType faultToleranceType = FaultToleranceType::NONE,
-                                    uint64_t numberOfOrigins = 1);
+                                    uint64_t numberOfOrigins = 1,
+                                    FileSinkWriteMode writeMode = FileSinkWriteMode::SYNCHRONOUS);
 
 /**
  * @brief create a JSON test sink with a schema int
@@ -77,6 +82,7 @@ DataSinkPtr createBinaryxFileSink(const SchemaPtr& schema,
  * @param bool indicating if data is appended (true) or overwritten (false)
  * @param faultToleranceType: fault tolerance type of a query
  * @param numberOfOrigins: number of origins of a given query
+ * @param writeMode: if workers write synchronously or hand their buffers to a group-committing writer thread
  * @return a data sink pointer
  */
 DataSinkPtr createJSONFileSink(const SchemaPtr& schema,
@@ -87,7 +93,8 @@ DataSinkPtr createJSONFileSink(const SchemaPtr& schema,
                                const std::string& filePath,
                                bool append,
                                FaultToleranceType faultToleranceType = FaultToleranceType::NONE,
-                               uint64_t numberOfOrigins = 1);
+                               uint64_t numberOfOrigins = 1,
+                               FileSinkWriteMode writeMode = FileSinkWriteMode::SYNCHRONOUS);
 
 #ifdef ENABLE_ARROW_BUILD
 /**
@@ -318,6 +325,9 @@ DataSinkPtr createMaterializedViewSink(SchemaPtr schema,
  * @param kafkaProducerTimeout: kafka producer timeout
  * @param faultToleranceType
  * @param numberOfOrigins
+ * @param maxInFlightMessages: maximal number of messages that are produced but not acknowledged by the brokers
+ * @param lingerTimeInMs: time the producer waits for further messages to batch them into one request
+ * @param batchSizeInBytes: maximal size of the messages that are batched into one request
  * @return a data sink pointer
  */
 DataSinkPtr createCsvKafkaSink(SchemaPtr schema,
@@ -329,7 +339,10 @@ DataSinkPtr createCsvKafkaSink(SchemaPtr schema,
                                const std::string& topic,
                                uint64_t kafkaProducerTimeout,
                                FaultToleranceType faultToleranceType,
-                               uint64_t numberOfOrigins);
+                               uint64_t numberOfOrigins,
+                               uint64_t maxInFlightMessages,
+                               uint64_t lingerTimeInMs,
+                               uint64_t batchSizeInBytes);
 #endif
 #ifdef ENABLE_MQTT_BUILD
 /**
@@ -348,6 +361,7 @@ DataSinkPtr createCsvKafkaSink(SchemaPtr schema,
  * @param asynchronousClient: 1 if client should be asynchronous, else 0
  * @param faultToleranceType: fault tolerance type of a query
  * @param numberOfOrigins: number of origins of a given query
+ * @param tuplesPerMessage: number of tuples that are packed into one message, one tuple per line
  * @return a data sink pointer
  */
 DataSinkPtr createMQTTSink(const SchemaPtr& schema,
@@ -365,7 +379,8 @@ DataSinkPtr createMQTTSink(const SchemaPtr& schema,
                            MQTTSinkDescriptor::ServiceQualities qualityOfService,
                            bool asynchronousClient,
                            FaultToleranceType faultToleranceType = FaultToleranceType::NONE,
-                           uint64_t numberOfOrigins = 1);
+                           uint64_t numberOfOrigins = 1,
+                           uint64_t tuplesPerMessage = 1);
 #endif
 
 }// namespace x
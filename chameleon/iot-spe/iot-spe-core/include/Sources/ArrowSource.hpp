@@ -21,6 +21,8 @@
 #include <Operators/LogicalOperators/Sources/ArrowSourceDescriptor.hpp>
 #include <Operators/LogicalOperators/Sources/SourceDescriptor.hpp>
 #include <Sources/DataSource.hpp>
+#include <Sources/PartitionedFileReader.hpp>
+#include <Util/MappedFile.hpp>
 
 #include <string>
 
@@ -37,6 +39,9 @@ using ArrowParserPtr = std::shared_ptr<ArrowParser>;
  * @brief this class implement the Arrow as an input source
  * @brief more specifically we currently support the Arrow IPC format (a.k.a Feather v2)
  * @see https://arrow.apache.org/docs/format/Columnar.html#serialization-and-interprocess-communication-ipc
+ * With more than one reader thread, every record batch is a partition that a PartitionedFileReader converts into
+ * buffers in parallel, while the buffers are still emitted in file order.
+ * With a columnar schema, fixed-width numeric Arrow arrays are copied as a whole into the column regions of the buffer.
  */
 class ArrowSource : public DataSource {
   public:
@@ -68,6 +73,11 @@ class ArrowSource : public DataSource {
      */
     std::optional<Runtime::TupleBuffer> receiveData() override;
 
+    /**
+     * @brief stops the reader threads of a partitioned file and closes the source
+     */
+    void close() override;
+
     /**
      *  @brief method to fill the buffer with tuples
      *  @param buffer to be filled
@@ -97,9 +107,27 @@ class ArrowSource : public DataSource {
      */
     const ArrowSourceTypePtr& getSourceConfig() const;
 
+    /**
+     * @brief the arrow source writes into the row layout as well as into the columnar layout
+     */
+    std::vector<Schema::MemoryLayoutType> getSupportedLayouts() override;
+
   protected:
     bool fileEnded;
 
+    /**
+     * @brief copies the values of a fixed-width numeric arrow array with one memcpy into its column of the tuple buffer
+     * @param tupleCountInBuffer the index of the first tuple to write
+     * @param schemaFieldIndex the column to be written
+     * @param tupleBuffer the tuple buffer to be written
+     * @param arrowArray the arrow array to write to the tupleBuffer
+     * @return false if the layout is not columnar or the array has to be written value by value
+     */
+    bool copyArrowArrayToColumn(uint64_t tupleCountInBuffer,
+                                uint64_t schemaFieldIndex,
+                                Runtime::MemoryLayouts::DynamicTupleBuffer& tupleBuffer,
+                                const std::shared_ptr<arrow::Array>& arrowArray);
+
   private:
     ArrowSourceTypePtr arrowSourceType;
     std::string filePath;
@@ -108,11 +136,15 @@ class ArrowSource : public DataSource {
     std::vector<PhysicalTypePtr> physicalTypes;
     size_t fileSize;
     ArrowParserPtr inputParser;
+    // set if the schema uses the columnar layout, enables copying whole arrays into the columns
+    Runtime::MemoryLayouts::ColumnLayoutPtr columnLayout;
 
     // arrow related data structures and helper functions
     // TODO #4083: these should move to an ArrowWrapper when we support other formats from Arrow
     // Arrow status returns at every operation also do not play well currently
-    std::shared_ptr<arrow::io::ReadableFile> inputFile;
+    // the stream reader reads from a buffer over the memory mapped file, so arrays of record batches point into the mapping
+    Util::MappedFilePtr mappedFile;
+    std::shared_ptr<arrow::io::BufferReader> inputFile;
     // A record batch in Arrow is two-dimensional data structure that is semantically a sequence
     // of fields, each a contiguous Arrow array
     // See: https://arrow.apache.org/docs/cpp/api/table.html#_CPPv4N5arrow11RecordBatchE
@@ -123,6 +155,12 @@ class ArrowSource : public DataSource {
     uint64_t indexWithinCurrentRecordBatch{0};
     std::shared_ptr<arrow::ipc::RecordBatchStreamReader> recordBatchStreamReader;
 
+    // state of the partitioned reading, only used with more than one reader thread
+    // the record batches are read upfront, their arrays point into the mapping and are converted by the readers
+    uint32_t numberOfReaderThreads;
+    std::vector<std::shared_ptr<arrow::RecordBatch>> recordBatches;
+    PartitionedFileReaderPtr partitionedFileReader;
+
     // arrow related utility functions
     /**
      * @brief opens the Arrow inputSource, and initializes the recordBatchStreamReader
@@ -136,6 +174,11 @@ class ArrowSource : public DataSource {
      */
     void readNextBatch();
 
+    /**
+     * @brief converts one record batch into buffers, runs on a reader thread
+     */
+    void parsePartition(uint64_t partitionIndex, std::vector<Runtime::TupleBuffer>& buffers);
+
     /**
      * @brief this function writes the data from the record batches to DynamicTupleBuffer
      * @param tupleCountInBuffer is the count of total filled buffers in tupleBuffer
@@ -97,6 +97,11 @@ class BenchmarkSource : public GeneratorSource, public Runtime::BufferRecycler {
      */
     virtual void runningRoutine() override;
 
+    /**
+     * @brief the benchmark source replaces the running routine and keeps its own thread
+     */
+    bool supportsSourceExecutor() const override { return false; }
+
     virtual void recyclePooledBuffer(Runtime::detail::MemorySegment*) override;
 
     /**
@@ -16,12 +16,14 @@
 #define x_CORE_INCLUDE_SOURCES_BINARYSOURCE_HPP_
 
 #include <Sources/DataSource.hpp>
-#include <fstream>
+#include <Util/MappedFile.hpp>
 
 namespace x {
 
 /**
- * @brief this class provides a binary file as source
+ * @brief this class provides a binary file as source, which holds tuples in the row layout of the schema.
+ * The file is memory mapped and replayed in a loop. If the source produces row layout buffers, receiveData() wraps
+ * ranges of the mapping into tuple buffers instead of copying them.
  */
 class BinarySource : public DataSource {
   public:
@@ -63,7 +65,7 @@ class BinarySource : public DataSource {
     std::string toString() const override;
 
     /**
-     *  @brief method to fill the buffer with tuples
+     *  @brief method to fill the buffer with tuples, copies them from the mapping
      *  @param buffer to be filled
      */
     void fillBuffer(Runtime::TupleBuffer&);
@@ -73,13 +75,24 @@ class BinarySource : public DataSource {
     const std::string& getFilePath() const;
 
   protected:
-    std::ifstream input;
+    Util::MappedFilePtr mappedFile;
 
   private:
+    /**
+     * @brief the number of bytes of whole tuples at currentPositionInFile that fit into bufferSize bytes,
+     * starts over at the beginning of the file once less than one tuple is left
+     */
+    uint64_t getNumberOfBytesToRead(uint64_t bufferSize);
+
+    /// updates the position and the statistics after numberOfBytes were emitted
+    void advance(uint64_t numberOfBytes);
+
     std::string filePath;
 
     size_t fileSize;
     uint64_t tupleSize;
+    uint64_t currentPositionInFile{0};
+    bool zeroCopy;
 };
 
 using BinarySourcePtr = std::shared_ptr<BinarySource>;
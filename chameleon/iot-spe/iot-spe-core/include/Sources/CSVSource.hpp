@@ -16,16 +16,24 @@
 #define x_CORE_INCLUDE_SOURCES_CSVSOURCE_HPP_
 
 #include <Catalogs/Source/PhysicalSourceTypes/CSVSourceType.hpp>
+#include <Sources/Parsers/CSVTokenizer.hpp>
+#include <Sources/PartitionedFileReader.hpp>
+#include <Util/MappedFile.hpp>
 #include <chrono>
-#include <fstream>
+#include <optional>
 #include <string>
+#include <vector>
 
 namespace x {
 
 class CSVParser;
 using CSVParserPtr = std::shared_ptr<CSVParser>;
 /**
- * @brief this class implement the CSV as an input source
+ * @brief this class implement the CSV as an input source.
+ * The file is memory mapped. Files with a single character delimiter are parsed in large blocks of the mapping,
+ * which the CSVTokenizer splits into fields with SIMD instructions. Files with a longer delimiter are parsed line by line.
+ * With more than one reader thread, the file is split into newline aligned partitions that a PartitionedFileReader
+ * parses in parallel, while the buffers are still emitted in file order.
  */
 class CSVSource : public DataSource {
   public:
@@ -60,6 +68,11 @@ class CSVSource : public DataSource {
      */
     std::optional<Runtime::TupleBuffer> receiveData() override;
 
+    /**
+     * @brief stops the reader threads of a partitioned file and closes the source
+     */
+    void close() override;
+
     /**
      *  @brief method to fill the buffer with tuples
      *  @param buffer to be filled
@@ -90,10 +103,44 @@ class CSVSource : public DataSource {
     const CSVSourceTypePtr& getSourceConfig() const;
 
   protected:
-    std::ifstream input;
+    Util::MappedFilePtr mappedFile;
     bool fileEnded;
 
   private:
+    /**
+     * @brief fills the buffer with lines that are split by the CSVParser
+     * @return the number of tuples written
+     */
+    uint64_t fillBufferFromLines(Runtime::MemoryLayouts::DynamicTupleBuffer& buffer, uint64_t numberOfTuples);
+
+    /**
+     * @brief fills the buffer with lines of the tokenized block, reads the next block if necessary
+     * @return the number of tuples written
+     */
+    uint64_t fillBufferFromBlocks(Runtime::MemoryLayouts::DynamicTupleBuffer& buffer, uint64_t numberOfTuples);
+
+    /**
+     * @brief finds the end of the line that starts at currentPositionInFile
+     * @return the index of the separator that ends the line, or an empty optional at the end of the file
+     */
+    std::optional<uint64_t> findNextLineEnd();
+
+    /**
+     * @brief tokenizes the block that starts at currentPositionInFile. The block size is doubled if the
+     * previous block started at the same position, i.e., if it did not contain a complete line.
+     */
+    void readBlock();
+
+    /**
+     * @brief splits the file into newline aligned partitions of a few buffers each
+     */
+    void computePartitions();
+
+    /**
+     * @brief tokenizes and parses one partition into buffers, runs on a reader thread
+     */
+    void parsePartition(uint64_t partitionIndex, std::vector<Runtime::TupleBuffer>& buffers) const;
+
     CSVSourceTypePtr csvSourceType;
     std::string filePath;
     uint64_t tupleSize;
@@ -104,6 +151,19 @@ class CSVSource : public DataSource {
     size_t fileSize;
     bool skipHeader;
     CSVParserPtr inputParser;
+
+    // state of the block-oriented reading, only used for single character delimiters
+    std::optional<CSVTokenizer> tokenizer;
+    uint64_t maxBlockSize{0};
+    uint64_t blockSize{0};
+    uint64_t blockPositionInFile{0};
+    std::vector<uint32_t> separators;
+    uint64_t nextSeparator{0};
+
+    // state of the partitioned reading, only used with more than one reader thread
+    uint32_t numberOfReaderThreads;
+    std::vector<uint64_t> partitionOffsets;
+    PartitionedFileReaderPtr partitionedFileReader;
 };
 
 using CSVSourcePtr = std::shared_ptr<CSVSource>;
@@ -24,6 +24,8 @@
 #include <Runtime/RuntimeForwardRefs.hpp>
 #include <Util/CircularBuffer.hpp>
 #include <Util/GatheringMode.hpp>
+#include <Util/GatheringPolicy.hpp>
+#include <Util/SlidingDFT.hpp>
 #include <atomic>
 #include <chrono>
 #include <future>
@@ -33,10 +35,15 @@
 
 namespace x::Runtime::MemoryLayouts {
 class DynamicTupleBuffer;
+class FieldValueReader;
+}
+
+namespace x::Util {
+class RatePacer;
 }
 
 namespace x {
-class KalmanFilter;
+class KalmanFilterBase;
 
 /**
 * @brief Base class for all data sources in x
@@ -112,6 +119,29 @@ class DataSource : public Runtime::Reconfigurable, public DataEmitter {
      */
     virtual void runningRoutine();
 
+    /**
+     * @brief one iteration of the running routine, called by the Runtime::SourceExecutor instead of runningRoutine().
+     * The first iteration opens the source, the last one closes it and completes the source.
+     * Like the dedicated source thread, the iterations do not wait for the gathering interval.
+     * @return the delay until the next iteration or std::nullopt if the source is done
+     */
+    std::optional<std::chrono::milliseconds> runningRoutineIteration();
+
+    /**
+     * @brief whether the source can be driven by a Runtime::SourceExecutor instead of a dedicated thread.
+     * Sources that override runningRoutine() or block in receiveData() have to return false. A readiness file descriptor
+     * only helps a source that reads without blocking, as readiness guarantees just the first read.
+     * @return true if the running routine can be split into iterations
+     */
+    virtual bool supportsSourceExecutor() const;
+
+    /**
+     * @brief file descriptor that becomes readable when receiveData() can make progress, e.g., a socket.
+     * The Runtime::SourceExecutor runs the next iteration of such a source on readiness instead of right away.
+     * @return the file descriptor or -1 if the source does not wait for readiness
+     */
+    virtual int getReadinessFileDescriptor() const;
+
     /**
      * @brief virtual function to receive a buffer
      * @Note this function is overwritten by the particular data source
@@ -172,6 +202,22 @@ class DataSource : public Runtime::Reconfigurable, public DataEmitter {
      */
     void setGatheringInterval(std::chrono::milliseconds interval);
 
+    /**
+     * @brief Sets the numeric fields that drive the adaptive gathering modes. All fields form the
+     * measurement vector of the KF, the first field also drives the spectrum estimation.
+     * Without fields, the field value is used, or else the first numeric field of the schema.
+     * @param fieldNames fully or partly qualified field names
+     * @throws RuntimeException if a field does not exist or is not numeric
+     */
+    void setAdaptiveValueFields(const std::vector<std::string>& fieldNames);
+
+    /**
+     * @brief Sets the group of the fused adaptive gathering mode. All sources of a group share one KF over
+     * their adaptive value fields and gather on one interval, see Runtime::FusedGatheringGroup.
+     * @param groupName the name of the group, an empty name lets the source adapt its interval on its own
+     */
+    void setFusedGatheringGroup(const std::string& groupName);
+
     /**
      * @brief Internal destructor to make sure that the data source is stopped before deconstrcuted
      * @Note must be public because of boost serialize
@@ -193,6 +239,24 @@ class DataSource : public Runtime::Reconfigurable, public DataEmitter {
      */
     uint64_t getGatheringIntervalCount() const;
 
+    /**
+     * @brief Get the ingestion rate in buffers per second that the INGESTION_RATE_MODE or the REPLAY_MODE achieved,
+     * to compare it with the target rate, zero before the source finished emitting
+     */
+    double getAchievedIngestionRate() const;
+
+    /**
+     * @brief Sets the Kalman filter settings of the adaptive gathering modes at runtime. The policy is merged into the
+     * previous policies of the source and applied by the source itself before its next adaptive iteration.
+     * @param policy
+     */
+    void setGatheringPolicy(const GatheringPolicy& policy);
+
+    /**
+     * @brief Gets the name of the physical source the data source reads from
+     */
+    const std::string& getPhysicalSourceName() const;
+
     /**
      * @brief Gets the operator id for the data source
      * @return OperatorId
@@ -288,6 +352,7 @@ class DataSource : public Runtime::Reconfigurable, public DataEmitter {
     uint64_t numberOfBuffersToProduce = std::numeric_limits<decltype(numberOfBuffersToProduce)>::max();
     uint64_t numSourceLocalBuffers;
     uint64_t gatheringIngestionRate{};
+    std::atomic<double> achievedIngestionRate{0};
     std::chrono::milliseconds gatheringInterval{0};
     GatheringMode gatheringMode;
     SourceType type;
@@ -296,6 +361,7 @@ class DataSource : public Runtime::Reconfigurable, public DataEmitter {
     std::atomic_bool futureRetrieved{false};
     std::atomic_bool running{false};
     std::promise<bool> completedPromise;
+    Runtime::SourceExecutorPtr sourceExecutor{nullptr};// protected by startStopMutex
     uint64_t sourceAffinity;
     uint64_t taskQueueId;
     bool sourceSharing = false;
@@ -314,6 +380,19 @@ class DataSource : public Runtime::Reconfigurable, public DataEmitter {
     void emitWorkFromSource(Runtime::TupleBuffer& buffer);
     x::Runtime::MemoryLayouts::DynamicTupleBuffer allocateBuffer();
 
+    /**
+     * @brief Called when an adaptive gathering mode changes the gathering interval. Sources that poll a device
+     * on a schedule of their own override it to push the new interval down to the device.
+     * @param newGatheringInterval
+     */
+    virtual void onGatheringIntervalChange(std::chrono::milliseconds newGatheringInterval);
+
+    /**
+     * @brief Stores and logs the rate that the pacer of the ingestion rate or replay mode achieved
+     * @param pacer
+     */
+    void reportIngestionRate(const Util::RatePacer& pacer);
+
   protected:
     Runtime::MemoryLayouts::MemoryLayoutPtr memoryLayout;
 
@@ -322,6 +401,50 @@ class DataSource : public Runtime::Reconfigurable, public DataEmitter {
     uint64_t maxSequenceNumber = 0;
 
     mutable std::recursive_mutex successorModifyMutex;
+
+    /**
+     * @brief completes the source with the exception that terminated its running routine
+     */
+    void failRunningRoutine(std::exception_ptr expPtr);
+
+    /**
+     * @brief one loop iteration of runningRoutineWithGatheringInterval
+     */
+    void gatheringIntervalIteration();
+
+    /**
+     * @brief one loop iteration of the adaptive running routines
+     * @param applyNewGatheringInterval whether the interval proposed by the KF is applied (false for the oversampler)
+     */
+    void adaptiveGatheringIntervalIteration(bool applyNewGatheringInterval);
+
+    /**
+     * @brief joins the fused gathering group of the source, if any
+     */
+    void joinFusedGatheringGroup();
+
+    /**
+     * @brief leaves the fused gathering group of the source, so the group no longer waits for its values
+     */
+    void leaveFusedGatheringGroup();
+
+    /**
+     * @brief sets the default interval and range of the KF, and schedules the gathering policy on top of them
+     */
+    void initAdaptiveGathering();
+
+    /**
+     * @brief applies the gathering policy to the KF if it changed since the last iteration
+     */
+    void applyGatheringPolicy();
+
+    /**
+     * @brief records the current gathering interval for the next report to the coordinator
+     */
+    void recordGatheringInterval();
+
+    uint64_t numberOfBuffersProduced{0};
+    bool openedBySourceExecutor{false};
     /**
     * @brief running routine with a fixed gathering interval
     */
@@ -332,6 +455,12 @@ class DataSource : public Runtime::Reconfigurable, public DataEmitter {
     */
     virtual void runningRoutineWithIngestionRate();
 
+    /**
+    * @brief running routine that generates a ring of numSourceLocalBuffers buffers with receiveData() first and then
+    * emits copies of them at the ingestion rate, so the generation cost does not affect the rate
+    */
+    virtual void runningRoutineWithReplay();
+
     /**
     * @brief running routine with an adaptive rate (defaults to KF)
     */
@@ -346,13 +475,39 @@ class DataSource : public Runtime::Reconfigurable, public DataEmitter {
      * @brief the KF associated with a source.
      * We use default values for initialization.
      */
-    std::unique_ptr<KalmanFilter> kFilter;
+    std::unique_ptr<KalmanFilterBase> kFilter;
+
+    /**
+     * @brief reads the adaptive value fields from the memory layout,
+     * nullptr if the schema has no numeric field
+     */
+    std::unique_ptr<Runtime::MemoryLayouts::FieldValueReader> adaptiveValueReader;
+    std::vector<double> adaptiveValues;
+
+    /**
+     * @brief the group that decides the gathering interval in the fused adaptive mode,
+     * nullptr if the source is not a member of a group
+     */
+    std::string fusedGatheringGroupName;
+    Runtime::FusedGatheringGroupPtr fusedGatheringGroup{nullptr};
+    uint64_t fusedGatheringGroupMemberId{0};
+
+    /**
+     * @brief the merged gathering policies set by the coordinator and the part of them that is not yet applied,
+     * guarded by gatheringPolicyMutex
+     */
+    std::mutex gatheringPolicyMutex;
+    GatheringPolicy gatheringPolicy;
+    GatheringPolicy pendingGatheringPolicy;
+    std::atomic<bool> gatheringPolicyChanged{false};
+    std::optional<std::chrono::milliseconds> policySlowestInterval;
 
     /**
-     * @brief window of W last seen values.
+     * @brief spectrum over the window of W last seen values.
+     * Updated incrementally on every value instead of running a full FFT per buffer.
      */
     const static uint64_t lastValuesSize{20};
-    CircularBuffer<double> lastValuesBuf;
+    Util::SlidingDFT lastValuesSpectrum;
 
 
     /**
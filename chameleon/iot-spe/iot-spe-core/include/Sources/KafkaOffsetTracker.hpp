@@ -0,0 +1,72 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#ifndef x_CORE_INCLUDE_SOURCES_KAFKAOFFSETTRACKER_HPP_
+#define x_CORE_INCLUDE_SOURCES_KAFKAOFFSETTRACKER_HPP_
+
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+namespace x {
+
+/**
+ * @brief Keeps the Kafka offsets of emitted buffers until downstream acknowledged them.
+ * The source tracks every emitted buffer with its watermark and the offsets of the next messages to consume, per partition.
+ * An epoch barrier acknowledges all buffers whose watermark is smaller than the barrier, like BufferStorage::trimBuffer(),
+ * and makes their offsets committable. Committing only acknowledged offsets gives at-least-once semantics:
+ * after a restart, the consumer resumes at the first message of a buffer that was not acknowledged.
+ * Buffers are tracked and committed by the source thread, while barriers may be acknowledged by any thread.
+ */
+class KafkaOffsetTracker {
+  public:
+    /// the offset of the next message to consume per partition
+    using PartitionOffsets = std::map<int32_t, int64_t>;
+
+    /**
+     * @brief Tracks an emitted buffer, watermarks have to be non-decreasing in emission order
+     * @param watermark the watermark of the buffer
+     * @param nextOffsets the offsets of the next messages after the buffer, per partition
+     */
+    void track(uint64_t watermark, PartitionOffsets nextOffsets);
+
+    /**
+     * @brief Acknowledges all tracked buffers whose watermark is smaller than the epoch barrier
+     * @param epochBarrier the watermark up to which downstream processed all buffers
+     */
+    void acknowledge(uint64_t epochBarrier);
+
+    /**
+     * @brief Takes the offsets that became committable since the last call
+     * @return the offsets to commit or nullopt if no buffer was acknowledged in the meantime
+     */
+    std::optional<PartitionOffsets> takeCommittableOffsets();
+
+    /**
+     * @return the number of tracked buffers that are not acknowledged yet
+     */
+    [[nodiscard]] uint64_t getNumberOfPendingBuffers() const;
+
+  private:
+    mutable std::mutex mutex;
+    std::deque<std::pair<uint64_t, PartitionOffsets>> pendingBuffers;
+    PartitionOffsets committableOffsets;
+};
+
+}// namespace x
+
+#endif// x_CORE_INCLUDE_SOURCES_KAFKAOFFSETTRACKER_HPP_
@@ -17,11 +17,14 @@
 
 #ifdef ENABLE_KAFKA_BUILD
 #include <Operators/LogicalOperators/Sources/KafkaSourceDescriptor.hpp>
+#include <Sources/KafkaOffsetTracker.hpp>
+#include <Sources/Parsers/OnDemandJSONParser.hpp>
 #include <Sources/Parsers/Parser.hpp>
 #include <cppkafka/configuration.h>
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 namespace cppkafka {
 class Consumer;
 class Message;
@@ -29,6 +32,15 @@ class Message;
 
 namespace x {
 
+/**
+ * @brief Consumes one or more partitions of a Kafka topic, see KafkaSourceType::getPartitions().
+ * Polled batches are decoded directly into tuple buffers, JSON payloads by a parser and BINARY payloads, which hold
+ * whole tuples in the row layout, by copying them.
+ * With autoCommit, the offsets are committed after every poll. Without autoCommit, each buffer carries the largest
+ * timestamp of its messages as watermark and its offsets are only committed once an epoch barrier of the sinks
+ * acknowledged the buffer, which gives at-least-once semantics. Messages without a timestamp are stamped with their
+ * ingestion time.
+ */
 class KafkaSource : public DataSource {
   public:
     /**
@@ -77,6 +89,20 @@ class KafkaSource : public DataSource {
     ~KafkaSource() override;
     std::optional<Runtime::TupleBuffer> receiveData() override;
 
+    /**
+     * @brief receiveData() blocks in the poll of the kafka consumer, so the source keeps its own thread
+     */
+    bool supportsSourceExecutor() const override { return false; }
+
+    /**
+     * @brief acknowledges all buffers with a smaller watermark than the epoch barrier, their offsets are committed
+     * with the next poll if autoCommit is disabled
+     * @param epochBarrier current epoch barrier
+     * @param queryId currect query id
+     * @return success is the message was sent
+     */
+    bool injectEpochBarrier(uint64_t epochBarrier, uint64_t queryId) override;
+
     /**
      * @brief override the toString method for the kafka source
      * @return returns string describing the kafka source
@@ -108,6 +134,11 @@ class KafkaSource : public DataSource {
      */
     uint64_t getBatchSize() const;
 
+    /**
+     * @brief Get the consumed partitions of the topic
+     */
+    const std::vector<int32_t>& getPartitions() const;
+
     /**
      * @brief If kafka offset is to be committed automatically
      */
@@ -136,6 +167,14 @@ class KafkaSource : public DataSource {
      */
     bool fillBuffer(Runtime::MemoryLayouts::DynamicTupleBuffer& tupleBuffer);
 
+    /**
+     * @brief parses the comma separated partitions of KafkaSourceType::getPartitions(), empty entries are skipped
+     * @param partitionList
+     * @throws RuntimeException if an entry is not a non-negative number
+     * @return the partitions in the order of the list
+     */
+    static std::vector<int32_t> parsePartitions(const std::string& partitionList);
+
   private:
     /**
      * @brief method to connect kafka using the host and port specified before
@@ -144,6 +183,16 @@ class KafkaSource : public DataSource {
      */
     bool connect();
 
+    /**
+     * @brief marks the current message as written to tuple buffers and moves to the next one
+     */
+    void completeMessage(const cppkafka::Message& message);
+
+    /**
+     * @brief commits the offsets of acknowledged buffers
+     */
+    void commitAcknowledgedOffsets();
+
     std::string brokers;
     std::string topic;
     std::string groupId;
@@ -158,11 +207,22 @@ class KafkaSource : public DataSource {
     uint64_t batchSize = 1;
     uint64_t numberOfTuplesPerBuffer = 1;
     std::vector<cppkafka::Message> messages;
+    // polled messages that did not fit into the previous buffer start at nextMessage
+    uint64_t nextMessage = 0;
+    uint64_t positionInMessage = 0;
     uint64_t successFullPollCnt = 0;
     uint64_t failedFullPollCnt = 0;
     uint32_t bufferFlushIntervalMs = 500;
     std::unique_ptr<Parser> inputParser;
+    // set if the payloads are parsed on demand, points to inputParser
+    OnDemandJSONParser* onDemandJSONParser = nullptr;
     std::vector<PhysicalTypePtr> physicalTypes;
+    std::vector<int32_t> partitions;
+    bool binaryInput = false;
+    // offsets of the messages after the completely written messages and the largest timestamp among them
+    KafkaOffsetTracker::PartitionOffsets consumedOffsets;
+    uint64_t maxMessageTimestamp = 0;
+    KafkaOffsetTracker offsetTracker;
 };
 
 typedef std::shared_ptr<KafkaSource> KafkaSourcePtr;
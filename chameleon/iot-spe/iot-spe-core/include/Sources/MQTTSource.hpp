@@ -19,14 +19,18 @@
 #include <Operators/LogicalOperators/Sources/MQTTSourceDescriptor.hpp>
 #include <Operators/LogicalOperators/Sources/SourceDescriptor.hpp>
 #include <Sources/DataSource.hpp>
+#include <Sources/Parsers/OnDemandJSONParser.hpp>
 #include <Sources/Parsers/Parser.hpp>
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace mqtt {
 class async_client;
 using async_clientPtr = std::shared_ptr<async_client>;
+class message;
+using const_message_ptr = std::shared_ptr<const message>;
 }// namespace mqtt
 
 namespace x {
@@ -74,6 +78,11 @@ class MQTTSource : public DataSource {
      */
     std::optional<Runtime::TupleBuffer> receiveData() override;
 
+    /**
+     * @brief receiveData() blocks on the mqtt client until a message arrives, so the source keeps its own thread
+     */
+    bool supportsSourceExecutor() const override { return false; }
+
     /**
      * @brief fill buffer tuple by tuple using the appropriate parser
      * @param tupleBuffer buffer to be filled
@@ -144,6 +153,11 @@ class MQTTSource : public DataSource {
      */
     const MQTTSourceTypePtr& getSourceConfigPtr() const;
 
+  protected:
+    // the drained messages, the vector keeps its capacity for the next batches
+    std::vector<mqtt::const_message_ptr> messageBatch;
+    uint64_t nextMessageInBatch{0};
+
   private:
     /**
      * @brief default constructor required for boost serialization
@@ -164,6 +178,18 @@ class MQTTSource : public DataSource {
      */
     bool disconnect();
 
+    /**
+     * @brief fills the buffer in batched consumption mode: waits for the first queued message, drains all other queued
+     * messages without waiting, and parses the batch, until the buffer is full or the flush interval passed
+     * @param tupleBuffer buffer to be filled
+     */
+    bool fillBufferFromBatches(Runtime::MemoryLayouts::DynamicTupleBuffer& tupleBuffer);
+
+    /**
+     * @brief resubscribes after the client reconnected, or marks the source as disconnected
+     */
+    void checkConnection();
+
     /**
      * @brief method for serialization, all listed variable below are added to the
      * serialization/deserialization process
@@ -182,6 +208,12 @@ class MQTTSource : public DataSource {
     bool cleanSession;
     std::vector<PhysicalTypePtr> physicalTypes;
     std::unique_ptr<Parser> inputParser;
+    // set if the payloads are parsed on demand, points to inputParser
+    OnDemandJSONParser* onDemandJSONParser{nullptr};
+    // a message with newline-delimited records that did not fit into the previous buffer
+    mqtt::const_message_ptr pendingMessage;
+    uint64_t pendingPosition{0};
+    bool batchedConsumption;
     long bufferFlushIntervalMs;
     //Read timeout in ms for mqtt message consumer
     long readTimeoutInMs;
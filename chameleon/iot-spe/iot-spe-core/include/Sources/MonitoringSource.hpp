@@ -53,6 +53,11 @@ class MonitoringSource : public DataSource {
 
     std::optional<Runtime::TupleBuffer> receiveData() override;
 
+    /**
+     * @brief receiveData() sleeps for the wait time, so the source keeps its own thread
+     */
+    bool supportsSourceExecutor() const override { return false; }
+
     /**
      * @brief Returns the collector type of the monitoring source.
      * @return the collector type
@@ -75,6 +75,11 @@ class OPCSource : public DataSource {
      */
     std::optional<Runtime::TupleBuffer> receiveData() override;
 
+    /**
+     * @brief receiveData() blocks on the opc client, so the source keeps its own thread
+     */
+    bool supportsSourceExecutor() const override { return false; }
+
     /**
      * @brief override the toString method for the opc source
      * @return returns string describing the opc source
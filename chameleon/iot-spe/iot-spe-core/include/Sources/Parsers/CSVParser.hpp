@@ -48,6 +48,29 @@ class CSVParser : public Parser {
                                       const SchemaPtr& schema,
                                       const Runtime::BufferManagerPtr& bufferManager) override;
 
+    /**
+   * @brief writes one line of a block that was tokenized by the CSVTokenizer to the TupleBuffer.
+   * Numeric fields are parsed with std::from_chars directly into their offsets in the buffer, which are resolved once
+   * per memory layout. All other fields, and values that from_chars does not parse completely, are written by
+   * writeFieldValueToTupleBuffer, so the result is the same as the one of writeInputTupleToTupleBuffer.
+   * @param block: start of the tokenized block
+   * @param lineStart: position of the line in the block
+   * @param separators: the positions of the delimiters of the line in the block, the last one ends the line
+   * @param numberOfSeparators: the number of separators of the line
+   * @param tupleCount: the number of tuples already written to the current TupleBuffer
+   * @param tupleBuffer: the TupleBuffer to which the value is written to containing the chosen memory layout
+   * @param schema: data schema
+   * @param bufferManager: the buffer manager
+   */
+    bool writeTokenizedLineToTupleBuffer(const char* block,
+                                         uint64_t lineStart,
+                                         const uint32_t* separators,
+                                         uint64_t numberOfSeparators,
+                                         uint64_t tupleCount,
+                                         Runtime::MemoryLayouts::DynamicTupleBuffer& tupleBuffer,
+                                         const SchemaPtr& schema,
+                                         const Runtime::BufferManagerPtr& bufferManager);
+
   private:
     uint64_t numberOfSchemaFields;
     std::vector<x::PhysicalTypePtr> physicalTypes;
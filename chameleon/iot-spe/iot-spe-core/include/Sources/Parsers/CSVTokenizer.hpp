@@ -0,0 +1,63 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#ifndef x_CORE_INCLUDE_SOURCES_PARSERS_CSVTOKENIZER_HPP_
+#define x_CORE_INCLUDE_SOURCES_PARSERS_CSVTOKENIZER_HPP_
+
+#include <cstdint>
+#include <vector>
+
+namespace x {
+
+/**
+ * @brief Finds the positions of all field delimiters and line feeds in a block of csv data.
+ * The block is scanned 64 bytes at a time: each iteration compares the bytes against the delimiter and the line feed
+ * with AVX2, SSE2, or NEON instructions, and then only visits the set bits of the resulting masks.
+ * Quoting is not supported, i.e., every delimiter separates two fields.
+ */
+class CSVTokenizer {
+  public:
+    /// flag of a separator that ends a line
+    static constexpr uint32_t LINE_END = 1U << 31;
+
+    /// the maximum size of a block, positions have to fit next to the LINE_END flag
+    static constexpr uint64_t MAX_BLOCK_SIZE = LINE_END - 1;
+
+    /**
+     * @brief Creates a tokenizer
+     * @param delimiter the field delimiter, must not be a line feed
+     */
+    explicit CSVTokenizer(char delimiter);
+
+    /**
+     * @brief Appends the position of every delimiter and line feed in the block to separators.
+     * Positions are relative to the start of the block, line feeds are marked with LINE_END.
+     * @param data start of the block
+     * @param size size of the block, at most MAX_BLOCK_SIZE
+     * @param separators the vector the positions are appended to
+     */
+    void tokenize(const char* data, uint64_t size, std::vector<uint32_t>& separators) const;
+
+    /**
+     * @return the field delimiter
+     */
+    [[nodiscard]] char getDelimiter() const;
+
+  private:
+    char delimiter;
+};
+
+}// namespace x
+
+#endif// x_CORE_INCLUDE_SOURCES_PARSERS_CSVTOKENIZER_HPP_
@@ -0,0 +1,109 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#ifndef x_CORE_INCLUDE_SOURCES_PARSERS_ONDEMANDJSONPARSER_HPP_
+#define x_CORE_INCLUDE_SOURCES_PARSERS_ONDEMANDJSONPARSER_HPP_
+
+#include <Runtime/MemoryLayout/DynamicTupleBuffer.hpp>
+#include <Sources/Parsers/Parser.hpp>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace x {
+
+/**
+ * @brief Parses flat JSON objects in a single pass without building a document.
+ * The parser walks the keys of an object and only extracts the values of the schema keys, all other values are skipped.
+ * Numeric values are parsed with std::from_chars directly into their fields, all other values are passed unquoted to
+ * writeFieldValueToTupleBuffer as the JSONParser does, so both parsers write the same tuples.
+ * Besides single objects, a payload may hold a batch of records, i.e., several objects separated by line feeds.
+ */
+class OnDemandJSONParser : public Parser {
+
+  public:
+    /**
+   * @brief public constructor for the on-demand JSON input data parser
+   * @param numberOfSchemaFields number of schema fields
+   * @param schemaKeys vector with schema keys to identify the keys in the json object
+   * @param physicalTypes vector with physical data types
+   */
+    OnDemandJSONParser(uint64_t numberOfSchemaFields,
+                       std::vector<std::string> schemaKeys,
+                       std::vector<PhysicalTypePtr> physicalTypes);
+
+    /**
+   * @brief parses a single json object and writes its schema keys to the TupleBuffer
+   * @param jsonTuple: the json object
+   * @param tupleCount: the number of tuples already written to the current TupleBuffer
+   * @param tupleBuffer: the TupleBuffer to which the value is written containing the currently chosen memory layout
+   * @param schema: data schema
+   * @param bufferManager: the buffer manager
+   * @return false if a schema key is missing or null
+   * @throws RuntimeException if the object is malformed
+   */
+    bool writeInputTupleToTupleBuffer(const std::string& jsonTuple,
+                                      uint64_t tupleCount,
+                                      Runtime::MemoryLayouts::DynamicTupleBuffer& tupleBuffer,
+                                      const SchemaPtr& schema,
+                                      const Runtime::BufferManagerPtr& bufferManager) override;
+
+    /**
+   * @brief parses the next record of a payload with newline-delimited json records
+   * @param payload: the payload of one message
+   * @param position: the position of the next record in the payload, is moved behind the parsed record
+   * @param tupleCount: the number of tuples already written to the current TupleBuffer
+   * @param tupleBuffer: the TupleBuffer to which the value is written containing the currently chosen memory layout
+   * @param schema: data schema
+   * @param bufferManager: the buffer manager
+   * @return true if a record was written, false if the payload holds no further record
+   * @throws RuntimeException if the record is malformed, or if a schema key is missing or null
+   */
+    bool writeNextRecordToTupleBuffer(std::string_view payload,
+                                      uint64_t& position,
+                                      uint64_t tupleCount,
+                                      Runtime::MemoryLayouts::DynamicTupleBuffer& tupleBuffer,
+                                      const SchemaPtr& schema,
+                                      const Runtime::BufferManagerPtr& bufferManager);
+
+  private:
+    /**
+     * @brief parses the object that starts at begin, afterwards numberOfWrittenFields tells if schema keys are missing
+     * @return the end of the object
+     * @throws RuntimeException if the object is malformed
+     */
+    const char* parseObject(const char* begin,
+                            const char* end,
+                            uint64_t tupleCount,
+                            Runtime::MemoryLayouts::DynamicTupleBuffer& tupleBuffer,
+                            const SchemaPtr& schema,
+                            const Runtime::BufferManagerPtr& bufferManager);
+
+    /// returns the index of the schema key, or numberOfSchemaFields if the key does not belong to the schema
+    uint64_t findSchemaField(std::string_view key);
+
+    /// returns the first schema key that the last object did not contain
+    const std::string& getMissingSchemaKey() const;
+
+    uint64_t numberOfSchemaFields;
+    std::vector<std::string> schemaKeys;
+    // the object that wrote a field last, to detect missing keys without clearing a flag per field and object
+    std::vector<uint64_t> fieldWrittenByObject;
+    uint64_t objectNumber{0};
+    uint64_t numberOfWrittenFields{0};
+    // keys usually arrive in the same order in every object, so the lookup starts behind the previous key
+    uint64_t nextExpectedField{0};
+};
+}// namespace x
+#endif// x_CORE_INCLUDE_SOURCES_PARSERS_ONDEMANDJSONPARSER_HPP_
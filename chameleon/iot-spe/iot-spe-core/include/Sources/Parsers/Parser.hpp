@@ -14,7 +14,10 @@
 #ifndef x_CORE_INCLUDE_SOURCES_PARSERS_PARSER_HPP_
 #define x_CORE_INCLUDE_SOURCES_PARSERS_PARSER_HPP_
 
+#include <Common/PhysicalTypes/BasicPhysicalType.hpp>
+#include <Runtime/RuntimeForwardRefs.hpp>
 #include <string>
+#include <vector>
 
 namespace x {
 
@@ -69,8 +72,43 @@ class Parser {
                                       uint64_t tupleCount,
                                       const Runtime::BufferManagerPtr& bufferManager);
 
+  protected:
+    /**
+     * @brief resolves the offsets and strides of the numeric fields for the memory layout of the buffer,
+     * has to be called before writeNumericFieldValue() writes to a buffer. Only the first call per layout resolves.
+     * @param tupleBuffer the buffer that is written next
+     */
+    void prepareNumericFieldWriters(const Runtime::MemoryLayouts::DynamicTupleBuffer& tupleBuffer);
+
+    /**
+     * @brief parses a numeric value with std::from_chars directly into its field in the buffer
+     * @param begin start of the value, may be surrounded by blanks
+     * @param end end of the value
+     * @param schemaFieldIndex field/attribute that is currently processed
+     * @param tupleBuffer the buffer that was passed to prepareNumericFieldWriters()
+     * @param tupleCount current tuple count, i.e. how many tuples have already been produced
+     * @return false if the field is not numeric or the value is not a number. The value has to be written with
+     * writeFieldValueToTupleBuffer() then, so that the result does not depend on the path.
+     */
+    bool writeNumericFieldValue(const char* begin,
+                                const char* end,
+                                uint64_t schemaFieldIndex,
+                                Runtime::MemoryLayouts::DynamicTupleBuffer& tupleBuffer,
+                                uint64_t tupleCount) const;
+
   private:
+    /**
+     * @brief native type and location of a field in the buffers of one memory layout
+     */
+    struct FieldWriter {
+        BasicPhysicalType::NativeType nativeType;// UNDEFINED for fields that are not basic types
+        uint64_t offset;
+        uint64_t stride;
+    };
+
     std::vector<PhysicalTypePtr> physicalTypes;
+    std::vector<FieldWriter> fieldWriters;
+    Runtime::MemoryLayouts::MemoryLayoutPtr fieldWriterLayout;
 };
 }//namespace x
 #endif// x_CORE_INCLUDE_SOURCES_PARSERS_PARSER_HPP_
@@ -0,0 +1,127 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#ifndef x_CORE_INCLUDE_SOURCES_PARTITIONEDFILEREADER_HPP_
+#define x_CORE_INCLUDE_SOURCES_PARTITIONEDFILEREADER_HPP_
+
+#include <Runtime/TupleBuffer.hpp>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace x {
+
+/**
+ * @brief Parses the partitions of a file on several reader threads and hands out the parsed buffers in file order.
+ *
+ * A file source splits its file into partitions that can be parsed independently, e.g., newline aligned byte ranges
+ * of a CSV file or the record batches of an Arrow file. Reader threads claim the partitions in ascending order and
+ * parse each one into a list of buffers. next() returns the buffers of partition 0, then of partition 1, and so on,
+ * so the source thread still calls emitWorkFromSource() in file order and sequence numbers and watermarks stay
+ * monotonic, no matter which reader finishes first.
+ * At most maxPartitionsInFlight partitions are parsed or waiting for the source thread at any time, which bounds the
+ * number of buffers that the readers hold. A reader that runs ahead of the source thread waits until the oldest
+ * partition is handed out.
+ */
+class PartitionedFileReader {
+  public:
+    /**
+     * @brief parses one partition into buffers, runs on a reader thread.
+     * Buffers must be allocated from a thread-safe buffer manager, exceptions are rethrown by next().
+     */
+    using PartitionParser = std::function<void(uint64_t partitionIndex, std::vector<Runtime::TupleBuffer>& buffers)>;
+
+    /**
+     * @brief Creates a reader, the reader threads start with start()
+     * @param numberOfPartitions the number of partitions of the file
+     * @param numberOfThreads the number of reader threads
+     * @param partitionParser parses one partition, is called concurrently for different partitions
+     * @param maxPartitionsInFlight the number of partitions that are parsed ahead of the source thread,
+     * 0 selects two per reader thread
+     */
+    PartitionedFileReader(uint64_t numberOfPartitions,
+                          uint32_t numberOfThreads,
+                          PartitionParser partitionParser,
+                          uint64_t maxPartitionsInFlight = 0);
+
+    PartitionedFileReader(const PartitionedFileReader&) = delete;
+    PartitionedFileReader& operator=(const PartitionedFileReader&) = delete;
+
+    /// destructor that stops the reader threads
+    ~PartitionedFileReader();
+
+    /**
+     * @brief starts the reader threads, only the first invocation has an effect
+     */
+    void start();
+
+    /**
+     * @brief stops the reader threads and releases all buffers that were not handed out.
+     * A partition that is being parsed is finished and dropped.
+     */
+    void stop();
+
+    /**
+     * @brief returns the next buffer in file order and blocks until its partition is parsed
+     * @return the buffer, or an empty optional if all partitions were handed out or the reader was stopped
+     * @throws the exception of the partition parser that failed for the next partition
+     */
+    std::optional<Runtime::TupleBuffer> next();
+
+    /**
+     * @return the number of partitions of the file
+     */
+    [[nodiscard]] uint64_t getNumberOfPartitions() const;
+
+  private:
+    struct Partition {
+        std::vector<Runtime::TupleBuffer> buffers;
+        std::exception_ptr error;
+        bool parsed{false};
+    };
+
+    /// the routine of a reader thread
+    void readerRoutine();
+
+    /// the slot of a partition in the ring of partitions in flight
+    Partition& getPartition(uint64_t partitionIndex);
+
+    const uint64_t numberOfPartitions;
+    const uint32_t numberOfThreads;
+    const uint64_t maxPartitionsInFlight;
+    PartitionParser partitionParser;
+
+    std::mutex mutex;
+    std::condition_variable partitionParsed;
+    std::condition_variable windowAdvanced;
+    std::vector<Partition> partitionsInFlight;
+    uint64_t nextPartitionToParse{0};
+    uint64_t nextPartitionToEmit{0};
+    uint64_t nextBufferToEmit{0};
+    bool running{false};
+    bool started{false};
+    std::vector<std::thread> readerThreads;
+};
+
+using PartitionedFileReaderPtr = std::unique_ptr<PartitionedFileReader>;
+
+}// namespace x
+
+#endif// x_CORE_INCLUDE_SOURCES_PARTITIONEDFILEREADER_HPP_
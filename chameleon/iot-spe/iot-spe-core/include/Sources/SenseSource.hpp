@@ -15,13 +15,22 @@
 #ifndef x_CORE_INCLUDE_SOURCES_SENSESOURCE_HPP_
 #define x_CORE_INCLUDE_SOURCES_SENSESOURCE_HPP_
 
+#include <Catalogs/Source/PhysicalSourceTypes/SenseSourceType.hpp>
+#include <Sensors/GenericBus.hpp>
 #include <Sources/DataSource.hpp>
+#include <atomic>
 #include <fstream>
 #include <string>
 
 namespace x {
 /**
- * @brief this class implement the CSV as an input source
+ * @brief this class implements a source that polls a sensor over a sensor bus
+ *
+ * Every tuple is one read of schema-size bytes from the registers of the sensor, starting at register 0.
+ * The bus polls on the gathering interval. In the adaptive modes, the interval that the KF proposes is pushed
+ * down to the polling schedule of the bus, so slower gathering saves bus transactions instead of only
+ * delaying the emission of buffers. The source reports the reads it saved compared to polling on the
+ * configured gathering interval.
  */
 class SenseSource : public DataSource {
   public:
@@ -31,6 +40,7 @@ class SenseSource : public DataSource {
      * @param bufferManager pointer to the buffer manager
      * @param queryManager pointer to the query manager
      * @param udfs to apply
+     * @param senseSourceType the bus and gathering configuration, no bus is polled if nullptr
      * @param operatorId current operator id
      * @param originId represents the identifier of the upstream operator that represents the origin of the input stream
      * @param numSourceLocalBuffers the number of buffers allocated to a source
@@ -41,6 +51,7 @@ class SenseSource : public DataSource {
                          Runtime::BufferManagerPtr bufferManager,
                          Runtime::QueryManagerPtr queryManager,
                          std::string udfs,
+                         const SenseSourceTypePtr& senseSourceType,
                          OperatorId operatorId,
                          OriginId originId,
                          size_t numSourceLocalBuffers,
@@ -59,6 +70,21 @@ class SenseSource : public DataSource {
    */
     void fillBuffer(Runtime::TupleBuffer&);
 
+    /**
+     * @brief initializes the sensor bus
+     */
+    void open() override;
+
+    /**
+     * @brief reports the read savings
+     */
+    void close() override;
+
+    /**
+     * @brief a source with a sensor bus waits on the polling schedule of the bus and needs a thread of its own
+     */
+    bool supportsSourceExecutor() const override;
+
     /**
      * @brief override the toString method for the csv source
      * @return returns string describing the binary source
@@ -75,8 +101,42 @@ class SenseSource : public DataSource {
      */
     const std::string& getUdfs() const;
 
+    /**
+     * @return the sensor bus or nullptr
+     */
+    Sensors::GenericBusPtr getBus() const;
+
+    /**
+     * @return the number of read transactions on the sensor bus
+     */
+    uint64_t getNumberOfBusReads() const;
+
+    /**
+     * @return the number of reads that polling on the configured gathering interval takes for the same time
+     */
+    uint64_t getNumberOfBaselineBusReads() const;
+
+    /**
+     * @return the fraction of bus reads saved compared to polling on the configured gathering interval
+     */
+    double getReadSavings() const;
+
+  protected:
+    /**
+     * @brief applies the new gathering interval to the polling schedule of the bus
+     */
+    void onGatheringIntervalChange(std::chrono::milliseconds newGatheringInterval) override;
+
   private:
     std::string udfs;
+    std::string busPath;// outlives the bus, which keeps a pointer to it
+    Sensors::GenericBusPtr bus{nullptr};
+    int busAddress{0};
+    uint64_t numberOfTuplesToProducePerBuffer{1};
+    uint64_t tupleSize;
+    std::vector<unsigned char> tupleBytes;
+    std::chrono::milliseconds configuredGatheringInterval{0};
+    std::atomic<uint64_t> pollingTimeInMs{0};
 };
 
 using SenseSourcePtr = std::shared_ptr<SenseSource>;
@@ -22,6 +22,7 @@
 #include <Operators/LogicalOperators/Sources/CsvSourceDescriptor.hpp>
 #include <Operators/LogicalOperators/Sources/KafkaSourceDescriptor.hpp>
 #include <Operators/LogicalOperators/Sources/MQTTSourceDescriptor.hpp>
+#include <Operators/LogicalOperators/Sources/SenseSourceDescriptor.hpp>
 #include <Sources/BenchmarkSource.hpp>
 #include <Sources/DataSource.hpp>
 #include <Sources/GeneratorSource.hpp>
@@ -192,6 +193,7 @@ DataSourcePtr createBinaryFileSource(const SchemaPtr& schema,
  * @param bufferManager pointer to the buffer manager
  * @param queryManager pointer to the query manager
  * @param udfs of the file
+ * @param senseSourceType the sensor bus and gathering configuration, no bus is polled if nullptr
  * @param operatorId current operator id
  * @param originId represents the identifier of the upstream operator that represents the origin of the input stream
  * @param numSourceLocalBuffers the number of buffers allocated to a source
@@ -203,6 +205,7 @@ DataSourcePtr createSenseSource(const SchemaPtr& schema,
                                 const Runtime::BufferManagerPtr& bufferManager,
                                 const Runtime::QueryManagerPtr& queryManager,
                                 const std::string& udfs,
+                                const SenseSourceTypePtr& senseSourceType,
                                 OperatorId operatorId,
                                 OriginId originId,
                                 size_t numSourceLocalBuffers,
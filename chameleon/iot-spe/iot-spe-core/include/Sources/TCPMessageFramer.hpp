@@ -0,0 +1,100 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#ifndef x_CORE_INCLUDE_SOURCES_TCPMESSAGEFRAMER_HPP_
+#define x_CORE_INCLUDE_SOURCES_TCPMESSAGEFRAMER_HPP_
+
+#include <Configurations/ConfigurationsNames.hpp>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace x {
+
+/**
+ * @brief Splits the byte stream of a TCP connection into messages without copying them.
+ * Bytes are received directly into a reusable buffer, see getWritableSpace() and commitWrite(), and nextMessage() returns
+ * views of complete messages inside this buffer. The framing follows Configurations::TCPDecideMessageSize:
+ *  - TUPLE_SEPARATOR: messages end with the tuple separator, which is not part of the message,
+ *  - USER_SPECIFIED_BUFFER_SIZE: all messages have the same size,
+ *  - BUFFER_SIZE_FROM_SOCKET: each message is preceded by a fixed number of bytes with its size as decimal number.
+ * The buffer only moves the bytes of an incomplete message to its front, and only grows if a message does not fit.
+ */
+class TCPMessageFramer {
+  public:
+    /**
+     * @brief Creates a TCPMessageFramer
+     * @param decideMessageSize how the end of a message is found
+     * @param tupleSeparator the separator for TUPLE_SEPARATOR
+     * @param messageSize the size of every message for USER_SPECIFIED_BUFFER_SIZE
+     * @param bytesUsedForMessageSize the size of the size prefix for BUFFER_SIZE_FROM_SOCKET
+     * @param initialCapacity the initial size of the receive buffer
+     * @throws RuntimeException if the size of a message or of the size prefix is zero
+     */
+    TCPMessageFramer(Configurations::TCPDecideMessageSize decideMessageSize,
+                     char tupleSeparator,
+                     uint64_t messageSize,
+                     uint64_t bytesUsedForMessageSize,
+                     uint64_t initialCapacity = 2048);
+
+    /**
+     * @brief Makes room for new bytes behind the buffered bytes. Invalidates all message views.
+     * @return the start and the size of the free space, which is never empty
+     */
+    std::pair<char*, uint64_t> getWritableSpace();
+
+    /**
+     * @brief Marks bytes in the free space as received
+     * @param numberOfBytes the number of bytes that were written to the start of the free space
+     */
+    void commitWrite(uint64_t numberOfBytes);
+
+    /**
+     * @brief Returns the next complete message and consumes it. Empty messages are skipped.
+     * @return a view of the message, which stays valid until the next call to getWritableSpace(), or nullopt if the
+     * buffered bytes do not contain a complete message
+     * @throws RuntimeException if the size prefix of a message is not a number
+     */
+    std::optional<std::string_view> nextMessage();
+
+    /**
+     * @return the number of received bytes that were not returned as message yet
+     */
+    [[nodiscard]] uint64_t getNumberOfBufferedBytes() const;
+
+    /**
+     * @return the current size of the receive buffer
+     */
+    [[nodiscard]] uint64_t getCapacity() const;
+
+  private:
+    Configurations::TCPDecideMessageSize decideMessageSize;
+    char tupleSeparator;
+    uint64_t messageSize;
+    uint64_t bytesUsedForMessageSize;
+
+    std::vector<char> buffer;
+    uint64_t readPosition{0};
+    uint64_t writePosition{0};
+    // the search for the next tuple separator continues here
+    uint64_t scanPosition{0};
+    // the number of bytes that the incomplete message at readPosition needs, if known
+    uint64_t requiredBytes{0};
+};
+
+}// namespace x
+
+#endif// x_CORE_INCLUDE_SOURCES_TCPMESSAGEFRAMER_HPP_
@@ -19,7 +19,8 @@
 #include <Operators/LogicalOperators/Sources/SourceDescriptor.hpp>
 #include <Operators/LogicalOperators/Sources/TCPSourceDescriptor.hpp>
 #include <Sources/DataSource.hpp>
-#include <Util/CircularBuffer.hpp>
+#include <Sources/TCPMessageFramer.hpp>
+#include <string_view>
 
 namespace x {
 
@@ -70,21 +71,6 @@ class TCPSource : public DataSource {
      */
     bool fillBuffer(Runtime::MemoryLayouts::DynamicTupleBuffer&);
 
-    /**
-     * @brief search from the back (first inputted item) to the front for the given search token
-     * @token to search for
-     * @return number of places until first occurrence of token (place of token not included)
-     */
-    uint64_t sizeUntilSearchToken(char token);
-
-    /**
-     * @brief pop number of values given and fill temp with popped values. If popTextDevider true, pop one more value and discard
-     * @param numberOfValuesToPop number of values to pop and fill temp with
-     * @param popTextDivider if true, pop one more value and discard, if false, only pop given number of values to pop
-     * @return true if number of values to pop successfully popped, false otherwise
-     */
-    bool popGivenNumberOfValues(uint64_t numberOfValuesToPop, bool popTextDivider);
-
     /**
      * @brief override the toString method for the csv source
      * @return returns string describing the binary source
@@ -113,7 +99,25 @@ class TCPSource : public DataSource {
      */
     void close() override;
 
+    /**
+     * @brief fillBuffer() blocks on the socket until the buffer is full or the flush interval passed, readiness of the
+     * socket only guarantees the first read, so the source keeps its own thread
+     */
+    bool supportsSourceExecutor() const override { return false; }
+
   private:
+    /**
+     * @brief receives bytes from the socket
+     * @return the number of received bytes, 0 if the server closed the connection, or -1 if an error occurred
+     */
+    int64_t receive(char* target, uint64_t size);
+
+    /**
+     * @brief receives bytes from the socket into the message framer
+     * @return false if an error occurred
+     */
+    bool receiveMessages();
+
     std::vector<PhysicalTypePtr> physicalTypes;
     ParserPtr inputParser;
     int connection = -1;
@@ -121,8 +125,19 @@ class TCPSource : public DataSource {
     uint64_t tuplesThisPass;
     TCPSourceTypePtr sourceConfig;
     int sockfd = -1;
-    CircularBuffer<char> circularBuffer;
-    char* messageBuffer;
+    // binary tuples are copied as they are, without a parser
+    bool binaryInput;
+    // binary tuples without framing are received directly into the tuple buffer
+    bool receiveTuplesDirectly;
+    TCPMessageFramer messageFramer;
+    // reused for the text parsers, which expect a string
+    std::string message;
+    // the received part of a binary tuple that did not fit into the previous buffer
+    std::vector<char> partialTuple;
+    uint64_t partialTupleSize = 0;
+    // the tuples of a binary message that did not fit into the previous buffer
+    std::string_view pendingMessage;
+    bool endOfStream = false;
 };
 using TCPSourcePtr = std::shared_ptr<TCPSource>;
 }// namespace x
@@ -16,7 +16,9 @@
 #define x_CORE_INCLUDE_SOURCES_ZMQSOURCE_HPP_
 
 #include <cstdint>
+#include <deque>
 #include <memory>
+#include <optional>
 #include <string>
 #include <zmq.hpp>
 
@@ -62,7 +64,8 @@ class ZmqSource : public DataSource {
     ~ZmqSource() x_NOEXCEPT(false) override;
 
     /**
-     * @brief blocking method to receive a buffer from the zmq source
+     * @brief blocking method to receive a buffer from the zmq source.
+     * Buffers that are already queued on the socket are received as well and returned by the following calls.
      * @return TupleBufferPtr containing thre received buffer
      */
     std::optional<Runtime::TupleBuffer> receiveData() override;
@@ -95,6 +98,11 @@ class ZmqSource : public DataSource {
         return DataSource::stop(graceful);
     }
 
+    /**
+     * @brief receiveData() blocks on the zmq socket, so the source keeps its own thread
+     */
+    bool supportsSourceExecutor() const override { return false; }
+
   private:
     /**
      * @brief default constructor required for boost serialization
@@ -115,6 +123,13 @@ class ZmqSource : public DataSource {
      */
     bool disconnect();
 
+    /**
+     * @brief receives the envelope and the payload of one buffer, the payload directly into a pooled buffer
+     * @param flags zmq::recv_flags::dontwait returns nullopt if no buffer is queued
+     * @return the buffer or nullopt if no buffer was received
+     */
+    std::optional<Runtime::TupleBuffer> receiveBuffer(zmq::recv_flags flags);
+
     /**
      * @brief method for serialization, all listed variable below are added to the
      * serialization/deserialization process
@@ -125,6 +140,8 @@ class ZmqSource : public DataSource {
     bool connected;
     zmq::context_t context;
     zmq::socket_t socket;
+    // buffers that were drained from the socket and are handed out by the next calls of receiveData
+    std::deque<Runtime::TupleBuffer> receivedBuffers;
 };
 
 using ZmqSourcePtr = std::shared_ptr<ZmqSource>;
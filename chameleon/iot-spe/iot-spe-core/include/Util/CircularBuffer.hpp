@@ -17,6 +17,7 @@
 
 #include <memory>
 #include <type_traits>
+#include <vector>
 namespace x {
 
 namespace detail {
@@ -0,0 +1,29 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#ifndef x_CORE_INCLUDE_UTIL_FILESINKWRITEMODE_HPP_
+#define x_CORE_INCLUDE_UTIL_FILESINKWRITEMODE_HPP_
+
+#include <cstdint>
+
+namespace x {
+
+enum class FileSinkWriteMode : uint8_t {
+    SYNCHRONOUS = 0, ///Every worker formats and writes its buffer under the write lock and flushes the file
+    GROUP_COMMIT = 1,///A writer thread coalesces the buffers of all workers, watermarks advance once the OS took the data
+    GROUP_COMMIT_FSYNC = 2///Like GROUP_COMMIT, but every batch is synced to disk before the watermarks advance
+};
+}// namespace x
+
+#endif// x_CORE_INCLUDE_UTIL_FILESINKWRITEMODE_HPP_
@@ -0,0 +1,231 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#ifndef x_CORE_INCLUDE_UTIL_FIXEDSIZEKALMANFILTER_HPP_
+#define x_CORE_INCLUDE_UTIL_FIXEDSIZEKALMANFILTER_HPP_
+
+#include <Eigen/Dense>
+#include <Util/KalmanFilterBase.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <ctime>
+
+namespace x {
+
+/**
+ * @brief Kalman Filter with N states and M measurements, known at compile time.
+ *
+ * Same model and gathering interval logic as KalmanFilter, but all matrices are
+ * fixed-size Eigen types that live inside the object. Hence, update() and
+ * updateFromValues() do not touch the heap. For a scalar observation (M = 1)
+ * the innovation covariance is a scalar and the gain is computed in closed form,
+ * instead of through a general matrix inverse.
+ *
+ * The default model (setDefaultValues) is the 3-state projectile model of
+ * KalmanFilter, other dimensions have to pass their model to the full c-tor.
+ *
+ * @tparam N number of states
+ * @tparam M number of measurements
+ */
+template<int N, int M>
+class FixedSizeKalmanFilter : public KalmanFilterBase {
+    static_assert(N > 0 && M > 0, "FixedSizeKalmanFilter needs at least one state and one measurement");
+
+  public:
+    using StateVector = Eigen::Matrix<double, N, 1>;
+    using MeasurementVector = Eigen::Matrix<double, M, 1>;
+    using StateMatrix = Eigen::Matrix<double, N, N>;
+    using ObservationMatrix = Eigen::Matrix<double, M, N>;
+    using MeasurementMatrix = Eigen::Matrix<double, M, M>;
+    using GainMatrix = Eigen::Matrix<double, N, M>;
+
+    /**
+     * Full c-tor of a filter.
+     * The parameters use the mathematical names
+     * of the matrices.
+     *
+     * @param timeStep
+     * @param F
+     * @param H
+     * @param Q
+     * @param R
+     * @param P
+     * @param errorWindowSize
+     */
+    explicit FixedSizeKalmanFilter(double timeStep,
+                                   const StateMatrix& F,
+                                   const ObservationMatrix& H,
+                                   const StateMatrix& Q,
+                                   const MeasurementMatrix& R,
+                                   const StateMatrix& P,
+                                   uint64_t errorWindowSize = 10)
+        : KalmanFilterBase(errorWindowSize), hasModel(true), stateTransitionModel(F), observationModel(H),
+          processNoiseCovariance(Q), measurementNoiseCovariance(R), estimateCovariance(P) {
+        this->timeStep = timeStep;
+        xHat.setZero();
+        innovationError.setZero();
+    }
+
+    /**
+     * Simple c-tor of a filter.
+     * Only uses the history window size.
+     * The model is set by init() or setDefaultValues().
+     *
+     * @param errorWindowSize
+     */
+    explicit FixedSizeKalmanFilter(uint64_t errorWindowSize = 10) : KalmanFilterBase(errorWindowSize) {
+        xHat.setZero();
+        innovationError.setZero();
+    }
+
+    /**
+     * Initialize the filter with an all-zeroes state.
+     * Filters without a model get the default values.
+     */
+    void init() override {
+        initModel();
+        xHat.setZero();
+    }
+
+    void init(const StateVector& initialState) {
+        initModel();
+        xHat = initialState;
+    }
+
+    void init(const StateVector& initialState, double initialTimestamp) {
+        init(initialState);
+        this->initialTimestamp = initialTimestamp;
+        this->currentTime = initialTimestamp;
+    }
+
+    /**
+     * create artificial initial values, same as KalmanFilter::setDefaultValues
+     */
+    void setDefaultValues()
+        requires(N == 3 && M == 1)
+    {
+        // timestep value
+        this->timeStep = 1.0 / 30;
+
+        // Discrete LTI projectile motion, measuring position only
+        stateTransitionModel << 1, this->timeStep, 0, 0, 1, this->timeStep, 0, 0, 1;
+        observationModel << 1, 0, 0;
+
+        // Reasonable covariance matrices
+        processNoiseCovariance << .05, .05, .0, .05, .05, .0, .0, .0, .0;
+        measurementNoiseCovariance << 5;
+        estimateCovariance << .1, .1, .1, .1, 10000, 10, .1, 10, 100;
+
+        xHat.setZero();
+        this->initialTimestamp = std::time(nullptr);
+        this->currentTime = std::time(nullptr);
+        hasModel = true;
+    }
+
+    /**
+     * Update methods, with different signatures.
+     * 1st - use only a vector of measured values
+     * 2nd - vector of values + timestep for updates
+     * 3rd - values + timestem + dynamics matrix
+     * @param measuredValues
+     */
+    void update(const MeasurementVector& measuredValues) {
+        // simplified prediction phase
+        StateVector xHatNew = stateTransitionModel * xHat;// no control unit (B*u), predicted a-priori state estimate
+        estimateCovariance = stateTransitionModel * estimateCovariance * stateTransitionModel.transpose()
+            + processNoiseCovariance;// predicted a-priori estimate covariance
+
+        // update phase, see KalmanFilter::update
+        innovationError = measuredValues - observationModel * xHatNew;// update innovation error ψ_k, eq. 2 + 3
+        GainMatrix kalmanGain;
+        if constexpr (M == 1) {
+            // scalar innovation covariance, the gain needs no matrix inverse
+            double innovationCovariance =
+                (observationModel * estimateCovariance * observationModel.transpose())(0, 0) + measurementNoiseCovariance(0, 0);
+            kalmanGain = estimateCovariance * observationModel.transpose() / innovationCovariance;
+        } else {
+            // fixed-size inverse, Eigen uses closed-form cofactors up to 4x4
+            kalmanGain = estimateCovariance * observationModel.transpose()
+                * (observationModel * estimateCovariance * observationModel.transpose() + measurementNoiseCovariance).inverse();
+        }
+        xHatNew += kalmanGain * innovationError;// updated a-posteriori state estimate
+        estimateCovariance = (StateMatrix::Identity() - kalmanGain * observationModel)
+            * estimateCovariance;// updated a-posteriori estimate covariance
+        xHat = xHatNew;          // updated xHat
+
+        // update estimation error, eq.8, relative innovation error per measurement
+        this->estimationError = (innovationError.array() / measuredValues.array()).matrix().norm();
+        this->kfErrorWindow.emplace(this->estimationError);// store result in error window
+        // update timestep
+        this->currentTime += this->timeStep;
+    }
+
+    void update(const MeasurementVector& measuredValues, double newTimeStep) {
+        this->timeStep = newTimeStep;
+        update(measuredValues);
+    }
+
+    void update(const MeasurementVector& measuredValues, double newTimeStep, const StateMatrix& F) {
+        stateTransitionModel = F;
+        this->timeStep = newTimeStep;
+        update(measuredValues);
+    }
+
+    void updateFromValues(const double* measurements, uint64_t numberOfMeasurements) override {
+        for (uint64_t i = 0; i < numberOfMeasurements; ++i) {
+            update(Eigen::Map<const MeasurementVector>(measurements + i * M));
+        }
+    }
+
+    [[nodiscard]] uint64_t getMeasurementSize() const override { return M; }
+
+    // simple setters/getters for individual fields
+    const StateVector& getState() const { return xHat; }
+    const StateMatrix& getError() const { return estimateCovariance; }
+    const MeasurementVector& getInnovationError() const { return innovationError; }
+
+  protected:
+    void initModel() {
+        if constexpr (N == 3 && M == 1) {
+            if (!hasModel) {
+                setDefaultValues();
+                return;
+            }
+        }
+        x_ASSERT(hasModel, "FixedSizeKalmanFilter: no default model for these dimensions, use the full c-tor");
+        this->initialTimestamp = std::time(nullptr);
+        this->currentTime = this->initialTimestamp;
+    }
+
+    bool hasModel{false};
+
+    /**
+     * Process-specific matrices, see KalmanFilter.
+     */
+    StateMatrix stateTransitionModel{StateMatrix::Zero()};
+    ObservationMatrix observationModel{ObservationMatrix::Zero()};
+    StateMatrix processNoiseCovariance{StateMatrix::Zero()};
+    MeasurementMatrix measurementNoiseCovariance{MeasurementMatrix::Zero()};
+    StateMatrix estimateCovariance{StateMatrix::Zero()};
+
+    /**
+     * Estimated state and error between predict/update
+     */
+    StateVector xHat;
+    MeasurementVector innovationError;// eq. 3
+
+};// class FixedSizeKalmanFilter
+
+}// namespace x
+
+#endif// x_CORE_INCLUDE_UTIL_FIXEDSIZEKALMANFILTER_HPP_
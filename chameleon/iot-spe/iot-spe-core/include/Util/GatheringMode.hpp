@@ -19,7 +19,14 @@
 
 namespace x {
 
-enum class GatheringMode : uint8_t { INTERVAL_MODE = 0, INGESTION_RATE_MODE = 1, ADAPTIVE_MODE = 2, ADAPTIVE_MODE_OVERSAMPLER = 3 };
+enum class GatheringMode : uint8_t {
+    INTERVAL_MODE = 0,
+    INGESTION_RATE_MODE = 1,
+    ADAPTIVE_MODE = 2,
+    ADAPTIVE_MODE_OVERSAMPLER = 3,
+    FUSED_ADAPTIVE_MODE = 4,// one Kalman filter and gathering interval for a group of sources
+    REPLAY_MODE = 5         // pre-generated buffers are emitted again and again at the ingestion rate
+};
 
 inline const char* GatheringModeString(GatheringMode v)
 {
@@ -28,6 +35,8 @@ inline const char* GatheringModeString(GatheringMode v)
         case GatheringMode::INGESTION_RATE_MODE: return "Ingestion";
         case GatheringMode::ADAPTIVE_MODE: return "Adaptive";
         case GatheringMode::ADAPTIVE_MODE_OVERSAMPLER: return "AdaptiveOversampler";
+        case GatheringMode::FUSED_ADAPTIVE_MODE: return "FusedAdaptive";
+        case GatheringMode::REPLAY_MODE: return "Replay";
         default: return "Interval";
     }
 }
@@ -0,0 +1,61 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#ifndef x_CORE_INCLUDE_UTIL_GATHERINGPOLICY_HPP_
+#define x_CORE_INCLUDE_UTIL_GATHERINGPOLICY_HPP_
+
+#include <chrono>
+#include <optional>
+#include <string>
+
+namespace x {
+
+class KalmanFilterBase;
+
+/**
+ * @brief Runtime settings of the Kalman filter that drives the adaptive gathering modes of a source.
+ * The coordinator sets them for groups of sources, see WorkerRPCService::SetGatheringPolicy.
+ * Fields that are not set leave the respective setting of the filter unchanged.
+ */
+struct GatheringPolicy {
+    std::optional<std::chrono::milliseconds> gatheringInterval;
+    std::optional<std::chrono::milliseconds> gatheringIntervalRange;
+    std::optional<std::chrono::milliseconds> slowestInterval;
+    std::optional<std::chrono::milliseconds> fastestInterval;
+    std::optional<float> lambda;
+
+    /**
+     * @return true if no field is set
+     */
+    [[nodiscard]] bool empty() const;
+
+    /**
+     * @brief overwrites the fields of this policy with the fields that are set in other
+     * @param other
+     */
+    void merge(const GatheringPolicy& other);
+
+    /**
+     * @brief applies the fields that are set to a filter. The gathering interval is applied first,
+     * as it resets the slowest and fastest interval of the filter.
+     * @param kFilter
+     */
+    void applyTo(KalmanFilterBase& kFilter) const;
+
+    [[nodiscard]] std::string toString() const;
+};
+
+}// namespace x
+
+#endif// x_CORE_INCLUDE_UTIL_GATHERINGPOLICY_HPP_
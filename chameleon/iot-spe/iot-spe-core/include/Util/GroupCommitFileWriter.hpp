@@ -0,0 +1,116 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#ifndef x_CORE_INCLUDE_UTIL_GROUPCOMMITFILEWRITER_HPP_
+#define x_CORE_INCLUDE_UTIL_GROUPCOMMITFILEWRITER_HPP_
+
+#include <atomic>
+#include <cstdint>
+#include <folly/MPMCQueue.h>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace x::Util {
+
+/**
+ * @brief Appends data of many producer threads to a file from one writer thread.
+ * Producers hand their data to a bounded lock-free queue and return immediately, unless the queue is full.
+ * The writer thread drains everything that is queued, up to maxBatchSizeInBytes, and writes it with a single pwritev call
+ * (group commit). If syncToDisk is set, each batch is synced with fdatasync before it is acknowledged.
+ * The completion callbacks of a batch run on the writer thread in the order of the writes, after the batch is written.
+ * If a batch cannot be written, its callbacks are not invoked and all further writes are rejected.
+ */
+class GroupCommitFileWriter {
+  public:
+    static constexpr uint64_t DEFAULT_MAX_BATCH_SIZE_IN_BYTES = 4 * 1024 * 1024;
+    static constexpr uint64_t DEFAULT_QUEUE_CAPACITY = 1024;
+
+    /**
+     * @brief Opens the file, appends to it if it exists, and starts the writer thread
+     * @param filePath the path of the file
+     * @param syncToDisk if each batch is synced to disk before its completion callbacks are invoked
+     * @param maxBatchSizeInBytes the size after which a batch is written, even if more data is queued
+     * @param queueCapacity the number of writes that can be queued before producers block
+     * @throws RuntimeException if the file cannot be opened
+     */
+    explicit GroupCommitFileWriter(const std::string& filePath,
+                                   bool syncToDisk = false,
+                                   uint64_t maxBatchSizeInBytes = DEFAULT_MAX_BATCH_SIZE_IN_BYTES,
+                                   uint64_t queueCapacity = DEFAULT_QUEUE_CAPACITY);
+
+    GroupCommitFileWriter(const GroupCommitFileWriter&) = delete;
+    GroupCommitFileWriter& operator=(const GroupCommitFileWriter&) = delete;
+
+    /**
+     * @brief Writes all queued data, stops the writer thread, and closes the file
+     */
+    ~GroupCommitFileWriter();
+
+    /**
+     * @brief Queues data to be appended to the file, thread-safe
+     * @param data the data to append
+     * @param onWritten invoked on the writer thread once the data is written (and synced), may be empty
+     * @return false if the writer is stopped or failed to write an earlier batch
+     */
+    bool write(std::string data, std::function<void()> onWritten = {});
+
+    /**
+     * @brief Writes all queued data and stops the writer thread, only the first invocation has an effect.
+     * Must not run concurrently with write().
+     * @return true if all data was written
+     */
+    bool stop();
+
+    /**
+     * @return the number of bytes written to the file so far
+     */
+    [[nodiscard]] uint64_t getNumberOfWrittenBytes() const;
+
+    /**
+     * @return the number of batches written to the file so far
+     */
+    [[nodiscard]] uint64_t getNumberOfBatches() const;
+
+  private:
+    struct PendingWrite {
+        std::string data;
+        std::function<void()> onWritten;
+        bool isStopMarker{false};
+    };
+
+    /// the routine of the writer thread
+    void writerRoutine();
+
+    /// writes a batch at the end of the file, returns false on an error
+    bool writeBatch(std::vector<PendingWrite>& batch);
+
+    std::string filePath;
+    bool syncToDisk;
+    uint64_t maxBatchSizeInBytes;
+    int fileDescriptor{-1};
+    uint64_t fileOffset{0};
+
+    folly::MPMCQueue<PendingWrite> pendingWrites;
+    std::thread writerThread;
+    std::atomic<bool> running{true};
+    std::atomic<bool> failed{false};
+    std::atomic<uint64_t> numberOfWrittenBytes{0};
+    std::atomic<uint64_t> numberOfBatches{0};
+};
+
+}// namespace x::Util
+
+#endif// x_CORE_INCLUDE_UTIL_GROUPCOMMITFILEWRITER_HPP_
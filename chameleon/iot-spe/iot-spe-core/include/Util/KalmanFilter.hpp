@@ -16,8 +16,8 @@
 #define x_CORE_INCLUDE_UTIL_KALMANFILTER_HPP_
 
 #include <Eigen/Dense>
-#include <Util/CircularBuffer.hpp>
-#include <chrono>
+#include <Util/KalmanFilterBase.hpp>
+#include <memory>
 
 namespace x {
 
@@ -36,8 +36,12 @@ namespace x {
  * available knowledge resource for KFs, which is wikipedia.
  * The reason is that the original paper is old, so there's
  * lots of names for the different steps and variables.
+ *
+ * The matrices are sized at runtime, which makes this the
+ * general fallback. For small models with known dimensions
+ * prefer FixedSizeKalmanFilter<N, M>.
  */
-class KalmanFilter {
+class KalmanFilter : public KalmanFilterBase {
 
   public:
     /**
@@ -61,6 +65,15 @@ class KalmanFilter {
                           Eigen::MatrixXd P,
                           uint64_t errorWindowSize = 10);
 
+    /**
+     * @brief creates a filter that tracks numberOfValues values as
+     * independent random walks, each value is measured directly (F = H = I).
+     * Used for several value fields of one source and for fused sources.
+     * @param numberOfValues number of states and measurements
+     * @param errorWindowSize
+     */
+    static std::unique_ptr<KalmanFilter> createRandomWalk(uint64_t numberOfValues, uint64_t errorWindowSize = 10);
+
     /**
      * Simple c-tor of a filter.
      * Only uses the history window size.
@@ -77,7 +90,7 @@ class KalmanFilter {
      * with a prepared initialState vector
      * as well as an initialTimestamp.
      */
-    void init();// all zeroes
+    void init() override;// all zeroes
     void init(double initialTimestamp);// all zeroes
     void init(const Eigen::VectorXd& initialState);
     void init(const Eigen::VectorXd& initialState, double initialTimestamp);
@@ -100,94 +113,16 @@ class KalmanFilter {
                 double newTimeStep,
                 const Eigen::MatrixXd& A);// update using new timestep and dynamics
 
-    /**
-     * Update method, using a full tuple buffer as input.
-     * @param buffer
-     */
-    void updateFromTupleBuffer(Runtime::TupleBuffer& buffer);
+    void updateFromValues(const double* measurements, uint64_t numberOfMeasurements) override;
+
+    [[nodiscard]] uint64_t getMeasurementSize() const override;
 
     // simple setters/getters for individual fields
-    double getCurrentStep();
     Eigen::VectorXd getState();
     Eigen::MatrixXd getError();
     Eigen::MatrixXd getInnovationError();
-    double getEstimationError();
-    uint64_t getTheta();
-    float getLambda();
-    void setLambda(float newLambda);
-
-    /**
-     * Gathering interval related setters.
-     * @param gatheringIntervalInMillis
-     */
-    void setGatheringInterval(std::chrono::milliseconds gatheringIntervalInMillis);
-    void setGatheringIntervalRange(std::chrono::milliseconds gatheringIntervalRange);
-    void setGatheringIntervalWithRange(std::chrono::milliseconds gatheringIntervalInMillis,
-                                       std::chrono::milliseconds gatheringIntervalRange);
-    /**
-     * set nyquist and maximum phys gathering intervals in millis (external to edge node)
-     * @param gatheringIntervalInMillis
-     */
-    void setSlowestInterval(std::chrono::milliseconds gatheringIntervalInMillis);
-    void setFastestInterval(std::chrono::milliseconds gatheringIntervalInMillis);
-
-    /**
-     * Get current gathering interval.
-     * @return gathering interval in millis
-     */
-    std::chrono::milliseconds getCurrentGatheringInterval();
-
-    /**
-     * @brief calculate new gathering interval using euler number
-     * as the smoothing part. The new proposed gathering interval
-     * has to stay inside the original gathering interval range.
-     * @return a new gathering interval that we can sleep on
-     */
-    std::chrono::milliseconds getNewGatheringIntervalBaseline();// eq. 7 and 10
-
-    /**
-     * @brief calculate new gathering interval using Chameleon.
-     * The new proposed gathering interval has to stay inside the
-     * original gathering interval range.
-     * @return a new gathering interval that we can sleep on
-     */
-    std::chrono::milliseconds getNewGatheringInterval();
-
-    /**
-     * @return the total estimation error, calculated
-     * from the window. This just exposes it in a
-     * public API.
-     */
-    double getTotalEstimationError();
 
   protected:
-    /**
-     * Calculates the current estimation error.
-     * Uses the last W errors stored in the
-     * history window in kfErrorWindow. Basically
-     * sum all errors in the window and divide
-     * them by the totalEstimationErrorDivider.
-     * @return the total error over the history window
-     */
-    float calculateTotalEstimationError();// eq. 9
-
-    /**
-     * Calculate the divider of the total estimation
-     * error. It stays the same across history,
-     * so it can be calculated once, during
-     * initialization.
-     * @return the current estimation error divider
-     */
-    void calculateTotalEstimationErrorDivider(int size);// eq. 9 (divider, calc. once)
-
-    /**
-     * The divider used whenever an update
-     * on the total estimation error happens.
-     * It's calculated once on init. Depends
-     * on the size of the history window.
-     */
-    float totalEstimationErrorDivider;
-
     /**
      * System model dimensions.
      * These are used to initialize
@@ -225,66 +160,6 @@ class KalmanFilter {
      */
     Eigen::VectorXd valueVector;
 
-    /**
-     * Timestep used in updates.
-     * This is needed to create special
-     * versions of KFs.
-     */
-    double timeStep;
-    double initialTimestamp;
-    double currentTime;
-    double estimationError;// eq. 8
-
-    /**
-     * @brief used to give lower/upper bounds on freq.
-     * Paper is not clear on the magnitude (size) of
-     * the range, this can be determined in tests later.
-     */
-    std::chrono::milliseconds gatheringIntervalRange{8000};   // allowed to change by +4s/-4s
-    std::chrono::milliseconds gatheringInterval{1000};        // currently in use
-    std::chrono::milliseconds gatheringIntervalReceived{1000};// from coordinator
-    std::chrono::milliseconds initialInterval{1000};          // original start
-    std::chrono::milliseconds slowestInterval{1500};     // nyquist rate
-    std::chrono::milliseconds fastestInterval{500};    // max limit
-
-    /**
-     * @brief control units for changing the new
-     * gathering interval. Theta (θ) is static according
-     * to the paper in Jain et al.
-     */
-    const uint64_t theta = 2;// θ = 2 in all experiments
-    float lambda = 0.6;      // λ = 0.6 in most experiments
-
-    /**
-     * @brief _e_ constant, used to calculate
-     * magnitude of change for the new
-     * gathering interval estimation.
-     */
-    const double eulerConstant = std::exp(1.0);
-
-    /**
-     * @brief buffer of residual error from KF
-     */
-    CircularBuffer<double> kfErrorWindow;
-
-    /**
-     * @brief Return the diff of the last 2 estimation errors
-     */
-    double getEstimationErrorDifference();
-
-    /**
-     * @brief Exponentially decrease/increase the freq.
-     */
-    double frequencyExponentialDecay();
-    double frequencyExponentialGrowth();
-
-    /**
-     * @brief counters to keep track of exp. decay/growth
-     */
-    uint64_t decreaseCounter = 1;
-    uint64_t increaseCounter = 1;
-    const uint64_t maxValue = std::numeric_limits<uint64_t>::max();
-
 };// class KalmanFilter
 
 }// namespace x
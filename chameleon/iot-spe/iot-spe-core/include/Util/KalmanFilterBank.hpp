@@ -0,0 +1,142 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#ifndef x_CORE_INCLUDE_UTIL_KALMANFILTERBANK_HPP_
+#define x_CORE_INCLUDE_UTIL_KALMANFILTERBANK_HPP_
+
+#include <Util/KalmanFilterBase.hpp>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace x {
+
+/**
+ * @brief A bank of many small Kalman Filters with a scalar observation,
+ * e.g., one per low-rate sensor on a worker.
+ *
+ * The state and covariance of all filters are kept in structure-of-arrays
+ * form, so that update(measurements) advances every filter of the bank in
+ * one call with AVX2 (HAS_AVX) or NEON (aarch64) kernels, and a scalar
+ * loop otherwise. All filters share the same model:
+ *   - SCALAR: random walk, one state (the value)
+ *   - CONSTANT_VELOCITY: two states (value, rate), F = [1 dt; 0 1], H = [1 0]
+ *
+ * Every filter is exposed as a KalmanFilterBase through getFilter(), which
+ * keeps its own error window and gathering interval. Hence, getNewGatheringInterval()
+ * and the interval setters have the same semantics as for a single KalmanFilter.
+ * The bank is not thread-safe, it is meant to be driven by one thread.
+ * @note the adaptive gathering modes of DataSource do not use the bank yet: every source still steps its own
+ * FixedSizeKalmanFilter<3, 1>, whose three-state model the bank does not provide.
+ */
+class KalmanFilterBank {
+  public:
+    enum class ModelType : uint8_t { SCALAR, CONSTANT_VELOCITY };
+
+    /**
+     * @brief shared model parameters of all filters in the bank
+     * processNoise and initialCovariance are the diagonal entries,
+     * processNoiseCovariance01 the off-diagonal entry of Q (CONSTANT_VELOCITY only).
+     */
+    struct Model {
+        ModelType type{ModelType::CONSTANT_VELOCITY};
+        double timeStep{1.0 / 30};
+        double processNoise{.05};
+        double processNoiseCovariance01{.05};
+        double measurementNoise{5};
+        double initialCovariance{10};
+    };
+
+    /**
+     * @param numberOfFilters number of filters in the bank
+     * @param model shared model of all filters
+     * @param errorWindowSize size of the error window of each filter
+     */
+    explicit KalmanFilterBank(uint64_t numberOfFilters, Model model, uint64_t errorWindowSize = 10);
+
+    /**
+     * @brief bank with the default CONSTANT_VELOCITY model
+     * @param numberOfFilters number of filters in the bank
+     */
+    explicit KalmanFilterBank(uint64_t numberOfFilters);
+
+    ~KalmanFilterBank();
+
+    KalmanFilterBank(const KalmanFilterBank&) = delete;
+    KalmanFilterBank& operator=(const KalmanFilterBank&) = delete;
+
+    /**
+     * @brief advances all filters by one step
+     * @param measurements one measured value per filter, size() values
+     */
+    void update(const double* measurements);
+
+    /**
+     * @brief advances a single filter by one step
+     * @param filterId index of the filter
+     * @param measurement the measured value
+     */
+    void update(uint64_t filterId, double measurement);
+
+    /**
+     * @brief resets state and covariance of a single filter
+     * @param filterId index of the filter
+     * @param initialValue initial estimate of the value
+     */
+    void reset(uint64_t filterId, double initialValue = 0);
+
+    /**
+     * @brief per-filter view with the gathering interval logic of KalmanFilterBase.
+     * updateFromValues() on the view feeds scalar measurements into this filter.
+     * @param filterId index of the filter
+     * @return the filter with the given index, owned by the bank
+     */
+    KalmanFilterBase& getFilter(uint64_t filterId);
+
+    [[nodiscard]] uint64_t size() const { return numberOfFilters; }
+    [[nodiscard]] double getValueEstimate(uint64_t filterId) const { return value[filterId]; }
+    [[nodiscard]] double getRateEstimate(uint64_t filterId) const { return rate[filterId]; }
+    [[nodiscard]] double getEstimationError(uint64_t filterId) const { return estimationErrors[filterId]; }
+
+  private:
+    class BankedFilter;
+
+    /**
+     * @brief predict-and-update kernel for the filters in [begin, end), scalar code
+     * @param measurements one value per filter in the range, starting with filter begin
+     */
+    void updateRange(uint64_t begin, uint64_t end, const double* measurements);
+
+    /**
+     * @brief predict-and-update kernel for the filters in [0, end), vectorized, returns the first filter it did not update
+     */
+    uint64_t updateVectorized(uint64_t end, const double* measurements);
+
+    uint64_t numberOfFilters;
+    Model model;
+
+    // state (value, rate) and symmetric covariance (p00, p01, p11) of every filter
+    std::vector<double> value;
+    std::vector<double> rate;
+    std::vector<double> covariance00;
+    std::vector<double> covariance01;
+    std::vector<double> covariance11;
+    std::vector<double> estimationErrors;
+
+    std::vector<std::unique_ptr<BankedFilter>> filters;
+};
+
+}// namespace x
+
+#endif// x_CORE_INCLUDE_UTIL_KALMANFILTERBANK_HPP_
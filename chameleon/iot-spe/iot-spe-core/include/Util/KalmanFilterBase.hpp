@@ -0,0 +1,210 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#ifndef x_CORE_INCLUDE_UTIL_KALMANFILTERBASE_HPP_
+#define x_CORE_INCLUDE_UTIL_KALMANFILTERBASE_HPP_
+
+#include <Util/CircularBuffer.hpp>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+namespace x {
+
+/**
+ * @brief Common part of all Kalman Filters: the window of
+ * estimation errors and the logic that derives a new gathering
+ * interval from it. The state and covariance matrices, and
+ * with them the predict-and-update step, live in the subclasses,
+ * which only have to push their estimation error into kfErrorWindow.
+ *
+ * KalmanFilter uses dynamically sized matrices and is the general
+ * fallback, FixedSizeKalmanFilter<N, M> uses compile-time sized
+ * matrices and does not allocate during updates.
+ */
+class KalmanFilterBase {
+
+  public:
+    /**
+     * @param errorWindowSize size of the history window of estimation errors
+     */
+    explicit KalmanFilterBase(uint64_t errorWindowSize = 10);
+
+    virtual ~KalmanFilterBase() = default;
+
+    /**
+     * Initialize the filter with default
+     * values and an all-zeroes state.
+     */
+    virtual void init() = 0;
+
+    /**
+     * Update method, one step per measurement vector. The values are
+     * read from the tuple buffers by the caller, e.g., with a
+     * Runtime::MemoryLayouts::FieldValueReader.
+     * @param measurements numberOfMeasurements vectors of getMeasurementSize() values, one after the other
+     * @param numberOfMeasurements
+     */
+    virtual void updateFromValues(const double* measurements, uint64_t numberOfMeasurements) = 0;
+
+    /**
+     * @return the number of values in one measurement vector
+     */
+    [[nodiscard]] virtual uint64_t getMeasurementSize() const = 0;
+
+    // simple setters/getters for individual fields
+    double getCurrentStep();
+    double getEstimationError();
+    uint64_t getTheta();
+    float getLambda();
+    void setLambda(float newLambda);
+
+    /**
+     * Gathering interval related setters.
+     * @param gatheringIntervalInMillis
+     */
+    void setGatheringInterval(std::chrono::milliseconds gatheringIntervalInMillis);
+    void setGatheringIntervalRange(std::chrono::milliseconds gatheringIntervalRange);
+    void setGatheringIntervalWithRange(std::chrono::milliseconds gatheringIntervalInMillis,
+                                       std::chrono::milliseconds gatheringIntervalRange);
+    /**
+     * set nyquist and maximum phys gathering intervals in millis (external to edge node)
+     * @param gatheringIntervalInMillis
+     */
+    void setSlowestInterval(std::chrono::milliseconds gatheringIntervalInMillis);
+    void setFastestInterval(std::chrono::milliseconds gatheringIntervalInMillis);
+
+    /**
+     * Get current gathering interval.
+     * @return gathering interval in millis
+     */
+    std::chrono::milliseconds getCurrentGatheringInterval();
+
+    /**
+     * @brief calculate new gathering interval using euler number
+     * as the smoothing part. The new proposed gathering interval
+     * has to stay inside the original gathering interval range.
+     * @return a new gathering interval that we can sleep on
+     */
+    std::chrono::milliseconds getNewGatheringIntervalBaseline();// eq. 7 and 10
+
+    /**
+     * @brief calculate new gathering interval using Chameleon.
+     * The new proposed gathering interval has to stay inside the
+     * original gathering interval range.
+     * @return a new gathering interval that we can sleep on
+     */
+    std::chrono::milliseconds getNewGatheringInterval();
+
+    /**
+     * @return the total estimation error, calculated
+     * from the window. This just exposes it in a
+     * public API.
+     */
+    double getTotalEstimationError();
+
+  protected:
+    /**
+     * Calculates the current estimation error.
+     * Uses the last W errors stored in the
+     * history window in kfErrorWindow. Basically
+     * sum all errors in the window and divide
+     * them by the totalEstimationErrorDivider.
+     * @return the total error over the history window
+     */
+    float calculateTotalEstimationError();// eq. 9
+
+    /**
+     * Calculate the divider of the total estimation
+     * error. It stays the same across history,
+     * so it can be calculated once, during
+     * initialization.
+     * @return the current estimation error divider
+     */
+    void calculateTotalEstimationErrorDivider(int size);// eq. 9 (divider, calc. once)
+
+    /**
+     * The divider used whenever an update
+     * on the total estimation error happens.
+     * It's calculated once on init. Depends
+     * on the size of the history window.
+     */
+    float totalEstimationErrorDivider;
+
+    /**
+     * Timestep used in updates.
+     * This is needed to create special
+     * versions of KFs.
+     */
+    double timeStep{0};
+    double initialTimestamp{0};
+    double currentTime{0};
+    double estimationError{0};// eq. 8
+
+    /**
+     * @brief used to give lower/upper bounds on freq.
+     * Paper is not clear on the magnitude (size) of
+     * the range, this can be determined in tests later.
+     */
+    std::chrono::milliseconds gatheringIntervalRange{8000};   // allowed to change by +4s/-4s
+    std::chrono::milliseconds gatheringInterval{1000};        // currently in use
+    std::chrono::milliseconds gatheringIntervalReceived{1000};// from coordinator
+    std::chrono::milliseconds initialInterval{1000};          // original start
+    std::chrono::milliseconds slowestInterval{1500};     // nyquist rate
+    std::chrono::milliseconds fastestInterval{500};    // max limit
+
+    /**
+     * @brief control units for changing the new
+     * gathering interval. Theta (θ) is static according
+     * to the paper in Jain et al.
+     */
+    const uint64_t theta = 2;// θ = 2 in all experiments
+    float lambda = 0.6;      // λ = 0.6 in most experiments
+
+    /**
+     * @brief _e_ constant, used to calculate
+     * magnitude of change for the new
+     * gathering interval estimation.
+     */
+    const double eulerConstant = std::exp(1.0);
+
+    /**
+     * @brief buffer of residual error from KF
+     */
+    CircularBuffer<double> kfErrorWindow;
+
+    /**
+     * @brief Return the diff of the last 2 estimation errors
+     */
+    double getEstimationErrorDifference();
+
+    /**
+     * @brief Exponentially decrease/increase the freq.
+     */
+    double frequencyExponentialDecay();
+    double frequencyExponentialGrowth();
+
+    /**
+     * @brief counters to keep track of exp. decay/growth
+     */
+    uint64_t decreaseCounter = 1;
+    uint64_t increaseCounter = 1;
+    const uint64_t maxValue = std::numeric_limits<uint64_t>::max();
+
+};// class KalmanFilterBase
+
+}// namespace x
+
+#endif// x_CORE_INCLUDE_UTIL_KALMANFILTERBASE_HPP_
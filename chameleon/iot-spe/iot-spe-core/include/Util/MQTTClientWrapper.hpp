@@ -17,6 +17,7 @@
 
 #include <mqtt/callback.h>
 #include <mqtt/client.h>
+#include <mqtt/iaction_listener.h>
 
 namespace x {
 /**
@@ -61,8 +62,11 @@ class MQTTClientWrapper {
 
     /**
     * @brief send a string to an MQTT broker
+    * @param deliveryListener if set, the asynchronous client calls it once the message is delivered or failed
+    * @return the delivery token of the message for the asynchronous client, nullptr for the synchronous client,
+    * which returns after the message was delivered
     */
-    void sendPayload(std::string payload);
+    mqtt::delivery_token_ptr sendPayload(std::string payload, mqtt::iaction_listener* deliveryListener = nullptr);
 
     /**
      * @brief get the number of elements currently residing in the buffer (messages that have not been delivered yet)
@@ -0,0 +1,97 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#ifndef x_CORE_INCLUDE_UTIL_MAPPEDFILE_HPP_
+#define x_CORE_INCLUDE_UTIL_MAPPEDFILE_HPP_
+
+#include <Runtime/TupleBuffer.hpp>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace x::Util {
+
+class MappedFile;
+using MappedFilePtr = std::shared_ptr<MappedFile>;
+
+/**
+ * @brief A private, copy-on-write memory mapping of a whole file that file sources read from instead of an ifstream.
+ * The mapping is advised for sequential access. willRead() keeps a window of READ_AHEAD_SIZE bytes ahead of the
+ * reader in flight with MADV_WILLNEED, so replaying a large recording does not stall on page faults.
+ * Ranges of the mapping can be wrapped into TupleBuffers without copying them. Every wrapped buffer keeps the
+ * mapping alive until it is recycled, so the source may be destroyed before its last buffer is processed.
+ * Writes to wrapped buffers only change private copies of the pages, never the file.
+ */
+class MappedFile : public std::enable_shared_from_this<MappedFile> {
+  public:
+    /// the number of bytes willRead() requests ahead of the reader
+    static constexpr uint64_t READ_AHEAD_SIZE = 16 * 1024 * 1024;
+
+    /**
+     * @brief Maps a file
+     * @param path path of the file
+     * @throws RuntimeException if the file cannot be opened or mapped
+     * @return the mapping
+     */
+    static MappedFilePtr create(const std::string& path);
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /// unmaps and closes the file
+    ~MappedFile();
+
+    /**
+     * @return the first byte of the file, nullptr for an empty file
+     */
+    [[nodiscard]] const char* getData() const;
+
+    /**
+     * @return the size of the file in bytes
+     */
+    [[nodiscard]] uint64_t getSize() const;
+
+    /**
+     * @return the path the file was mapped from
+     */
+    [[nodiscard]] const std::string& getPath() const;
+
+    /**
+     * @brief Tells the mapping that the reader continues at position. Once the reader gets close to the end of the
+     * current read-ahead window, the next READ_AHEAD_SIZE bytes are requested from the kernel asynchronously.
+     * @param position the position of the reader in the file
+     */
+    void willRead(uint64_t position);
+
+    /**
+     * @brief Wraps a range of the file into a TupleBuffer without copying it
+     * @param position the start of the range
+     * @param size the size of the range, has to fit into a TupleBuffer
+     * @return a TupleBuffer that keeps the mapping alive until it is recycled
+     */
+    Runtime::TupleBuffer wrap(uint64_t position, uint64_t size);
+
+  private:
+    MappedFile(std::string path, int fileDescriptor, uint8_t* data, uint64_t size);
+
+    std::string path;
+    int fileDescriptor;
+    uint8_t* data;
+    uint64_t size;
+    uint64_t readAheadEnd{0};
+};
+
+}// namespace x::Util
+
+#endif// x_CORE_INCLUDE_UTIL_MAPPEDFILE_HPP_
@@ -0,0 +1,88 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#ifndef x_CORE_INCLUDE_UTIL_RATEPACER_HPP_
+#define x_CORE_INCLUDE_UTIL_RATEPACER_HPP_
+
+#include <chrono>
+#include <cstdint>
+
+namespace x::Util {
+
+/**
+ * @brief Paces events, e.g., emitted buffers, at a fixed target rate.
+ * The n-th event is due at start + n / targetRate, so the time lost in one period, e.g., by a late wake-up or a slow
+ * emission, shortens the following waits instead of accumulating. If the pacer falls behind by more than maxLag,
+ * e.g., because downstream applied backpressure, it restarts the schedule instead of emitting a burst.
+ * waitForNextEvent() sleeps until spinThreshold before the deadline and spins for the rest, which keeps the error of a
+ * single event in the order of microseconds at the cost of one busy core.
+ */
+class RatePacer {
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief Creates a pacer, the schedule starts with the first call to waitForNextEvent()
+     * @param targetRate the events per second
+     * @param spinThreshold the remaining time to a deadline that is spun instead of slept
+     * @param maxLag the lag after which the schedule restarts
+     * @throws RuntimeException if the target rate is not positive
+     */
+    explicit RatePacer(double targetRate,
+                       std::chrono::nanoseconds spinThreshold = std::chrono::microseconds(100),
+                       std::chrono::nanoseconds maxLag = std::chrono::milliseconds(100));
+
+    /**
+     * @brief Waits until the next event is due and counts it, returns at once while the pacer is behind its schedule
+     */
+    void waitForNextEvent();
+
+    /**
+     * @return the number of events so far
+     */
+    [[nodiscard]] uint64_t getNumberOfEvents() const;
+
+    /**
+     * @return the target rate in events per second
+     */
+    [[nodiscard]] double getTargetRate() const;
+
+    /**
+     * @return the achieved rate in events per second from the first to the last event, including the period of the last
+     * event, or zero before the first event
+     */
+    [[nodiscard]] double getAchievedRate() const;
+
+    /**
+     * @return how often the pacer fell behind by more than maxLag and restarted its schedule
+     */
+    [[nodiscard]] uint64_t getNumberOfRestarts() const;
+
+  private:
+    double targetRate;
+    std::chrono::duration<double, std::nano> interval;
+    std::chrono::nanoseconds spinThreshold;
+    std::chrono::nanoseconds maxLag;
+    Clock::time_point firstEvent;
+    Clock::time_point lastEvent;
+    // the schedule starts at scheduleStart with event number scheduleOffset
+    Clock::time_point scheduleStart;
+    uint64_t scheduleOffset{0};
+    uint64_t numberOfEvents{0};
+    uint64_t numberOfRestarts{0};
+};
+
+}// namespace x::Util
+
+#endif// x_CORE_INCLUDE_UTIL_RATEPACER_HPP_
@@ -0,0 +1,106 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#ifndef x_CORE_INCLUDE_UTIL_TIMERWHEEL_HPP_
+#define x_CORE_INCLUDE_UTIL_TIMERWHEEL_HPP_
+
+#include <cstdint>
+#include <vector>
+
+namespace x::Util {
+
+/**
+ * @brief Hashed timing wheel, see Varghese and Lauck, "Hashed and Hierarchical Timing Wheels".
+ * The wheel has numberOfSlots slots, one per tick. A timer that expires in d ticks is put into
+ * slot (currentTick + d) % numberOfSlots and remembers how many full rotations it has to wait.
+ * Scheduling is O(1), advancing by one tick only touches the timers of one slot.
+ * Timers cannot be cancelled, the owner has to drop outdated timers when they expire.
+ * The wheel is not thread-safe.
+ * @tparam T the payload of a timer, returned on expiry
+ */
+template<typename T>
+class TimerWheel {
+  public:
+    /**
+     * @param numberOfSlots number of ticks covered by one rotation of the wheel
+     */
+    explicit TimerWheel(uint64_t numberOfSlots = 1024) : slots(numberOfSlots == 0 ? 1 : numberOfSlots) {}
+
+    /**
+     * @brief adds a timer that expires after delayInTicks calls to advance()
+     * A delay of zero expires on the next call of advance().
+     * @param payload the payload of the timer
+     * @param delayInTicks the delay in ticks
+     */
+    void schedule(T payload, uint64_t delayInTicks) {
+        if (delayInTicks == 0) {
+            delayInTicks = 1;
+        }
+        auto numberOfSlots = slots.size();
+        auto& slot = slots[(currentSlot + delayInTicks) % numberOfSlots];
+        slot.emplace_back(Timer{std::move(payload), (delayInTicks - 1) / numberOfSlots});
+        ++numberOfTimers;
+    }
+
+    /**
+     * @brief moves the wheel by one tick
+     * @param expired the payloads of all expired timers are appended to expired
+     */
+    void advance(std::vector<T>& expired) {
+        currentSlot = (currentSlot + 1) % slots.size();
+        ++currentTick;
+        auto& slot = slots[currentSlot];
+        uint64_t kept = 0;
+        for (uint64_t i = 0; i < slot.size(); ++i) {
+            if (slot[i].remainingRotations == 0) {
+                expired.emplace_back(std::move(slot[i].payload));
+                --numberOfTimers;
+            } else {
+                --slot[i].remainingRotations;
+                if (kept != i) {
+                    slot[kept] = std::move(slot[i]);
+                }
+                ++kept;
+            }
+        }
+        slot.resize(kept);
+    }
+
+    /**
+     * @return the number of timers in the wheel
+     */
+    [[nodiscard]] uint64_t size() const { return numberOfTimers; }
+
+    [[nodiscard]] bool empty() const { return numberOfTimers == 0; }
+
+    /**
+     * @return the number of ticks since the creation of the wheel
+     */
+    [[nodiscard]] uint64_t getCurrentTick() const { return currentTick; }
+
+  private:
+    struct Timer {
+        T payload;
+        uint64_t remainingRotations;
+    };
+
+    std::vector<std::vector<Timer>> slots;
+    uint64_t currentSlot{0};
+    uint64_t currentTick{0};
+    uint64_t numberOfTimers{0};
+};
+
+}// namespace x::Util
+
+#endif// x_CORE_INCLUDE_UTIL_TIMERWHEEL_HPP_
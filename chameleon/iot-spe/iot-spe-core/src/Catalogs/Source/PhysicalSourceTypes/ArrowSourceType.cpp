@@ -49,7 +49,11 @@ ArrowSourceType::ArrowSourceType()
                                                                 "Gathering interval of the source.")),
       gatheringMode(Configurations::ConfigurationOption<GatheringMode>::create(Configurations::SOURCE_GATHERING_MODE_CONFIG,
                                                                                GatheringMode::INTERVAL_MODE,
-                                                                               "Gathering mode of the source.")) {
+                                                                               "Gathering mode of the source."),
+      numberOfReaderThreads(
+          Configurations::ConfigurationOption<uint32_t>::create(Configurations::SOURCE_NUMBER_OF_READER_THREADS_CONFIG,
+                                                                1,
+                                                                "Number of threads that convert the record batches of the file in parallel, 1 converts them on the source thread.")) {
     x_INFO("ArrowSourceTypeConfig: Init source config object with default values.");
 }
 
@@ -78,6 +82,10 @@ ArrowSourceType::ArrowSourceType(std::map<std::string, std::string> sourceConfig
             magic_enum::enum_cast<GatheringMode>(sourceConfigMap.find(Configurations::SOURCE_GATHERING_MODE_CONFIG)->second)
                 .value());
     }
+    if (sourceConfigMap.find(Configurations::SOURCE_NUMBER_OF_READER_THREADS_CONFIG) != sourceConfigMap.end()) {
+        numberOfReaderThreads->setValue(
+            std::stoi(sourceConfigMap.find(Configurations::SOURCE_NUMBER_OF_READER_THREADS_CONFIG)->second));
+    }
 }
 
 ArrowSourceType::ArrowSourceType(Yaml::Node yamlConfig) : ArrowSourceType() {
@@ -108,6 +116,10 @@ ArrowSourceType::ArrowSourceType(Yaml::Node yamlConfig) : ArrowSourceType() {
             magic_enum::enum_cast<GatheringMode>(yamlConfig[Configurations::SOURCE_GATHERING_MODE_CONFIG].As<std::string>())
                 .value());
     }
+    if (!yamlConfig[Configurations::SOURCE_NUMBER_OF_READER_THREADS_CONFIG].As<std::string>().empty()
+        && yamlConfig[Configurations::SOURCE_NUMBER_OF_READER_THREADS_CONFIG].As<std::string>() != "\n") {
+        numberOfReaderThreads->setValue(yamlConfig[Configurations::SOURCE_NUMBER_OF_READER_THREADS_CONFIG].As<uint32_t>());
+    }
 }
 
 std::string ArrowSourceType::toString() {
@@ -120,6 +132,7 @@ std::string ArrowSourceType::toString() {
     ss << Configurations::NUMBER_OF_BUFFERS_TO_PRODUCE_CONFIG + ":" + numberOfBuffersToProduce->toStringNameCurrentValue();
     ss << Configurations::NUMBER_OF_TUPLES_TO_PRODUCE_PER_BUFFER_CONFIG + ":"
             + numberOfTuplesToProducePerBuffer->toStringNameCurrentValue();
+    ss << Configurations::SOURCE_NUMBER_OF_READER_THREADS_CONFIG + ":" + numberOfReaderThreads->toStringNameCurrentValue();
     ss << "\n}";
     return ss.str();
 }
@@ -133,7 +146,8 @@ bool ArrowSourceType::equal(const PhysicalSourceTypePtr& other) {
         && sourceGatheringInterval->getValue() == otherSourceConfig->sourceGatheringInterval->getValue()
         && gatheringMode->getValue() == otherSourceConfig->gatheringMode->getValue()
         && numberOfBuffersToProduce->getValue() == otherSourceConfig->numberOfBuffersToProduce->getValue()
-        && numberOfTuplesToProducePerBuffer->getValue() == otherSourceConfig->numberOfTuplesToProducePerBuffer->getValue();
+        && numberOfTuplesToProducePerBuffer->getValue() == otherSourceConfig->numberOfTuplesToProducePerBuffer->getValue()
+        && numberOfReaderThreads->getValue() == otherSourceConfig->numberOfReaderThreads->getValue();
 }
 
 Configurations::StringConfigOption ArrowSourceType::getFilePath() const { return filePath; }
@@ -148,6 +162,8 @@ Configurations::IntConfigOption ArrowSourceType::getNumberOfTuplesToProducePerBu
 
 Configurations::GatheringModeConfigOption ArrowSourceType::getGatheringMode() const { return gatheringMode; }
 
+Configurations::IntConfigOption ArrowSourceType::getNumberOfReaderThreads() const { return numberOfReaderThreads; }
+
 void ArrowSourceType::setFilePath(std::string filePathValue) { filePath->setValue(std::move(filePathValue)); }
 
 void ArrowSourceType::setGatheringInterval(uint32_t sourceGatheringIntervalValue) {
@@ -168,12 +184,17 @@ void ArrowSourceType::setGatheringMode(std::string inputGatheringMode) {
 
 void ArrowSourceType::setGatheringMode(GatheringMode inputGatheringMode) { gatheringMode->setValue(inputGatheringMode); }
 
+void ArrowSourceType::setNumberOfReaderThreads(uint32_t numberOfReaderThreadsValue) {
+    numberOfReaderThreads->setValue(numberOfReaderThreadsValue);
+}
+
 void ArrowSourceType::reset() {
     setFilePath(filePath->getDefaultValue());
     setGatheringMode(gatheringMode->getDefaultValue());
     setGatheringInterval(sourceGatheringInterval->getDefaultValue());
     setNumberOfBuffersToProduce(numberOfBuffersToProduce->getDefaultValue());
     setNumberOfTuplesToProducePerBuffer(numberOfTuplesToProducePerBuffer->getDefaultValue());
+    setNumberOfReaderThreads(numberOfReaderThreads->getDefaultValue());
 }
 
 }// namespace x
@@ -55,7 +55,20 @@ CSVSourceType::CSVSourceType()
                                                                 "Gathering interval of the source.")),
       gatheringMode(Configurations::ConfigurationOption<GatheringMode>::create(Configurations::SOURCE_GATHERING_MODE_CONFIG,
                                                                                GatheringMode::INTERVAL_MODE,
-                                                                               "Gathering mode of the source.")) {
+                                                                               "Gathering mode of the source.")),
+      adaptiveValueFields(Configurations::ConfigurationOption<std::string>::create(
+          Configurations::SOURCE_ADAPTIVE_VALUE_FIELDS_CONFIG,
+          "",
+          "Comma separated numeric fields that drive the adaptive gathering mode. "
+          "Default: the field value, or the first numeric field of the schema.")),
+      fusedGatheringGroup(Configurations::ConfigurationOption<std::string>::create(
+          Configurations::SOURCE_FUSED_GATHERING_GROUP_CONFIG,
+          "",
+          "Sources with the same group share one Kalman filter and gathering interval in the FUSED_ADAPTIVE_MODE."),
+      numberOfReaderThreads(
+          Configurations::ConfigurationOption<uint32_t>::create(Configurations::SOURCE_NUMBER_OF_READER_THREADS_CONFIG,
+                                                                1,
+                                                                "Number of threads that parse newline aligned partitions of the file in parallel. Requires a single character delimiter, 1 parses the file on the source thread.")) {
     x_INFO("CSVSourceTypeConfig: Init source config object with default values.");
 }
 
@@ -90,6 +103,16 @@ CSVSourceType::CSVSourceType(std::map<std::string, std::string> sourceConfigMap)
             magic_enum::enum_cast<GatheringMode>(sourceConfigMap.find(Configurations::SOURCE_GATHERING_MODE_CONFIG)->second)
                 .value());
     }
+    if (sourceConfigMap.find(Configurations::SOURCE_ADAPTIVE_VALUE_FIELDS_CONFIG) != sourceConfigMap.end()) {
+        adaptiveValueFields->setValue(sourceConfigMap.find(Configurations::SOURCE_ADAPTIVE_VALUE_FIELDS_CONFIG)->second);
+    }
+    if (sourceConfigMap.find(Configurations::SOURCE_FUSED_GATHERING_GROUP_CONFIG) != sourceConfigMap.end()) {
+        fusedGatheringGroup->setValue(sourceConfigMap.find(Configurations::SOURCE_FUSED_GATHERING_GROUP_CONFIG)->second);
+    }
+    if (sourceConfigMap.find(Configurations::SOURCE_NUMBER_OF_READER_THREADS_CONFIG) != sourceConfigMap.end()) {
+        numberOfReaderThreads->setValue(
+            std::stoi(sourceConfigMap.find(Configurations::SOURCE_NUMBER_OF_READER_THREADS_CONFIG)->second));
+    }
 }
 
 CSVSourceType::CSVSourceType(Yaml::Node yamlConfig) : CSVSourceType() {
@@ -128,6 +151,18 @@ CSVSourceType::CSVSourceType(Yaml::Node yamlConfig) : CSVSourceType() {
             magic_enum::enum_cast<GatheringMode>(yamlConfig[Configurations::SOURCE_GATHERING_MODE_CONFIG].As<std::string>())
                 .value());
     }
+    if (!yamlConfig[Configurations::SOURCE_ADAPTIVE_VALUE_FIELDS_CONFIG].As<std::string>().empty()
+        && yamlConfig[Configurations::SOURCE_ADAPTIVE_VALUE_FIELDS_CONFIG].As<std::string>() != "\n") {
+        adaptiveValueFields->setValue(yamlConfig[Configurations::SOURCE_ADAPTIVE_VALUE_FIELDS_CONFIG].As<std::string>());
+    }
+    if (!yamlConfig[Configurations::SOURCE_FUSED_GATHERING_GROUP_CONFIG].As<std::string>().empty()
+        && yamlConfig[Configurations::SOURCE_FUSED_GATHERING_GROUP_CONFIG].As<std::string>() != "\n") {
+        fusedGatheringGroup->setValue(yamlConfig[Configurations::SOURCE_FUSED_GATHERING_GROUP_CONFIG].As<std::string>());
+    }
+    if (!yamlConfig[Configurations::SOURCE_NUMBER_OF_READER_THREADS_CONFIG].As<std::string>().empty()
+        && yamlConfig[Configurations::SOURCE_NUMBER_OF_READER_THREADS_CONFIG].As<std::string>() != "\n") {
+        numberOfReaderThreads->setValue(yamlConfig[Configurations::SOURCE_NUMBER_OF_READER_THREADS_CONFIG].As<uint32_t>());
+    }
 }
 
 std::string CSVSourceType::toString() {
@@ -139,9 +174,12 @@ std::string CSVSourceType::toString() {
     ss << Configurations::SOURCE_GATHERING_INTERVAL_CONFIG + ":" + sourceGatheringInterval->toStringNameCurrentValue();
     ss << Configurations::SOURCE_GATHERING_MODE_CONFIG + ":" + std::string(magic_enum::enum_name(gatheringMode->getValue()))
        << "\n";
+    ss << Configurations::SOURCE_ADAPTIVE_VALUE_FIELDS_CONFIG + ":" + adaptiveValueFields->toStringNameCurrentValue();
+    ss << Configurations::SOURCE_FUSED_GATHERING_GROUP_CONFIG + ":" + fusedGatheringGroup->toStringNameCurrentValue();
     ss << Configurations::NUMBER_OF_BUFFERS_TO_PRODUCE_CONFIG + ":" + numberOfBuffersToProduce->toStringNameCurrentValue();
     ss << Configurations::NUMBER_OF_TUPLES_TO_PRODUCE_PER_BUFFER_CONFIG + ":"
             + numberOfTuplesToProducePerBuffer->toStringNameCurrentValue();
+    ss << Configurations::SOURCE_NUMBER_OF_READER_THREADS_CONFIG + ":" + numberOfReaderThreads->toStringNameCurrentValue();
     ss << "\n}";
     return ss.str();
 }
@@ -156,8 +194,11 @@ bool CSVSourceType::equal(const PhysicalSourceTypePtr& other) {
         && delimiter->getValue() == otherSourceConfig->delimiter->getValue()
         && sourceGatheringInterval->getValue() == otherSourceConfig->sourceGatheringInterval->getValue()
         && gatheringMode->getValue() == otherSourceConfig->gatheringMode->getValue()
+        && adaptiveValueFields->getValue() == otherSourceConfig->adaptiveValueFields->getValue()
+        && fusedGatheringGroup->getValue() == otherSourceConfig->fusedGatheringGroup->getValue()
         && numberOfBuffersToProduce->getValue() == otherSourceConfig->numberOfBuffersToProduce->getValue()
-        && numberOfTuplesToProducePerBuffer->getValue() == otherSourceConfig->numberOfTuplesToProducePerBuffer->getValue();
+        && numberOfTuplesToProducePerBuffer->getValue() == otherSourceConfig->numberOfTuplesToProducePerBuffer->getValue()
+        && numberOfReaderThreads->getValue() == otherSourceConfig->numberOfReaderThreads->getValue();
 }
 
 Configurations::StringConfigOption CSVSourceType::getFilePath() const { return filePath; }
@@ -176,6 +217,12 @@ Configurations::IntConfigOption CSVSourceType::getNumberOfTuplesToProducePerBuff
 
 Configurations::GatheringModeConfigOption CSVSourceType::getGatheringMode() const { return gatheringMode; }
 
+Configurations::IntConfigOption CSVSourceType::getNumberOfReaderThreads() const { return numberOfReaderThreads; }
+
+Configurations::StringConfigOption CSVSourceType::getAdaptiveValueFields() const { return adaptiveValueFields; }
+
+Configurations::StringConfigOption CSVSourceType::getFusedGatheringGroup() const { return fusedGatheringGroup; }
+
 void CSVSourceType::setSkipHeader(bool skipHeaderValue) { skipHeader->setValue(skipHeaderValue); }
 
 void CSVSourceType::setFilePath(std::string filePathValue) { filePath->setValue(std::move(filePathValue)); }
@@ -200,6 +247,18 @@ void CSVSourceType::setGatheringMode(std::string inputGatheringMode) {
 
 void CSVSourceType::setGatheringMode(GatheringMode inputGatheringMode) { gatheringMode->setValue(inputGatheringMode); }
 
+void CSVSourceType::setAdaptiveValueFields(std::string adaptiveValueFieldsValue) {
+    adaptiveValueFields->setValue(std::move(adaptiveValueFieldsValue));
+}
+
+void CSVSourceType::setFusedGatheringGroup(std::string fusedGatheringGroupValue) {
+    fusedGatheringGroup->setValue(std::move(fusedGatheringGroupValue));
+}
+
+void CSVSourceType::setNumberOfReaderThreads(uint32_t numberOfReaderThreadsValue) {
+    numberOfReaderThreads->setValue(numberOfReaderThreadsValue);
+}
+
 void CSVSourceType::reset() {
     setFilePath(filePath->getDefaultValue());
     setSkipHeader(skipHeader->getDefaultValue());
@@ -208,6 +267,9 @@ void CSVSourceType::reset() {
     setNumberOfTuplesToProducePerBuffer(numberOfTuplesToProducePerBuffer->getDefaultValue());
     setGatheringInterval(sourceGatheringInterval->getDefaultValue());
     setGatheringMode(gatheringMode->getDefaultValue());
+    setAdaptiveValueFields(adaptiveValueFields->getDefaultValue());
+    setFusedGatheringGroup(fusedGatheringGroup->getDefaultValue());
+    setNumberOfReaderThreads(numberOfReaderThreads->getDefaultValue());
 }
 
 }// namespace x
@@ -68,6 +68,12 @@ KafkaSourceType::KafkaSourceType(std::map<std::string, std::string> sourceConfig
     if (sourceConfigMap.find(Configurations::INPUT_FORMAT_CONFIG) != sourceConfigMap.end()) {
         inputFormat->setInputFormatEnum(sourceConfigMap.find(Configurations::INPUT_FORMAT_CONFIG)->second);
     }
+    if (sourceConfigMap.find(Configurations::ON_DEMAND_JSON_PARSING_CONFIG) != sourceConfigMap.end()) {
+        onDemandJSONParsing->setValue((sourceConfigMap.find(Configurations::ON_DEMAND_JSON_PARSING_CONFIG)->second == "true"));
+    }
+    if (sourceConfigMap.find(Configurations::PARTITIONS_CONFIG) != sourceConfigMap.end()) {
+        partitions->setValue(sourceConfigMap.find(Configurations::PARTITIONS_CONFIG)->second);
+    }
 }
 
 KafkaSourceType::KafkaSourceType(Yaml::Node yamlConfig) : KafkaSourceType() {
@@ -117,6 +123,14 @@ KafkaSourceType::KafkaSourceType(Yaml::Node yamlConfig) : KafkaSourceType() {
         && yamlConfig[Configurations::INPUT_FORMAT_CONFIG].As<std::string>() != "\n") {
         inputFormat->setInputFormatEnum(yamlConfig[Configurations::INPUT_FORMAT_CONFIG].As<std::string>());
     }
+    if (!yamlConfig[Configurations::ON_DEMAND_JSON_PARSING_CONFIG].As<std::string>().empty()
+        && yamlConfig[Configurations::ON_DEMAND_JSON_PARSING_CONFIG].As<std::string>() != "\n") {
+        onDemandJSONParsing->setValue(yamlConfig[Configurations::ON_DEMAND_JSON_PARSING_CONFIG].As<bool>());
+    }
+    if (!yamlConfig[Configurations::PARTITIONS_CONFIG].As<std::string>().empty()
+        && yamlConfig[Configurations::PARTITIONS_CONFIG].As<std::string>() != "\n") {
+        partitions->setValue(yamlConfig[Configurations::PARTITIONS_CONFIG].As<std::string>());
+    }
 }
 
 KafkaSourceType::KafkaSourceType()
@@ -154,7 +168,17 @@ KafkaSourceType::KafkaSourceType()
                                                                 "Numbers of events pulled from the queue per pull request")),
       inputFormat(Configurations::ConfigurationOption<Configurations::InputFormat>::create(Configurations::INPUT_FORMAT_CONFIG,
                                                                                            Configurations::InputFormat::JSON,
-                                                                                           "input data format")) {
+                                                                                           "input data format")),
+      onDemandJSONParsing(Configurations::ConfigurationOption<bool>::create(
+          Configurations::ON_DEMAND_JSON_PARSING_CONFIG,
+          false,
+          "Parse JSON input on demand, only the keys of the schema are extracted and a payload may hold several "
+          "newline-delimited records.")),
+      partitions(Configurations::ConfigurationOption<std::string>::create(
+          Configurations::PARTITIONS_CONFIG,
+          "",
+          "Comma-separated partitions of the topic that are consumed by one source, e.g., 0,1,2. If empty, the groupId "
+          "is used as partition.")) {
     x_INFO("KafkaSourceType: Init source config object with default values.");
 }
 
@@ -170,6 +194,8 @@ std::string KafkaSourceType::toString() {
     ss << Configurations::NUMBER_OF_BUFFER_TO_PRODUCE + ":" + numberOfBuffersToProduce->toStringNameCurrentValue();
     ss << Configurations::BATCH_SIZE + ":" + batchSize->toStringNameCurrentValue();
     ss << Configurations::INPUT_FORMAT_CONFIG + ":" + inputFormat->toStringNameCurrentValueEnum();
+    ss << Configurations::ON_DEMAND_JSON_PARSING_CONFIG + ":" + onDemandJSONParsing->toStringNameCurrentValue();
+    ss << Configurations::PARTITIONS_CONFIG + ":" + partitions->toStringNameCurrentValue();
     ss << "\n}";
     return ss.str();
 }
@@ -187,7 +213,9 @@ bool KafkaSourceType::equal(const PhysicalSourceTypePtr& other) {
         && connectionTimeout->getValue() == otherSourceConfig->connectionTimeout->getValue()
         && numberOfBuffersToProduce->getValue() == otherSourceConfig->numberOfBuffersToProduce->getValue()
         && batchSize->getValue() == otherSourceConfig->batchSize->getValue()
-        && inputFormat->getValue() == otherSourceConfig->inputFormat->getValue();
+        && inputFormat->getValue() == otherSourceConfig->inputFormat->getValue()
+        && onDemandJSONParsing->getValue() == otherSourceConfig->onDemandJSONParsing->getValue()
+        && partitions->getValue() == otherSourceConfig->partitions->getValue();
 }
 
 Configurations::StringConfigOption KafkaSourceType::getBrokers() const { return brokers; }
@@ -202,6 +230,10 @@ Configurations::StringConfigOption KafkaSourceType::getOffsetMode() const { retu
 
 Configurations::InputFormatConfigOption KafkaSourceType::getInputFormat() const { return inputFormat; }
 
+Configurations::BoolConfigOption KafkaSourceType::getOnDemandJSONParsing() const { return onDemandJSONParsing; }
+
+Configurations::StringConfigOption KafkaSourceType::getPartitions() const { return partitions; }
+
 Configurations::IntConfigOption KafkaSourceType::getConnectionTimeout() const { return connectionTimeout; }
 
 Configurations::IntConfigOption KafkaSourceType::getNumberOfBuffersToProduce() const { return numberOfBuffersToProduce; }
@@ -236,6 +268,12 @@ void KafkaSourceType::setInputFormat(Configurations::InputFormat inputFormatValu
     inputFormat->setValue(std::move(inputFormatValue));
 }
 
+void KafkaSourceType::setOnDemandJSONParsing(bool onDemandJSONParsingValue) {
+    onDemandJSONParsing->setValue(onDemandJSONParsingValue);
+}
+
+void KafkaSourceType::setPartitions(std::string partitionsValue) { partitions->setValue(std::move(partitionsValue)); }
+
 uint64_t getBatchSize();
 
 void KafkaSourceType::reset() {
@@ -248,5 +286,7 @@ void KafkaSourceType::reset() {
     setNumberOfBuffersToProduce(numberOfBuffersToProduce->getDefaultValue());
     setBatchSize(batchSize->getDefaultValue());
     setInputFormat(inputFormat->getDefaultValue());
+    setOnDemandJSONParsing(onDemandJSONParsing->getDefaultValue());
+    setPartitions(partitions->getDefaultValue());
 }
 }// namespace x
\ No newline at end of file
@@ -64,6 +64,12 @@ MQTTSourceType::MQTTSourceType(std::map<std::string, std::string> sourceConfigMa
     if (sourceConfigMap.find(Configurations::INPUT_FORMAT_CONFIG) != sourceConfigMap.end()) {
         inputFormat->setInputFormatEnum(sourceConfigMap.find(Configurations::INPUT_FORMAT_CONFIG)->second);
     }
+    if (sourceConfigMap.find(Configurations::ON_DEMAND_JSON_PARSING_CONFIG) != sourceConfigMap.end()) {
+        onDemandJSONParsing->setValue((sourceConfigMap.find(Configurations::ON_DEMAND_JSON_PARSING_CONFIG)->second == "true"));
+    }
+    if (sourceConfigMap.find(Configurations::BATCHED_CONSUMPTION_CONFIG) != sourceConfigMap.end()) {
+        batchedConsumption->setValue((sourceConfigMap.find(Configurations::BATCHED_CONSUMPTION_CONFIG)->second == "true"));
+    }
     if (sourceConfigMap.find(Configurations::SOURCE_GATHERING_INTERVAL_CONFIG) != sourceConfigMap.end()) {
         sourceGatheringInterval->setValue(
             std::stoi(sourceConfigMap.find(Configurations::SOURCE_GATHERING_INTERVAL_CONFIG)->second));
@@ -73,6 +79,12 @@ MQTTSourceType::MQTTSourceType(std::map<std::string, std::string> sourceConfigMa
             magic_enum::enum_cast<GatheringMode>(sourceConfigMap.find(Configurations::SOURCE_GATHERING_MODE_CONFIG)->second)
                 .value());
     }
+    if (sourceConfigMap.find(Configurations::SOURCE_ADAPTIVE_VALUE_FIELDS_CONFIG) != sourceConfigMap.end()) {
+        adaptiveValueFields->setValue(sourceConfigMap.find(Configurations::SOURCE_ADAPTIVE_VALUE_FIELDS_CONFIG)->second);
+    }
+    if (sourceConfigMap.find(Configurations::SOURCE_FUSED_GATHERING_GROUP_CONFIG) != sourceConfigMap.end()) {
+        fusedGatheringGroup->setValue(sourceConfigMap.find(Configurations::SOURCE_FUSED_GATHERING_GROUP_CONFIG)->second);
+    }
     if (sourceConfigMap.find(Configurations::NUMBER_OF_BUFFERS_TO_PRODUCE_CONFIG) != sourceConfigMap.end()) {
         numberOfBuffersToProduce->setValue(
             std::stoi(sourceConfigMap.find(Configurations::NUMBER_OF_BUFFERS_TO_PRODUCE_CONFIG)->second));
@@ -126,6 +138,14 @@ MQTTSourceType::MQTTSourceType(Yaml::Node yamlConfig) : MQTTSourceType() {
         && yamlConfig[Configurations::INPUT_FORMAT_CONFIG].As<std::string>() != "\n") {
         inputFormat->setInputFormatEnum(yamlConfig[Configurations::INPUT_FORMAT_CONFIG].As<std::string>());
     }
+    if (!yamlConfig[Configurations::ON_DEMAND_JSON_PARSING_CONFIG].As<std::string>().empty()
+        && yamlConfig[Configurations::ON_DEMAND_JSON_PARSING_CONFIG].As<std::string>() != "\n") {
+        onDemandJSONParsing->setValue(yamlConfig[Configurations::ON_DEMAND_JSON_PARSING_CONFIG].As<bool>());
+    }
+    if (!yamlConfig[Configurations::BATCHED_CONSUMPTION_CONFIG].As<std::string>().empty()
+        && yamlConfig[Configurations::BATCHED_CONSUMPTION_CONFIG].As<std::string>() != "\n") {
+        batchedConsumption->setValue(yamlConfig[Configurations::BATCHED_CONSUMPTION_CONFIG].As<bool>());
+    }
     if (!yamlConfig[Configurations::SOURCE_GATHERING_INTERVAL_CONFIG].As<std::string>().empty()
         && yamlConfig[Configurations::SOURCE_GATHERING_INTERVAL_CONFIG].As<std::string>() != "\n") {
         sourceGatheringInterval->setValue(yamlConfig[Configurations::SOURCE_GATHERING_INTERVAL_CONFIG].As<uint32_t>());
@@ -136,6 +156,14 @@ MQTTSourceType::MQTTSourceType(Yaml::Node yamlConfig) : MQTTSourceType() {
             magic_enum::enum_cast<GatheringMode>(yamlConfig[Configurations::SOURCE_GATHERING_MODE_CONFIG].As<std::string>())
                 .value());
     }
+    if (!yamlConfig[Configurations::SOURCE_ADAPTIVE_VALUE_FIELDS_CONFIG].As<std::string>().empty()
+        && yamlConfig[Configurations::SOURCE_ADAPTIVE_VALUE_FIELDS_CONFIG].As<std::string>() != "\n") {
+        adaptiveValueFields->setValue(yamlConfig[Configurations::SOURCE_ADAPTIVE_VALUE_FIELDS_CONFIG].As<std::string>());
+    }
+    if (!yamlConfig[Configurations::SOURCE_FUSED_GATHERING_GROUP_CONFIG].As<std::string>().empty()
+        && yamlConfig[Configurations::SOURCE_FUSED_GATHERING_GROUP_CONFIG].As<std::string>() != "\n") {
+        fusedGatheringGroup->setValue(yamlConfig[Configurations::SOURCE_FUSED_GATHERING_GROUP_CONFIG].As<std::string>());
+    }
     if (!yamlConfig[Configurations::NUMBER_OF_BUFFERS_TO_PRODUCE_CONFIG].As<std::string>().empty()
         && yamlConfig[Configurations::NUMBER_OF_BUFFERS_TO_PRODUCE_CONFIG].As<std::string>() != "\n") {
         numberOfBuffersToProduce->setValue(yamlConfig[Configurations::NUMBER_OF_BUFFERS_TO_PRODUCE_CONFIG].As<uint32_t>());
@@ -179,6 +207,15 @@ MQTTSourceType::MQTTSourceType()
       inputFormat(Configurations::ConfigurationOption<Configurations::InputFormat>::create(Configurations::INPUT_FORMAT_CONFIG,
                                                                                            Configurations::InputFormat::JSON,
                                                                                            "input data format")),
+      onDemandJSONParsing(Configurations::ConfigurationOption<bool>::create(
+          Configurations::ON_DEMAND_JSON_PARSING_CONFIG,
+          false,
+          "Parse JSON input on demand, only the keys of the schema are extracted and a payload may hold several "
+          "newline-delimited records.")),
+      batchedConsumption(Configurations::ConfigurationOption<bool>::create(
+          Configurations::BATCHED_CONSUMPTION_CONFIG,
+          false,
+          "Drain all queued messages at once and parse them in a batch, instead of consuming one message per tuple.")),
       sourceGatheringInterval(
           Configurations::ConfigurationOption<uint32_t>::create(Configurations::SOURCE_GATHERING_INTERVAL_CONFIG,
                                                                 0,
@@ -186,6 +223,15 @@ MQTTSourceType::MQTTSourceType()
       gatheringMode(Configurations::ConfigurationOption<GatheringMode>::create(Configurations::SOURCE_GATHERING_MODE_CONFIG,
                                                                                GatheringMode::INTERVAL_MODE,
                                                                                "Gathering mode of the source.")),
+      adaptiveValueFields(Configurations::ConfigurationOption<std::string>::create(
+          Configurations::SOURCE_ADAPTIVE_VALUE_FIELDS_CONFIG,
+          "",
+          "Comma separated numeric fields that drive the adaptive gathering mode. "
+          "Default: the field value, or the first numeric field of the schema.")),
+      fusedGatheringGroup(Configurations::ConfigurationOption<std::string>::create(
+          Configurations::SOURCE_FUSED_GATHERING_GROUP_CONFIG,
+          "",
+          "Sources with the same group share one Kalman filter and gathering interval in the FUSED_ADAPTIVE_MODE.")),
       numberOfBuffersToProduce(
           Configurations::ConfigurationOption<uint32_t>::create(Configurations::NUMBER_OF_BUFFERS_TO_PRODUCE_CONFIG,
                                                                 0,
@@ -208,8 +254,12 @@ std::string MQTTSourceType::toString() {
     ss << Configurations::CLEAN_SESSION_CONFIG + ":" + cleanSession->toStringNameCurrentValue();
     ss << Configurations::FLUSH_INTERVAL_MS_CONFIG + ":" + flushIntervalMS->toStringNameCurrentValue();
     ss << Configurations::INPUT_FORMAT_CONFIG + ":" + inputFormat->toStringNameCurrentValueEnum();
+    ss << Configurations::ON_DEMAND_JSON_PARSING_CONFIG + ":" + onDemandJSONParsing->toStringNameCurrentValue();
+    ss << Configurations::BATCHED_CONSUMPTION_CONFIG + ":" + batchedConsumption->toStringNameCurrentValue();
     ss << Configurations::SOURCE_GATHERING_INTERVAL_CONFIG + ":" + sourceGatheringInterval->toStringNameCurrentValue();
     ss << Configurations::SOURCE_GATHERING_MODE_CONFIG + ":" + std::string(magic_enum::enum_name(gatheringMode->getValue()));
+    ss << Configurations::SOURCE_ADAPTIVE_VALUE_FIELDS_CONFIG + ":" + adaptiveValueFields->toStringNameCurrentValue();
+    ss << Configurations::SOURCE_FUSED_GATHERING_GROUP_CONFIG + ":" + fusedGatheringGroup->toStringNameCurrentValue();
     ss << Configurations::NUMBER_OF_BUFFERS_TO_PRODUCE_CONFIG + ":" + numberOfBuffersToProduce->toStringNameCurrentValue();
     ss << Configurations::NUMBER_OF_TUPLES_TO_PRODUCE_PER_BUFFER_CONFIG + ":"
             + numberOfTuplesToProducePerBuffer->toStringNameCurrentValue();
@@ -229,8 +279,12 @@ bool MQTTSourceType::equal(const PhysicalSourceTypePtr& other) {
         && cleanSession->getValue() == otherSourceConfig->cleanSession->getValue()
         && flushIntervalMS->getValue() == otherSourceConfig->flushIntervalMS->getValue()
         && inputFormat->getValue() == otherSourceConfig->inputFormat->getValue()
+        && onDemandJSONParsing->getValue() == otherSourceConfig->onDemandJSONParsing->getValue()
+        && batchedConsumption->getValue() == otherSourceConfig->batchedConsumption->getValue()
         && sourceGatheringInterval->getValue() == otherSourceConfig->sourceGatheringInterval->getValue()
         && gatheringMode->getValue() == otherSourceConfig->gatheringMode->getValue()
+        && adaptiveValueFields->getValue() == otherSourceConfig->adaptiveValueFields->getValue()
+        && fusedGatheringGroup->getValue() == otherSourceConfig->fusedGatheringGroup->getValue()
         && numberOfBuffersToProduce->getValue() == otherSourceConfig->numberOfBuffersToProduce->getValue()
         && numberOfTuplesToProducePerBuffer->getValue() == otherSourceConfig->numberOfTuplesToProducePerBuffer->getValue();
 }
@@ -251,10 +305,18 @@ Configurations::FloatConfigOption MQTTSourceType::getFlushIntervalMS() const { r
 
 Configurations::InputFormatConfigOption MQTTSourceType::getInputFormat() const { return inputFormat; }
 
+Configurations::BoolConfigOption MQTTSourceType::getOnDemandJSONParsing() const { return onDemandJSONParsing; }
+
+Configurations::BoolConfigOption MQTTSourceType::getBatchedConsumption() const { return batchedConsumption; }
+
 Configurations::IntConfigOption MQTTSourceType::getGatheringInterval() const { return sourceGatheringInterval; }
 
 Configurations::GatheringModeConfigOption MQTTSourceType::getGatheringMode() const { return gatheringMode; }
 
+Configurations::StringConfigOption MQTTSourceType::getAdaptiveValueFields() const { return adaptiveValueFields; }
+
+Configurations::StringConfigOption MQTTSourceType::getFusedGatheringGroup() const { return fusedGatheringGroup; }
+
 Configurations::IntConfigOption MQTTSourceType::getNumberOfBuffersToProduce() const { return numberOfBuffersToProduce; }
 
 Configurations::IntConfigOption MQTTSourceType::getNumberOfTuplesToProducePerBuffer() const {
@@ -283,6 +345,12 @@ void MQTTSourceType::setInputFormat(Configurations::InputFormat inputFormatValue
     inputFormat->setValue(std::move(inputFormatValue));
 }
 
+void MQTTSourceType::setOnDemandJSONParsing(bool onDemandJSONParsingValue) {
+    onDemandJSONParsing->setValue(onDemandJSONParsingValue);
+}
+
+void MQTTSourceType::setBatchedConsumption(bool batchedConsumptionValue) { batchedConsumption->setValue(batchedConsumptionValue); }
+
 void MQTTSourceType::setGatheringInterval(uint32_t sourceGatheringIntervalValue) {
     sourceGatheringInterval->setValue(sourceGatheringIntervalValue);
 }
@@ -293,6 +361,14 @@ void MQTTSourceType::setGatheringMode(std::string inputGatheringMode) {
 
 void MQTTSourceType::setGatheringMode(GatheringMode inputGatheringMode) { gatheringMode->setValue(inputGatheringMode); }
 
+void MQTTSourceType::setAdaptiveValueFields(std::string adaptiveValueFieldsValue) {
+    adaptiveValueFields->setValue(std::move(adaptiveValueFieldsValue));
+}
+
+void MQTTSourceType::setFusedGatheringGroup(std::string fusedGatheringGroupValue) {
+    fusedGatheringGroup->setValue(std::move(fusedGatheringGroupValue));
+}
+
 void MQTTSourceType::setNumberOfBuffersToProduce(uint32_t numberOfBuffersToProduceValue) {
     numberOfBuffersToProduce->setValue(numberOfBuffersToProduceValue);
 }
@@ -310,7 +386,11 @@ void MQTTSourceType::reset() {
     setCleanSession(cleanSession->getDefaultValue());
     setFlushIntervalMS(flushIntervalMS->getDefaultValue());
     setInputFormat(inputFormat->getDefaultValue());
+    setOnDemandJSONParsing(onDemandJSONParsing->getDefaultValue());
+    setBatchedConsumption(batchedConsumption->getDefaultValue());
     setGatheringInterval(sourceGatheringInterval->getDefaultValue());
+    setAdaptiveValueFields(adaptiveValueFields->getDefaultValue());
+    setFusedGatheringGroup(fusedGatheringGroup->getDefaultValue());
     setNumberOfBuffersToProduce(numberOfBuffersToProduce->getDefaultValue());
     setNumberOfTuplesToProducePerBuffer(numberOfTuplesToProducePerBuffer->getDefaultValue());
 }
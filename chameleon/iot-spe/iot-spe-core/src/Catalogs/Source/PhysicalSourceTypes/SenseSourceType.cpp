@@ -36,6 +36,32 @@ SenseSourceType::SenseSourceType(std::map<std::string, std::string> sourceConfig
     } else {
         x_THROW_RUNTIME_ERROR("OPCSourceConfig:: no udfs defined! Please define a udfs.");
     }
+    if (sourceConfigMap.find(Configurations::SENSOR_BUS_TYPE_CONFIG) != sourceConfigMap.end()) {
+        busType->setValue(sourceConfigMap.find(Configurations::SENSOR_BUS_TYPE_CONFIG)->second);
+    }
+    if (sourceConfigMap.find(Configurations::SENSOR_BUS_PATH_CONFIG) != sourceConfigMap.end()) {
+        busPath->setValue(sourceConfigMap.find(Configurations::SENSOR_BUS_PATH_CONFIG)->second);
+    }
+    if (sourceConfigMap.find(Configurations::SENSOR_BUS_ADDRESS_CONFIG) != sourceConfigMap.end()) {
+        // accepts decimal and hexadecimal addresses, e.g., 0x1c
+        busAddress->setValue(std::stoul(sourceConfigMap.find(Configurations::SENSOR_BUS_ADDRESS_CONFIG)->second, nullptr, 0));
+    }
+    if (sourceConfigMap.find(Configurations::SENSOR_BUS_SAMPLE_INTERVAL_CONFIG) != sourceConfigMap.end()) {
+        busSampleInterval->setValue(std::stoi(sourceConfigMap.find(Configurations::SENSOR_BUS_SAMPLE_INTERVAL_CONFIG)->second));
+    }
+    if (sourceConfigMap.find(Configurations::SOURCE_GATHERING_INTERVAL_CONFIG) != sourceConfigMap.end()) {
+        sourceGatheringInterval->setValue(
+            std::stoi(sourceConfigMap.find(Configurations::SOURCE_GATHERING_INTERVAL_CONFIG)->second));
+    }
+    if (sourceConfigMap.find(Configurations::SOURCE_GATHERING_MODE_CONFIG) != sourceConfigMap.end()) {
+        gatheringMode->setValue(
+            magic_enum::enum_cast<GatheringMode>(sourceConfigMap.find(Configurations::SOURCE_GATHERING_MODE_CONFIG)->second)
+                .value());
+    }
+    if (sourceConfigMap.find(Configurations::NUMBER_OF_TUPLES_TO_PRODUCE_PER_BUFFER_CONFIG) != sourceConfigMap.end()) {
+        numberOfTuplesToProducePerBuffer->setValue(
+            std::stoi(sourceConfigMap.find(Configurations::NUMBER_OF_TUPLES_TO_PRODUCE_PER_BUFFER_CONFIG)->second));
+    }
 }
 
 SenseSourceType::SenseSourceType(Yaml::Node yamlConfig) : SenseSourceType() {
@@ -46,13 +72,68 @@ SenseSourceType::SenseSourceType(Yaml::Node yamlConfig) : SenseSourceType() {
     } else {
         x_THROW_RUNTIME_ERROR("SenseSourceType:: no udfs defined! Please define a udfs.");
     }
+    if (!yamlConfig[Configurations::SENSOR_BUS_TYPE_CONFIG].As<std::string>().empty()
+        && yamlConfig[Configurations::SENSOR_BUS_TYPE_CONFIG].As<std::string>() != "\n") {
+        busType->setValue(yamlConfig[Configurations::SENSOR_BUS_TYPE_CONFIG].As<std::string>());
+    }
+    if (!yamlConfig[Configurations::SENSOR_BUS_PATH_CONFIG].As<std::string>().empty()
+        && yamlConfig[Configurations::SENSOR_BUS_PATH_CONFIG].As<std::string>() != "\n") {
+        busPath->setValue(yamlConfig[Configurations::SENSOR_BUS_PATH_CONFIG].As<std::string>());
+    }
+    if (!yamlConfig[Configurations::SENSOR_BUS_ADDRESS_CONFIG].As<std::string>().empty()
+        && yamlConfig[Configurations::SENSOR_BUS_ADDRESS_CONFIG].As<std::string>() != "\n") {
+        busAddress->setValue(std::stoul(yamlConfig[Configurations::SENSOR_BUS_ADDRESS_CONFIG].As<std::string>(), nullptr, 0));
+    }
+    if (!yamlConfig[Configurations::SENSOR_BUS_SAMPLE_INTERVAL_CONFIG].As<std::string>().empty()
+        && yamlConfig[Configurations::SENSOR_BUS_SAMPLE_INTERVAL_CONFIG].As<std::string>() != "\n") {
+        busSampleInterval->setValue(yamlConfig[Configurations::SENSOR_BUS_SAMPLE_INTERVAL_CONFIG].As<uint32_t>());
+    }
+    if (!yamlConfig[Configurations::SOURCE_GATHERING_INTERVAL_CONFIG].As<std::string>().empty()
+        && yamlConfig[Configurations::SOURCE_GATHERING_INTERVAL_CONFIG].As<std::string>() != "\n") {
+        sourceGatheringInterval->setValue(yamlConfig[Configurations::SOURCE_GATHERING_INTERVAL_CONFIG].As<uint32_t>());
+    }
+    if (!yamlConfig[Configurations::SOURCE_GATHERING_MODE_CONFIG].As<std::string>().empty()
+        && yamlConfig[Configurations::SOURCE_GATHERING_MODE_CONFIG].As<std::string>() != "\n") {
+        gatheringMode->setValue(
+            magic_enum::enum_cast<GatheringMode>(yamlConfig[Configurations::SOURCE_GATHERING_MODE_CONFIG].As<std::string>())
+                .value());
+    }
+    if (!yamlConfig[Configurations::NUMBER_OF_TUPLES_TO_PRODUCE_PER_BUFFER_CONFIG].As<std::string>().empty()
+        && yamlConfig[Configurations::NUMBER_OF_TUPLES_TO_PRODUCE_PER_BUFFER_CONFIG].As<std::string>() != "\n") {
+        numberOfTuplesToProducePerBuffer->setValue(
+            yamlConfig[Configurations::NUMBER_OF_TUPLES_TO_PRODUCE_PER_BUFFER_CONFIG].As<uint32_t>());
+    }
 }
 
 SenseSourceType::SenseSourceType()
     : PhysicalSourceType(SourceType::SENSE_SOURCE),
       udfs(Configurations::ConfigurationOption<std::string>::create(Configurations::UDFS_CONFIG,
                                                                     "",
-                                                                    "udfs, needed for: SenseSource")) {
+                                                                    "udfs, needed for: SenseSource")),
+      busType(Configurations::ConfigurationOption<std::string>::create(Configurations::SENSOR_BUS_TYPE_CONFIG,
+                                                                       "",
+                                                                       "Type of the sensor bus (I2C, SIMULATED), empty for none.")),
+      busPath(Configurations::ConfigurationOption<std::string>::create(Configurations::SENSOR_BUS_PATH_CONFIG,
+                                                                       "",
+                                                                       "Device of the sensor bus or file of a simulated bus.")),
+      busAddress(Configurations::ConfigurationOption<uint32_t>::create(Configurations::SENSOR_BUS_ADDRESS_CONFIG,
+                                                                       0,
+                                                                       "Address of the sensor on the bus.")),
+      busSampleInterval(
+          Configurations::ConfigurationOption<uint32_t>::create(Configurations::SENSOR_BUS_SAMPLE_INTERVAL_CONFIG,
+                                                                1,
+                                                                "Interval in ms between two samples of a simulated bus.")),
+      sourceGatheringInterval(
+          Configurations::ConfigurationOption<uint32_t>::create(Configurations::SOURCE_GATHERING_INTERVAL_CONFIG,
+                                                                1000,
+                                                                "Gathering interval of the source.")),
+      gatheringMode(Configurations::ConfigurationOption<GatheringMode>::create(Configurations::SOURCE_GATHERING_MODE_CONFIG,
+                                                                               GatheringMode::INTERVAL_MODE,
+                                                                               "Gathering mode of the source.")),
+      numberOfTuplesToProducePerBuffer(
+          Configurations::ConfigurationOption<uint32_t>::create(Configurations::NUMBER_OF_TUPLES_TO_PRODUCE_PER_BUFFER_CONFIG,
+                                                                1,
+                                                                "Number of bus reads per buffer.")) {
     x_INFO("SenseSourceType: Init source config object with default values.");
 }
 
@@ -60,6 +141,15 @@ std::string SenseSourceType::toString() {
     std::stringstream ss;
     ss << "SenseSourceType => {\n";
     ss << Configurations::UDFS_CONFIG + ":" + udfs->toStringNameCurrentValue();
+    ss << Configurations::SENSOR_BUS_TYPE_CONFIG + ":" + busType->toStringNameCurrentValue();
+    ss << Configurations::SENSOR_BUS_PATH_CONFIG + ":" + busPath->toStringNameCurrentValue();
+    ss << Configurations::SENSOR_BUS_ADDRESS_CONFIG + ":" + busAddress->toStringNameCurrentValue();
+    ss << Configurations::SENSOR_BUS_SAMPLE_INTERVAL_CONFIG + ":" + busSampleInterval->toStringNameCurrentValue();
+    ss << Configurations::SOURCE_GATHERING_INTERVAL_CONFIG + ":" + sourceGatheringInterval->toStringNameCurrentValue();
+    ss << Configurations::SOURCE_GATHERING_MODE_CONFIG + ":" + std::string(magic_enum::enum_name(gatheringMode->getValue()))
+       << "\n";
+    ss << Configurations::NUMBER_OF_TUPLES_TO_PRODUCE_PER_BUFFER_CONFIG + ":"
+            + numberOfTuplesToProducePerBuffer->toStringNameCurrentValue();
     ss << "\n}";
     return ss.str();
 }
@@ -70,13 +160,66 @@ bool SenseSourceType::equal(const PhysicalSourceTypePtr& other) {
         return false;
     }
     auto otherSourceConfig = other->as<SenseSourceType>();
-    return udfs->getValue() == otherSourceConfig->udfs->getValue();
+    return udfs->getValue() == otherSourceConfig->udfs->getValue() && busType->getValue() == otherSourceConfig->busType->getValue()
+        && busPath->getValue() == otherSourceConfig->busPath->getValue()
+        && busAddress->getValue() == otherSourceConfig->busAddress->getValue()
+        && busSampleInterval->getValue() == otherSourceConfig->busSampleInterval->getValue()
+        && sourceGatheringInterval->getValue() == otherSourceConfig->sourceGatheringInterval->getValue()
+        && gatheringMode->getValue() == otherSourceConfig->gatheringMode->getValue()
+        && numberOfTuplesToProducePerBuffer->getValue() == otherSourceConfig->numberOfTuplesToProducePerBuffer->getValue();
 }
 
 Configurations::StringConfigOption SenseSourceType::getUdfs() const { return udfs; }
 
 void SenseSourceType::setUdfs(std::string udfsValue) { udfs->setValue(udfsValue); }
 
-void SenseSourceType::reset() { setUdfs(udfs->getDefaultValue()); }
+Configurations::StringConfigOption SenseSourceType::getBusType() const { return busType; }
+
+void SenseSourceType::setBusType(std::string busTypeValue) { busType->setValue(std::move(busTypeValue)); }
+
+Configurations::StringConfigOption SenseSourceType::getBusPath() const { return busPath; }
+
+void SenseSourceType::setBusPath(std::string busPathValue) { busPath->setValue(std::move(busPathValue)); }
+
+Configurations::IntConfigOption SenseSourceType::getBusAddress() const { return busAddress; }
+
+void SenseSourceType::setBusAddress(uint32_t busAddressValue) { busAddress->setValue(busAddressValue); }
+
+Configurations::IntConfigOption SenseSourceType::getBusSampleInterval() const { return busSampleInterval; }
+
+void SenseSourceType::setBusSampleInterval(uint32_t busSampleIntervalValue) { busSampleInterval->setValue(busSampleIntervalValue); }
+
+Configurations::IntConfigOption SenseSourceType::getGatheringInterval() const { return sourceGatheringInterval; }
+
+void SenseSourceType::setGatheringInterval(uint32_t sourceGatheringIntervalValue) {
+    sourceGatheringInterval->setValue(sourceGatheringIntervalValue);
+}
+
+Configurations::GatheringModeConfigOption SenseSourceType::getGatheringMode() const { return gatheringMode; }
+
+void SenseSourceType::setGatheringMode(std::string inputGatheringMode) {
+    SenseSourceType::setGatheringMode(magic_enum::enum_cast<GatheringMode>(inputGatheringMode).value());
+}
+
+void SenseSourceType::setGatheringMode(GatheringMode inputGatheringMode) { gatheringMode->setValue(inputGatheringMode); }
+
+Configurations::IntConfigOption SenseSourceType::getNumberOfTuplesToProducePerBuffer() const {
+    return numberOfTuplesToProducePerBuffer;
+}
+
+void SenseSourceType::setNumberOfTuplesToProducePerBuffer(uint32_t numberOfTuplesToProducePerBufferValue) {
+    numberOfTuplesToProducePerBuffer->setValue(numberOfTuplesToProducePerBufferValue);
+}
+
+void SenseSourceType::reset() {
+    setUdfs(udfs->getDefaultValue());
+    setBusType(busType->getDefaultValue());
+    setBusPath(busPath->getDefaultValue());
+    setBusAddress(busAddress->getDefaultValue());
+    setBusSampleInterval(busSampleInterval->getDefaultValue());
+    setGatheringInterval(sourceGatheringInterval->getDefaultValue());
+    setGatheringMode(gatheringMode->getDefaultValue());
+    setNumberOfTuplesToProducePerBuffer(numberOfTuplesToProducePerBuffer->getDefaultValue());
+}
 
 }// namespace x
\ No newline at end of file
@@ -57,7 +57,7 @@ TCPSourceType::TCPSourceType()
           Configurations::INPUT_FORMAT_CONFIG,
           Configurations::InputFormat::CSV,
           "Input format defix how the data will arrive in x. Current Option: CSV (comma separated list with separator "
-          "between lix/tuples), JSON.")),
+          "between lix/tuples), JSON, BINARY (fixed-size tuples in the row layout of the schema).")),
       decideMessageSize(Configurations::ConfigurationOption<Configurations::TCPDecideMessageSize>::create(
           Configurations::DECIDE_MESSAGE_SIZE_CONFIG,
           Configurations::TCPDecideMessageSize::TUPLE_SEPARATOR,
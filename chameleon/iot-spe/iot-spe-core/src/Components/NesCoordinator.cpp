@@ -29,6 +29,7 @@
 #include <RequestProcessor/AsyncRequestProcessor.hpp>
 #include <RequestProcessor/StorageHandles/StorageDataStructures.hpp>
 #include <Runtime/NodeEngine.hpp>
+#include <Services/GatheringPolicyService.hpp>
 #include <Services/LocationService.hpp>
 #include <Services/QueryCatalogService.hpp>
 #include <Services/QueryService.hpp>
@@ -94,6 +95,7 @@ xCoordinator::xCoordinator(CoordinatorConfigurationPtr coordinatorConfiguration)
     queryCatalog = std::make_shared<Catalogs::Query::QueryCatalog>();
 
     sourceCatalogService = std::make_shared<SourceCatalogService>(sourceCatalog);
+    gatheringPolicyService = std::make_shared<GatheringPolicyService>(sourceCatalog);
     topologyManagerService = std::make_shared<TopologyManagerService>(topology, locationIndex);
     queryRequestQueue = std::make_shared<RequestQueue>(this->coordinatorConfiguration->optimizer.queryBatchSize);
     globalQueryPlan = GlobalQueryPlan::create();
@@ -230,6 +232,7 @@ uint64_t xCoordinator::startCoordinator(bool blocking) {
                                               udfCatalog,
                                               worker->getNodeEngine()->getBufferManager(),
                                               locationService,
+                                              gatheringPolicyService,
                                               allowedOrigin);
     restThread = std::make_shared<std::thread>(([&]() {
         setThreadName("xREST");
@@ -259,6 +262,8 @@ Catalogs::Source::SourceCatalogPtr xCoordinator::getSourceCatalog() const { retu
 
 ReplicationServicePtr xCoordinator::getReplicationService() const { return replicationService; }
 
+GatheringPolicyServicePtr xCoordinator::getGatheringPolicyService() const { return gatheringPolicyService; }
+
 TopologyPtr xCoordinator::getTopology() const { return topology; }
 
 bool xCoordinator::stopCoordinator(bool force) {
@@ -333,7 +338,8 @@ void xCoordinator::buildAndStartGRPCServer(const std::shared_ptr<std::promise<bo
                                  queryCatalogService,
                                  monitoringService->getMonitoringManager(),
                                  this->replicationService,
-                                 locationService);
+                                 locationService,
+                                 gatheringPolicyService);
 
     std::string address = rpcIp + ":" + std::to_string(rpcPort);
     builder.AddListeningPort(address, grpc::InsecureServerCredentials());
@@ -25,8 +25,10 @@
 #include <Monitoring/MonitoringPlan.hpp>
 #include <Monitoring/Storage/AbstractMetricStore.hpp>
 #include <Network/NetworkManager.hpp>
+#include <Runtime/GatheringIntervalCollector.hpp>
 #include <Runtime/NodeEngine.hpp>
 #include <Runtime/NodeEngineBuilder.hpp>
+#include <Runtime/QueryManager.hpp>
 #include <Runtime/QueryStatistics.hpp>
 #include <Services/WorkerHealthCheckService.hpp>
 #include <Spatial/DataTypes/Waypoint.hpp>
@@ -230,6 +232,28 @@ bool xWorker::start(bool blocking, bool withConnect) {
             x_DEBUG("xWorker: statistic collection end");
         }));
     }
+    if (withConnect && workerConfig->gatheringIntervalReportPeriod > 0) {
+        gatheringIntervalReportThread = std::make_shared<std::thread>(([this]() {
+            setThreadName("GatherReport");
+            x_DEBUG("xWorker: start gathering interval reports");
+            auto period = std::chrono::milliseconds(workerConfig->gatheringIntervalReportPeriod.getValue());
+            auto& collector = nodeEngine->getQueryManager()->getGatheringIntervalCollector();
+            auto nextReport = std::chrono::steady_clock::now() + period;
+            while (isRunning) {
+                // wake up frequently to observe a stop, but report only once per period
+                std::this_thread::sleep_for(std::min(period, std::chrono::milliseconds(100)));
+                if (std::chrono::steady_clock::now() < nextReport) {
+                    continue;
+                }
+                nextReport += period;
+                auto samples = collector.drain();
+                if (!samples.empty() && connected && !coordinatorRpcClient->reportGatheringIntervals(workerId, samples)) {
+                    x_WARNING("xWorker: could not report {} gathering intervals to the coordinator", samples.size());
+                }
+            }
+            x_DEBUG("xWorker: gathering interval reports end");
+        }));
+    }
     if (blocking) {
         x_DEBUG("xWorker: started, join now and waiting for work");
         signal(SIGINT, termFunc);
@@ -293,6 +317,11 @@ bool xWorker::stop(bool) {
             statisticOutputThread->join();
         }
         statisticOutputThread.reset();
+        if (gatheringIntervalReportThread && gatheringIntervalReportThread->joinable()) {
+            x_DEBUG("xWorker: gathering interval report thread join");
+            gatheringIntervalReportThread->join();
+        }
+        gatheringIntervalReportThread.reset();
 
         return successShutdownNodeEngine;
     }
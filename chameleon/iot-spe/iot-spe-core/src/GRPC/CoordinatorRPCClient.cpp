@@ -18,6 +18,7 @@
 #include <GRPC/CoordinatorRPCClient.hpp>
 #include <Health.grpc.pb.h>
 #include <Monitoring/Metrics/Gauge/RegistrationMetrics.hpp>
+#include <Runtime/GatheringIntervalCollector.hpp>
 #include <Runtime/TupleBuffer.hpp>
 #include <Spatial/DataTypes/GeoLocation.hpp>
 #include <Spatial/DataTypes/Waypoint.hpp>
@@ -538,6 +539,30 @@ bool CoordinatorRPCClient::sendErrors(uint64_t workerId, std::string errorMsg) {
     return false;
 }
 
+bool CoordinatorRPCClient::reportGatheringIntervals(uint64_t workerId,
+                                                    const std::vector<Runtime::GatheringIntervalSample>& samples) {
+    GatheringIntervalReport request;
+    request.set_workerid(workerId);
+    for (const auto& sample : samples) {
+        auto* serializedSample = request.add_samples();
+        serializedSample->set_physicalsourcename(sample.physicalSourceName);
+        serializedSample->set_operatorid(sample.operatorId);
+        serializedSample->set_timestampinms(sample.timestampInMs);
+        serializedSample->set_gatheringintervalinms(sample.gatheringInterval.count());
+        serializedSample->set_estimationerror(sample.estimationError);
+    }
+
+    GatheringIntervalReportReply reply;
+    ClientContext context;
+    Status status = coordinatorStub->ReportGatheringIntervals(&context, request, &reply);
+    if (status.ok()) {
+        x_DEBUG("CoordinatorRPCClient::reportGatheringIntervals: reported {} samples", samples.size());
+        return reply.success();
+    }
+    x_DEBUG("CoordinatorRPCClient::reportGatheringIntervals error={}: {}", status.error_code(), status.error_message());
+    return false;
+}
+
 bool CoordinatorRPCClient::checkAndMarkForSoftStop(QueryId queryId, QuerySubPlanId subPlanId, OperatorId sourceId) {
 
     //Build request
@@ -19,6 +19,7 @@
 #include <Monitoring/Metrics/Gauge/RegistrationMetrics.hpp>
 #include <Monitoring/Metrics/Metric.hpp>
 #include <Monitoring/MonitoringManager.hpp>
+#include <Services/GatheringPolicyService.hpp>
 #include <Services/LocationService.hpp>
 #include <Services/QueryCatalogService.hpp>
 #include <Services/QueryService.hpp>
@@ -37,11 +38,12 @@ CoordinatorRPCServer::CoordinatorRPCServer(QueryServicePtr queryService,
                                            QueryCatalogServicePtr queryCatalogService,
                                            Monitoring::MonitoringManagerPtr monitoringManager,
                                            ReplicationServicePtr replicationService,
-                                           LocationServicePtr locationService)
+                                           LocationServicePtr locationService,
+                                           GatheringPolicyServicePtr gatheringPolicyService)
     : queryService(std::move(queryService)), topologyManagerService(std::move(topologyManagerService)),
       sourceCatalogService(std::move(sourceCatalogService)), queryCatalogService(std::move(queryCatalogService)),
       monitoringManager(std::move(monitoringManager)), replicationService(std::move(replicationService)),
-      locationService(std::move(locationService)){};
+      locationService(std::move(locationService)), gatheringPolicyService(std::move(gatheringPolicyService)){};
 
 Status CoordinatorRPCServer::RegisterWorker(ServerContext*,
                                             const RegisterWorkerRequest* registrationRequest,
@@ -324,6 +326,29 @@ Status CoordinatorRPCServer::SendErrors(ServerContext*, const SendErrorsMessage*
     }
 }
 
+Status CoordinatorRPCServer::ReportGatheringIntervals(ServerContext*,
+                                                      const GatheringIntervalReport* request,
+                                                      GatheringIntervalReportReply* reply) {
+    try {
+        std::vector<Runtime::GatheringIntervalSample> samples;
+        samples.reserve(request->samples_size());
+        for (const auto& sample : request->samples()) {
+            samples.emplace_back(Runtime::GatheringIntervalSample{sample.physicalsourcename(),
+                                                                  sample.operatorid(),
+                                                                  sample.timestampinms(),
+                                                                  std::chrono::milliseconds(sample.gatheringintervalinms()),
+                                                                  sample.estimationerror()});
+        }
+        gatheringPolicyService->addGatheringIntervalSamples(request->workerid(), std::move(samples));
+        reply->set_success(true);
+        return Status::OK;
+    } catch (std::exception& ex) {
+        x_ERROR("CoordinatorRPCServer: received a broken gathering interval report: {}", ex.what());
+        reply->set_success(false);
+        return Status::CANCELLED;
+    }
+}
+
 Status CoordinatorRPCServer::RequestSoftStop(::grpc::ServerContext*,
                                              const ::RequestSoftStopMessage* request,
                                              ::StopRequestReply* response) {
@@ -0,0 +1,52 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <GRPC/Serialization/GatheringPolicySerializationUtil.hpp>
+#include <Util/GatheringPolicy.hpp>
+#include <WorkerRPCService.pb.h>
+
+namespace x {
+
+void GatheringPolicySerializationUtil::serializeGatheringPolicy(const std::string& physicalSourceName,
+                                                                const GatheringPolicy& policy,
+                                                                SerializableGatheringPolicy* serializedPolicy) {
+    serializedPolicy->set_physicalsourcename(physicalSourceName);
+    serializedPolicy->set_gatheringintervalinms(policy.gatheringInterval.value_or(std::chrono::milliseconds(0)).count());
+    serializedPolicy->set_gatheringintervalrangeinms(policy.gatheringIntervalRange.value_or(std::chrono::milliseconds(0)).count());
+    serializedPolicy->set_slowestintervalinms(policy.slowestInterval.value_or(std::chrono::milliseconds(0)).count());
+    serializedPolicy->set_fastestintervalinms(policy.fastestInterval.value_or(std::chrono::milliseconds(0)).count());
+    serializedPolicy->set_lambda(policy.lambda.value_or(0));
+}
+
+GatheringPolicy GatheringPolicySerializationUtil::deserializeGatheringPolicy(const SerializableGatheringPolicy& serializedPolicy) {
+    GatheringPolicy policy;
+    if (serializedPolicy.gatheringintervalinms() > 0) {
+        policy.gatheringInterval = std::chrono::milliseconds(serializedPolicy.gatheringintervalinms());
+    }
+    if (serializedPolicy.gatheringintervalrangeinms() > 0) {
+        policy.gatheringIntervalRange = std::chrono::milliseconds(serializedPolicy.gatheringintervalrangeinms());
+    }
+    if (serializedPolicy.slowestintervalinms() > 0) {
+        policy.slowestInterval = std::chrono::milliseconds(serializedPolicy.slowestintervalinms());
+    }
+    if (serializedPolicy.fastestintervalinms() > 0) {
+        policy.fastestInterval = std::chrono::milliseconds(serializedPolicy.fastestintervalinms());
+    }
+    if (serializedPolicy.lambda() > 0) {
+        policy.lambda = serializedPolicy.lambda();
+    }
+    return policy;
+}
+
+}// namespace x
@@ -90,6 +90,7 @@
 #include <Catalogs/Source/PhysicalSourceTypes/CSVSourceType.hpp>
 #include <GRPC/Serialization/UDFSerializationUtil.hpp>
 #include <Operators/LogicalOperators/CEP/IterationLogicalOperatorNode.hpp>
+#include <Operators/LogicalOperators/Sinks/KafkaSinkDescriptor.hpp>
 #include <Operators/LogicalOperators/Sinks/MQTTSinkDescriptor.hpp>
 #include <Operators/LogicalOperators/Sources/MonitoringSourceDescriptor.hpp>
 
@@ -1120,6 +1121,9 @@ void OperatorSerializationUtil::serializeSourceDescriptor(const SourceDescriptor
             case Configurations::InputFormat::CSV:
                 mqttSerializedSourceConfig.set_inputformat(SerializablePhysicalSourceType_InputFormat_CSV);
                 break;
+            case Configurations::InputFormat::BINARY:
+                mqttSerializedSourceConfig.set_inputformat(SerializablePhysicalSourceType_InputFormat_BINARY);
+                break;
         }
         serializedPhysicalSourceType->mutable_specificphysicalsourcetype()->PackFrom(mqttSerializedSourceConfig);
         //init serializable mqtt source descriptor
@@ -1208,6 +1212,9 @@ void OperatorSerializationUtil::serializeSourceDescriptor(const SourceDescriptor
             case Configurations::InputFormat::CSV:
                 tcpSerializedSourceConfig.set_inputformat(SerializablePhysicalSourceType_InputFormat_CSV);
                 break;
+            case Configurations::InputFormat::BINARY:
+                tcpSerializedSourceConfig.set_inputformat(SerializablePhysicalSourceType_InputFormat_BINARY);
+                break;
         }
         switch (tcpSourceDescriptor->getSourceConfig()->getDecideMessageSize()->getValue()) {
             case Configurations::TCPDecideMessageSize::TUPLE_SEPARATOR:
@@ -1618,10 +1625,27 @@ void OperatorSerializationUtil::serializeSinkDescriptor(const SinkDescriptor& si
             (SerializableOperator_SinkDetails_SerializableMQTTSinkDescriptor_TimeUnits) mqttSinkDescriptor->getTimeUnit());
         mqttSerializedSinkDescriptor.set_msgdelay(mqttSinkDescriptor->getMsgDelay());
         mqttSerializedSinkDescriptor.set_asynchronousclient(mqttSinkDescriptor->getAsynchronousClient());
+        mqttSerializedSinkDescriptor.set_tuplespermessage(mqttSinkDescriptor->getTuplesPerMessage());
 
         sinkDetails.mutable_sinkdescriptor()->PackFrom(mqttSerializedSinkDescriptor);
         sinkDetails.set_faulttolerancemode(static_cast<uint64_t>(mqttSinkDescriptor->getFaultToleranceType()));
         sinkDetails.set_numberoforiginids(numberOfOrigins);
+    } else if (sinkDescriptor.instanceOf<const KafkaSinkDescriptor>()) {
+        // serialize kafka sink descriptor
+        x_TRACE("OperatorSerializationUtil:: serialized SinkDescriptor as "
+                  "SerializableOperator_SinkDetails_SerializableKafkaSinkDescriptor");
+        auto kafkaSinkDescriptor = sinkDescriptor.as<const KafkaSinkDescriptor>();
+        auto serializedSinkDescriptor = SerializableOperator_SinkDetails_SerializableKafkaSinkDescriptor();
+        serializedSinkDescriptor.set_topic(kafkaSinkDescriptor->getTopic());
+        serializedSinkDescriptor.set_brokers(kafkaSinkDescriptor->getBrokers());
+        serializedSinkDescriptor.set_kafkaconnecttimeout(kafkaSinkDescriptor->getTimeout());
+        serializedSinkDescriptor.set_sinkformat(kafkaSinkDescriptor->getSinkFormatAsString());
+        serializedSinkDescriptor.set_maxinflightmessages(kafkaSinkDescriptor->getMaxInFlightMessages());
+        serializedSinkDescriptor.set_lingertimeinms(kafkaSinkDescriptor->getLingerTimeInMs());
+        serializedSinkDescriptor.set_batchsizeinbytes(kafkaSinkDescriptor->getBatchSizeInBytes());
+        sinkDetails.mutable_sinkdescriptor()->PackFrom(serializedSinkDescriptor);
+        sinkDetails.set_faulttolerancemode(static_cast<uint64_t>(kafkaSinkDescriptor->getFaultToleranceType()));
+        sinkDetails.set_numberoforiginids(numberOfOrigins);
     } else if (sinkDescriptor.instanceOf<const Network::NetworkSinkDescriptor>()) {
         // serialize zmq sink descriptor
         x_TRACE("OperatorSerializationUtil:: serialized SinkDescriptor as "
@@ -1661,6 +1685,7 @@ void OperatorSerializationUtil::serializeSinkDescriptor(const SinkDescriptor& si
         serializedSinkDescriptor.set_filepath(fileSinkDescriptor->getFileName());
         serializedSinkDescriptor.set_append(fileSinkDescriptor->getAppend());
         serializedSinkDescriptor.set_addtimestamp(fileSinkDescriptor->getAddTimestamp());
+        serializedSinkDescriptor.set_writemode(static_cast<uint32_t>(fileSinkDescriptor->getWriteMode()));
 
         auto format = fileSinkDescriptor->getSinkFormatAsString();
         if (format == "JSON_FORMAT") {
@@ -1750,6 +1775,8 @@ SinkDescriptorPtr OperatorSerializationUtil::deserializeSinkDescriptor(const Ser
         x_TRACE("OperatorSerializationUtil:: de-serialized SinkDescriptor as MQTTSinkDescriptor");
         auto serializedSinkDescriptor = SerializableOperator_SinkDetails_SerializableMQTTSinkDescriptor();
         deserializedSinkDescriptor.UnpackTo(&serializedSinkDescriptor);
+        // descriptors that were serialized without the field pack one tuple per message
+        auto tuplesPerMessage = serializedSinkDescriptor.tuplespermessage() > 0 ? serializedSinkDescriptor.tuplespermessage() : 1;
         return MQTTSinkDescriptor::create(std::string{serializedSinkDescriptor.address()},
                                           std::string{serializedSinkDescriptor.topic()},
                                           std::string{serializedSinkDescriptor.user()},
@@ -1760,7 +1787,22 @@ SinkDescriptorPtr OperatorSerializationUtil::deserializeSinkDescriptor(const Ser
                                           serializedSinkDescriptor.asynchronousclient(),
                                           std::string{serializedSinkDescriptor.clientid()},
                                           FaultToleranceType(deserializedFaultTolerance),
-                                          deserializedNumberOfOrigins);
+                                          deserializedNumberOfOrigins,
+                                          tuplesPerMessage);
+    } else if (deserializedSinkDescriptor.Is<SerializableOperator_SinkDetails_SerializableKafkaSinkDescriptor>()) {
+        // de-serialize kafka sink descriptor
+        x_TRACE("OperatorSerializationUtil:: de-serialized SinkDescriptor as KafkaSinkDescriptor");
+        auto serializedSinkDescriptor = SerializableOperator_SinkDetails_SerializableKafkaSinkDescriptor();
+        deserializedSinkDescriptor.UnpackTo(&serializedSinkDescriptor);
+        return KafkaSinkDescriptor::create(serializedSinkDescriptor.sinkformat(),
+                                           serializedSinkDescriptor.topic(),
+                                           serializedSinkDescriptor.brokers(),
+                                           serializedSinkDescriptor.kafkaconnecttimeout(),
+                                           serializedSinkDescriptor.maxinflightmessages(),
+                                           serializedSinkDescriptor.lingertimeinms(),
+                                           serializedSinkDescriptor.batchsizeinbytes(),
+                                           FaultToleranceType(deserializedFaultTolerance),
+                                           deserializedNumberOfOrigins);
     } else if (deserializedSinkDescriptor.Is<SerializableOperator_SinkDetails_SerializableNetworkSinkDescriptor>()) {
         // de-serialize zmq sink descriptor
         x_TRACE("OperatorSerializationUtil:: de-serialized SinkDescriptor as NetworkSinkDescriptor");
@@ -1791,7 +1833,8 @@ SinkDescriptorPtr OperatorSerializationUtil::deserializeSinkDescriptor(const Ser
                                           serializedSinkDescriptor.append() ? "APPEND" : "OVERWRITE",
                                           serializedSinkDescriptor.addtimestamp(),
                                           FaultToleranceType(deserializedFaultTolerance),
-                                          deserializedNumberOfOrigins);
+                                          deserializedNumberOfOrigins,
+                                          static_cast<FileSinkWriteMode>(serializedSinkDescriptor.writemode()));
     } else if (deserializedSinkDescriptor.Is<SerializableOperator_SinkDetails_SerializableMaterializedViewSinkDescriptor>()) {
         // de-serialize materialized view sink descriptor
         auto serializedSinkDescriptor = SerializableOperator_SinkDetails_SerializableMaterializedViewSinkDescriptor();
@@ -15,6 +15,7 @@
 #include <API/Schema.hpp>
 #include <Exceptions/RpcException.hpp>
 #include <GRPC/CoordinatorRPCClient.hpp>
+#include <GRPC/Serialization/GatheringPolicySerializationUtil.hpp>
 #include <GRPC/Serialization/QueryPlanSerializationUtil.hpp>
 #include <GRPC/WorkerRPCClient.hpp>
 #include <Health.grpc.pb.h>
@@ -22,6 +23,7 @@
 #include <Plans/Query/QueryPlan.hpp>
 #include <Spatial/DataTypes/GeoLocation.hpp>
 #include <Spatial/DataTypes/Waypoint.hpp>
+#include <Util/GatheringPolicy.hpp>
 #include <Util/Logger/Logger.hpp>
 #include <Util/magicenum/magic_enum.hpp>
 
@@ -363,6 +365,27 @@ bool WorkerRPCClient::injectEpochBarrier(uint64_t timestamp, uint64_t queryId, c
     return false;
 }
 
+std::optional<uint64_t> WorkerRPCClient::setGatheringPolicy(const std::string& address,
+                                                            const std::vector<std::pair<std::string, GatheringPolicy>>& policies) {
+    x_DEBUG("WorkerRPCClient::setGatheringPolicy: send {} policies to address={}", policies.size(), address);
+    GatheringPolicyRequest request;
+    for (const auto& [physicalSourceName, policy] : policies) {
+        GatheringPolicySerializationUtil::serializeGatheringPolicy(physicalSourceName, policy, request.add_policies());
+    }
+    GatheringPolicyReply reply;
+    ClientContext context;
+
+    std::shared_ptr<::grpc::Channel> chan = grpc::CreateChannel(address, grpc::InsecureChannelCredentials());
+    std::unique_ptr<WorkerRPCService::Stub> workerStub = WorkerRPCService::NewStub(chan);
+    Status status = workerStub->SetGatheringPolicy(&context, request, &reply);
+    if (status.ok()) {
+        x_DEBUG("WorkerRPCClient::setGatheringPolicy: status ok, updated {} sources", reply.numberofupdatedsources());
+        return reply.numberofupdatedsources();
+    }
+    x_ERROR("WorkerRPCClient::setGatheringPolicy: error={}: {}", status.error_code(), status.error_message());
+    return std::nullopt;
+}
+
 bool WorkerRPCClient::bufferData(const std::string& address, uint64_t querySubPlanId, uint64_t uniqueNetworkSinDescriptorId) {
     x_DEBUG("WorkerRPCClient::buffering Data on address={}", address);
     BufferRequest request;
@@ -12,6 +12,7 @@
     limitations under the License.
 */
 
+#include <GRPC/Serialization/GatheringPolicySerializationUtil.hpp>
 #include <GRPC/Serialization/QueryPlanSerializationUtil.hpp>
 #include <GRPC/WorkerRPCServer.hpp>
 #include <Monitoring/MonitoringAgent.hpp>
@@ -23,6 +24,7 @@
 #include <Spatial/Mobility/ReconnectSchedulePredictors/ReconnectPoint.hpp>
 #include <Spatial/Mobility/ReconnectSchedulePredictors/ReconnectSchedule.hpp>
 #include <Spatial/Mobility/ReconnectSchedulePredictors/ReconnectSchedulePredictor.hpp>
+#include <Util/GatheringPolicy.hpp>
 #include <Util/Logger/Logger.hpp>
 #include <nlohmann/json.hpp>
 #include <utility>
@@ -148,6 +150,24 @@ Status WorkerRPCServer::InjectEpochBarrier(ServerContext*, const EpochBarrierNot
     }
 }
 
+Status WorkerRPCServer::SetGatheringPolicy(ServerContext*, const GatheringPolicyRequest* request, GatheringPolicyReply* reply) {
+    try {
+        uint64_t numberOfUpdatedSources = 0;
+        for (const auto& serializedPolicy : request->policies()) {
+            auto policy = GatheringPolicySerializationUtil::deserializeGatheringPolicy(serializedPolicy);
+            numberOfUpdatedSources += nodeEngine->setGatheringPolicy(serializedPolicy.physicalsourcename(), policy);
+        }
+        x_DEBUG("WorkerRPCServer::SetGatheringPolicy: updated {} sources for {} policies",
+                numberOfUpdatedSources,
+                request->policies_size());
+        reply->set_numberofupdatedsources(numberOfUpdatedSources);
+        return Status::OK;
+    } catch (std::exception& ex) {
+        x_ERROR("WorkerRPCServer: received a broken gathering policy: {}", ex.what());
+        return Status::CANCELLED;
+    }
+}
+
 Status WorkerRPCServer::BeginBuffer(ServerContext*, const BufferRequest* request, BufferReply* reply) {
     x_DEBUG("WorkerRPCServer::BeginBuffer request received");
 
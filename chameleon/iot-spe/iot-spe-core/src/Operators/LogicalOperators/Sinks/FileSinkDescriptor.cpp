@@ -34,13 +34,15 @@ SinkDescriptorPtr FileSinkDescriptor::create(std::string fileName,
                                              const std::string& append,
                                              bool addTimestamp,
                                              FaultToleranceType faultToleranceType,
-                                             uint64_t numberOfOrigins) {
+                                             uint64_t numberOfOrigins,
+                                             FileSinkWriteMode writeMode) {
     return std::make_shared<FileSinkDescriptor>(FileSinkDescriptor(std::move(fileName),
                                                                    std::move(sinkFormat),
                                                                    append == "APPEND",
                                                                    addTimestamp,
                                                                    faultToleranceType,
-                                                                   numberOfOrigins));
+                                                                   numberOfOrigins,
+                                                                   writeMode));
 }
 
 SinkDescriptorPtr FileSinkDescriptor::create(std::string fileName, std::string sinkFormat, const std::string& append) {
@@ -52,9 +54,10 @@ FileSinkDescriptor::FileSinkDescriptor(std::string fileName,
                                        bool append,
                                        bool addTimestamp,
                                        FaultToleranceType faultToleranceType,
-                                       uint64_t numberOfOrigins)
+                                       uint64_t numberOfOrigins,
+                                       FileSinkWriteMode writeMode)
     : SinkDescriptor(faultToleranceType, numberOfOrigins, addTimestamp), fileName(std::move(fileName)),
-      sinkFormat(std::move(sinkFormat)), append(append) {}
+      sinkFormat(std::move(sinkFormat)), append(append), writeMode(writeMode) {}
 
 const std::string& FileSinkDescriptor::getFileName() const { return fileName; }
 
@@ -70,6 +73,8 @@ bool FileSinkDescriptor::equal(SinkDescriptorPtr const& other) {
 
 bool FileSinkDescriptor::getAppend() const { return append; }
 
+FileSinkWriteMode FileSinkDescriptor::getWriteMode() const { return writeMode; }
+
 std::string FileSinkDescriptor::getSinkFormatAsString() const { return sinkFormat; }
 
 }// namespace x
\ No newline at end of file
@@ -15,16 +15,49 @@
 #include <Operators/LogicalOperators/Sinks/KafkaSinkDescriptor.hpp>
 namespace x {
 
-KafkaSinkDescriptor::KafkaSinkDescriptor(std::string sinkFormat, std::string topic, std::string brokers, uint64_t timeout)
-    : sinkFormat(sinkFormat), topic(topic), brokers(brokers), timeout(timeout) {}
+KafkaSinkDescriptor::KafkaSinkDescriptor(std::string sinkFormat,
+                                         std::string topic,
+                                         std::string brokers,
+                                         uint64_t timeout,
+                                         uint64_t maxInFlightMessages,
+                                         uint64_t lingerTimeInMs,
+                                         uint64_t batchSizeInBytes,
+                                         FaultToleranceType faultToleranceType,
+                                         uint64_t numberOfOrigins)
+    : SinkDescriptor(faultToleranceType, numberOfOrigins), sinkFormat(sinkFormat), topic(topic), brokers(brokers),
+      timeout(timeout), maxInFlightMessages(maxInFlightMessages), lingerTimeInMs(lingerTimeInMs),
+      batchSizeInBytes(batchSizeInBytes) {}
 
 const std::string& KafkaSinkDescriptor::getTopic() const { return topic; }
 
 const std::string& KafkaSinkDescriptor::getBrokers() const { return brokers; }
 
 uint64_t KafkaSinkDescriptor::getTimeout() const { return timeout; }
-SinkDescriptorPtr KafkaSinkDescriptor::create(std::string sinkFormat, std::string topic, std::string brokers, uint64_t timeout) {
-    return std::make_shared<KafkaSinkDescriptor>(KafkaSinkDescriptor(sinkFormat, topic, brokers, timeout));
+
+uint64_t KafkaSinkDescriptor::getMaxInFlightMessages() const { return maxInFlightMessages; }
+
+uint64_t KafkaSinkDescriptor::getLingerTimeInMs() const { return lingerTimeInMs; }
+
+uint64_t KafkaSinkDescriptor::getBatchSizeInBytes() const { return batchSizeInBytes; }
+
+SinkDescriptorPtr KafkaSinkDescriptor::create(std::string sinkFormat,
+                                              std::string topic,
+                                              std::string brokers,
+                                              uint64_t timeout,
+                                              uint64_t maxInFlightMessages,
+                                              uint64_t lingerTimeInMs,
+                                              uint64_t batchSizeInBytes,
+                                              FaultToleranceType faultToleranceType,
+                                              uint64_t numberOfOrigins) {
+    return std::make_shared<KafkaSinkDescriptor>(KafkaSinkDescriptor(sinkFormat,
+                                                                     topic,
+                                                                     brokers,
+                                                                     timeout,
+                                                                     maxInFlightMessages,
+                                                                     lingerTimeInMs,
+                                                                     batchSizeInBytes,
+                                                                     faultToleranceType,
+                                                                     numberOfOrigins));
 }
 
 std::string KafkaSinkDescriptor::toString() const { return "KafkaSinkDescriptor()"; }
@@ -35,9 +68,11 @@ bool KafkaSinkDescriptor::equal(SinkDescriptorPtr const& other) {
     }
     auto otherSinkDescriptor = other->as<KafkaSinkDescriptor>();
     return topic == otherSinkDescriptor->topic && brokers == otherSinkDescriptor->brokers
-        && sinkFormat == otherSinkDescriptor->sinkFormat && timeout == otherSinkDescriptor->timeout;
+        && sinkFormat == otherSinkDescriptor->sinkFormat && timeout == otherSinkDescriptor->timeout
+        && maxInFlightMessages == otherSinkDescriptor->maxInFlightMessages
+        && lingerTimeInMs == otherSinkDescriptor->lingerTimeInMs && batchSizeInBytes == otherSinkDescriptor->batchSizeInBytes;
 }
 
-std::string KafkaSinkDescriptor::getSinkFormatAsString() { return sinkFormat; }
+std::string KafkaSinkDescriptor::getSinkFormatAsString() const { return sinkFormat; }
 
 }// namespace x
\ No newline at end of file
@@ -26,10 +26,12 @@ MQTTSinkDescriptor::MQTTSinkDescriptor(std::string&& address,
                                        const ServiceQualities qualityOfService,
                                        bool asynchronousClient,
                                        FaultToleranceType faultToleranceType,
-                                       uint64_t numberOfOrigins)
+                                       uint64_t numberOfOrigins,
+                                       uint64_t tuplesPerMessage)
     : SinkDescriptor(faultToleranceType, numberOfOrigins), address(std::move(address)), clientId(std::move(clientId)),
       topic(std::move(topic)), user(std::move(user)), maxBufferedMSGs(maxBufferedMSGs), timeUnit(timeUnit),
-      messageDelay(messageDelay), qualityOfService(qualityOfService), asynchronousClient(asynchronousClient) {}
+      messageDelay(messageDelay), qualityOfService(qualityOfService), asynchronousClient(asynchronousClient),
+      tuplesPerMessage(tuplesPerMessage) {}
 
 std::string MQTTSinkDescriptor::getAddress() const { return address; }
 
@@ -53,6 +55,8 @@ FaultToleranceType MQTTSinkDescriptor::getFaultToleranceType() const { return fa
 
 uint64_t MQTTSinkDescriptor::getNumberOfOrigins() const { return numberOfOrigins; }
 
+uint64_t MQTTSinkDescriptor::getTuplesPerMessage() const { return tuplesPerMessage; }
+
 SinkDescriptorPtr MQTTSinkDescriptor::create(std::string&& address,
                                              std::string&& topic,
                                              std::string&& user,
@@ -63,7 +67,8 @@ SinkDescriptorPtr MQTTSinkDescriptor::create(std::string&& address,
                                              bool asynchronousClient,
                                              std::string&& clientId,
                                              FaultToleranceType faultToleranceType,
-                                             uint64_t numberOfOrigins) {
+                                             uint64_t numberOfOrigins,
+                                             uint64_t tuplesPerMessage) {
     return std::make_shared<MQTTSinkDescriptor>(std::move(address),
                                                 std::move(clientId),
                                                 std::move(topic),
@@ -74,7 +79,8 @@ SinkDescriptorPtr MQTTSinkDescriptor::create(std::string&& address,
                                                 qualityOfService,
                                                 asynchronousClient,
                                                 faultToleranceType,
-                                                numberOfOrigins);
+                                                numberOfOrigins,
+                                                tuplesPerMessage);
 }
 
 std::string MQTTSinkDescriptor::toString() const { return "MQTTSinkDescriptor()"; }
@@ -89,6 +95,7 @@ bool MQTTSinkDescriptor::equal(SinkDescriptorPtr const& other) {
         && topic == otherSinkDescriptor->topic && user == otherSinkDescriptor->user
         && maxBufferedMSGs == otherSinkDescriptor->maxBufferedMSGs && timeUnit == otherSinkDescriptor->timeUnit
         && messageDelay == otherSinkDescriptor->messageDelay && qualityOfService == otherSinkDescriptor->qualityOfService
-        && asynchronousClient == otherSinkDescriptor->asynchronousClient;
+        && asynchronousClient == otherSinkDescriptor->asynchronousClient
+        && tuplesPerMessage == otherSinkDescriptor->tuplesPerMessage;
 }
 }// namespace x
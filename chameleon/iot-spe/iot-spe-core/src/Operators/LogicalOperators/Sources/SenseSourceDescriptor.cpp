@@ -25,11 +25,21 @@ SenseSourceDescriptor::SenseSourceDescriptor(SchemaPtr schema, std::string sourc
 
 const std::string& SenseSourceDescriptor::getUdfs() const { return udfs; }
 
+SenseSourceTypePtr SenseSourceDescriptor::getSourceConfig() const { return senseSourceType; }
+
 SourceDescriptorPtr SenseSourceDescriptor::create(SchemaPtr schema, std::string sourceName, std::string udfs) {
     return std::make_shared<SenseSourceDescriptor>(
         SenseSourceDescriptor(std::move(schema), std::move(sourceName), std::move(udfs)));
 }
 
+SourceDescriptorPtr
+SenseSourceDescriptor::create(SchemaPtr schema, std::string sourceName, SenseSourceTypePtr senseSourceType) {
+    auto descriptor = std::make_shared<SenseSourceDescriptor>(
+        SenseSourceDescriptor(std::move(schema), std::move(sourceName), senseSourceType->getUdfs()->getValue()));
+    descriptor->senseSourceType = std::move(senseSourceType);
+    return descriptor;
+}
+
 SourceDescriptorPtr SenseSourceDescriptor::create(SchemaPtr schema, std::string udfs) {
     return std::make_shared<SenseSourceDescriptor>(SenseSourceDescriptor(std::move(schema), std::move(udfs)));
 }
@@ -39,13 +49,16 @@ bool SenseSourceDescriptor::equal(SourceDescriptorPtr const& other) const {
         return false;
     }
     auto otherSource = other->as<SenseSourceDescriptor>();
-    return udfs == otherSource->getUdfs() && getSchema()->equals(otherSource->getSchema());
+    auto sameSourceConfig = senseSourceType == otherSource->senseSourceType
+        || (senseSourceType && otherSource->senseSourceType && senseSourceType->equal(otherSource->senseSourceType));
+    return udfs == otherSource->getUdfs() && sameSourceConfig && getSchema()->equals(otherSource->getSchema());
 }
 
 std::string SenseSourceDescriptor::toString() const { return "SenseSourceDescriptor()"; }
 
 SourceDescriptorPtr SenseSourceDescriptor::copy() {
-    auto copy = SenseSourceDescriptor::create(schema->copy(), logicalSourceName, udfs);
+    auto copy = senseSourceType ? SenseSourceDescriptor::create(schema->copy(), logicalSourceName, senseSourceType)
+                                : SenseSourceDescriptor::create(schema->copy(), logicalSourceName, udfs);
     copy->setPhysicalSourceName(physicalSourceName);
     return copy;
 }
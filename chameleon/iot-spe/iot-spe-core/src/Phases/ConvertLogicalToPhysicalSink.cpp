@@ -105,7 +105,10 @@ DataSinkPtr ConvertLogicalToPhysicalSink::createDataSink(OperatorId operatorId,
                                       kafkaSinkDescriptor->getTopic(),
                                       kafkaSinkDescriptor->getTimeout(),
                                       kafkaSinkDescriptor->getFaultToleranceType(),
-                                      kafkaSinkDescriptor->getNumberOfOrigins());
+                                      kafkaSinkDescriptor->getNumberOfOrigins(),
+                                      kafkaSinkDescriptor->getMaxInFlightMessages(),
+                                      kafkaSinkDescriptor->getLingerTimeInMs(),
+                                      kafkaSinkDescriptor->getBatchSizeInBytes());
         } else {
             x_THROW_RUNTIME_ERROR("Sinkformat " << kafkaSinkDescriptor->getSinkFormatAsString()
                                                   << " currently not supported for Kafka");
@@ -149,7 +152,8 @@ DataSinkPtr ConvertLogicalToPhysicalSink::createDataSink(OperatorId operatorId,
                               mqttSinkDescriptor->getQualityOfService(),
                               mqttSinkDescriptor->getAsynchronousClient(),
                               mqttSinkDescriptor->getFaultToleranceType(),
-                              mqttSinkDescriptor->getNumberOfOrigins());
+                              mqttSinkDescriptor->getNumberOfOrigins(),
+                              mqttSinkDescriptor->getTuplesPerMessage());
     }
 #endif
     else if (sinkDescriptor->instanceOf<FileSinkDescriptor>()) {
@@ -165,7 +169,8 @@ DataSinkPtr ConvertLogicalToPhysicalSink::createDataSink(OperatorId operatorId,
                                      fileSinkDescriptor->getAppend(),
                                      fileSinkDescriptor->getAddTimestamp(),
                                      fileSinkDescriptor->getFaultToleranceType(),
-                                     fileSinkDescriptor->getNumberOfOrigins());
+                                     fileSinkDescriptor->getNumberOfOrigins(),
+                                     fileSinkDescriptor->getWriteMode());
         } else if (fileSinkDescriptor->getSinkFormatAsString() == "x_FORMAT") {
             return createBinaryxFileSink(schema,
                                            querySubPlan->getQueryId(),
@@ -175,7 +180,8 @@ DataSinkPtr ConvertLogicalToPhysicalSink::createDataSink(OperatorId operatorId,
                                            fileSinkDescriptor->getFileName(),
                                            fileSinkDescriptor->getAppend(),
                                            fileSinkDescriptor->getFaultToleranceType(),
-                                           fileSinkDescriptor->getNumberOfOrigins());
+                                           fileSinkDescriptor->getNumberOfOrigins(),
+                                           fileSinkDescriptor->getWriteMode());
         }
 #ifdef ENABLE_ARROW_BUILD
         else if (fileSinkDescriptor->getSinkFormatAsString() == "ARROW_FORMAT") {
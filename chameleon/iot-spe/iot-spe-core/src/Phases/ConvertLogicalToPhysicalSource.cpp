@@ -196,6 +196,7 @@ ConvertLogicalToPhysicalSource::createDataSource(OperatorId operatorId,
                                  bufferManager,
                                  queryManager,
                                  senseSourceDescriptor->getUdfs(),
+                                 senseSourceDescriptor->getSourceConfig(),
                                  operatorId,
                                  originId,
                                  numSourceLocalBuffers,
@@ -334,7 +334,7 @@ SourceDescriptorPtr LowerToExecutableQueryPlanPhase::createSourceDescriptor(Sche
         }
         case SourceType::SENSE_SOURCE: {
             auto senseSourceType = physicalSourceType->as<SenseSourceType>();
-            return SenseSourceDescriptor::create(schema, logicalSourceName, senseSourceType->getUdfs()->getValue());
+            return SenseSourceDescriptor::create(schema, logicalSourceName, senseSourceType);
         }
         case SourceType::MEMORY_SOURCE: {
             auto memorySourceType = physicalSourceType->as<MemorySourceType>();
@@ -16,6 +16,7 @@
 #include <Catalogs/UDF/UDFCatalog.hpp>
 #include <Components/xCoordinator.hpp>
 #include <REST/Controller/ConnectivityController.hpp>
+#include <REST/Controller/GatheringPolicyController.hpp>
 #include <REST/Controller/LocationController.hpp>
 #include <REST/Controller/MonitoringController.hpp>
 #include <REST/Controller/QueryCatalogController.hpp>
@@ -52,13 +53,14 @@ RestServer::RestServer(std::string host,
                        Catalogs::UDF::UDFCatalogPtr udfCatalog,
                        Runtime::BufferManagerPtr bufferManager,
                        LocationServicePtr locationService,
+                       GatheringPolicyServicePtr gatheringPolicyService,
                        std::optional<std::string> corsAllowedOrigin)
     : host(std::move(host)), port(port), coordinator(std::move(coordinator)), queryCatalogService(std::move(queryCatalogService)),
       globalExecutionPlan(std::move(globalExecutionPlan)), queryService(std::move(queryService)),
       globalQueryPlan(std::move(globalQueryPlan)), sourceCatalogService(std::move(sourceCatalogService)),
       topologyManagerService(std::move(topologyManagerService)), udfCatalog(std::move(udfCatalog)),
       locationService(std::move(locationService)), monitoringService(std::move(monitoringService)),
-      bufferManager(std::move(bufferManager)), corsAllowedOrigin(std::move(corsAllowedOrigin)) {}
+      gatheringPolicyService(std::move(gatheringPolicyService)), bufferManager(std::move(bufferManager)), corsAllowedOrigin(std::move(corsAllowedOrigin)) {}
 
 bool RestServer::start() {
     x_INFO("Starting Oatpp Server on {}:{}", host, std::to_string(port));
@@ -131,6 +133,10 @@ void RestServer::run() {
                                                                                bufferManager,
                                                                                errorHandler,
                                                                                "/monitoring");
+    auto gatheringPolicyController = REST::Controller::GatheringPolicyController::create(objectMapper,
+                                                                                         gatheringPolicyService,
+                                                                                         errorHandler,
+                                                                                         "/gatheringPolicy");
 
     router->addController(connectivityController);
     router->addController(queryCatalogController);
@@ -142,6 +148,7 @@ void RestServer::run() {
     router->addController(connectivityController);
     router->addController(queryCatalogController);
     router->addController(monitoringController);
+    router->addController(gatheringPolicyController);
 
     /* Create HTTP connection handler with router */
     auto connectionHandler = oatpp::web::server::HttpConnectionHandler::createShared(router);
@@ -0,0 +1,154 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Runtime/FusedGatheringGroup.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <algorithm>
+#include <cstring>
+
+namespace x::Runtime {
+
+FusedGatheringGroup::FusedGatheringGroup(std::string name) : name(std::move(name)) {}
+
+uint64_t FusedGatheringGroup::join(uint64_t numberOfValues, std::chrono::milliseconds gatheringInterval) {
+    x_ASSERT(numberOfValues > 0, "FusedGatheringGroup: a member has to submit at least one value");
+    std::unique_lock lock(mutex);
+    // reuse the id of a member that left, so that redeployed members do not grow the group
+    auto inactiveMember = std::find_if(members.begin(), members.end(), [](const Member& member) {
+        return !member.active;
+    });
+    auto memberId = static_cast<uint64_t>(inactiveMember - members.begin());
+    if (inactiveMember == members.end()) {
+        members.emplace_back(Member{observation.size(), numberOfValues});
+    } else {
+        *inactiveMember = Member{observation.size(), numberOfValues};
+    }
+    observation.resize(observation.size() + numberOfValues, 0.0);
+    if (this->gatheringInterval.count() == 0 || gatheringInterval < this->gatheringInterval) {
+        this->gatheringInterval = gatheringInterval;
+    }
+    // the dimension changed, the filter is rebuilt on the next update
+    filter.reset();
+    x_DEBUG("FusedGatheringGroup {}: member {} joined with {} value(s)", name, memberId, numberOfValues);
+    return memberId;
+}
+
+void FusedGatheringGroup::leave(uint64_t memberId) {
+    std::unique_lock lock(mutex);
+    x_ASSERT(memberId < members.size() && members[memberId].active, "FusedGatheringGroup: invalid member " << memberId);
+    // remove the values of the member, so that they are no longer fused, and close the gap in the observation vector
+    auto& leavingMember = members[memberId];
+    auto valuesBegin = observation.begin() + static_cast<int64_t>(leavingMember.offset);
+    observation.erase(valuesBegin, valuesBegin + static_cast<int64_t>(leavingMember.numberOfValues));
+    for (auto& member : members) {
+        if (member.active && member.offset > leavingMember.offset) {
+            member.offset -= leavingMember.numberOfValues;
+        }
+    }
+    leavingMember = Member{0, 0, std::chrono::milliseconds{0}, false, false};
+    // the dimension changed, the filter is rebuilt on the next update
+    filter.reset();
+    x_DEBUG("FusedGatheringGroup {}: member {} left", name, memberId);
+    updateIfComplete();
+}
+
+std::chrono::milliseconds FusedGatheringGroup::submit(uint64_t memberId, const double* values) {
+    std::unique_lock lock(mutex);
+    x_ASSERT(memberId < members.size() && members[memberId].active, "FusedGatheringGroup: invalid member " << memberId);
+    auto& member = members[memberId];
+    std::memcpy(observation.data() + member.offset, values, member.numberOfValues * sizeof(double));
+    member.submitted = true;
+    updateIfComplete();
+    return gatheringInterval;
+}
+
+void FusedGatheringGroup::setSlowestInterval(uint64_t memberId, std::chrono::milliseconds slowestInterval) {
+    std::unique_lock lock(mutex);
+    x_ASSERT(memberId < members.size(), "FusedGatheringGroup: invalid member " << memberId);
+    members[memberId].slowestInterval = slowestInterval;
+}
+
+void FusedGatheringGroup::updateIfComplete() {
+    bool anyActive = false;
+    for (const auto& member : members) {
+        if (member.active && !member.submitted) {
+            return;
+        }
+        anyActive |= member.active;
+    }
+    if (!anyActive) {
+        return;
+    }
+
+    if (!filter) {
+        filter = KalmanFilter::createRandomWalk(observation.size());
+        filter->setGatheringInterval(gatheringInterval);
+        filter->setGatheringIntervalRange(std::chrono::milliseconds{8000});
+    }
+    std::chrono::milliseconds slowestInterval{0};
+    for (auto& member : members) {
+        if (member.active && member.slowestInterval.count() > 0
+            && (slowestInterval.count() == 0 || member.slowestInterval < slowestInterval)) {
+            slowestInterval = member.slowestInterval;
+        }
+        member.submitted = false;
+    }
+    if (slowestInterval.count() > 0) {
+        filter->setSlowestInterval(slowestInterval);
+    }
+    filter->updateFromValues(observation.data(), 1);
+    gatheringInterval = filter->getNewGatheringInterval();
+    ++numberOfUpdates;
+    x_TRACE("FusedGatheringGroup {}: update {} decided interval {}ms", name, numberOfUpdates, gatheringInterval.count());
+}
+
+std::chrono::milliseconds FusedGatheringGroup::getGatheringInterval() const {
+    std::unique_lock lock(mutex);
+    return gatheringInterval;
+}
+
+uint64_t FusedGatheringGroup::getNumberOfUpdates() const {
+    std::unique_lock lock(mutex);
+    return numberOfUpdates;
+}
+
+uint64_t FusedGatheringGroup::getNumberOfMembers() const {
+    std::unique_lock lock(mutex);
+    return std::count_if(members.begin(), members.end(), [](const Member& member) {
+        return member.active;
+    });
+}
+
+uint64_t FusedGatheringGroup::getMeasurementSize() const {
+    std::unique_lock lock(mutex);
+    return observation.size();
+}
+
+std::vector<double> FusedGatheringGroup::getEstimate(uint64_t memberId) const {
+    std::unique_lock lock(mutex);
+    x_ASSERT(memberId < members.size() && members[memberId].active, "FusedGatheringGroup: invalid member " << memberId);
+    const auto& member = members[memberId];
+    std::vector<double> estimate(member.numberOfValues, 0.0);
+    if (filter) {
+        auto state = filter->getState();
+        for (uint64_t i = 0; i < member.numberOfValues; ++i) {
+            estimate[i] = state(static_cast<int64_t>(member.offset + i));
+        }
+    }
+    return estimate;
+}
+
+const std::string& FusedGatheringGroup::getName() const { return name; }
+
+}// namespace x::Runtime
@@ -0,0 +1,45 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Runtime/GatheringIntervalCollector.hpp>
+#include <Util/Logger/Logger.hpp>
+
+namespace x::Runtime {
+
+GatheringIntervalCollector::GatheringIntervalCollector(uint64_t capacity) : capacity(capacity) {
+    x_ASSERT(capacity > 0, "GatheringIntervalCollector: capacity must be greater than zero");
+}
+
+void GatheringIntervalCollector::record(GatheringIntervalSample sample) {
+    std::unique_lock lock(mutex);
+    if (samples.size() == capacity) {
+        samples.pop_front();
+        ++numberOfDroppedSamples;
+    }
+    samples.emplace_back(std::move(sample));
+}
+
+std::vector<GatheringIntervalSample> GatheringIntervalCollector::drain() {
+    std::unique_lock lock(mutex);
+    std::vector<GatheringIntervalSample> result(std::make_move_iterator(samples.begin()), std::make_move_iterator(samples.end()));
+    samples.clear();
+    return result;
+}
+
+uint64_t GatheringIntervalCollector::getNumberOfDroppedSamples() const {
+    std::unique_lock lock(mutex);
+    return numberOfDroppedSamples;
+}
+
+}// namespace x::Runtime
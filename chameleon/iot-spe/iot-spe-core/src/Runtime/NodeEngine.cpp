@@ -33,6 +33,8 @@
 #include <Runtime/MaterializedViewManager.hpp>
 #include <Runtime/NodeEngine.hpp>
 #include <Runtime/QueryManager.hpp>
+#include <Sources/DataSource.hpp>
+#include <Util/GatheringPolicy.hpp>
 #include <Util/Logger/Logger.hpp>
 #include <string>
 #include <utility>
@@ -389,6 +391,24 @@ void NodeEngine::injectEpochBarrier(uint64_t timestamp, uint64_t queryId) const
     }
 }
 
+uint64_t NodeEngine::setGatheringPolicy(const std::string& physicalSourceName, const GatheringPolicy& policy) const {
+    std::unique_lock lock(engineMutex);
+    uint64_t numberOfUpdatedSources = 0;
+    for (const auto& [querySubPlanId, qep] : deployedQEPs) {
+        for (const auto& source : qep->getSources()) {
+            if (source->getPhysicalSourceName() == physicalSourceName) {
+                x_DEBUG("NodeEngine: set {} on source {} of subQueryPlanId {}",
+                        policy.toString(),
+                        source->getOperatorId(),
+                        querySubPlanId);
+                source->setGatheringPolicy(policy);
+                ++numberOfUpdatedSources;
+            }
+        }
+    }
+    return numberOfUpdatedSources;
+}
+
 StateManagerPtr NodeEngine::getStateManager() { return stateManager; }
 
 uint64_t NodeEngine::getNodeEngineId() { return nodeEngineId; }
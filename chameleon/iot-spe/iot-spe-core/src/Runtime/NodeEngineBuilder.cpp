@@ -29,6 +29,7 @@
 #include <Runtime/NodeEngineBuilder.hpp>
 #include <Runtime/OpenCLManager.hpp>
 #include <Runtime/QueryManager.hpp>
+#include <Runtime/SourceExecutor.hpp>
 #include <Util/Common.hpp>
 #include <Util/Core.hpp>
 #include <Util/Logger/Logger.hpp>
@@ -177,6 +178,10 @@ x::Runtime::NodeEnginePtr NodeEngineBuilder::build() {
                 }
             }
         }
+        if (auto numberOfSourceExecutorThreads = workerConfiguration->numberOfSourceExecutorThreads.getValue();
+            numberOfSourceExecutorThreads > 0 && queryManager) {
+            queryManager->setSourceExecutor(std::make_shared<SourceExecutor>(numberOfSourceExecutorThreads));
+        }
         auto materializedViewManager = (!this->materializedViewManager)
             ? std::make_shared<x::Experimental::MaterializedView::MaterializedViewManager>()
             : this->materializedViewManager;
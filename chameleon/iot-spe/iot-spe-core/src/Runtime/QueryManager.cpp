@@ -27,6 +27,9 @@
 #include <Runtime/FixedSizeBufferPool.hpp>
 #include <Runtime/HardwareManager.hpp>
 #include <Runtime/QueryManager.hpp>
+#include <Runtime/FusedGatheringGroup.hpp>
+#include <Runtime/GatheringIntervalCollector.hpp>
+#include <Runtime/SourceExecutor.hpp>
 #include <Runtime/ThreadPool.hpp>
 #include <Runtime/WorkerContext.hpp>
 #include <Sinks/Mediums/SinkMedium.hpp>
@@ -56,6 +59,7 @@ AbstractQueryManager::AbstractQueryManager(std::shared_ptr<AbstractQueryStatusLi
     tempCounterTasksCompleted.resize(numThreads);
 
     asyncTaskExecutor = std::make_shared<AsyncTaskExecutor>(this->hardwareManager, 1);
+    gatheringIntervalCollector = std::make_unique<GatheringIntervalCollector>();
 }
 
 DynamicQueryManager::DynamicQueryManager(std::shared_ptr<AbstractQueryStatusListener> queryStatusListener,
@@ -134,6 +138,44 @@ uint64_t AbstractQueryManager::getCurrentTaskSum() {
 
 uint64_t AbstractQueryManager::getNumberOfBuffersPerEpoch() const { return numberOfBuffersPerEpoch; }
 
+void AbstractQueryManager::setSourceExecutor(SourceExecutorPtr sourceExecutor) {
+    this->sourceExecutor = std::move(sourceExecutor);
+}
+
+SourceExecutorPtr AbstractQueryManager::getSourceExecutor() const { return sourceExecutor; }
+
+std::pair<FusedGatheringGroupPtr, uint64_t> AbstractQueryManager::joinFusedGatheringGroup(const std::string& name,
+                                                                                         uint64_t numberOfValues,
+                                                                                         std::chrono::milliseconds gatheringInterval) {
+    // joining holds the lock, so that a group is not dropped between its lookup and the join
+    std::unique_lock lock(fusedGatheringGroupsMutex);
+    auto& group = fusedGatheringGroups[name];
+    if (!group) {
+        group = std::make_shared<FusedGatheringGroup>(name);
+    }
+    auto memberId = group->join(numberOfValues, gatheringInterval);
+    return {group, memberId};
+}
+
+void AbstractQueryManager::leaveFusedGatheringGroup(const FusedGatheringGroupPtr& group, uint64_t memberId) {
+    std::unique_lock lock(fusedGatheringGroupsMutex);
+    group->leave(memberId);
+    if (group->getNumberOfMembers() == 0) {
+        auto entry = fusedGatheringGroups.find(group->getName());
+        if (entry != fusedGatheringGroups.end() && entry->second == group) {
+            fusedGatheringGroups.erase(entry);
+        }
+    }
+}
+
+FusedGatheringGroupPtr AbstractQueryManager::getFusedGatheringGroup(const std::string& name) {
+    std::unique_lock lock(fusedGatheringGroupsMutex);
+    auto entry = fusedGatheringGroups.find(name);
+    return entry == fusedGatheringGroups.end() ? nullptr : entry->second;
+}
+
+GatheringIntervalCollector& AbstractQueryManager::getGatheringIntervalCollector() { return *gatheringIntervalCollector; }
+
 AbstractQueryManager::~AbstractQueryManager() x_NOEXCEPT(false) { destroy(); }
 
 bool DynamicQueryManager::startThreadPool(uint64_t numberOfBuffersPerWorker) {
@@ -237,6 +279,10 @@ void AbstractQueryManager::destroy() {
             threadPool->stop();
             threadPool.reset();
         }
+        if (sourceExecutor) {
+            sourceExecutor->destroy();
+            sourceExecutor.reset();
+        }
         x_DEBUG("AbstractQueryManager::resetQueryManager finished");
     }
 }
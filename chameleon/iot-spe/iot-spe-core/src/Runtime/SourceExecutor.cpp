@@ -0,0 +1,294 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+#include <Runtime/SourceExecutor.hpp>
+#include <Sources/DataSource.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/ThreadNaming.hpp>
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <functional>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+namespace x::Runtime {
+
+namespace {
+/// epoll data of the event file descriptor, source ids start at 1
+constexpr uint64_t EVENT_FILE_DESCRIPTOR_ID = 0;
+constexpr int MAX_EPOLL_EVENTS = 64;
+}// namespace
+
+SourceExecutor::SourceExecutor(uint32_t numberOfThreads, std::chrono::milliseconds tickDuration, uint64_t numberOfSlots)
+    : tickDuration(tickDuration.count() > 0 ? tickDuration : std::chrono::milliseconds(1)), timerWheel(numberOfSlots) {
+    x_ASSERT(numberOfThreads > 0, "SourceExecutor needs at least one thread");
+    epollFileDescriptor = epoll_create1(EPOLL_CLOEXEC);
+    eventFileDescriptor = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (epollFileDescriptor < 0 || eventFileDescriptor < 0) {
+        x_THROW_RUNTIME_ERROR("SourceExecutor: cannot create epoll instance. Error: " << strerror(errno));
+    }
+    epoll_event event{};
+    event.events = EPOLLIN;
+    event.data.u64 = EVENT_FILE_DESCRIPTOR_ID;
+    if (epoll_ctl(epollFileDescriptor, EPOLL_CTL_ADD, eventFileDescriptor, &event) != 0) {
+        x_THROW_RUNTIME_ERROR("SourceExecutor: cannot register event file descriptor. Error: " << strerror(errno));
+    }
+
+    auto startThread = [this](std::function<void(void)>&& routine) {
+        auto promise = std::make_shared<std::promise<bool>>();
+        completionPromises.emplace_back(promise);
+        std::thread([routine = std::move(routine), promise]() {
+            try {
+                routine();
+                promise->set_value(true);
+            } catch (std::exception const& ex) {
+                x_ERROR("SourceExecutor: thread failed with {}", ex.what());
+                promise->set_exception(std::make_exception_ptr(ex));
+            }
+        }).detach();
+    };
+    startThread([this]() {
+        setThreadName("SrcExecLoop");
+        eventLoop();
+    });
+    for (uint32_t i = 0; i < numberOfThreads; ++i) {
+        startThread([this, i]() {
+            setThreadName("SrcExec-%d", i);
+            workerRoutine();
+        });
+    }
+    x_DEBUG("SourceExecutor: started with {} threads and a tick of {}ms", numberOfThreads, this->tickDuration.count());
+}
+
+SourceExecutor::~SourceExecutor() { destroy(); }
+
+bool SourceExecutor::destroy() {
+    bool expected = true;
+    if (!running.compare_exchange_strong(expected, false)) {
+        return false;
+    }
+    {
+        std::unique_lock lock(scheduleMutex);
+        readyCondition.notify_all();
+    }
+    notifyEventLoop();
+    bool result = true;
+    for (auto& promise : completionPromises) {
+        try {
+            result &= promise->get_future().get();
+        } catch (std::exception const& ex) {
+            result = false;
+        }
+    }
+    {
+        std::unique_lock lock(scheduleMutex);
+        if (!sources.empty()) {
+            x_WARNING("SourceExecutor: destroyed with {} sources that did not complete", sources.size());
+        }
+        sources.clear();
+        sourceToId.clear();
+        readyQueue.clear();
+    }
+    ::close(eventFileDescriptor);
+    ::close(epollFileDescriptor);
+    return result;
+}
+
+void SourceExecutor::registerSource(const DataSourcePtr& source) {
+    x_ASSERT(running, "SourceExecutor: cannot register a source after destroy");
+    std::unique_lock lock(scheduleMutex);
+    auto id = nextSourceId++;
+    auto scheduledSource = std::make_unique<ScheduledSource>();
+    scheduledSource->source = source;
+    scheduledSource->id = id;
+    scheduledSource->readinessFileDescriptor = -1;
+    auto& ref = *scheduledSource;
+    sources.emplace(id, std::move(scheduledSource));
+    sourceToId.emplace(source.get(), id);
+    makeReady(ref);
+}
+
+void SourceExecutor::wakeUp(const DataSource* source) {
+    std::unique_lock lock(scheduleMutex);
+    auto it = sourceToId.find(source);
+    if (it == sourceToId.end()) {
+        return;
+    }
+    auto& scheduledSource = *sources.at(it->second);
+    switch (scheduledSource.state) {
+        case SourceState::Ready: break;
+        case SourceState::Running: {
+            scheduledSource.wakeUpPending = true;
+            break;
+        }
+        case SourceState::WaitingForTimer: {
+            ++scheduledSource.timerGeneration;// the pending timer is outdated
+            makeReady(scheduledSource);
+            break;
+        }
+        case SourceState::WaitingForData: {
+            // a readiness event that arrives while the source is not waiting for data is dropped
+            makeReady(scheduledSource);
+            break;
+        }
+    }
+}
+
+uint64_t SourceExecutor::getNumberOfSources() const {
+    std::unique_lock lock(scheduleMutex);
+    return sources.size();
+}
+
+void SourceExecutor::makeReady(ScheduledSource& scheduledSource) {
+    scheduledSource.state = SourceState::Ready;
+    readyQueue.emplace_back(scheduledSource.id);
+    readyCondition.notify_one();
+}
+
+void SourceExecutor::notifyEventLoop() {
+    uint64_t one = 1;
+    if (write(eventFileDescriptor, &one, sizeof(one)) < 0 && errno != EAGAIN) {
+        x_ERROR("SourceExecutor: cannot notify event loop. Error: {}", strerror(errno));
+    }
+}
+
+void SourceExecutor::eventLoop() {
+    std::array<epoll_event, MAX_EPOLL_EVENTS> events{};
+    std::vector<TimerEntry> expiredTimers;
+    auto nextTick = std::chrono::steady_clock::now() + tickDuration;
+    while (running) {
+        int timeoutInMs = -1;// block until a source becomes readable or a timer is scheduled
+        {
+            std::unique_lock lock(scheduleMutex);
+            if (!timerWheel.empty()) {
+                auto now = std::chrono::steady_clock::now();
+                timeoutInMs = nextTick > now
+                    ? static_cast<int>(std::chrono::ceil<std::chrono::milliseconds>(nextTick - now).count())
+                    : 0;
+            }
+        }
+
+        auto numberOfEvents = epoll_wait(epollFileDescriptor, events.data(), MAX_EPOLL_EVENTS, timeoutInMs);
+        if (numberOfEvents < 0 && errno != EINTR) {
+            x_THROW_RUNTIME_ERROR("SourceExecutor: epoll_wait failed. Error: " << strerror(errno));
+        }
+
+        std::unique_lock lock(scheduleMutex);
+        for (int i = 0; i < numberOfEvents; ++i) {
+            auto id = events[i].data.u64;
+            if (id == EVENT_FILE_DESCRIPTOR_ID) {
+                uint64_t counter;
+                [[maybe_unused]] auto bytesRead = read(eventFileDescriptor, &counter, sizeof(counter));
+                continue;
+            }
+            if (auto it = sources.find(id); it != sources.end() && it->second->state == SourceState::WaitingForData) {
+                makeReady(*it->second);
+            }
+        }
+
+        auto now = std::chrono::steady_clock::now();
+        if (timeoutInMs < 0) {
+            // the wheel was idle, so there are no ticks to catch up on
+            nextTick = now + tickDuration;
+            continue;
+        }
+        while (nextTick <= now) {
+            timerWheel.advance(expiredTimers);
+            nextTick += tickDuration;
+        }
+        for (auto& timer : expiredTimers) {
+            auto it = sources.find(timer.id);
+            if (it != sources.end() && it->second->state == SourceState::WaitingForTimer
+                && it->second->timerGeneration == timer.generation) {
+                makeReady(*it->second);
+            }
+        }
+        expiredTimers.clear();
+    }
+    x_DEBUG("SourceExecutor: event loop terminated");
+}
+
+void SourceExecutor::workerRoutine() {
+    while (true) {
+        ScheduledSource* scheduledSource;
+        {
+            std::unique_lock lock(scheduleMutex);
+            readyCondition.wait(lock, [this]() {
+                return !running || !readyQueue.empty();
+            });
+            if (!running) {
+                break;
+            }
+            auto it = sources.find(readyQueue.front());
+            readyQueue.pop_front();
+            if (it == sources.end()) {
+                continue;
+            }
+            scheduledSource = it->second.get();
+            scheduledSource->state = SourceState::Running;
+            scheduledSource->wakeUpPending = false;
+        }
+
+        // only this thread touches the source until it is scheduled again
+        auto& source = scheduledSource->source;
+        auto delay = source->runningRoutineIteration();
+        auto fileDescriptor = delay.has_value() ? source->getReadinessFileDescriptor() : -1;
+
+        std::unique_lock lock(scheduleMutex);
+        if (scheduledSource->readinessFileDescriptor >= 0 && scheduledSource->readinessFileDescriptor != fileDescriptor) {
+            // fails with EBADF if the source already closed its descriptor, which also removes it from the epoll set
+            epoll_ctl(epollFileDescriptor, EPOLL_CTL_DEL, scheduledSource->readinessFileDescriptor, nullptr);
+            scheduledSource->readinessFileDescriptor = -1;
+        }
+
+        if (!delay.has_value()) {
+            x_DEBUG("SourceExecutor: source {} completed", source->getOperatorId());
+            sourceToId.erase(source.get());
+            sources.erase(scheduledSource->id);
+            continue;
+        }
+
+        if (scheduledSource->wakeUpPending || (fileDescriptor < 0 && delay->count() == 0)) {
+            makeReady(*scheduledSource);
+        } else if (fileDescriptor >= 0) {
+            epoll_event event{};
+            event.events = EPOLLIN | EPOLLONESHOT;
+            event.data.u64 = scheduledSource->id;
+            auto operation = scheduledSource->readinessFileDescriptor == fileDescriptor ? EPOLL_CTL_MOD : EPOLL_CTL_ADD;
+            if (epoll_ctl(epollFileDescriptor, operation, fileDescriptor, &event) == 0) {
+                scheduledSource->readinessFileDescriptor = fileDescriptor;
+                scheduledSource->state = SourceState::WaitingForData;
+            } else {
+                x_WARNING("SourceExecutor: cannot wait for readiness of source {}, fall back to its gathering interval. Error: {}",
+                          source->getOperatorId(),
+                          strerror(errno));
+                fileDescriptor = -1;
+            }
+        }
+
+        if (fileDescriptor < 0 && scheduledSource->state == SourceState::Running) {
+            auto delayInTicks = (delay->count() + tickDuration.count() - 1) / tickDuration.count();
+            auto wasIdle = timerWheel.empty();
+            scheduledSource->state = SourceState::WaitingForTimer;
+            timerWheel.schedule(TimerEntry{scheduledSource->id, ++scheduledSource->timerGeneration}, delayInTicks);
+            if (wasIdle) {
+                notifyEventLoop();
+            }
+        }
+    }
+    x_DEBUG("SourceExecutor: worker terminated");
+}
+
+}// namespace x::Runtime
@@ -15,6 +15,7 @@
 #include <Sensors/GenericBus.hpp>
 #include <Util/Logger/Logger.hpp>
 #include <Util/magicenum/magic_enum.hpp>
+#include <thread>
 
 namespace x::Sensors {
 
@@ -28,7 +29,30 @@ bool GenericBus::init(int address) { return this->initBus(address); }
 
 bool GenericBus::write(int addr, int size, unsigned char* buffer) { return this->writeData(addr, size, buffer); }
 
-bool GenericBus::read(int addr, int size, unsigned char* buffer) { return this->readData(addr, size, buffer); }
+bool GenericBus::read(int addr, int size, unsigned char* buffer) {
+    ++numberOfReads;
+    return this->readData(addr, size, buffer);
+}
+
+bool GenericBus::poll(int addr, int size, unsigned char* buffer) {
+    this->waitForNextPoll();
+    return this->read(addr, size, buffer);
+}
+
+void GenericBus::waitForNextPoll() {
+    if (lastPoll != std::chrono::steady_clock::time_point{}) {
+        std::this_thread::sleep_until(lastPoll + getPollingInterval());
+    }
+    lastPoll = std::chrono::steady_clock::now();
+}
+
+void GenericBus::setPollingInterval(std::chrono::milliseconds pollingInterval) {
+    this->pollingIntervalInMs = pollingInterval.count();
+}
+
+std::chrono::milliseconds GenericBus::getPollingInterval() const { return std::chrono::milliseconds(pollingIntervalInMs.load()); }
+
+uint64_t GenericBus::getNumberOfReads() const { return numberOfReads; }
 
 BusType GenericBus::getType() { return this->busType; }
 
@@ -0,0 +1,87 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Sensors/SimulatedBus.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+namespace x::Sensors {
+
+SimulatedBus::SimulatedBus(const char* filename, uint64_t sampleSize, std::chrono::milliseconds sampleInterval)
+    : GenericBus(filename, BusType::SIMULATED), sampleSize(sampleSize),
+      sampleInterval(std::max(sampleInterval, std::chrono::milliseconds(1))) {
+    x_ASSERT(sampleSize > 0, "SimulatedBus: samples must not be empty");
+    x_INFO("SimulatedBus: Creating bus");
+}
+
+SimulatedBus::~SimulatedBus() { x_DEBUG("SimulatedBus: Destroying bus"); }
+
+bool SimulatedBus::initBus(int) {
+    std::ifstream input(this->fileName, std::ios::binary);
+    if (!input.is_open()) {
+        x_ERROR("SimulatedBus: cannot open recording {}", this->fileName);
+        return false;
+    }
+    samples.assign(std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>());
+    if (samples.size() % sampleSize != 0) {
+        x_WARNING("SimulatedBus: recording {} ends with an incomplete sample, which is ignored", this->fileName);
+        samples.resize(samples.size() - samples.size() % sampleSize);
+    }
+    currentSample = 0;
+    simulatedTime = std::chrono::milliseconds(0);
+    polled = false;
+    x_DEBUG("SimulatedBus: loaded {} samples from {}", getNumberOfSamples(), this->fileName);
+    return getNumberOfSamples() > 0;
+}
+
+bool SimulatedBus::writeData(int address, int size, unsigned char* buffer) {
+    if (!isValidRange(address, size)) {
+        return false;
+    }
+    std::memcpy(samples.data() + currentSample * sampleSize + address, buffer, size);
+    return true;
+}
+
+bool SimulatedBus::readData(int address, int size, unsigned char* buffer) {
+    if (!isValidRange(address, size)) {
+        return false;
+    }
+    std::memcpy(buffer, samples.data() + currentSample * sampleSize + address, size);
+    return true;
+}
+
+void SimulatedBus::waitForNextPoll() {
+    if (polled) {
+        // the sensor kept sampling while the bus was not polled, the clock keeps the remainder of intervals that are
+        // not a multiple of the sample interval. Without a polling interval, the bus is polled on every sample.
+        auto pollingInterval = getPollingInterval();
+        simulatedTime += pollingInterval.count() > 0 ? pollingInterval : sampleInterval;
+        currentSample = simulatedTime / sampleInterval;
+    }
+    polled = true;
+}
+
+bool SimulatedBus::isValidRange(int address, int size) const {
+    return currentSample < getNumberOfSamples() && address >= 0 && size >= 0
+        && static_cast<uint64_t>(address) + static_cast<uint64_t>(size) <= sampleSize;
+}
+
+uint64_t SimulatedBus::getNumberOfSamples() const { return samples.size() / sampleSize; }
+
+std::chrono::milliseconds SimulatedBus::getSimulatedTime() const { return simulatedTime; }
+
+}// namespace x::Sensors
@@ -0,0 +1,118 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Catalogs/Source/PhysicalSource.hpp>
+#include <Catalogs/Source/SourceCatalog.hpp>
+#include <Catalogs/Source/SourceCatalogEntry.hpp>
+#include <GRPC/WorkerRPCClient.hpp>
+#include <Services/GatheringPolicyService.hpp>
+#include <Topology/TopologyNode.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <algorithm>
+#include <utility>
+
+namespace x {
+
+GatheringPolicyService::GatheringPolicyService(Catalogs::Source::SourceCatalogPtr sourceCatalog,
+                                               uint64_t numberOfSamplesPerSource)
+    : sourceCatalog(std::move(sourceCatalog)), workerRpcClient(WorkerRPCClient::create()),
+      numberOfSamplesPerSource(numberOfSamplesPerSource) {
+    x_ASSERT(this->sourceCatalog, "GatheringPolicyService: sourceCatalog has to be valid");
+    x_ASSERT(numberOfSamplesPerSource > 0, "GatheringPolicyService: numberOfSamplesPerSource must be greater than zero");
+}
+
+uint64_t GatheringPolicyService::setGatheringPolicy(const std::string& logicalSourceName, const GatheringPolicy& policy) {
+    auto numberOfUpdatedSources = sendGatheringPolicy(logicalSourceName, {}, policy);
+    std::unique_lock lock(policyMutex);
+    logicalSourceToPolicy[logicalSourceName].merge(policy);
+    return numberOfUpdatedSources;
+}
+
+uint64_t GatheringPolicyService::setGatheringPolicy(const std::string& logicalSourceName,
+                                                    const std::vector<std::string>& physicalSourceNames,
+                                                    const GatheringPolicy& policy) {
+    if (physicalSourceNames.empty()) {
+        return 0;
+    }
+    return sendGatheringPolicy(logicalSourceName, physicalSourceNames, policy);
+}
+
+std::optional<GatheringPolicy> GatheringPolicyService::getGatheringPolicy(const std::string& logicalSourceName) const {
+    std::unique_lock lock(policyMutex);
+    if (auto it = logicalSourceToPolicy.find(logicalSourceName); it != logicalSourceToPolicy.end()) {
+        return it->second;
+    }
+    return std::nullopt;
+}
+
+uint64_t GatheringPolicyService::sendGatheringPolicy(const std::string& logicalSourceName,
+                                                     const std::vector<std::string>& filter,
+                                                     const GatheringPolicy& policy) {
+    x_DEBUG("GatheringPolicyService: set {} for logical source {}", policy.toString(), logicalSourceName);
+    // one request per worker, carrying the policies of all its physical sources
+    std::map<std::string, std::vector<std::pair<std::string, GatheringPolicy>>> workerToPolicies;
+    for (const auto& entry : sourceCatalog->getPhysicalSources(logicalSourceName)) {
+        const auto& physicalSourceName = entry->getPhysicalSource()->getPhysicalSourceName();
+        if (!filter.empty() && std::find(filter.begin(), filter.end(), physicalSourceName) == filter.end()) {
+            continue;
+        }
+        const auto& node = entry->getNode();
+        auto rpcAddress = node->getIpAddress() + ":" + std::to_string(node->getGrpcPort());
+        workerToPolicies[rpcAddress].emplace_back(physicalSourceName, policy);
+    }
+
+    uint64_t numberOfUpdatedSources = 0;
+    for (const auto& [rpcAddress, policies] : workerToPolicies) {
+        if (auto result = workerRpcClient->setGatheringPolicy(rpcAddress, policies)) {
+            numberOfUpdatedSources += result.value();
+        } else {
+            x_ERROR("GatheringPolicyService: could not send the gathering policy of {} to worker {}", logicalSourceName, rpcAddress);
+        }
+    }
+    return numberOfUpdatedSources;
+}
+
+void GatheringPolicyService::addGatheringIntervalSamples(uint64_t workerId, std::vector<Runtime::GatheringIntervalSample> samples) {
+    x_TRACE("GatheringPolicyService: worker {} reported {} gathering intervals", workerId, samples.size());
+    std::unique_lock lock(sampleMutex);
+    for (auto& sample : samples) {
+        auto& history = physicalSourceToSamples[sample.physicalSourceName];
+        if (history.size() == numberOfSamplesPerSource) {
+            history.pop_front();
+        }
+        history.emplace_back(std::move(sample));
+    }
+}
+
+std::vector<Runtime::GatheringIntervalSample>
+GatheringPolicyService::getGatheringIntervalSamples(const std::string& physicalSourceName) const {
+    std::unique_lock lock(sampleMutex);
+    if (auto it = physicalSourceToSamples.find(physicalSourceName); it != physicalSourceToSamples.end()) {
+        return {it->second.begin(), it->second.end()};
+    }
+    return {};
+}
+
+std::map<std::string, Runtime::GatheringIntervalSample> GatheringPolicyService::getLatestGatheringIntervals() const {
+    std::unique_lock lock(sampleMutex);
+    std::map<std::string, Runtime::GatheringIntervalSample> result;
+    for (const auto& [physicalSourceName, history] : physicalSourceToSamples) {
+        if (!history.empty()) {
+            result.emplace(physicalSourceName, history.back());
+        }
+    }
+    return result;
+}
+
+}// namespace x
@@ -15,13 +15,14 @@
 #ifdef ENABLE_ARROW_BUILD
 #include <API/Schema.hpp>
 #include <Runtime/BufferManager.hpp>
-#include <Runtime/MemoryLayout/DynamicTupleBuffer.hpp>
+#include <Runtime/MemoryLayout/ColumnLayout.hpp>
 #include <Runtime/MemoryLayout/RowLayout.hpp>
 #include <Runtime/TupleBuffer.hpp>
 #include <Sinks/Formats/ArrowFormat.hpp>
 #include <Util/Core.hpp>
 #include <Util/Logger/Logger.hpp>
 
+#include <cstring>
 #include <iostream>
 #include <utility>
 
@@ -46,328 +47,151 @@ FormatTypes ArrowFormat::getSinkFormat() { return FormatTypes::ARROW_IPC_FORMAT;
 
 FormatIterator ArrowFormat::getTupleIterator(Runtime::TupleBuffer&) { x_NOT_IMPLEMENTED(); }
 
-std::vector<std::shared_ptr<arrow::Array>> ArrowFormat::getArrowArrays(Runtime::TupleBuffer& inputBuffer) {
-    std::vector<std::shared_ptr<arrow::Array>> arrowArrays;
-    uint64_t numberOfFields = schema->fields.size();
-    auto numberOfTuples = inputBuffer.getNumberOfTuples();
-
-    // TODO #4082: add support for column layout
-    auto layout = Runtime::MemoryLayouts::RowLayout::create(schema, inputBuffer.getBufferSize());
-    auto dynamicTupleBuffer = Runtime::MemoryLayouts::DynamicTupleBuffer(layout, inputBuffer);
-
-    // iterate over all fields in the schema to create respective arrow builders
-    for (uint64_t columnIndex = 0; columnIndex < numberOfFields; ++columnIndex) {
-        auto fieldName = schema->fields[columnIndex]->toString();
-        auto attributeField = schema->get(columnIndex);
-        auto dataType = attributeField->getDataType();
-        auto physicalType = DefaultPhysicalTypeFactory().getPhysicalType(dataType);
-        auto fieldSize = physicalType->size();
-        uint64_t offset = 0;
-        try {
-            if (physicalType->isBasicType()) {
-                auto basicPhysicalType = std::dynamic_pointer_cast<BasicPhysicalType>(physicalType);
-                switch (basicPhysicalType->nativeType) {
-                    case x::BasicPhysicalType::NativeType::INT_8: {
-                        // create an int8 builder
-                        arrow::Int8Builder int8Builder;
-
-                        // iterate over all values in the column and add values to the builder
-                        for (uint64_t rowIndex = 0; rowIndex < numberOfTuples; ++rowIndex) {
-                            int8_t value = dynamicTupleBuffer[rowIndex][columnIndex].read<int8_t>();
-                            auto append = int8Builder.Append(value);
-                        }
-
-                        // build the int8Array
-                        auto buildArray = int8Builder.Finish();
-                        if (!buildArray.ok()) {
-                            x_FATAL_ERROR("ArrowFormat::getArrowArrays: could not convert INT_8 field to arrow array.");
-                        }
-
-                        // add the int8Array to the arrowArrays
-                        std::shared_ptr<arrow::Array> int8Array = *buildArray;
-                        arrowArrays.push_back(int8Array);
-                        break;
-                    }
-                    case x::BasicPhysicalType::NativeType::INT_16: {
-                        // create an int16 builder
-                        arrow::Int16Builder int16Builder;
-
-                        // iterate over all values in the column and add values to the builder
-                        for (uint64_t rowIndex = 0; rowIndex < numberOfTuples; ++rowIndex) {
-                            int16_t value = dynamicTupleBuffer[rowIndex][columnIndex].read<int16_t>();
-                            auto append = int16Builder.Append(value);
-                        }
-
-                        // build the int16Array
-                        auto buildArray = int16Builder.Finish();
-                        if (!buildArray.ok()) {
-                            x_FATAL_ERROR("ArrowFormat::getArrowArrays: could not convert INT_16 field to arrow array.");
-                        }
-
-                        // add the int16Array to the arrowArrays
-                        std::shared_ptr<arrow::Array> int16Array = *buildArray;
-                        arrowArrays.push_back(int16Array);
-                        break;
-                    }
-                    case x::BasicPhysicalType::NativeType::INT_32: {
-                        // create an int32 builder
-                        arrow::Int32Builder int32Builder;
-
-                        // iterate over all values in the column and add values to the builder
-                        for (uint64_t rowIndex = 0; rowIndex < numberOfTuples; ++rowIndex) {
-                            int32_t value = dynamicTupleBuffer[rowIndex][columnIndex].read<int32_t>();
-                            auto append = int32Builder.Append(value);
-                        }
-
-                        // build the int32Array
-                        auto buildArray = int32Builder.Finish();
-                        if (!buildArray.ok()) {
-                            x_FATAL_ERROR("ArrowFormat::getArrowArrays: could not convert INT_32 field to arrow array.");
-                        }
-
-                        // add the int32Array to the arrowArrays
-                        std::shared_ptr<arrow::Array> int32Array = *buildArray;
-                        arrowArrays.push_back(int32Array);
-                        break;
-                    }
-                    case x::BasicPhysicalType::NativeType::INT_64: {
-                        // create an int64 builder
-                        arrow::Int64Builder int64Builder;
-
-                        // iterate over all values in the column and add values to the builder
-                        for (uint64_t rowIndex = 0; rowIndex < numberOfTuples; ++rowIndex) {
-                            int64_t value = dynamicTupleBuffer[rowIndex][columnIndex].read<int64_t>();
-                            auto append = int64Builder.Append(value);
-                        }
-
-                        // build the int64Array
-                        auto buildArray = int64Builder.Finish();
-                        if (!buildArray.ok()) {
-                            x_FATAL_ERROR("ArrowFormat::getArrowArrays: could not convert INT_64 field to arrow array.");
-                        }
-
-                        // add the int64Array to the arrowArrays
-                        std::shared_ptr<arrow::Array> int64Array = *buildArray;
-                        arrowArrays.push_back(int64Array);
-                        break;
-                    }
-                    case x::BasicPhysicalType::NativeType::UINT_8: {
-                        // create an uint8 builder
-                        arrow::UInt8Builder uint8Builder;
-
-                        // iterate over all values in the column and add values to the builder
-                        for (uint64_t rowIndex = 0; rowIndex < numberOfTuples; ++rowIndex) {
-                            uint8_t value = dynamicTupleBuffer[rowIndex][columnIndex].read<uint8_t>();
-                            auto append = uint8Builder.Append(value);
-                        }
-
-                        // build the uint8Array
-                        auto buildArray = uint8Builder.Finish();
-                        if (!buildArray.ok()) {
-                            x_FATAL_ERROR("ArrowFormat::getArrowArrays: could not convert UINT_8 field to arrow array.");
-                        }
-
-                        // add the uint8Array to the arrowArrays
-                        std::shared_ptr<arrow::Array> uint8Array = *buildArray;
-                        arrowArrays.push_back(uint8Array);
-                        break;
-                    }
-                    case x::BasicPhysicalType::NativeType::UINT_16: {
-                        // create an uint16 builder
-                        arrow::UInt16Builder uint16Builder;
-
-                        // iterate over all values in the column and add values to the builder
-                        for (uint64_t rowIndex = 0; rowIndex < numberOfTuples; ++rowIndex) {
-                            uint16_t value = dynamicTupleBuffer[rowIndex][columnIndex].read<uint16_t>();
-                            auto append = uint16Builder.Append(value);
-                        }
-
-                        // build the uint16Array
-                        auto buildArray = uint16Builder.Finish();
-                        if (!buildArray.ok()) {
-                            x_FATAL_ERROR("ArrowFormat::getArrowArrays: could not convert UINT_16 field to arrow array.");
-                        }
-
-                        // add the uint16Array to the arrowArrays
-                        std::shared_ptr<arrow::Array> uint16Array = *buildArray;
-                        arrowArrays.push_back(uint16Array);
-                        break;
-                    }
-                    case x::BasicPhysicalType::NativeType::UINT_32: {
-                        // create an uint32 builder
-                        arrow::UInt32Builder uint32Builder;
-
-                        // iterate over all values in the column and add values to the builder
-                        for (uint64_t rowIndex = 0; rowIndex < numberOfTuples; ++rowIndex) {
-                            uint32_t value = dynamicTupleBuffer[rowIndex][columnIndex].read<uint32_t>();
-                            auto append = uint32Builder.Append(value);
-                        }
-
-                        // build the uint32Array
-                        auto buildArray = uint32Builder.Finish();
-                        if (!buildArray.ok()) {
-                            x_FATAL_ERROR("ArrowFormat::getArrowArrays: could not convert UINT_32 field to arrow array.");
-                        }
-
-                        // add the uint32Array to the arrowArrays
-                        std::shared_ptr<arrow::Array> uint32Array = *buildArray;
-                        arrowArrays.push_back(uint32Array);
-                        break;
-                    }
-                    case x::BasicPhysicalType::NativeType::UINT_64: {
-                        // create an uint64 builder
-                        arrow::UInt64Builder uint64Builder;
-
-                        // iterate over all values in the column and add values to the builder
-                        for (uint64_t rowIndex = 0; rowIndex < numberOfTuples; ++rowIndex) {
-                            uint64_t value = dynamicTupleBuffer[rowIndex][columnIndex].read<uint64_t>();
-                            auto append = uint64Builder.Append(value);
-                        }
-
-                        // build the uint64Array
-                        auto buildArray = uint64Builder.Finish();
-                        if (!buildArray.ok()) {
-                            x_FATAL_ERROR("ArrowFormat::getArrowArrays: could not convert UINT_64 field to arrow array.");
-                        }
-
-                        // add the uint64Array to the arrowArrays
-                        std::shared_ptr<arrow::Array> uint64Array = *buildArray;
-                        arrowArrays.push_back(uint64Array);
-                        break;
-                    }
-                    case x::BasicPhysicalType::NativeType::FLOAT: {
-                        // create a float builder
-                        arrow::FloatBuilder floatBuilder;
-
-                        // iterate over all values in the column and add values to the builder
-                        for (uint64_t rowIndex = 0; rowIndex < numberOfTuples; ++rowIndex) {
-                            float value = dynamicTupleBuffer[rowIndex][columnIndex].read<float>();
-                            auto append = floatBuilder.Append(value);
-                        }
-
-                        // build the floatArray
-                        auto buildArray = floatBuilder.Finish();
-                        if (!buildArray.ok()) {
-                            x_FATAL_ERROR("ArrowFormat::getArrowArrays: could not convert FLOAT field to arrow array.");
-                        }
-
-                        // add the floatArray to the arrowArrays
-                        std::shared_ptr<arrow::Array> floatArray = *buildArray;
-                        arrowArrays.push_back(floatArray);
-                        break;
-                    }
-                    case x::BasicPhysicalType::NativeType::DOUBLE: {
-                        // create a double builder
-                        arrow::DoubleBuilder doubleBuilder;
-
-                        // iterate over all values in the column and add values to the builder
-                        for (uint64_t rowIndex = 0; rowIndex < numberOfTuples; ++rowIndex) {
-                            double value = dynamicTupleBuffer[rowIndex][columnIndex].read<double>();
-                            auto append = doubleBuilder.Append(value);
-                        }
-
-                        // build the doubleArray
-                        auto buildArray = doubleBuilder.Finish();
-                        if (!buildArray.ok()) {
-                            x_FATAL_ERROR("ArrowFormat::getArrowArrays: could not convert DOUBLE field to arrow array.");
-                        }
-
-                        // add the doubleArray to the arrowArrays
-                        std::shared_ptr<arrow::Array> doubleArray = *buildArray;
-                        arrowArrays.push_back(doubleArray);
-                        break;
-                    }
-                    case x::BasicPhysicalType::NativeType::TEXT: {
-                        arrow::StringBuilder stringBuilder;
-
-                        // iterate over all values in the column and add values to the builder
-                        for (uint64_t rowIndex = 0; rowIndex < numberOfTuples; ++rowIndex) {
-                            std::string str;
-                            auto* buffer = inputBuffer.getBuffer<char>();
-                            auto indexInBuffer = buffer + offset + rowIndex * schema->getSchemaSizeInBytes();
-
-                            // read the child buffer index from the tuple buffer
-                            Runtime::TupleBuffer::xtedTupleBufferKey childIdx =
-                                *reinterpret_cast<uint32_t const*>(indexInBuffer);
-
-                            // retrieve the child buffer from the tuple buffer
-                            auto childTupleBuffer = inputBuffer.loadChildBuffer(childIdx);
-
-                            // retrieve the size of the variable-length field from the child buffer
-                            uint32_t sizeOfTextField = *(childTupleBuffer.getBuffer<uint32_t>());
-
-                            // build the string
-                            if (sizeOfTextField > 0) {
-                                auto begin = childTupleBuffer.getBuffer() + sizeof(uint32_t);
-                                std::string deserialized(begin, begin + sizeOfTextField);
-                                str = std::move(deserialized);
-                            }
+namespace {
+/**
+ * @brief appends numberOfTuples fixed-width values that are stride bytes apart to a numeric arrow builder,
+ * consecutive values, i.e., a column of the column layout, are copied at once
+ */
+template<typename ArrowType>
+arrow::Status
+appendFixedWidthValues(arrow::ArrayBuilder& arrayBuilder, const uint8_t* firstValue, uint64_t stride, uint64_t numberOfTuples) {
+    using ValueType = typename ArrowType::c_type;
+    auto& builder = static_cast<arrow::NumericBuilder<ArrowType>&>(arrayBuilder);
+    if (stride == sizeof(ValueType)) {
+        return builder.AppendValues(reinterpret_cast<const ValueType*>(firstValue), numberOfTuples);
+    }
+    ARROW_RETURN_NOT_OK(builder.Reserve(numberOfTuples));
+    for (uint64_t rowIndex = 0; rowIndex < numberOfTuples; ++rowIndex) {
+        ValueType value;
+        std::memcpy(&value, firstValue + rowIndex * stride, sizeof(ValueType));// fields in the row layout are not aligned
+        builder.UnsafeAppend(value);
+    }
+    return arrow::Status::OK();
+}
+}// namespace
 
-                            else {
-                                x_WARNING("ArrowFormat::getArrowArrays: Variable-length field could not be read."
-                                            "Invalid size in the variable-length TEXT field. Adding an empty string.")
-                            }
+std::vector<std::shared_ptr<arrow::Array>> ArrowFormat::getArrowArrays(Runtime::TupleBuffer& inputBuffer) {
+    x_ASSERT(numberOfPendingTuples == 0, "ArrowFormat::getArrowArrays: the tuples of a pending record batch would be mixed in");
+    appendToRecordBatch(inputBuffer);
+    return finishRecordBatch()->columns();
+}
 
-                            auto append = stringBuilder.Append(str);
-                        }
+void ArrowFormat::appendToRecordBatch(Runtime::TupleBuffer& inputBuffer) {
+    initializeArrayBuilders();
+    if (!memoryLayout || memoryLayout->getBufferSize() != inputBuffer.getBufferSize()) {
+        if (schema->getLayoutType() == Schema::MemoryLayoutType::ROW_LAYOUT) {
+            memoryLayout = Runtime::MemoryLayouts::RowLayout::create(schema, inputBuffer.getBufferSize());
+        } else {
+            memoryLayout = Runtime::MemoryLayouts::ColumnLayout::create(schema, inputBuffer.getBufferSize());
+        }
+    }
 
-                        // build the stringArray
-                        auto buildArray = stringBuilder.Finish();
-                        if (!buildArray.ok()) {
-                            x_FATAL_ERROR("ArrowFormat::getArrowArrays: could not convert TEXT field to arrow array.");
-                        }
+    auto numberOfTuples = inputBuffer.getNumberOfTuples();
+    for (uint64_t fieldIndex = 0; fieldIndex < arrayBuilders.size(); ++fieldIndex) {
+        auto status = appendColumn(inputBuffer, fieldIndex, numberOfTuples);
+        if (!status.ok()) {
+            x_THROW_RUNTIME_ERROR("ArrowFormat::appendToRecordBatch: could not convert field "
+                                    << schema->fields[fieldIndex]->getName() << " to an arrow array: " << status.ToString());
+        }
+    }
+    numberOfPendingTuples += numberOfTuples;
+}
 
-                        // add the stringArray to the arrowArrays
-                        std::shared_ptr<arrow::Array> stringArray = *buildArray;
-                        arrowArrays.push_back(stringArray);
-                        break;
-                    }
-                    case x::BasicPhysicalType::NativeType::BOOLEAN: {
-                        // create a boolean builder
-                        arrow::BooleanBuilder booleanBuilder;
+uint64_t ArrowFormat::getNumberOfPendingTuples() const { return numberOfPendingTuples; }
 
-                        // iterate over all values in the column and add values to the builder
-                        for (uint64_t rowIndex = 0; rowIndex < numberOfTuples; ++rowIndex) {
-                            bool value = dynamicTupleBuffer[rowIndex][columnIndex].read<bool>();
-                            auto append = booleanBuilder.Append(value);
-                        }
+std::shared_ptr<arrow::RecordBatch> ArrowFormat::finishRecordBatch() {
+    initializeArrayBuilders();
+    std::vector<std::shared_ptr<arrow::Array>> arrowArrays;
+    arrowArrays.reserve(arrayBuilders.size());
+    for (auto& builder : arrayBuilders) {
+        std::shared_ptr<arrow::Array> arrowArray;
+        auto status = builder->Finish(&arrowArray);
+        if (!status.ok()) {
+            x_THROW_RUNTIME_ERROR("ArrowFormat::finishRecordBatch: could not build arrow array: " << status.ToString());
+        }
+        arrowArrays.emplace_back(std::move(arrowArray));
+    }
+    auto recordBatch = arrow::RecordBatch::Make(getArrowSchema(), numberOfPendingTuples, std::move(arrowArrays));
+    numberOfPendingTuples = 0;
+    return recordBatch;
+}
 
-                        // build the booleanArray
-                        auto buildArray = booleanBuilder.Finish();
-                        if (!buildArray.ok()) {
-                            x_FATAL_ERROR("ArrowFormat::getArrowArrays: could not convert BOOLEAN field to arrow array.");
-                        }
+void ArrowFormat::initializeArrayBuilders() {
+    if (!arrayBuilders.empty()) {
+        return;
+    }
+    for (const auto& arrowField : getArrowSchema()->fields()) {
+        auto builder = arrow::MakeBuilder(arrowField->type());
+        if (!builder.ok()) {
+            x_THROW_RUNTIME_ERROR("ArrowFormat: could not create a builder for field " << arrowField->name() << ": "
+                                                                                         << builder.status().ToString());
+        }
+        arrayBuilders.emplace_back(std::move(builder).ValueOrDie());
+    }
+}
 
-                        // add the booleanArray to the arrowArrays
-                        std::shared_ptr<arrow::Array> booleanArray = *buildArray;
-                        arrowArrays.push_back(booleanArray);
-                        break;
-                    }
-                    case x::BasicPhysicalType::NativeType::CHAR: {
-                        x_FATAL_ERROR("ArrowFormat::getArrowArrays: type CHAR not supported by Arrow.");
-                        throw std::invalid_argument("Arrow does not support CHAR");
-                        break;
-                    }
-                    case x::BasicPhysicalType::NativeType::UNDEFINED: {
-                        x_FATAL_ERROR("ArrowFormat::getArrowArrays: Field Type UNDEFINED");
-                        break;
-                    }
-                }
+arrow::Status ArrowFormat::appendColumn(Runtime::TupleBuffer& inputBuffer, uint64_t fieldIndex, uint64_t numberOfTuples) {
+    auto& builder = *arrayBuilders[fieldIndex];
+    auto* firstValue = inputBuffer.getBuffer<uint8_t>() + memoryLayout->getFieldOffset(0, fieldIndex);
+    // the row layout strides over whole tuples, the column layout over the values of one column
+    auto stride = schema->getLayoutType() == Schema::MemoryLayoutType::ROW_LAYOUT ? memoryLayout->getTupleSize()
+                                                                                   : memoryLayout->getFieldSizes()[fieldIndex];
+    auto& physicalType = memoryLayout->getPhysicalTypes()[fieldIndex];
+    if (!physicalType->isBasicType()) {
+        return arrow::Status::NotImplemented("type ", physicalType->toString(), " is not supported by the arrow format");
+    }
+    switch (std::dynamic_pointer_cast<BasicPhysicalType>(physicalType)->nativeType) {
+        case BasicPhysicalType::NativeType::INT_8:
+            return appendFixedWidthValues<arrow::Int8Type>(builder, firstValue, stride, numberOfTuples);
+        case BasicPhysicalType::NativeType::INT_16:
+            return appendFixedWidthValues<arrow::Int16Type>(builder, firstValue, stride, numberOfTuples);
+        case BasicPhysicalType::NativeType::INT_32:
+            return appendFixedWidthValues<arrow::Int32Type>(builder, firstValue, stride, numberOfTuples);
+        case BasicPhysicalType::NativeType::INT_64:
+            return appendFixedWidthValues<arrow::Int64Type>(builder, firstValue, stride, numberOfTuples);
+        case BasicPhysicalType::NativeType::UINT_8:
+            return appendFixedWidthValues<arrow::UInt8Type>(builder, firstValue, stride, numberOfTuples);
+        case BasicPhysicalType::NativeType::UINT_16:
+            return appendFixedWidthValues<arrow::UInt16Type>(builder, firstValue, stride, numberOfTuples);
+        case BasicPhysicalType::NativeType::UINT_32:
+            return appendFixedWidthValues<arrow::UInt32Type>(builder, firstValue, stride, numberOfTuples);
+        case BasicPhysicalType::NativeType::UINT_64:
+            return appendFixedWidthValues<arrow::UInt64Type>(builder, firstValue, stride, numberOfTuples);
+        case BasicPhysicalType::NativeType::FLOAT:
+            return appendFixedWidthValues<arrow::FloatType>(builder, firstValue, stride, numberOfTuples);
+        case BasicPhysicalType::NativeType::DOUBLE:
+            return appendFixedWidthValues<arrow::DoubleType>(builder, firstValue, stride, numberOfTuples);
+        case BasicPhysicalType::NativeType::BOOLEAN: {
+            auto& booleanBuilder = static_cast<arrow::BooleanBuilder&>(builder);
+            ARROW_RETURN_NOT_OK(booleanBuilder.Reserve(numberOfTuples));
+            for (uint64_t rowIndex = 0; rowIndex < numberOfTuples; ++rowIndex) {
+                booleanBuilder.UnsafeAppend(firstValue[rowIndex * stride] != 0);
             }
-        } catch (const std::exception& e) {
-            x_ERROR("ArrowFormat::getArrowArrays: Failed to convert the arrowArray to desired x data type. "
-                      "Error: {}",
-                      e.what());
+            return arrow::Status::OK();
         }
-        offset += fieldSize;
+        case BasicPhysicalType::NativeType::TEXT: {
+            auto& stringBuilder = static_cast<arrow::StringBuilder&>(builder);
+            ARROW_RETURN_NOT_OK(stringBuilder.Reserve(numberOfTuples));
+            for (uint64_t rowIndex = 0; rowIndex < numberOfTuples; ++rowIndex) {
+                // the field holds the index of the child buffer that stores the size and the characters of the text
+                Runtime::TupleBuffer::xtedTupleBufferKey childIdx;
+                std::memcpy(&childIdx, firstValue + rowIndex * stride, sizeof(childIdx));
+                auto childTupleBuffer = inputBuffer.loadChildBuffer(childIdx);
+                auto sizeOfTextField = *childTupleBuffer.getBuffer<uint32_t>();
+                ARROW_RETURN_NOT_OK(
+                    stringBuilder.Append(childTupleBuffer.getBuffer<char>() + sizeof(uint32_t), sizeOfTextField));
+            }
+            return arrow::Status::OK();
+        }
+        default: return arrow::Status::NotImplemented("type ", physicalType->toString(), " is not supported by the arrow format");
     }
-
-    return arrowArrays;
 }
 
 std::shared_ptr<arrow::Schema> ArrowFormat::getArrowSchema() {
+    if (arrowSchema) {
+        return arrowSchema;
+    }
     std::vector<std::shared_ptr<arrow::Field>> arrowFields;
-    std::shared_ptr<arrow::Schema> arrowSchema;
     uint64_t numberOfFields = schema->fields.size();
 
     // create arrow fields and add them to the field vector
@@ -18,8 +18,8 @@
 #include <Sinks/Formats/CsvFormat.hpp>
 #include <Util/Core.hpp>
 #include <Util/Logger/Logger.hpp>
+#include <chrono>
 #include <iostream>
-#include <regex>
 #include <utility>
 
 namespace x {
@@ -41,17 +41,16 @@ std::string CsvFormat::getFormattedSchema() {
 
 std::string CsvFormat::getFormattedBuffer(Runtime::TupleBuffer& inputBuffer) {
     std::string bufferContent;
+    appendFormattedBuffer(inputBuffer, bufferContent);
+    return bufferContent;
+}
+
+void CsvFormat::appendFormattedBuffer(Runtime::TupleBuffer& inputBuffer, std::string& output) {
+    std::optional<uint64_t> timestamp;
     if (addTimestamp) {
-        auto timestamp = duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
-        schema->removeField(AttributeField::create("timestamp", DataTypeFactory::createType(BasicType::UINT64)));
-        bufferContent = Util::printTupleBufferAsCSV(inputBuffer, schema);
-        std::string repReg = "," + std::to_string(timestamp) + "\n";
-        bufferContent = std::regex_replace(bufferContent, std::regex(R"(\n)"), repReg);
-        schema->addField("timestamp", BasicType::UINT64);
-    } else {
-        bufferContent = Util::printTupleBufferAsCSV(inputBuffer, schema);
+        timestamp = duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
     }
-    return bufferContent;
+    getTupleBufferFormatter(inputBuffer)->appendCsv(inputBuffer, output, timestamp);
 }
 
 std::string CsvFormat::toString() { return "CSV_FORMAT"; }
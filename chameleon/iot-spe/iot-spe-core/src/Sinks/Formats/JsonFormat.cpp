@@ -16,17 +16,31 @@
 #include <Runtime/TupleBuffer.hpp>
 #include <Sinks/Formats/JsonFormat.hpp>
 #include <Util/Logger/Logger.hpp>
+#include <chrono>
 #include <iostream>
 #include <utility>
 
 namespace x {
 
-std::string JsonFormat::getFormattedSchema() { x_NOT_IMPLEMENTED(); }
+// every line of the output is a self-contained JSON object, so there is no header
+std::string JsonFormat::getFormattedSchema() { return ""; }
 
 JsonFormat::JsonFormat(SchemaPtr schema, Runtime::BufferManagerPtr bufferManager)
     : SinkFormat(std::move(schema), std::move(bufferManager)) {}
 
-std::string JsonFormat::getFormattedBuffer(Runtime::TupleBuffer&) { x_NOT_IMPLEMENTED(); }
+std::string JsonFormat::getFormattedBuffer(Runtime::TupleBuffer& inputBuffer) {
+    std::string bufferContent;
+    appendFormattedBuffer(inputBuffer, bufferContent);
+    return bufferContent;
+}
+
+void JsonFormat::appendFormattedBuffer(Runtime::TupleBuffer& inputBuffer, std::string& output) {
+    std::optional<uint64_t> timestamp;
+    if (addTimestamp) {
+        timestamp = duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    }
+    getTupleBufferFormatter(inputBuffer)->appendJson(inputBuffer, output, timestamp);
+}
 
 std::string JsonFormat::toString() { return "JSON_FORMAT"; }
 FormatTypes JsonFormat::getSinkFormat() { return FormatTypes::JSON_FORMAT; }
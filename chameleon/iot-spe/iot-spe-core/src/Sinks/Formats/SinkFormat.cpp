@@ -13,10 +13,13 @@
 */
 
 #include <API/Schema.hpp>
+#include <Runtime/MemoryLayout/ColumnLayout.hpp>
+#include <Runtime/MemoryLayout/RowLayout.hpp>
 #include <Runtime/TupleBuffer.hpp>
 #include <Sinks/Formats/SinkFormat.hpp>
 #include <Util/Logger/Logger.hpp>
 #include <iostream>
+#include <memory>
 #include <utility>
 
 namespace x {
@@ -28,11 +31,35 @@ SinkFormat::SinkFormat(SchemaPtr schema, Runtime::BufferManagerPtr bufferManager
 
 SchemaPtr SinkFormat::getSchemaPtr() { return schema; }
 
-void SinkFormat::setSchemaPtr(SchemaPtr schema) { this->schema = std::move(schema); }
+void SinkFormat::setSchemaPtr(SchemaPtr schema) {
+    this->schema = std::move(schema);
+    std::atomic_store(&tupleBufferFormatter, TupleBufferFormatterPtr());
+}
 
 Runtime::BufferManagerPtr SinkFormat::getBufferManager() { return bufferManager; }
 
 void SinkFormat::setBufferManager(Runtime::BufferManagerPtr bufferManager) { this->bufferManager = std::move(bufferManager); }
 bool SinkFormat::getAddTimestamp() { return addTimestamp; }
 void SinkFormat::setAddTimestamp(bool addTimestamp) { this->addTimestamp = addTimestamp; }
+
+void SinkFormat::appendFormattedBuffer(Runtime::TupleBuffer& inputBuffer, std::string& output) {
+    output.append(getFormattedBuffer(inputBuffer));
+}
+
+TupleBufferFormatterPtr SinkFormat::getTupleBufferFormatter(const Runtime::TupleBuffer& inputBuffer) {
+    auto formatter = std::atomic_load(&tupleBufferFormatter);
+    if (formatter && formatter->getBufferSize() == inputBuffer.getBufferSize()) {
+        return formatter;
+    }
+    // the offsets of the column layout depend on the buffer size, concurrent callers may create the same formatter twice
+    Runtime::MemoryLayouts::MemoryLayoutPtr memoryLayout;
+    if (schema->getLayoutType() == Schema::MemoryLayoutType::ROW_LAYOUT) {
+        memoryLayout = Runtime::MemoryLayouts::RowLayout::create(schema, inputBuffer.getBufferSize());
+    } else {
+        memoryLayout = Runtime::MemoryLayouts::ColumnLayout::create(schema, inputBuffer.getBufferSize());
+    }
+    formatter = std::make_shared<const TupleBufferFormatter>(memoryLayout);
+    std::atomic_store(&tupleBufferFormatter, formatter);
+    return formatter;
+}
 }// namespace x
\ No newline at end of file
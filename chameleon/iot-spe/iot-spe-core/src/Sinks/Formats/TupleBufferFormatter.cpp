@@ -0,0 +1,230 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <API/AttributeField.hpp>
+#include <API/Schema.hpp>
+#include <Runtime/MemoryLayout/MemoryLayout.hpp>
+#include <Runtime/MemoryLayout/RowLayout.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Sinks/Formats/TupleBufferFormatter.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+
+namespace x {
+
+namespace {
+/// the estimated number of characters of one value, used to reserve the output once per buffer
+constexpr uint64_t ESTIMATED_VALUE_LENGTH = 12;
+
+/// std::to_string writes floating point numbers with six decimal places, the longest double has 309 integral digits
+constexpr uint64_t MAX_FIXED_NUMBER_LENGTH = 512;
+constexpr int FIXED_NUMBER_PRECISION = 6;
+
+/// the shortest representation of a double that round-trips has at most 24 characters
+constexpr uint64_t MAX_NUMBER_LENGTH = 32;
+
+template<typename T>
+T readValue(const uint8_t* value) {
+    T result;
+    std::memcpy(&result, value, sizeof(T));// fields in the row layout are not aligned
+    return result;
+}
+
+template<typename T>
+void appendInteger(T value, std::string& output) {
+    std::array<char, MAX_NUMBER_LENGTH> chars;
+    auto result = std::to_chars(chars.data(), chars.data() + chars.size(), value);
+    output.append(chars.data(), result.ptr);
+}
+
+/// appends the number like std::to_string, i.e., with six decimal places
+template<typename T>
+void appendFixedFloatingPoint(T value, std::string& output) {
+    std::array<char, MAX_FIXED_NUMBER_LENGTH> chars;
+    auto result =
+        std::to_chars(chars.data(), chars.data() + chars.size(), value, std::chars_format::fixed, FIXED_NUMBER_PRECISION);
+    output.append(chars.data(), result.ptr);
+}
+
+/// appends the shortest representation that round-trips, JSON has no representation for infinity and NaN
+template<typename T>
+void appendJsonFloatingPoint(T value, std::string& output) {
+    if (!std::isfinite(value)) {
+        output.append("null");
+        return;
+    }
+    std::array<char, MAX_NUMBER_LENGTH> chars;
+    auto result = std::to_chars(chars.data(), chars.data() + chars.size(), value);
+    output.append(chars.data(), result.ptr);
+}
+}// namespace
+
+TupleBufferFormatter::TupleBufferFormatter(const Runtime::MemoryLayouts::MemoryLayoutPtr& memoryLayout) {
+    x_ASSERT(memoryLayout, "TupleBufferFormatter: invalid memory layout");
+    auto& schema = memoryLayout->getSchema();
+    auto rowLayout = std::dynamic_pointer_cast<Runtime::MemoryLayouts::RowLayout>(memoryLayout);
+    auto& physicalTypes = memoryLayout->getPhysicalTypes();
+    for (uint64_t fieldIndex = 0; fieldIndex < physicalTypes.size(); ++fieldIndex) {
+        auto& physicalType = physicalTypes[fieldIndex];
+        auto nativeType = physicalType->isBasicType() ? std::dynamic_pointer_cast<BasicPhysicalType>(physicalType)->nativeType
+                                                      : BasicPhysicalType::NativeType::UNDEFINED;
+        // the row layout strides over whole tuples, the column layout over the values of one column
+        auto stride = rowLayout ? memoryLayout->getTupleSize() : memoryLayout->getFieldSizes()[fieldIndex];
+        std::string jsonKey;
+        appendJsonString(schema->fields[fieldIndex]->getName(), jsonKey);
+        jsonKey.push_back(':');
+        fields.emplace_back(
+            Field{nativeType, memoryLayout->getFieldOffset(0, fieldIndex), stride, physicalType, std::move(jsonKey)});
+    }
+    bufferSize = memoryLayout->getBufferSize();
+    estimatedCsvTupleSize = fields.size() * ESTIMATED_VALUE_LENGTH;
+}
+
+void TupleBufferFormatter::appendCsv(Runtime::TupleBuffer& buffer, std::string& output, std::optional<uint64_t> timestamp) const {
+    auto numberOfTuples = buffer.getNumberOfTuples();
+    auto* bufferStart = buffer.getBuffer<uint8_t>();
+
+    // the timestamp is the same for all tuples, so its suffix is formatted only once
+    std::string lineEnd;
+    if (timestamp.has_value()) {
+        lineEnd.push_back(',');
+        appendInteger(timestamp.value(), lineEnd);
+    }
+    lineEnd.push_back('\n');
+
+    output.reserve(output.size() + numberOfTuples * (estimatedCsvTupleSize + lineEnd.size()));
+    for (uint64_t tupleIndex = 0; tupleIndex < numberOfTuples; ++tupleIndex) {
+        for (uint64_t fieldIndex = 0; fieldIndex < fields.size(); ++fieldIndex) {
+            const auto& field = fields[fieldIndex];
+            if (fieldIndex > 0) {
+                output.push_back(',');
+            }
+            appendCsvValue(field, bufferStart + field.offset + tupleIndex * field.stride, buffer, output);
+        }
+        output.append(lineEnd);
+    }
+}
+
+void TupleBufferFormatter::appendJson(Runtime::TupleBuffer& buffer,
+                                      std::string& output,
+                                      std::optional<uint64_t> timestamp) const {
+    auto numberOfTuples = buffer.getNumberOfTuples();
+    auto* bufferStart = buffer.getBuffer<uint8_t>();
+
+    std::string objectEnd;
+    if (timestamp.has_value()) {
+        objectEnd.append(fields.empty() ? "\"timestamp\":" : ",\"timestamp\":");
+        appendInteger(timestamp.value(), objectEnd);
+    }
+    objectEnd.append("}\n");
+
+    for (uint64_t tupleIndex = 0; tupleIndex < numberOfTuples; ++tupleIndex) {
+        output.push_back('{');
+        for (uint64_t fieldIndex = 0; fieldIndex < fields.size(); ++fieldIndex) {
+            const auto& field = fields[fieldIndex];
+            if (fieldIndex > 0) {
+                output.push_back(',');
+            }
+            output.append(field.jsonKey);
+            appendJsonValue(field, bufferStart + field.offset + tupleIndex * field.stride, buffer, output);
+        }
+        output.append(objectEnd);
+    }
+}
+
+uint64_t TupleBufferFormatter::getBufferSize() const { return bufferSize; }
+
+void TupleBufferFormatter::appendCsvValue(const Field& field,
+                                          const uint8_t* value,
+                                          Runtime::TupleBuffer& buffer,
+                                          std::string& output) {
+    switch (field.nativeType) {
+        case BasicPhysicalType::NativeType::UINT_8: appendInteger(readValue<uint8_t>(value), output); break;
+        case BasicPhysicalType::NativeType::UINT_16: appendInteger(readValue<uint16_t>(value), output); break;
+        case BasicPhysicalType::NativeType::UINT_32: appendInteger(readValue<uint32_t>(value), output); break;
+        case BasicPhysicalType::NativeType::UINT_64: appendInteger(readValue<uint64_t>(value), output); break;
+        case BasicPhysicalType::NativeType::INT_8: appendInteger(readValue<int8_t>(value), output); break;
+        case BasicPhysicalType::NativeType::INT_16: appendInteger(readValue<int16_t>(value), output); break;
+        case BasicPhysicalType::NativeType::INT_32: appendInteger(readValue<int32_t>(value), output); break;
+        case BasicPhysicalType::NativeType::INT_64: appendInteger(readValue<int64_t>(value), output); break;
+        case BasicPhysicalType::NativeType::FLOAT: appendFixedFloatingPoint(readValue<float>(value), output); break;
+        case BasicPhysicalType::NativeType::DOUBLE: appendFixedFloatingPoint(readValue<double>(value), output); break;
+        case BasicPhysicalType::NativeType::BOOLEAN: output.push_back(readValue<bool>(value) ? '1' : '0'); break;
+        case BasicPhysicalType::NativeType::CHAR: output.push_back(readValue<char>(value)); break;
+        case BasicPhysicalType::NativeType::TEXT: output.append(readText(value, buffer)); break;
+        default: output.append(field.physicalType->convertRawToString(value)); break;
+    }
+}
+
+void TupleBufferFormatter::appendJsonValue(const Field& field,
+                                           const uint8_t* value,
+                                           Runtime::TupleBuffer& buffer,
+                                           std::string& output) {
+    switch (field.nativeType) {
+        case BasicPhysicalType::NativeType::UINT_8: appendInteger(readValue<uint8_t>(value), output); break;
+        case BasicPhysicalType::NativeType::UINT_16: appendInteger(readValue<uint16_t>(value), output); break;
+        case BasicPhysicalType::NativeType::UINT_32: appendInteger(readValue<uint32_t>(value), output); break;
+        case BasicPhysicalType::NativeType::UINT_64: appendInteger(readValue<uint64_t>(value), output); break;
+        case BasicPhysicalType::NativeType::INT_8: appendInteger(readValue<int8_t>(value), output); break;
+        case BasicPhysicalType::NativeType::INT_16: appendInteger(readValue<int16_t>(value), output); break;
+        case BasicPhysicalType::NativeType::INT_32: appendInteger(readValue<int32_t>(value), output); break;
+        case BasicPhysicalType::NativeType::INT_64: appendInteger(readValue<int64_t>(value), output); break;
+        case BasicPhysicalType::NativeType::FLOAT: appendJsonFloatingPoint(readValue<float>(value), output); break;
+        case BasicPhysicalType::NativeType::DOUBLE: appendJsonFloatingPoint(readValue<double>(value), output); break;
+        case BasicPhysicalType::NativeType::BOOLEAN: output.append(readValue<bool>(value) ? "true" : "false"); break;
+        case BasicPhysicalType::NativeType::CHAR:
+            appendJsonString(std::string_view(reinterpret_cast<const char*>(value), 1), output);
+            break;
+        case BasicPhysicalType::NativeType::TEXT: appendJsonString(readText(value, buffer), output); break;
+        default: appendJsonString(field.physicalType->convertRawToStringWithoutFill(value), output); break;
+    }
+}
+
+void TupleBufferFormatter::appendJsonString(std::string_view value, std::string& output) {
+    static constexpr std::string_view hexDigits = "0123456789abcdef";
+    output.push_back('"');
+    for (auto character : value) {
+        switch (character) {
+            case '"': output.append("\\\""); break;
+            case '\\': output.append("\\\\"); break;
+            case '\b': output.append("\\b"); break;
+            case '\f': output.append("\\f"); break;
+            case '\n': output.append("\\n"); break;
+            case '\r': output.append("\\r"); break;
+            case '\t': output.append("\\t"); break;
+            default:
+                if (static_cast<unsigned char>(character) < 0x20) {
+                    output.append("\\u00");
+                    output.push_back(hexDigits[static_cast<unsigned char>(character) >> 4]);
+                    output.push_back(hexDigits[static_cast<unsigned char>(character) & 0xF]);
+                } else {
+                    output.push_back(character);
+                }
+        }
+    }
+    output.push_back('"');
+}
+
+std::string_view TupleBufferFormatter::readText(const uint8_t* value, Runtime::TupleBuffer& buffer) {
+    auto childBufferKey = readValue<Runtime::TupleBuffer::xtedTupleBufferKey>(value);
+    // the child buffer stays alive as long as its parent, so the returned view remains valid
+    auto childBuffer = buffer.loadChildBuffer(childBufferKey);
+    auto sizeOfTextField = *childBuffer.getBuffer<uint32_t>();
+    return {childBuffer.getBuffer<char>() + sizeof(uint32_t), sizeOfTextField};
+}
+
+}// namespace x
@@ -17,7 +17,9 @@
 #include <Sinks/Formats/ArrowFormat.hpp>
 #include <Sinks/Mediums/FileSink.hpp>
 #include <Sinks/Mediums/SinkMedium.hpp>
+#include <Util/GroupCommitFileWriter.hpp>
 #include <Util/Logger/Logger.hpp>
+#include <Util/magicenum/magic_enum.hpp>
 #include <filesystem>
 #include <iostream>
 #include <regex>
@@ -36,7 +38,8 @@ FileSink::FileSink(SinkFormatPtr format,
                    QueryId queryId,
                    QuerySubPlanId querySubPlanId,
                    FaultToleranceType faultToleranceType,
-                   uint64_t numberOfOrigins)
+                   uint64_t numberOfOrigins,
+                   FileSinkWriteMode writeMode)
     : SinkMedium(std::move(format),
                  std::move(nodeEngine),
                  numOfProducers,
@@ -47,16 +50,25 @@ FileSink::FileSink(SinkFormatPtr format,
                  std::make_unique<Windowing::MultiOriginWatermarkProcessor>(numberOfOrigins)) {
     this->filePath = filePath;
     this->append = append;
+    this->writeMode = writeMode;
     if (!append) {
         if (std::filesystem::exists(filePath.c_str())) {
             bool success = std::filesystem::remove(filePath.c_str());
             x_ASSERT2_FMT(success, "cannot remove file " << filePath.c_str());
         }
     }
-    x_DEBUG("FileSink: open file= {}", filePath);
-
-    // only open the file stream if it is not an arrow file
-    if (sinkFormat->getSinkFormat() != FormatTypes::ARROW_IPC_FORMAT) {
+    x_DEBUG("FileSink: open file= {} writeMode= {}", filePath, magic_enum::enum_name(writeMode));
+
+    if (writeMode != FileSinkWriteMode::SYNCHRONOUS && sinkFormat->getSinkFormat() != FormatTypes::ARROW_IPC_FORMAT) {
+        groupCommitWriter =
+            std::make_unique<Util::GroupCommitFileWriter>(filePath, writeMode == FileSinkWriteMode::GROUP_COMMIT_FSYNC);
+        // the schema is the first write, so it precedes the data of all workers
+        if (sinkFormat->getSinkFormat() != FormatTypes::x_FORMAT) {
+            groupCommitWriter->write(sinkFormat->getFormattedSchema());
+            schemaWritten = true;
+        }
+    } else if (sinkFormat->getSinkFormat() != FormatTypes::ARROW_IPC_FORMAT) {
+        // only open the file stream if it is not an arrow file
         if (!outputFile.is_open()) {
             outputFile.open(filePath, std::ofstream::binary | std::ofstream::app);
         }
@@ -66,19 +78,28 @@ FileSink::FileSink(SinkFormatPtr format,
 
 #ifdef ENABLE_ARROW_BUILD
     if (sinkFormat->getSinkFormat() == FormatTypes::ARROW_IPC_FORMAT) {
-        // raise a warning if the file path does not have the streaming "arrows" extension some other system might
+        // raise a warning if the file path does not have an arrow extension some other system might
         // thus interpret the file differently with different extension
         // the MIME types for arrow files are ".arrow" for file format, and ".arrows" for streaming file format
         // see https://arrow.apache.org/faq/
-        if (!(filePath.find(".arrows"))) {
+        auto extension = std::filesystem::path(filePath).extension();
+        if (extension != ".arrows" && extension != ".arrow" && extension != ".feather") {
             x_WARNING("FileSink: An arrow ipc file without '.arrows' extension created as a file sink.");
         }
+        auto openStatus = openArrowFile(std::dynamic_pointer_cast<ArrowFormat>(sinkFormat)->getArrowSchema());
+        if (!openStatus.ok()) {
+            x_THROW_RUNTIME_ERROR("FileSink: cannot open arrow file " << filePath << ": " << openStatus.ToString());
+        }
     }
 #endif
 }
 
 FileSink::~FileSink() {
     x_DEBUG("~FileSink: close file={}", filePath);
+    groupCommitWriter.reset();
+#ifdef ENABLE_ARROW_BUILD
+    closeArrowFile();
+#endif
     outputFile.close();
 }
 
@@ -92,7 +113,14 @@ std::string FileSink::toString() const {
 
 void FileSink::setup() {}
 
-void FileSink::shutdown() {}
+void FileSink::shutdown() {
+    if (groupCommitWriter && !groupCommitWriter->stop()) {
+        x_ERROR("FileSink: not all buffers could be written to file {}", filePath);
+    }
+#ifdef ENABLE_ARROW_BUILD
+    closeArrowFile();
+#endif
+}
 
 bool FileSink::writeData(Runtime::TupleBuffer& inputBuffer, Runtime::WorkerContextRef) {
 #ifdef ENABLE_ARROW_BUILD
@@ -101,6 +129,9 @@ bool FileSink::writeData(Runtime::TupleBuffer& inputBuffer, Runtime::WorkerConte
         return writeDataToArrowFile(inputBuffer);
     }
 #endif//ENABLE_ARROW_BUILD
+    if (groupCommitWriter) {
+        return writeDataToGroupCommitWriter(inputBuffer);
+    }
     // otherwise call the regular function
     return writeDataToFile(inputBuffer);
 }
@@ -126,17 +157,40 @@ bool FileSink::writeDataToFile(Runtime::TupleBuffer& inputBuffer) {
         x_DEBUG("FileSink::getData: schema already written");
     }
 
-    auto fBuffer = sinkFormat->getFormattedBuffer(inputBuffer);
-    x_DEBUG("FileSink::getData: writing to file {} following content {}", filePath, fBuffer);
-    outputFile.write(fBuffer.c_str(), fBuffer.size());
+    formattedBuffer.clear();
+    sinkFormat->appendFormattedBuffer(inputBuffer, formattedBuffer);
+    x_DEBUG("FileSink::getData: writing to file {} following content {}", filePath, formattedBuffer);
+    outputFile.write(formattedBuffer.data(), (int64_t) formattedBuffer.size());
     outputFile.flush();
     updateWatermarkCallback(inputBuffer);
 
     return true;
 }
 
+bool FileSink::writeDataToGroupCommitWriter(Runtime::TupleBuffer& inputBuffer) {
+    if (!inputBuffer) {
+        x_ERROR("FileSink::writeDataToGroupCommitWriter input buffer invalid");
+        return false;
+    }
+
+    // workers format their buffers in parallel, the output is moved to the writer and thus not reused
+    std::string formattedContent;
+    sinkFormat->appendFormattedBuffer(inputBuffer, formattedContent);
+
+    std::function<void()> onWritten;
+    if (faultToleranceType == FaultToleranceType::AT_LEAST_ONCE) {
+        // the watermark advances only after the buffer is written, the writer thread is the only caller
+        onWritten = [this, buffer = inputBuffer]() mutable {
+            updateWatermarkCallback(buffer);
+        };
+    }
+    return groupCommitWriter->write(std::move(formattedContent), std::move(onWritten));
+}
+
 bool FileSink::getAppend() const { return append; }
 
+FileSinkWriteMode FileSink::getWriteMode() const { return writeMode; }
+
 std::string FileSink::getAppendAsString() const {
     if (append) {
         return "APPEND";
@@ -158,46 +212,83 @@ bool FileSink::writeDataToArrowFile(Runtime::TupleBuffer& inputBuffer) {
         x_ERROR("FileSink::writeDataToArrowFile input buffer invalid");
         return false;
     }
+    if (!arrowRecordBatchWriter) {
+        x_ERROR("FileSink::writeDataToArrowFile arrow file {} is already closed", filePath);
+        return false;
+    }
 
-    // make arrow schema
+    // the tuples are accumulated into one large record batch instead of writing one small record batch per buffer
     auto arrowFormat = std::dynamic_pointer_cast<ArrowFormat>(sinkFormat);
-    std::shared_ptr<arrow::Schema> arrowSchema = arrowFormat->getArrowSchema();
-
-    // open the arrow ipc file
-    std::shared_ptr<arrow::io::FileOutputStream> outfileArrow;
-    std::shared_ptr<arrow::ipc::RecordBatchWriter> arrowWriter;
-    arrow::Status openStatus = openArrowFile(outfileArrow, arrowSchema, arrowWriter);
-
-    if (!openStatus.ok()) {
+    try {
+        arrowFormat->appendToRecordBatch(inputBuffer);
+    } catch (std::exception const& exception) {
+        x_ERROR("FileSink::writeDataToArrowFile cannot convert buffer: {}", exception.what());
         return false;
     }
+    if (faultToleranceType == FaultToleranceType::AT_LEAST_ONCE) {
+        pendingArrowBuffers.emplace_back(inputBuffer);
+    }
 
-    // get arrow arrays from tuple buffer
-    std::vector<std::shared_ptr<arrow::Array>> arrowArrays = arrowFormat->getArrowArrays(inputBuffer);
-
-    // make a record batch
-    std::shared_ptr<arrow::RecordBatch> recordBatch =
-        arrow::RecordBatch::Make(arrowSchema, arrowArrays[0]->length(), arrowArrays);
-
-    // write the record batch
-    auto write = arrowWriter->WriteRecordBatch(*recordBatch);
-
-    // close the writer
-    auto close = arrowWriter->Close();
+    if (arrowFormat->getNumberOfPendingTuples() >= ARROW_RECORD_BATCH_SIZE
+        || pendingArrowBuffers.size() >= ARROW_MAX_PENDING_BUFFERS) {
+        return writeArrowRecordBatch();
+    }
+    return true;
+}
 
+bool FileSink::writeArrowRecordBatch() {
+    auto arrowFormat = std::dynamic_pointer_cast<ArrowFormat>(sinkFormat);
+    if (arrowFormat->getNumberOfPendingTuples() > 0) {
+        auto recordBatch = arrowFormat->finishRecordBatch();
+        auto writeStatus = arrowRecordBatchWriter->WriteRecordBatch(*recordBatch);
+        if (!writeStatus.ok()) {
+            x_ERROR("FileSink::writeArrowRecordBatch cannot write to arrow file {}: {}", filePath, writeStatus.ToString());
+            pendingArrowBuffers.clear();
+            return false;
+        }
+    }
+    // the watermarks only advance once the tuples of the buffers are written
+    for (auto& buffer : pendingArrowBuffers) {
+        updateWatermarkCallback(buffer);
+    }
+    pendingArrowBuffers.clear();
     return true;
 }
 
-arrow::Status FileSink::openArrowFile(std::shared_ptr<arrow::io::FileOutputStream> arrowFileOutputStream,
-                                      std::shared_ptr<arrow::Schema> arrowSchema,
-                                      std::shared_ptr<arrow::ipc::RecordBatchWriter> arrowRecordBatchWriter) {
+arrow::Status FileSink::openArrowFile(const std::shared_ptr<arrow::Schema>& arrowSchema) {
     // the macros initialize the arrowFileOutputStream and arrowRecordBatchWriter
     // if everything goes well return status OK
     // else the macros return failure
-    ARROW_ASSIGN_OR_RAISE(arrowFileOutputStream, arrow::io::FileOutputStream::Open(filePath, append));
-    ARROW_ASSIGN_OR_RAISE(arrowRecordBatchWriter, arrow::ipc::MakeStreamWriter(arrowFileOutputStream, arrowSchema));
+    auto extension = std::filesystem::path(filePath).extension();
+    if (extension == ".arrow" || extension == ".feather") {
+        // the file format ends with a footer, so a file cannot be appended to
+        if (append) {
+            x_WARNING("FileSink: the arrow file format does not support appending, overwrite {}", filePath);
+        }
+        ARROW_ASSIGN_OR_RAISE(arrowFileOutputStream, arrow::io::FileOutputStream::Open(filePath, false));
+        ARROW_ASSIGN_OR_RAISE(arrowRecordBatchWriter, arrow::ipc::MakeFileWriter(arrowFileOutputStream, arrowSchema));
+    } else {
+        ARROW_ASSIGN_OR_RAISE(arrowFileOutputStream, arrow::io::FileOutputStream::Open(filePath, append));
+        ARROW_ASSIGN_OR_RAISE(arrowRecordBatchWriter, arrow::ipc::MakeStreamWriter(arrowFileOutputStream, arrowSchema));
+    }
     return arrow::Status::OK();
 }
+
+void FileSink::closeArrowFile() {
+    std::unique_lock lock(writeMutex);
+    if (!arrowRecordBatchWriter) {
+        return;
+    }
+    writeArrowRecordBatch();
+    if (auto closeStatus = arrowRecordBatchWriter->Close(); !closeStatus.ok()) {
+        x_ERROR("FileSink: cannot close arrow writer of {}: {}", filePath, closeStatus.ToString());
+    }
+    if (auto closeStatus = arrowFileOutputStream->Close(); !closeStatus.ok()) {
+        x_ERROR("FileSink: cannot close arrow file {}: {}", filePath, closeStatus.ToString());
+    }
+    arrowRecordBatchWriter.reset();
+    arrowFileOutputStream.reset();
+}
 #endif//ENABLE_ARROW_BUILD
 
 }// namespace x
@@ -15,6 +15,7 @@
 #include <Runtime/QueryManager.hpp>
 #include <Sinks/Mediums/KafkaSink.hpp>
 #include <Util/Logger/Logger.hpp>
+#include <Util/ThreadNaming.hpp>
 #include <chrono>
 #include <cppkafka/cppkafka.h>
 #include <sstream>
@@ -24,6 +25,9 @@ using namespace std::chrono_literals;
 
 namespace x {
 
+/// the maximal time the delivery thread waits for acknowledgements before it produces queued messages again
+const std::chrono::milliseconds DELIVERY_POLL_INTERVAL = std::chrono::milliseconds(10);
+
 KafkaSink::KafkaSink(SinkFormatPtr format,
                      Runtime::NodeEnginePtr nodeEngine,
                      uint32_t numOfProducers,
@@ -33,7 +37,10 @@ KafkaSink::KafkaSink(SinkFormatPtr format,
                      QuerySubPlanId querySubPlanId,
                      const uint64_t kafkaProducerTimeout,
                      FaultToleranceType faultToleranceType,
-                     uint64_t numberOfOrigins)
+                     uint64_t numberOfOrigins,
+                     uint64_t maxInFlightMessages,
+                     uint64_t lingerTimeInMs,
+                     uint64_t batchSizeInBytes)
     : SinkMedium(format,
                  std::move(nodeEngine),
                  numOfProducers,
@@ -42,40 +49,91 @@ KafkaSink::KafkaSink(SinkFormatPtr format,
                  faultToleranceType,
                  numberOfOrigins,
                  std::make_unique<Windowing::MultiOriginWatermarkProcessor>(numberOfOrigins)),
-      brokers(brokers), topic(topic), kafkaProducerTimeout(std::chrono::milliseconds(kafkaProducerTimeout)) {
+      brokers(brokers), topic(topic), kafkaProducerTimeout(std::chrono::milliseconds(kafkaProducerTimeout)),
+      maxInFlightMessages(maxInFlightMessages), lingerTimeInMs(lingerTimeInMs), batchSizeInBytes(batchSizeInBytes) {
+    x_ASSERT(maxInFlightMessages > 0, "KafkaSink: the maximal number of in-flight messages has to be greater than 0");
 
     config = std::make_unique<cppkafka::Configuration>();
     config->set("metadata.broker.list", brokers.c_str());
+    // the producer has to hold every message of the in-flight window
+    config->set("queue.buffering.max.messages", std::to_string(maxInFlightMessages));
+    config->set("linger.ms", std::to_string(lingerTimeInMs));
+    config->set("batch.size", std::to_string(batchSizeInBytes));
+    config->set_delivery_report_callback([this](cppkafka::Producer&, const cppkafka::Message& message) {
+        onDelivery(message);
+    });
 
     connect();
     x_DEBUG("KAFKASINK: Init KAFKA SINK to brokers  {} , topic  {}", brokers, topic);
 }
 
-KafkaSink::~KafkaSink() {}
+KafkaSink::~KafkaSink() { shutdown(); }
 
 bool KafkaSink::writeData(Runtime::TupleBuffer& inputBuffer, Runtime::WorkerContextRef) {
     x_TRACE("KAFKASINK: writes buffer");
+    // the buffer is formatted outside of the lock, so that several workers format in parallel
+    auto message = std::make_unique<PendingMessage>();
+    sinkFormat->appendFormattedBuffer(inputBuffer, message->payload);
+    message->buffer = inputBuffer;
+    x_TRACE("KafkaSink::writeData: write buffer of size {}", message->payload.size());
+
+    std::unique_lock lock(pendingMutex);
+    // queued messages are produced first to keep the order of the buffers
+    if (!queuedMessages.empty() || numberOfInFlightMessages >= maxInFlightMessages || !produce(message)) {
+        x_TRACE("KAFKASINK: in-flight window is full, queue message");
+        queuedMessages.emplace_back(std::move(message));
+    }
+    return true;
+}
+
+bool KafkaSink::produce(std::unique_ptr<PendingMessage>& message) {
+    cppkafka::MessageBuilder builder(topic);
+    // the producer passes the payload through without copying it, the message owns the payload until it is acknowledged
+    builder.payload(cppkafka::Buffer(message->payload.data(), message->payload.size()));
+    builder.user_data(message.get());
     try {
-        std::stringstream outputStream;
-        x_TRACE("KafkaSink::getData: write data");
-        auto buffer = sinkFormat->getFormattedBuffer(inputBuffer);
-        x_TRACE("KafkaSink::getData: write buffer of size {}", buffer.size());
-        cppkafka::Buffer kafkaBuffer(buffer.data(), buffer.size());
-        msgBuilder->payload(kafkaBuffer);
-        producer->produce(*msgBuilder);
-        producer->flush(std::chrono::milliseconds(kafkaProducerTimeout));
-
-        x_DEBUG("KAFKASINK: send successfully");
+        producer->produce(builder);
     } catch (const cppkafka::HandleException& ex) {
+        if (ex.get_error().get_error() == RD_KAFKA_RESP_ERR__QUEUE_FULL) {
+            return false;
+        }
         throw;
-    } catch (...) {
-        x_ERROR("KAFKASINK Unknown error occurs");
-        return false;
     }
-
+    ++numberOfInFlightMessages;
+    // the delivery report reclaims the message
+    message.release();
     return true;
 }
 
+void KafkaSink::produceQueuedMessages() {
+    std::unique_lock lock(pendingMutex);
+    while (!queuedMessages.empty() && numberOfInFlightMessages < maxInFlightMessages) {
+        if (!produce(queuedMessages.front())) {
+            return;
+        }
+        queuedMessages.pop_front();
+    }
+}
+
+void KafkaSink::onDelivery(const cppkafka::Message& message) {
+    std::unique_ptr<PendingMessage> deliveredMessage(static_cast<PendingMessage*>(message.get_user_data()));
+    --numberOfInFlightMessages;
+    if (message.get_error()) {
+        ++numberOfFailedMessages;
+        x_ERROR("KAFKASINK: could not deliver message to topic {}: {}", topic, message.get_error().to_string());
+        return;
+    }
+    updateWatermarkCallback(deliveredMessage->buffer);
+}
+
+void KafkaSink::deliveryRoutine() {
+    setThreadName("KafkaSink");
+    while (running) {
+        producer->poll(DELIVERY_POLL_INTERVAL);
+        produceQueuedMessages();
+    }
+}
+
 std::string KafkaSink::toString() const {
     std::stringstream ss;
     ss << "KAFKA_SINK(";
@@ -89,23 +147,64 @@ void KafkaSink::setup() {
 }
 
 void KafkaSink::shutdown() {
-    // currently not required
+    bool expected = true;
+    if (!running.compare_exchange_strong(expected, false)) {
+        return;
+    }
+    deliveryThread.join();
+
+    x_DEBUG("KAFKASINK: wait for {} in-flight messages", numberOfInFlightMessages.load());
+    auto deadline = std::chrono::steady_clock::now() + kafkaProducerTimeout;
+    while (std::chrono::steady_clock::now() < deadline) {
+        produceQueuedMessages();
+        {
+            std::unique_lock lock(pendingMutex);
+            if (queuedMessages.empty() && numberOfInFlightMessages == 0) {
+                return;
+            }
+        }
+        producer->poll(DELIVERY_POLL_INTERVAL);
+    }
+
+    std::unique_lock lock(pendingMutex);
+    x_WARNING("KAFKASINK: drop {} queued and {} in-flight messages after timeout",
+              queuedMessages.size(),
+              numberOfInFlightMessages.load());
+    numberOfFailedMessages += queuedMessages.size();
+    queuedMessages.clear();
+    // the delivery reports of the purged messages release them
+    rd_kafka_purge(producer->get_handle(), RD_KAFKA_PURGE_F_QUEUE | RD_KAFKA_PURGE_F_INFLIGHT);
+    while (numberOfInFlightMessages > 0 && producer->poll(DELIVERY_POLL_INTERVAL) > 0) {
+    }
 }
 
 void KafkaSink::connect() {
     x_DEBUG("KAFKASINK connecting...");
     producer = std::make_unique<cppkafka::Producer>(*config);
-    msgBuilder = std::make_unique<cppkafka::MessageBuilder>(topic);
+    producer->set_payload_policy(cppkafka::Producer::PayloadPolicy::PASSTHROUGH_PAYLOAD);
     // FIXME: should we provide user to access partition ?
     // if (partition != INVALID_PARTITION_NUMBER) {
     // msgBuilder->partition(partition);
     // }
+    running = true;
+    deliveryThread = std::thread([this]() {
+        deliveryRoutine();
+    });
 }
 
 std::string KafkaSink::getBrokers() const { return brokers; }
 std::string KafkaSink::getTopic() const { return topic; }
 uint64_t KafkaSink::getKafkaProducerTimeout() const { return kafkaProducerTimeout.count(); }
+uint64_t KafkaSink::getMaxInFlightMessages() const { return maxInFlightMessages; }
+uint64_t KafkaSink::getNumberOfInFlightMessages() const { return numberOfInFlightMessages; }
+uint64_t KafkaSink::getNumberOfQueuedMessages() const {
+    std::unique_lock lock(pendingMutex);
+    return queuedMessages.size();
+}
+uint64_t KafkaSink::getLingerTimeInMs() const { return lingerTimeInMs; }
+uint64_t KafkaSink::getBatchSizeInBytes() const { return batchSizeInBytes; }
+uint64_t KafkaSink::getNumberOfFailedMessages() const { return numberOfFailedMessages; }
 SinkMediumTypes KafkaSink::getSinkMediumType() { return SinkMediumTypes::KAFKA_SINK; }
 
 }// namespace x
-#endif
\ No newline at end of file
+#endif
@@ -13,8 +13,6 @@
 */
 
 #ifdef ENABLE_MQTT_BUILD
-#include <Runtime/MemoryLayout/DynamicTupleBuffer.hpp>
-#include <Runtime/MemoryLayout/RowLayout.hpp>
 #include <Runtime/QueryManager.hpp>
 #include <Sinks/Mediums/MQTTSink.hpp>
 #include <Util/Core.hpp>
@@ -24,7 +22,10 @@
 #include <memory>
 #include <sstream>
 #include <string>
+#include <string_view>
+#include <thread>
 #include <utility>
+#include <vector>
 
 namespace x {
 /*
@@ -34,6 +35,7 @@ namespace x {
 */
 const uint32_t NANO_TO_MILLI_SECONDS_MULTIPLIER = 1000000;
 const uint32_t NANO_TO_SECONDS_MULTIPLIER = 1000000000;
+const std::chrono::seconds MAX_WAIT_FOR_DELIVERY = std::chrono::seconds(20);
 
 SinkMediumTypes MQTTSink::getSinkMediumType() { return SinkMediumTypes::MQTT_SINK; }
 
@@ -52,7 +54,8 @@ MQTTSink::MQTTSink(SinkFormatPtr sinkFormat,
                    MQTTSinkDescriptor::ServiceQualities qualityOfService,
                    bool asynchronousClient,
                    FaultToleranceType faultToleranceType,
-                   uint64_t numberOfOrigins)
+                   uint64_t numberOfOrigins,
+                   uint64_t tuplesPerMessage)
     : SinkMedium(std::move(sinkFormat),
                  nodeEngine,
                  numOfProducers,
@@ -62,7 +65,9 @@ MQTTSink::MQTTSink(SinkFormatPtr sinkFormat,
                  numberOfOrigins,
                  std::make_unique<Windowing::MultiOriginWatermarkProcessor>(numberOfOrigins)),
       address(address), clientId(clientId), topic(topic), user(user), maxBufferedMSGs(maxBufferedMSGs), timeUnit(timeUnit),
-      messageDelay(messageDelay), qualityOfService(qualityOfService), asynchronousClient(asynchronousClient), connected(false) {
+      messageDelay(messageDelay), qualityOfService(qualityOfService), asynchronousClient(asynchronousClient), connected(false),
+      tuplesPerMessage(tuplesPerMessage) {
+    x_ASSERT(tuplesPerMessage > 0, "MQTTSink: a message has to contain at least one tuple");
 
     minDelayBetweenSends =
         std::chrono::nanoseconds(messageDelay
@@ -98,29 +103,30 @@ bool MQTTSink::writeData(Runtime::TupleBuffer& inputBuffer, Runtime::WorkerConte
         x_ERROR("MQTTSink::writeData input buffer invalid");
         return false;
     }
-    // Print received Tuple Buffer for debugging purposes.
-    auto layout = Runtime::MemoryLayouts::RowLayout::create(sinkFormat->getSchemaPtr(), inputBuffer.getBufferSize());
-    auto buffer = Runtime::MemoryLayouts::DynamicTupleBuffer(layout, inputBuffer);
-    x_TRACE("MQTTSink::writeData {}", buffer.toString(sinkFormat->getSchemaPtr()));
 
     try {
-        // Main share work performed here. The input TupleBuffer is iterated over and each tuple is converted to a json string
-        // and afterwards sent to an MQTT broker, via the MQTT client
-        for (auto formattedTuple : sinkFormat->getTupleIterator(inputBuffer)) {
-            if (formattedTuple == "") {
-                x_ERROR("MQTTSink:: Error during tuple creation from tuple buffer:  {}", formattedTuple);
-                continue;
+        // The input TupleBuffer is formatted as one line per tuple, a message packs tuplesPerMessage lines and is sent
+        // to an MQTT broker, via the MQTT client
+        formattedBuffer.clear();
+        sinkFormat->appendFormattedBuffer(inputBuffer, formattedBuffer);
+        auto payloads = splitIntoMessages(formattedBuffer, tuplesPerMessage);
+        mqtt::delivery_token_ptr lastDeliveryToken;
+        for (uint64_t i = 0; i < payloads.size(); ++i) {
+            x_TRACE("MQTTSink::writeData Sending Payload:  {}", payloads[i]);
+            lastDeliveryToken = client->sendPayload(std::string(payloads[i]), &deliveryListener);
+            if (i + 1 < payloads.size() && minDelayBetweenSends.count() > 0) {
+                std::this_thread::sleep_for(minDelayBetweenSends);
             }
-            x_TRACE("MQTTSink::writeData Sending Payload:  {}", formattedTuple);
-            client->sendPayload(formattedTuple);
-            std::this_thread::sleep_for(minDelayBetweenSends);
         }
 
-        // When the client is asynchronous it can happen that the client's buffer is large enough to buffer all messages
-        // that were not successfully sent to an MQTT broker.
-        if ((asynchronousClient && client->getNumberOfUnsentMessages() > 0)) {
-            x_ERROR("MQTTSink::writeData: {} messages could not be sent", client->getNumberOfUnsentMessages());
-            return false;
+        // The asynchronous client returns before the messages are delivered, so the buffer is released once its last
+        // message is delivered. Until then, it is not returned to the buffer pool.
+        if (lastDeliveryToken) {
+            std::unique_lock inFlightLock(inFlightMutex);
+            buffersInFlight.emplace_back(std::move(lastDeliveryToken), inputBuffer);
+            // the delivery callback may have run before the buffer was added
+            releaseDeliveredBuffers();
+            return true;
         }
     } catch (const mqtt::exception& ex) {
         x_ERROR("MQTTSink::writeData: Error during writeData in MQTT sink: {}", ex.what());
@@ -130,6 +136,75 @@ bool MQTTSink::writeData(Runtime::TupleBuffer& inputBuffer, Runtime::WorkerConte
     return true;
 }
 
+std::vector<std::string_view> MQTTSink::splitIntoMessages(std::string_view formattedTuples, uint64_t tuplesPerMessage) {
+    std::vector<std::string_view> payloads;
+    uint64_t messageStart = 0;
+    while (messageStart < formattedTuples.size()) {
+        auto messageEnd = messageStart;
+        for (uint64_t i = 0; i < tuplesPerMessage && messageEnd < formattedTuples.size(); ++i) {
+            messageEnd = formattedTuples.find('\n', messageEnd);
+            messageEnd = messageEnd == std::string_view::npos ? formattedTuples.size() : messageEnd + 1;
+        }
+        // the payload omits the line break after its last tuple
+        auto payloadSize = messageEnd - messageStart - (formattedTuples[messageEnd - 1] == '\n' ? 1 : 0);
+        payloads.emplace_back(formattedTuples.substr(messageStart, payloadSize));
+        messageStart = messageEnd;
+    }
+    return payloads;
+}
+
+void MQTTSink::shutdown() {
+    std::unique_lock lock(writeMutex);
+    waitForDelivery();
+}
+
+void MQTTSink::onDelivery() {
+    std::unique_lock lock(inFlightMutex);
+    releaseDeliveredBuffers();
+}
+
+void MQTTSink::releaseDeliveredBuffers() {
+    // messages are delivered in publishing order, so the buffers are released in the same order
+    while (!buffersInFlight.empty()) {
+        auto& [deliveryToken, buffer] = buffersInFlight.front();
+        if (!deliveryToken->is_complete()) {
+            return;
+        }
+        if (deliveryToken->get_return_code() != 0) {
+            x_ERROR("MQTTSink::releaseDeliveredBuffers: message could not be delivered, return code {}",
+                    deliveryToken->get_return_code());
+        } else {
+            updateWatermarkCallback(buffer);
+        }
+        buffersInFlight.pop_front();
+    }
+}
+
+void MQTTSink::waitForDelivery() {
+    while (true) {
+        mqtt::delivery_token_ptr deliveryToken;
+        {
+            std::unique_lock lock(inFlightMutex);
+            releaseDeliveredBuffers();
+            if (buffersInFlight.empty()) {
+                return;
+            }
+            deliveryToken = buffersInFlight.front().first;
+        }
+        // the client notifies waiting threads only after the delivery callback, which acquires the inFlightMutex
+        try {
+            if (!deliveryToken->wait_for(MAX_WAIT_FOR_DELIVERY)) {
+                std::unique_lock lock(inFlightMutex);
+                x_ERROR("MQTTSink::waitForDelivery: {} buffers were not delivered", buffersInFlight.size());
+                buffersInFlight.clear();
+                return;
+            }
+        } catch (const mqtt::exception& ex) {
+            x_ERROR("MQTTSink::waitForDelivery: Error during delivery in MQTT sink: {}", ex.what());
+        }
+    }
+}
+
 std::string MQTTSink::toString() const {
     std::stringstream ss;
     ss << "MQTT_SINK(";
@@ -143,7 +218,8 @@ std::string MQTTSink::toString() const {
     ss << "SEND_PERIOD=" << messageDelay << ", ";
     ss << "SEND_DURATION_IN_NS=" << std::to_string(minDelayBetweenSends.count()) << ", ";
     ss << "QUALITY_OF_SERVICE=" << std::string(magic_enum::enum_name(qualityOfService)) << ", ";
-    ss << "CLIENT_TYPE=" << ((asynchronousClient) ? "ASYMMETRIC_CLIENT" : "SYMMETRIC_CLIENT");
+    ss << "CLIENT_TYPE=" << ((asynchronousClient) ? "ASYMMETRIC_CLIENT" : "SYMMETRIC_CLIENT") << ", ";
+    ss << "TUPLES_PER_MESSAGE=" << tuplesPerMessage;
     ss << ")";
     return ss.str();
 }
@@ -195,5 +271,10 @@ MQTTSinkDescriptor::TimeUnits MQTTSink::getTimeUnit() const { return timeUnit; }
 uint64_t MQTTSink::getMsgDelay() const { return messageDelay; }
 MQTTSinkDescriptor::ServiceQualities MQTTSink::getQualityOfService() const { return qualityOfService; }
 bool MQTTSink::getAsynchronousClient() const { return asynchronousClient; }
+uint64_t MQTTSink::getTuplesPerMessage() const { return tuplesPerMessage; }
+uint64_t MQTTSink::getNumberOfBuffersInFlight() {
+    std::unique_lock lock(inFlightMutex);
+    return buffersInFlight.size();
+}
 #endif
 }// namespace x
@@ -52,8 +52,7 @@ MonitoringSink::~MonitoringSink() = default;
 SinkMediumTypes MonitoringSink::getSinkMediumType() { return SinkMediumTypes::MONITORING_SINK; }
 
 bool MonitoringSink::writeData(Runtime::TupleBuffer& inputBuffer, Runtime::WorkerContextRef) {
-    std::unique_lock lock(writeMutex);
-
+    // the metric store synchronizes itself, so workers parse their buffers in parallel
     if (!inputBuffer) {
         throw Exceptions::RuntimeException("MonitoringSink::writeData input buffer invalid");
     }
@@ -39,12 +39,31 @@ NullOutputSink::~NullOutputSink() = default;
 
 SinkMediumTypes NullOutputSink::getSinkMediumType() { return SinkMediumTypes::NULL_SINK; }
 
-bool NullOutputSink::writeData(Runtime::TupleBuffer& inputBuffer, Runtime::WorkerContextRef) {
-    std::unique_lock lock(writeMutex);
+bool NullOutputSink::writeData(Runtime::TupleBuffer& inputBuffer, Runtime::WorkerContextRef workerContext) {
+    receivedCounters.withLocalShard(workerContext, [&inputBuffer](ReceivedCounters& counters) {
+        ++counters.buffers;
+        counters.tuples += inputBuffer.getNumberOfTuples();
+    });
     updateWatermarkCallback(inputBuffer);
     return true;
 }
 
+uint64_t NullOutputSink::getNumberOfReceivedBuffers() {
+    uint64_t numberOfBuffers = 0;
+    receivedCounters.forEachShard([&numberOfBuffers](ReceivedCounters& counters) {
+        numberOfBuffers += counters.buffers;
+    });
+    return numberOfBuffers;
+}
+
+uint64_t NullOutputSink::getNumberOfReceivedTuples() {
+    uint64_t numberOfTuples = 0;
+    receivedCounters.forEachShard([&numberOfTuples](ReceivedCounters& counters) {
+        numberOfTuples += counters.tuples;
+    });
+    return numberOfTuples;
+}
+
 std::string NullOutputSink::toString() const {
     std::stringstream ss;
     ss << "NULL_SINK(";
@@ -58,27 +58,22 @@ SinkMedium::SinkMedium(SinkFormatPtr sinkFormat,
 
 OperatorId SinkMedium::getOperatorId() const { return 0; }
 
-uint64_t SinkMedium::getNumberOfWrittenOutBuffers() {
-    std::unique_lock lock(writeMutex);
-    return sentBuffer;
-}
+uint64_t SinkMedium::getNumberOfWrittenOutBuffers() { return sentBuffer; }
 
 void SinkMedium::updateWatermark(Runtime::TupleBuffer& inputBuffer) {
     x_ASSERT(watermarkProcessor != nullptr, "SinkMedium::updateWatermark watermark processor is null");
     watermarkProcessor->updateWatermark(inputBuffer.getWatermark(), inputBuffer.getSequenceNumber(), inputBuffer.getOriginId());
-    if (!(bufferCount % buffersPerEpoch) && bufferCount != 0) {
+    // every buffersPerEpoch-th buffer terminates an epoch, also if several workers update the watermark concurrently
+    auto currentBufferCount = bufferCount.fetch_add(1);
+    if (!(currentBufferCount % buffersPerEpoch) && currentBufferCount != 0) {
         auto timestamp = watermarkProcessor->getCurrentWatermark();
         if (timestamp) {
             notifyEpochTermination(timestamp);
         }
     }
-    bufferCount++;
 }
 
-uint64_t SinkMedium::getNumberOfWrittenOutTuples() {
-    std::unique_lock lock(writeMutex);
-    return sentTuples;
-}
+uint64_t SinkMedium::getNumberOfWrittenOutTuples() { return sentTuples; }
 
 SchemaPtr SinkMedium::getSchemaPtr() const { return sinkFormat->getSchemaPtr(); }
 
@@ -38,7 +38,8 @@ DataSinkPtr createCSVFileSink(const SchemaPtr& schema,
                               bool append,
                               bool addTimestamp,
                               FaultToleranceType faultToleranceType,
-                              uint64_t numberOfOrigins) {
+                              uint64_t numberOfOrigins,
+                              FileSinkWriteMode writeMode) {
     SinkFormatPtr format = std::make_shared<CsvFormat>(schema, nodeEngine->getBufferManager(), addTimestamp);
     return std::make_shared<FileSink>(format,
                                       nodeEngine,
@@ -48,7 +49,8 @@ DataSinkPtr createCSVFileSink(const SchemaPtr& schema,
                                       queryId,
                                       querySubPlanId,
                                       faultToleranceType,
-                                      numberOfOrigins);
+                                      numberOfOrigins,
+                                      writeMode);
 }
 
 DataSinkPtr createBinaryxFileSink(const SchemaPtr& schema,
@@ -59,7 +61,8 @@ DataSinkPtr createBinaryxFileSink(const SchemaPtr& schema,
                                     const std::string& filePath,
                                     bool append,
                                     FaultToleranceType faultToleranceType,
-                                    uint64_t numberOfOrigins) {
+                                    uint64_t numberOfOrigins,
+                                    FileSinkWriteMode writeMode) {
     SinkFormatPtr format = std::make_shared<xFormat>(schema, nodeEngine->getBufferManager());
     return std::make_shared<FileSink>(format,
                                       nodeEngine,
@@ -69,7 +72,8 @@ DataSinkPtr createBinaryxFileSink(const SchemaPtr& schema,
                                       queryId,
                                       querySubPlanId,
                                       faultToleranceType,
-                                      numberOfOrigins);
+                                      numberOfOrigins,
+                                      writeMode);
 }
 
 DataSinkPtr createJSONFileSink(const SchemaPtr& schema,
@@ -80,7 +84,8 @@ DataSinkPtr createJSONFileSink(const SchemaPtr& schema,
                                const std::string& filePath,
                                bool append,
                                FaultToleranceType faultToleranceType,
-                               uint64_t numberOfOrigins) {
+                               uint64_t numberOfOrigins,
+                               FileSinkWriteMode writeMode) {
     SinkFormatPtr format = std::make_shared<JsonFormat>(schema, nodeEngine->getBufferManager());
     return std::make_shared<FileSink>(format,
                                       nodeEngine,
@@ -90,7 +95,8 @@ DataSinkPtr createJSONFileSink(const SchemaPtr& schema,
                                       queryId,
                                       querySubPlanId,
                                       faultToleranceType,
-                                      numberOfOrigins);
+                                      numberOfOrigins,
+                                      writeMode);
 }
 
 #ifdef ENABLE_ARROW_BUILD
@@ -321,7 +327,10 @@ DataSinkPtr createCsvKafkaSink(SchemaPtr schema,
                                const std::string& topic,
                                uint64_t kafkaProducerTimeout,
                                FaultToleranceType faultToleranceType,
-                               uint64_t numberOfOrigins) {
+                               uint64_t numberOfOrigins,
+                               uint64_t maxInFlightMessages,
+                               uint64_t lingerTimeInMs,
+                               uint64_t batchSizeInBytes) {
     SinkFormatPtr format = std::make_shared<CsvFormat>(schema, nodeEngine->getBufferManager());
 
     return std::make_shared<KafkaSink>(format,
@@ -333,7 +342,10 @@ DataSinkPtr createCsvKafkaSink(SchemaPtr schema,
                                        querySubPlanId,
                                        kafkaProducerTimeout,
                                        faultToleranceType,
-                                       numberOfOrigins);
+                                       numberOfOrigins,
+                                       maxInFlightMessages,
+                                       lingerTimeInMs,
+                                       batchSizeInBytes);
 }
 #endif
 #ifdef ENABLE_OPC_BUILD
@@ -367,7 +379,8 @@ DataSinkPtr createMQTTSink(const SchemaPtr& schema,
                            MQTTSinkDescriptor::ServiceQualities qualityOfService,
                            bool asynchronousClient,
                            FaultToleranceType faultToleranceType,
-                           uint64_t numberOfOrigins) {
+                           uint64_t numberOfOrigins,
+                           uint64_t tuplesPerMessage) {
     SinkFormatPtr format = std::make_shared<JsonFormat>(schema, nodeEngine->getBufferManager());
     return std::make_shared<MQTTSink>(format,
                                       nodeEngine,
@@ -384,7 +397,8 @@ DataSinkPtr createMQTTSink(const SchemaPtr& schema,
                                       qualityOfService,
                                       asynchronousClient,
                                       faultToleranceType,
-                                      numberOfOrigins);
+                                      numberOfOrigins,
+                                      tuplesPerMessage);
 }
 #endif
 }// namespace x
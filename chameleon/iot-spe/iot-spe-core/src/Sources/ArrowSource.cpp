@@ -26,6 +26,7 @@
 #include <Util/Core.hpp>
 #include <Util/Logger/Logger.hpp>
 
+#include <algorithm>
 #include <chrono>
 #include <cstring>
 #include <sstream>
@@ -55,7 +56,8 @@ ArrowSource::ArrowSource(SchemaPtr schema,
                  physicalSourceName,
                  std::move(successors)),
       fileEnded(false), arrowSourceType(arrowSourceType), filePath(arrowSourceType->getFilePath()->getValue()),
-      numberOfTuplesToProducePerBuffer(arrowSourceType->getNumberOfTuplesToProducePerBuffer()->getValue()) {
+      numberOfTuplesToProducePerBuffer(arrowSourceType->getNumberOfTuplesToProducePerBuffer()->getValue()),
+      numberOfReaderThreads(arrowSourceType->getNumberOfReaderThreads()->getValue()) {
 
     this->numberOfBuffersToProduce = arrowSourceType->getNumberOfBuffersToProduce()->getValue();
     this->gatheringInterval = std::chrono::milliseconds(arrowSourceType->getGatheringInterval()->getValue());
@@ -87,10 +89,44 @@ ArrowSource::ArrowSource(SchemaPtr schema,
         auto physicalField = defaultPhysicalTypeFactory.getPhysicalType(field->getDataType());
         physicalTypes.push_back(physicalField);
     }
+    columnLayout = std::dynamic_pointer_cast<Runtime::MemoryLayouts::ColumnLayout>(memoryLayout);
+
+    if (numberOfReaderThreads > 1) {
+        // reading a batch only decodes its metadata, the conversion into buffers is left to the readers
+        while (true) {
+            readNextBatch();
+            if (this->fileEnded) {
+                break;
+            }
+            recordBatches.emplace_back(std::move(currentRecordBatch));
+        }
+        this->fileEnded = false;
+        x_DEBUG("ArrowSource: read {} record batches for {} reader threads", recordBatches.size(), numberOfReaderThreads);
+    }
 }
 
 std::optional<Runtime::TupleBuffer> ArrowSource::receiveData() {
     x_TRACE("ArrowSource::receiveData called on  {}", operatorId);
+    if (numberOfReaderThreads > 1) {
+        if (partitionedFileReader == nullptr) {
+            partitionedFileReader = std::make_unique<PartitionedFileReader>(
+                recordBatches.size(),
+                numberOfReaderThreads,
+                [this](uint64_t partitionIndex, std::vector<Runtime::TupleBuffer>& buffers) {
+                    parsePartition(partitionIndex, buffers);
+                });
+            partitionedFileReader->start();
+        }
+        // the record batches are handed out in file order, so emitWorkFromSource assigns ordered sequence numbers
+        auto buffer = partitionedFileReader->next();
+        if (!buffer.has_value()) {
+            this->fileEnded = true;
+            return std::nullopt;
+        }
+        generatedTuples += buffer->getNumberOfTuples();
+        generatedBuffers++;
+        return buffer;
+    }
     auto buffer = allocateBuffer();
     fillBuffer(buffer);
     x_TRACE("ArrowSource::receiveData filled buffer with tuples= {}", buffer.getNumberOfTuples());
@@ -101,6 +137,13 @@ std::optional<Runtime::TupleBuffer> ArrowSource::receiveData() {
     return buffer.getBuffer();
 }
 
+void ArrowSource::close() {
+    if (partitionedFileReader != nullptr) {
+        partitionedFileReader->stop();
+    }
+    DataSource::close();
+}
+
 std::string ArrowSource::toString() const {
     std::stringstream ss;
     ss << "ARROW_SOURCE(SCHEMA(" << schema->toString() << "), FILE=" << filePath << " freq=" << this->gatheringInterval.count()
@@ -199,11 +242,20 @@ std::string ArrowSource::getFilePath() const { return filePath; }
 
 const ArrowSourceTypePtr& ArrowSource::getSourceConfig() const { return arrowSourceType; }
 
+std::vector<Schema::MemoryLayoutType> ArrowSource::getSupportedLayouts() {
+    return {Schema::MemoryLayoutType::ROW_LAYOUT, Schema::MemoryLayoutType::COLUMNAR_LAYOUT};
+}
+
 arrow::Status ArrowSource::openFile() {
     // the macros initialize the file and recordBatchReader
     // if everything works well return status OK
     // else the macros returns failure
-    ARROW_ASSIGN_OR_RAISE(inputFile, arrow::io::ReadableFile::Open(filePath, arrow::default_memory_pool()));
+    mappedFile = Util::MappedFile::create(filePath);
+    fileSize = mappedFile->getSize();
+    // the buffer does not own the mapping, mappedFile outlives the reader
+    auto fileBuffer = std::make_shared<arrow::Buffer>(reinterpret_cast<const uint8_t*>(mappedFile->getData()),
+                                                      static_cast<int64_t>(mappedFile->getSize()));
+    inputFile = std::make_shared<arrow::io::BufferReader>(fileBuffer);
     ARROW_ASSIGN_OR_RAISE(recordBatchStreamReader, arrow::ipc::RecordBatchStreamReader::Open(inputFile));
     return arrow::Status::OK();
 }
@@ -211,6 +263,9 @@ arrow::Status ArrowSource::openFile() {
 void ArrowSource::readNextBatch() {
     // set the internal index to 0 and read the new batch
     indexWithinCurrentRecordBatch = 0;
+    if (auto position = inputFile->Tell(); position.ok()) {
+        mappedFile->willRead(static_cast<uint64_t>(*position));
+    }
     auto readStatus = recordBatchStreamReader->ReadNext(&currentRecordBatch);
 
     // check if file has ended
@@ -228,6 +283,21 @@ void ArrowSource::readNextBatch() {
     x_TRACE("ArrowSource::readNextBatch: read the following record batch {}", currentRecordBatch->ToString());
 }
 
+void ArrowSource::parsePartition(uint64_t partitionIndex, std::vector<Runtime::TupleBuffer>& buffers) {
+    const auto& recordBatch = recordBatches[partitionIndex];
+    auto tuplesPerBuffer = numberOfTuplesToProducePerBuffer > 0 ? numberOfTuplesToProducePerBuffer : memoryLayout->getCapacity();
+    auto numberOfRows = static_cast<uint64_t>(recordBatch->num_rows());
+    for (uint64_t row = 0; row < numberOfRows; row += tuplesPerBuffer) {
+        auto numberOfTuples = std::min<uint64_t>(tuplesPerBuffer, numberOfRows - row);
+        // the readers allocate from the global buffer manager, the local buffer pool belongs to the source thread
+        auto buffer = Runtime::MemoryLayouts::DynamicTupleBuffer(memoryLayout, localBufferManager->getBufferBlocking());
+        writeRecordBatchToTupleBuffer(0, buffer, recordBatch->Slice(row, numberOfTuples));
+        buffer.setNumberOfTuples(numberOfTuples);
+        buffers.emplace_back(buffer.getBuffer());
+    }
+    x_TRACE("ArrowSource::parsePartition: converted record batch {} into {} buffers", partitionIndex, buffers.size());
+}
+
 // TODO move all logic below to Parser / Format?
 // Core Logic in writeRecordBatchToTupleBuffer() and writeArrowArrayToTupleBuffer(): Arrow (and Parquet) format(s)
 // is(are) column-oriented. Instead of reconstructing each tuple due to high reconstruction cost, we instead retrieve
@@ -265,6 +335,11 @@ void ArrowSource::writeArrowArrayToTupleBuffer(uint64_t tupleCountInBuffer,
         return;
     }
 
+    // the values of numeric arrays are laid out exactly like a column, so they do not need to be written one by one
+    if (copyArrowArrayToColumn(tupleCountInBuffer, schemaFieldIndex, tupleBuffer, arrowArray)) {
+        return;
+    }
+
     try {
         if (physicalType->isBasicType()) {
             auto basicPhysicalType = std::dynamic_pointer_cast<BasicPhysicalType>(physicalType);
@@ -512,6 +587,46 @@ void ArrowSource::writeArrowArrayToTupleBuffer(uint64_t tupleCountInBuffer,
     }
 }
 
+bool ArrowSource::copyArrowArrayToColumn(uint64_t tupleCountInBuffer,
+                                         uint64_t schemaFieldIndex,
+                                         Runtime::MemoryLayouts::DynamicTupleBuffer& tupleBuffer,
+                                         const std::shared_ptr<arrow::Array>& arrowArray) {
+    if (columnLayout == nullptr || !physicalTypes[schemaFieldIndex]->isBasicType()) {
+        return false;
+    }
+
+    // only types with the same fixed width in arrow and in the buffer, arrow packs booleans into bits
+    arrow::Type::type expectedTypeId;
+    switch (std::dynamic_pointer_cast<BasicPhysicalType>(physicalTypes[schemaFieldIndex])->nativeType) {
+        case x::BasicPhysicalType::NativeType::INT_8: expectedTypeId = arrow::Type::type::INT8; break;
+        case x::BasicPhysicalType::NativeType::INT_16: expectedTypeId = arrow::Type::type::INT16; break;
+        case x::BasicPhysicalType::NativeType::INT_32: expectedTypeId = arrow::Type::type::INT32; break;
+        case x::BasicPhysicalType::NativeType::INT_64: expectedTypeId = arrow::Type::type::INT64; break;
+        case x::BasicPhysicalType::NativeType::UINT_8: expectedTypeId = arrow::Type::type::UINT8; break;
+        case x::BasicPhysicalType::NativeType::UINT_16: expectedTypeId = arrow::Type::type::UINT16; break;
+        case x::BasicPhysicalType::NativeType::UINT_32: expectedTypeId = arrow::Type::type::UINT32; break;
+        case x::BasicPhysicalType::NativeType::UINT_64: expectedTypeId = arrow::Type::type::UINT64; break;
+        case x::BasicPhysicalType::NativeType::FLOAT: expectedTypeId = arrow::Type::type::FLOAT; break;
+        case x::BasicPhysicalType::NativeType::DOUBLE: expectedTypeId = arrow::Type::type::DOUBLE; break;
+        default: return false;
+    }
+    // inconsistent types are reported by writeArrowArrayToTupleBuffer
+    if (arrowArray->type()->id() != expectedTypeId) {
+        return false;
+    }
+
+    auto arrayLength = static_cast<uint64_t>(arrowArray->length());
+    x_ASSERT(tupleCountInBuffer + arrayLength <= columnLayout->getCapacity(),
+             "ArrowSource::copyArrowArrayToColumn: not enough space in tuple buffer for " << arrayLength << " values");
+    auto fieldSize = physicalTypes[schemaFieldIndex]->size();
+    // the values buffer of a sliced array starts at the beginning of the unsliced array
+    const auto* values = arrowArray->data()->GetValues<uint8_t>(1, arrowArray->offset() * fieldSize);
+    auto* column = tupleBuffer.getBuffer().getBuffer<uint8_t>() + columnLayout->getColumnOffsets()[schemaFieldIndex]
+        + tupleCountInBuffer * fieldSize;
+    std::memcpy(column, values, arrayLength * fieldSize);
+    return true;
+}
+
 }// namespace x
 
 #endif// ENABLE_ARROW_BUILD
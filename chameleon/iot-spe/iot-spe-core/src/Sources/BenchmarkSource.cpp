@@ -21,6 +21,7 @@
 #include <Sources/BenchmarkSource.hpp>
 #include <Util/Core.hpp>
 #include <Util/Logger/Logger.hpp>
+#include <Util/RatePacer.hpp>
 #include <Util/ThreadNaming.hpp>
 #include <cmath>
 #ifdef x_USE_ONE_QUEUE_PER_NUMA_NODE
@@ -121,7 +122,16 @@ void BenchmarkSource::runningRoutine() {
 
         x_INFO("Going to produce {}", numberOfTuplesToProduce);
 
+        std::optional<Util::RatePacer> pacer;
+        if (gatheringMode == GatheringMode::INGESTION_RATE_MODE && gatheringIngestionRate > 0) {
+            pacer.emplace(static_cast<double>(gatheringIngestionRate));
+        }
+
         for (uint64_t i = 0; i < numberOfBuffersToProduce && running; ++i) {
+            // replay the memory area from its start instead of reading past its end
+            if (currentPositionInBytes + bufferSize > memoryAreaSize) {
+                currentPositionInBytes = 0;
+            }
             Runtime::TupleBuffer buffer;
             switch (sourceMode) {
                 case SourceMode::EMPTY_BUFFER: {
@@ -170,10 +180,16 @@ void BenchmarkSource::runningRoutine() {
             generatedBuffers++;
             currentPositionInBytes += bufferSize;
 
+            if (pacer) {
+                pacer->waitForNextEvent();
+            }
             for (const auto& successor : executableSuccessors) {
                 queryManager->addWorkForNextPipeline(buffer, successor, taskQueueId);
             }
         }
+        if (pacer) {
+            reportIngestionRate(*pacer);
+        }
 
         close();
         completedPromise.set_value(true);
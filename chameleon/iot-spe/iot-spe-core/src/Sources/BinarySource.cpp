@@ -12,11 +12,14 @@
     limitations under the License.
 */
 
+#include <Exceptions/RuntimeException.hpp>
 #include <Runtime/FixedSizeBufferPool.hpp>
 #include <Runtime/QueryManager.hpp>
 #include <Sources/BinarySource.hpp>
 #include <Sources/DataSource.hpp>
 #include <Util/Logger/Logger.hpp>
+#include <algorithm>
+#include <cstring>
 #include <sstream>
 #include <utility>
 
@@ -41,20 +44,27 @@ BinarySource::BinarySource(const SchemaPtr& schema,
                  gatheringMode,
                  physicalSourceName,
                  std::move(successors)),
-      input(std::ifstream(pathToFile.c_str())), filePath(pathToFile) {
-    if (!(input.is_open() && input.good())) {
-        x_THROW_RUNTIME_ERROR("Binary input file is not valid");
+      filePath(pathToFile) {
+    try {
+        mappedFile = Util::MappedFile::create(pathToFile);
+    } catch (const Exceptions::RuntimeException& exception) {
+        x_THROW_RUNTIME_ERROR("Binary input file is not valid: " << exception.what());
     }
-    input.seekg(0, std::ifstream::end);
-    fileSize = input.tellg();
-    if (fileSize < 0) {
-        x_FATAL_ERROR("ERROR: File {} is corrupted", pathToFile);
-    }
-    input.seekg(0, std::ifstream::beg);
+    fileSize = mappedFile->getSize();
     tupleSize = schema->getSchemaSizeInBytes();
+    // the file holds tuples in the row layout, so only row layout buffers can point into the mapping
+    zeroCopy = schema->getLayoutType() == Schema::MemoryLayoutType::ROW_LAYOUT;
 }
 
 std::optional<Runtime::TupleBuffer> BinarySource::receiveData() {
+    if (zeroCopy) {
+        if (auto numberOfBytes = getNumberOfBytesToRead(bufferManager->getBufferSize()); numberOfBytes > 0) {
+            auto buf = mappedFile->wrap(currentPositionInFile, numberOfBytes);
+            buf.setNumberOfTuples(numberOfBytes / tupleSize);
+            advance(numberOfBytes);
+            return buf;
+        }
+    }
     auto buf = this->bufferManager->getBufferBlocking();
     fillBuffer(buf);
     return buf;
@@ -67,23 +77,32 @@ std::string BinarySource::toString() const {
 }
 
 void BinarySource::fillBuffer(Runtime::TupleBuffer& buf) {
-    /** while(generated_tuples < num_tuples_to_process)
-     * read <buf.buffer_size> bytes data from file into buffer
-     * advance internal file pointer, if we reach the file end, set to file begin
-     */
+    auto numberOfBytes = getNumberOfBytesToRead(buf.getBufferSize());
+    if (numberOfBytes > 0) {
+        std::memcpy(buf.getBuffer<char>(), mappedFile->getData() + currentPositionInFile, numberOfBytes);
+    }
+    buf.setNumberOfTuples(numberOfBytes / tupleSize);
+    advance(numberOfBytes);
+}
 
-    // 'std::streamoff' (aka 'long') and 'size_t' (aka 'unsigned long')
-    if (input.tellg() > 0 && (unsigned) input.tellg() == fileSize) {
-        input.seekg(0, std::ifstream::beg);
+uint64_t BinarySource::getNumberOfBytesToRead(uint64_t bufferSize) {
+    if (tupleSize == 0) {
+        return 0;
     }
-    uint64_t uint64_to_read = buf.getBufferSize() < (uint64_t) fileSize ? buf.getBufferSize() : fileSize;
-    input.read(buf.getBuffer<char>(), uint64_to_read);
-    uint64_t generated_tuples_this_pass = uint64_to_read / tupleSize;
-    buf.setNumberOfTuples(generated_tuples_this_pass);
+    if (fileSize - currentPositionInFile < tupleSize) {
+        currentPositionInFile = 0;
+    }
+    auto numberOfTuples = std::min<uint64_t>(bufferSize, fileSize - currentPositionInFile) / tupleSize;
+    return numberOfTuples * tupleSize;
+}
 
-    generatedTuples += generated_tuples_this_pass;
+void BinarySource::advance(uint64_t numberOfBytes) {
+    currentPositionInFile += numberOfBytes;
+    mappedFile->willRead(currentPositionInFile);
+    generatedTuples += tupleSize == 0 ? 0 : numberOfBytes / tupleSize;
     generatedBuffers++;
 }
+
 SourceType BinarySource::getType() const { return SourceType::BINARY_SOURCE; }
 
 const std::string& BinarySource::getFilePath() const { return filePath; }
@@ -19,8 +19,11 @@
 #include <Sources/CSVSource.hpp>
 #include <Sources/DataSource.hpp>
 #include <Sources/Parsers/CSVParser.hpp>
+#include <Sources/Parsers/CSVTokenizer.hpp>
+#include <Util/Common.hpp>
 #include <Util/Core.hpp>
 #include <Util/Logger/Logger.hpp>
+#include <algorithm>
 #include <chrono>
 #include <cstring>
 #include <sstream>
@@ -30,6 +33,16 @@
 
 namespace x {
 
+namespace {
+/// the initial size of a block, lines that are longer double it
+constexpr uint64_t BLOCK_SIZE = 1024 * 1024;
+/// the number of buffers that a partition of a partitioned file fills, estimated from a sample of its lines
+constexpr uint64_t BUFFERS_PER_PARTITION = 8;
+constexpr uint64_t PARTITION_SAMPLE_SIZE = 64 * 1024;
+constexpr uint64_t MIN_PARTITION_SIZE = 64 * 1024;
+constexpr uint64_t MAX_PARTITION_SIZE = 64 * 1024 * 1024;
+}// namespace
+
 CSVSource::CSVSource(SchemaPtr schema,
                      Runtime::BufferManagerPtr bufferManager,
                      Runtime::QueryManagerPtr queryManager,
@@ -51,11 +64,21 @@ CSVSource::CSVSource(SchemaPtr schema,
                  std::move(successors)),
       fileEnded(false), csvSourceType(csvSourceType), filePath(csvSourceType->getFilePath()->getValue()),
       numberOfTuplesToProducePerBuffer(csvSourceType->getNumberOfTuplesToProducePerBuffer()->getValue()),
-      delimiter(csvSourceType->getDelimiter()->getValue()), skipHeader(csvSourceType->getSkipHeader()->getValue()) {
+      delimiter(csvSourceType->getDelimiter()->getValue()), skipHeader(csvSourceType->getSkipHeader()->getValue()),
+      numberOfReaderThreads(csvSourceType->getNumberOfReaderThreads()->getValue()) {
 
     this->numberOfBuffersToProduce = csvSourceType->getNumberOfBuffersToProduce()->getValue();
     this->gatheringInterval = std::chrono::milliseconds(csvSourceType->getGatheringInterval()->getValue());
     this->tupleSize = schema->getSchemaSizeInBytes();
+    std::vector<std::string> adaptiveValueFields;
+    auto configuredFields = csvSourceType->getAdaptiveValueFields()->getValue();
+    for (const auto& fieldName : Util::splitWithStringDelimiter<std::string>(configuredFields, ",")) {
+        adaptiveValueFields.emplace_back(Util::trim(fieldName));
+    }
+    if (!adaptiveValueFields.empty()) {
+        setAdaptiveValueFields(adaptiveValueFields);
+    }
+    setFusedGatheringGroup(csvSourceType->getFusedGatheringGroup()->getValue());
 
     struct Deleter {
         void operator()(const char* ptr) { std::free(const_cast<char*>(ptr)); }
@@ -65,18 +88,9 @@ CSVSource::CSVSource(SchemaPtr schema,
         x_THROW_RUNTIME_ERROR("Could not determine absolute pathname: " << filePath.c_str());
     }
 
-    input.open(path.get());
-    if (!(input.is_open() && input.good())) {
-        throw Exceptions::RuntimeException("Cannot open file: " + std::string(path.get()));
-    }
-
     x_DEBUG("CSVSource: Opening path {}", path.get());
-    input.seekg(0, std::ifstream::end);
-    if (auto const reportedFileSize = input.tellg(); reportedFileSize == -1) {
-        throw Exceptions::RuntimeException("CSVSource::CSVSource File " + filePath + " is corrupted");
-    } else {
-        this->fileSize = static_cast<decltype(this->fileSize)>(reportedFileSize);
-    }
+    mappedFile = Util::MappedFile::create(path.get());
+    this->fileSize = mappedFile->getSize();
 
     x_DEBUG("CSVSource: tupleSize={} freq={}ms numBuff={} numberOfTuplesToProducePerBuffer={}",
               this->tupleSize,
@@ -91,10 +105,43 @@ CSVSource::CSVSource(SchemaPtr schema,
     }
 
     this->inputParser = std::make_shared<CSVParser>(schema->getSize(), physicalTypes, delimiter);
+    if (delimiter.size() == 1 && delimiter[0] != '\n') {
+        tokenizer.emplace(delimiter[0]);
+        maxBlockSize = BLOCK_SIZE;
+    }
+    if (numberOfReaderThreads > 1) {
+        if (tokenizer.has_value()) {
+            computePartitions();
+        } else {
+            x_WARNING("CSVSource: cannot partition {} with the delimiter {}, it is parsed on the source thread",
+                        filePath,
+                        delimiter);
+        }
+    }
 }
 
 std::optional<Runtime::TupleBuffer> CSVSource::receiveData() {
     x_TRACE("CSVSource::receiveData called on  {}", operatorId);
+    if (!partitionOffsets.empty()) {
+        if (partitionedFileReader == nullptr) {
+            partitionedFileReader = std::make_unique<PartitionedFileReader>(
+                partitionOffsets.size() - 1,
+                numberOfReaderThreads,
+                [this](uint64_t partitionIndex, std::vector<Runtime::TupleBuffer>& buffers) {
+                    parsePartition(partitionIndex, buffers);
+                });
+            partitionedFileReader->start();
+        }
+        // the partitions are handed out in file order, so emitWorkFromSource assigns ordered sequence numbers
+        auto buffer = partitionedFileReader->next();
+        if (!buffer.has_value()) {
+            this->fileEnded = true;
+            return std::nullopt;
+        }
+        generatedTuples += buffer->getNumberOfTuples();
+        generatedBuffers++;
+        return buffer;
+    }
     auto buffer = allocateBuffer();
     fillBuffer(buffer);
     x_TRACE("CSVSource::receiveData filled buffer with tuples= {}", buffer.getNumberOfTuples());
@@ -105,6 +152,13 @@ std::optional<Runtime::TupleBuffer> CSVSource::receiveData() {
     return buffer.getBuffer();
 }
 
+void CSVSource::close() {
+    if (partitionedFileReader != nullptr) {
+        partitionedFileReader->stop();
+    }
+    DataSource::close();
+}
+
 std::string CSVSource::toString() const {
     std::stringstream ss;
     ss << "CSV_SOURCE(SCHEMA(" << schema->toString() << "), FILE=" << filePath << " freq=" << this->gatheringInterval.count()
@@ -120,8 +174,6 @@ void CSVSource::fillBuffer(Runtime::MemoryLayouts::DynamicTupleBuffer& buffer) {
         return;
     }
 
-    input.seekg(currentPositionInFile, std::ifstream::beg);
-
     uint64_t generatedTuplesThisPass = 0;
     //fill buffer maximally
     if (numberOfTuplesToProducePerBuffer == 0) {
@@ -132,40 +184,212 @@ void CSVSource::fillBuffer(Runtime::MemoryLayouts::DynamicTupleBuffer& buffer) {
     }
     x_TRACE("CSVSource::fillBuffer: fill buffer with #tuples={} of size={}", generatedTuplesThisPass, tupleSize);
 
-    std::string line;
+    auto tupleCount = tokenizer.has_value() ? fillBufferFromBlocks(buffer, generatedTuplesThisPass)
+                                            : fillBufferFromLines(buffer, generatedTuplesThisPass);
+
+    buffer.setNumberOfTuples(tupleCount);
+    generatedTuples += tupleCount;
+    generatedBuffers++;
+    x_TRACE("CSVSource::fillBuffer: reading finished read {} tuples at posInFile={}", tupleCount, currentPositionInFile);
+    x_TRACE("CSVSource::fillBuffer: read produced buffer=  {}", Util::printTupleBufferAsCSV(buffer.getBuffer(), schema));
+}
+
+uint64_t CSVSource::fillBufferFromLines(Runtime::MemoryLayouts::DynamicTupleBuffer& buffer, uint64_t numberOfTuples) {
+    const auto* data = mappedFile->getData();
+    // returns the length of the line that starts at currentPositionInFile, without its line feed
+    auto lineLength = [this, data]() -> uint64_t {
+        const auto* lineStart = data + currentPositionInFile;
+        const auto* lineFeed = static_cast<const char*>(memchr(lineStart, '\n', fileSize - currentPositionInFile));
+        return lineFeed == nullptr ? fileSize - currentPositionInFile : lineFeed - lineStart;
+    };
+
     uint64_t tupleCount = 0;
 
-    if (skipHeader && currentPositionInFile == 0) {
+    if (skipHeader && currentPositionInFile == 0 && fileSize > 0) {
         x_TRACE("CSVSource: Skipping header");
-        std::getline(input, line);
-        currentPositionInFile = input.tellg();
+        currentPositionInFile = lineLength() + 1;
     }
 
-    while (tupleCount < generatedTuplesThisPass) {
+    while (tupleCount < numberOfTuples) {
 
         //Check if EOF has reached
-        if (auto const tg = input.tellg(); (tg >= 0 && static_cast<uint64_t>(tg) >= fileSize) || tg == -1) {
-            x_TRACE("CSVSource::fillBuffer: reset tellg()={} fileSize={}", input.tellg(), fileSize);
-            input.clear();
+        if (currentPositionInFile >= fileSize) {
             x_TRACE("CSVSource::fillBuffer: break because file ended");
             this->fileEnded = true;
             break;
         }
 
-        std::getline(input, line);
+        mappedFile->willRead(currentPositionInFile);
+        auto length = lineLength();
+        std::string line(data + currentPositionInFile, length);
         x_TRACE("CSVSource line={} val={}", tupleCount, line);
-        // TODO: there will be a problem with non-printable characters (at least with null terminators). Check sources
 
         inputParser->writeInputTupleToTupleBuffer(line, tupleCount, buffer, schema, localBufferManager);
+        currentPositionInFile += length + 1;
         tupleCount++;
     }//end of while
 
-    currentPositionInFile = input.tellg();
-    buffer.setNumberOfTuples(tupleCount);
-    generatedTuples += tupleCount;
-    generatedBuffers++;
-    x_TRACE("CSVSource::fillBuffer: reading finished read {} tuples at posInFile={}", tupleCount, currentPositionInFile);
-    x_TRACE("CSVSource::fillBuffer: read produced buffer=  {}", Util::printTupleBufferAsCSV(buffer.getBuffer(), schema));
+    return tupleCount;
+}
+
+uint64_t CSVSource::fillBufferFromBlocks(Runtime::MemoryLayouts::DynamicTupleBuffer& buffer, uint64_t numberOfTuples) {
+    uint64_t tupleCount = 0;
+
+    if (skipHeader && currentPositionInFile == 0) {
+        x_TRACE("CSVSource: Skipping header");
+        if (auto lineEnd = findNextLineEnd()) {
+            currentPositionInFile = blockPositionInFile + (separators[*lineEnd] & ~CSVTokenizer::LINE_END) + 1;
+            nextSeparator = *lineEnd + 1;
+        }
+    }
+
+    while (tupleCount < numberOfTuples) {
+        auto lineEnd = findNextLineEnd();
+        if (!lineEnd.has_value()) {
+            x_TRACE("CSVSource::fillBuffer: break because file ended");
+            this->fileEnded = true;
+            break;
+        }
+
+        inputParser->writeTokenizedLineToTupleBuffer(mappedFile->getData() + blockPositionInFile,
+                                                     currentPositionInFile - blockPositionInFile,
+                                                     separators.data() + nextSeparator,
+                                                     *lineEnd - nextSeparator + 1,
+                                                     tupleCount,
+                                                     buffer,
+                                                     schema,
+                                                     localBufferManager);
+        currentPositionInFile = blockPositionInFile + (separators[*lineEnd] & ~CSVTokenizer::LINE_END) + 1;
+        nextSeparator = *lineEnd + 1;
+        tupleCount++;
+    }
+    return tupleCount;
+}
+
+std::optional<uint64_t> CSVSource::findNextLineEnd() {
+    while (currentPositionInFile < fileSize) {
+        if (currentPositionInFile >= blockPositionInFile && currentPositionInFile < blockPositionInFile + blockSize) {
+            for (auto i = nextSeparator; i < separators.size(); ++i) {
+                if (separators[i] & CSVTokenizer::LINE_END) {
+                    return i;
+                }
+            }
+        }
+        readBlock();
+    }
+    return std::nullopt;
+}
+
+void CSVSource::readBlock() {
+    if (blockPositionInFile == currentPositionInFile && blockSize == maxBlockSize) {
+        if (maxBlockSize * 2 > CSVTokenizer::MAX_BLOCK_SIZE) {
+            x_THROW_RUNTIME_ERROR("CSVSource: line at position " << currentPositionInFile << " of " << filePath
+                                                                 << " exceeds the maximum block size");
+        }
+        maxBlockSize *= 2;
+    }
+    blockPositionInFile = currentPositionInFile;
+    blockSize = std::min<uint64_t>(maxBlockSize, fileSize - currentPositionInFile);
+    separators.clear();
+    nextSeparator = 0;
+    mappedFile->willRead(blockPositionInFile);
+    const auto* block = mappedFile->getData() + blockPositionInFile;
+    tokenizer->tokenize(block, blockSize, separators);
+    if (blockPositionInFile + blockSize == fileSize && block[blockSize - 1] != '\n') {
+        // the last line of the file does not end with a line feed
+        separators.emplace_back(static_cast<uint32_t>(blockSize) | CSVTokenizer::LINE_END);
+    }
+    x_TRACE("CSVSource::readBlock: tokenized {} bytes at posInFile={}", blockSize, blockPositionInFile);
+}
+
+void CSVSource::computePartitions() {
+    const auto* data = mappedFile->getData();
+    uint64_t partitionStart = 0;
+    if (skipHeader && fileSize > 0) {
+        const auto* lineFeed = static_cast<const char*>(memchr(data, '\n', fileSize));
+        partitionStart = lineFeed == nullptr ? fileSize : lineFeed - data + 1;
+    }
+
+    // a partition should fill a few buffers, so that the partitions in flight hold a bounded number of buffers
+    auto sampleSize = std::min<uint64_t>(PARTITION_SAMPLE_SIZE, fileSize - partitionStart);
+    auto numberOfLines = static_cast<uint64_t>(std::count(data + partitionStart, data + partitionStart + sampleSize, '\n'));
+    auto averageLineLength = numberOfLines > 0 ? sampleSize / numberOfLines : sampleSize;
+    auto tuplesPerBuffer = numberOfTuplesToProducePerBuffer > 0 ? numberOfTuplesToProducePerBuffer : memoryLayout->getCapacity();
+    auto partitionSize =
+        std::clamp<uint64_t>(averageLineLength * tuplesPerBuffer * BUFFERS_PER_PARTITION, MIN_PARTITION_SIZE, MAX_PARTITION_SIZE);
+
+    partitionOffsets.emplace_back(partitionStart);
+    while (partitionStart < fileSize) {
+        // a partition ends after the line feed of the line that crosses its nominal end
+        auto partitionEnd = partitionStart + partitionSize;
+        if (partitionEnd >= fileSize) {
+            partitionEnd = fileSize;
+        } else {
+            const auto* lineFeed = static_cast<const char*>(memchr(data + partitionEnd - 1, '\n', fileSize - partitionEnd + 1));
+            partitionEnd = lineFeed == nullptr ? fileSize : lineFeed - data + 1;
+        }
+        partitionOffsets.emplace_back(partitionEnd);
+        partitionStart = partitionEnd;
+    }
+    x_DEBUG("CSVSource: split {} into {} partitions of about {} bytes for {} reader threads",
+              filePath,
+              partitionOffsets.size() - 1,
+              partitionSize,
+              numberOfReaderThreads);
+}
+
+void CSVSource::parsePartition(uint64_t partitionIndex, std::vector<Runtime::TupleBuffer>& buffers) const {
+    auto partitionStart = partitionOffsets[partitionIndex];
+    auto partitionSize = partitionOffsets[partitionIndex + 1] - partitionStart;
+    if (partitionSize > CSVTokenizer::MAX_BLOCK_SIZE) {
+        x_THROW_RUNTIME_ERROR("CSVSource: line at position " << partitionStart << " of " << filePath
+                                                             << " exceeds the maximum block size");
+    }
+    const auto* partition = mappedFile->getData() + partitionStart;
+    std::vector<uint32_t> partitionSeparators;
+    tokenizer->tokenize(partition, partitionSize, partitionSeparators);
+    if (partition[partitionSize - 1] != '\n') {
+        // the last line of the file does not end with a line feed
+        partitionSeparators.emplace_back(static_cast<uint32_t>(partitionSize) | CSVTokenizer::LINE_END);
+    }
+
+    // every partition gets its own parser, as the parser caches the field offsets of the layout
+    CSVParser parser(schema->getSize(), physicalTypes, delimiter);
+    auto tuplesPerBuffer = numberOfTuplesToProducePerBuffer > 0 ? numberOfTuplesToProducePerBuffer : memoryLayout->getCapacity();
+    std::optional<Runtime::MemoryLayouts::DynamicTupleBuffer> buffer;
+    uint64_t tupleCount = 0;
+    uint64_t lineStart = 0;
+    uint64_t firstSeparator = 0;
+    for (uint64_t i = 0; i < partitionSeparators.size(); ++i) {
+        if (!(partitionSeparators[i] & CSVTokenizer::LINE_END)) {
+            continue;
+        }
+        if (!buffer.has_value()) {
+            // the readers allocate from the global buffer manager, the local buffer pool belongs to the source thread
+            buffer.emplace(memoryLayout, localBufferManager->getBufferBlocking());
+            tupleCount = 0;
+        }
+        parser.writeTokenizedLineToTupleBuffer(partition,
+                                               lineStart,
+                                               partitionSeparators.data() + firstSeparator,
+                                               i - firstSeparator + 1,
+                                               tupleCount,
+                                               *buffer,
+                                               schema,
+                                               localBufferManager);
+        lineStart = (partitionSeparators[i] & ~CSVTokenizer::LINE_END) + 1;
+        firstSeparator = i + 1;
+        if (++tupleCount == tuplesPerBuffer) {
+            buffer->setNumberOfTuples(tupleCount);
+            buffers.emplace_back(buffer->getBuffer());
+            buffer.reset();
+        }
+    }
+    if (buffer.has_value()) {
+        buffer->setNumberOfTuples(tupleCount);
+        buffers.emplace_back(buffer->getBuffer());
+    }
+    x_TRACE("CSVSource::parsePartition: parsed partition {} into {} buffers", partitionIndex, buffers.size());
 }
 
 SourceType CSVSource::getType() const { return SourceType::CSV_SOURCE; }
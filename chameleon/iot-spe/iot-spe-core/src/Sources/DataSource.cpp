@@ -15,25 +15,32 @@
 #include <Runtime/Execution/ExecutablePipelixtage.hpp>
 #include <Runtime/Execution/PipelineExecutionContext.hpp>
 #include <Runtime/FixedSizeBufferPool.hpp>
+#include <Runtime/FusedGatheringGroup.hpp>
+#include <Runtime/GatheringIntervalCollector.hpp>
 #include <Runtime/MemoryLayout/ColumnLayout.hpp>
 #include <Runtime/MemoryLayout/DynamicTupleBuffer.hpp>
+#include <Runtime/MemoryLayout/FieldValueReader.hpp>
 #include <Runtime/MemoryLayout/RowLayout.hpp>
 #include <Runtime/QueryManager.hpp>
-#include <Sensors/Values/SingleSensor.hpp>
+#include <Runtime/SourceExecutor.hpp>
 #include <Sinks/Mediums/SinkMedium.hpp>
 #include <Sources/DataSource.hpp>
 #include <Sources/ZmqSource.hpp>
 #include <Util/Common.hpp>
 #include <Util/Core.hpp>
+#include <Util/FixedSizeKalmanFilter.hpp>
 #include <Util/KalmanFilter.hpp>
 #include <Util/Logger/Logger.hpp>
+#include <Util/RatePacer.hpp>
 #include <Util/ThreadNaming.hpp>
 #include <chrono>
+#include <cstring>
 #include <filesystem>
 #include <functional>
 #include <future>
 #include <iostream>
 #include <thread>
+#include <tuple>
 
 #ifdef x_USE_ONE_QUEUE_PER_NUMA_NODE
 #if defined(__linux__)
@@ -70,8 +77,8 @@ DataSource::DataSource(SchemaPtr pSchema,
     : Runtime::Reconfigurable(), DataEmitter(), queryManager(std::move(queryManager)),
       localBufferManager(std::move(bufferManager)), executableSuccessors(std::move(executableSuccessors)), operatorId(operatorId),
       originId(originId), schema(std::move(pSchema)), numSourceLocalBuffers(numSourceLocalBuffers), gatheringMode(gatheringMode),
-      sourceAffinity(sourceAffinity), taskQueueId(taskQueueId), physicalSourceName(physicalSourceName), kFilter(std::make_unique<KalmanFilter>()),
-      lastValuesBuf(lastValuesSize), lastIntervalBuf(lastValuesSize) {
+      sourceAffinity(sourceAffinity), taskQueueId(taskQueueId), physicalSourceName(physicalSourceName), kFilter(std::make_unique<FixedSizeKalmanFilter<3, 1>>()),
+      lastValuesSpectrum(lastValuesSize), lastIntervalBuf(lastValuesSize) {
     this->kFilter->init();
     x_DEBUG("DataSource  {} : Init Data Source with schema  {}", operatorId, schema->toString());
     x_ASSERT(this->localBufferManager, "Invalid buffer manager");
@@ -85,6 +92,128 @@ DataSource::DataSource(SchemaPtr pSchema,
     } else if (schema->getLayoutType() == Schema::MemoryLayoutType::COLUMNAR_LAYOUT) {
         memoryLayout = Runtime::MemoryLayouts::ColumnLayout::create(schema, localBufferManager->getBufferSize());
     }
+    setAdaptiveValueFields({});
+}
+
+void DataSource::setAdaptiveValueFields(const std::vector<std::string>& fieldNames) {
+    using Runtime::MemoryLayouts::FieldValueReader;
+    auto valueFieldNames = fieldNames;
+    if (valueFieldNames.empty()) {
+        // the value field of Sensors::SingleSensor, which the adaptive modes assumed before
+        auto valueFieldIndex = FieldValueReader::findFieldIndex(memoryLayout, "value");
+        auto& physicalTypes = memoryLayout->getPhysicalTypes();
+        if (!valueFieldIndex.has_value() || !FieldValueReader::isNumeric(physicalTypes[valueFieldIndex.value()])) {
+            auto numericField = std::find_if(physicalTypes.begin(), physicalTypes.end(), FieldValueReader::isNumeric);
+            valueFieldIndex = numericField == physicalTypes.end()
+                ? std::nullopt
+                : std::optional<uint64_t>(std::distance(physicalTypes.begin(), numericField));
+        }
+        if (!valueFieldIndex.has_value()) {
+            x_DEBUG("DataSource {}: schema has no numeric field, the adaptive modes keep the gathering interval", operatorId);
+            adaptiveValueReader.reset();
+            return;
+        }
+        valueFieldNames.emplace_back(schema->fields[valueFieldIndex.value()]->getName());
+    }
+    adaptiveValueReader = std::make_unique<FieldValueReader>(memoryLayout, valueFieldNames);
+
+    auto numberOfFields = adaptiveValueReader->getNumberOfFields();
+    if (numberOfFields != kFilter->getMeasurementSize()) {
+        if (numberOfFields == 1) {
+            kFilter = std::make_unique<FixedSizeKalmanFilter<3, 1>>();
+            kFilter->init();
+        } else {
+            kFilter = KalmanFilter::createRandomWalk(numberOfFields);
+        }
+    }
+    x_DEBUG("DataSource {}: adaptive modes use {} field(s), starting with {}",
+            operatorId,
+            numberOfFields,
+            adaptiveValueReader->getFieldNames()[0]);
+}
+
+void DataSource::setFusedGatheringGroup(const std::string& groupName) { fusedGatheringGroupName = groupName; }
+
+void DataSource::joinFusedGatheringGroup() {
+    if (gatheringMode != GatheringMode::FUSED_ADAPTIVE_MODE || fusedGatheringGroup) {
+        return;
+    }
+    if (fusedGatheringGroupName.empty() || !adaptiveValueReader) {
+        x_WARNING("DataSource {}: fused adaptive mode without a group or numeric fields, the source adapts its interval on its own",
+                  operatorId);
+        return;
+    }
+    std::tie(fusedGatheringGroup, fusedGatheringGroupMemberId) =
+        queryManager->joinFusedGatheringGroup(fusedGatheringGroupName, adaptiveValueReader->getNumberOfFields(), gatheringInterval);
+    x_DEBUG("DataSource {}: joined fused gathering group {} as member {}",
+            operatorId,
+            fusedGatheringGroupName,
+            fusedGatheringGroupMemberId);
+}
+
+void DataSource::leaveFusedGatheringGroup() {
+    if (fusedGatheringGroup) {
+        queryManager->leaveFusedGatheringGroup(fusedGatheringGroup, fusedGatheringGroupMemberId);
+        fusedGatheringGroup.reset();
+    }
+}
+
+void DataSource::setGatheringPolicy(const GatheringPolicy& policy) {
+    x_DEBUG("DataSource {}: received {}", operatorId, policy.toString());
+    std::unique_lock lock(gatheringPolicyMutex);
+    gatheringPolicy.merge(policy);
+    pendingGatheringPolicy.merge(policy);
+    gatheringPolicyChanged = true;
+}
+
+void DataSource::initAdaptiveGathering() {
+    this->kFilter->setGatheringInterval(this->gatheringInterval);
+    this->kFilter->setGatheringIntervalRange(std::chrono::milliseconds{8000});
+    // policies that arrived before the source started are applied on top of the defaults
+    std::unique_lock lock(gatheringPolicyMutex);
+    pendingGatheringPolicy = gatheringPolicy;
+    gatheringPolicyChanged = !gatheringPolicy.empty();
+}
+
+void DataSource::applyGatheringPolicy() {
+    if (!gatheringPolicyChanged.exchange(false)) {
+        return;
+    }
+    GatheringPolicy policy;
+    {
+        std::unique_lock lock(gatheringPolicyMutex);
+        std::swap(policy, pendingGatheringPolicy);
+    }
+    x_DEBUG("DataSource {}: apply {}", operatorId, policy.toString());
+    if (policy.slowestInterval) {
+        policySlowestInterval = policy.slowestInterval;
+    }
+    if (fusedGatheringGroup) {
+        // the group owns the filter, a member can only bound the slowest interval of the group
+        if (policy.slowestInterval) {
+            fusedGatheringGroup->setSlowestInterval(fusedGatheringGroupMemberId, policy.slowestInterval.value());
+        }
+        return;
+    }
+    policy.applyTo(*kFilter);
+    if (policy.gatheringInterval && policy.gatheringInterval.value() != gatheringInterval) {
+        gatheringInterval = policy.gatheringInterval.value();
+        onGatheringIntervalChange(gatheringInterval);
+        recordGatheringInterval();
+    }
+}
+
+void DataSource::recordGatheringInterval() {
+    if (!queryManager) {
+        return;
+    }
+    auto now = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch());
+    queryManager->getGatheringIntervalCollector().record(
+        Runtime::GatheringIntervalSample{physicalSourceName,
+                                         operatorId,
+                                         static_cast<uint64_t>(now.count()),
+                                         gatheringInterval,
+                                         fusedGatheringGroup ? 0.0 : kFilter->getEstimationError()});
 }
 
 void DataSource::emitWorkFromSource(Runtime::TupleBuffer& buffer) {
@@ -137,6 +266,18 @@ bool DataSource::start() {
         return false;
     } else {
         type = getType();
+        if (auto executor = queryManager->getSourceExecutor(); executor && supportsSourceExecutor()) {
+            auto expected = false;
+            if (wasStarted.compare_exchange_strong(expected, true)) {
+                x_DEBUG("DataSource {}: Register at source executor", operatorId);
+                if (sourceAffinity != std::numeric_limits<uint64_t>::max()) {
+                    x_WARNING("DataSource {}: source affinity is ignored by the source executor", operatorId);
+                }
+                sourceExecutor = executor;
+                sourceExecutor->registerSource(shared_from_base<DataSource>());
+            }
+            return true;
+        }
         x_DEBUG("DataSource {}: Spawn thread", operatorId);
         auto expected = false;
         if (wasStarted.compare_exchange_strong(expected, true)) {
@@ -206,9 +347,11 @@ bool waitForFuture(std::future<bool>&& future, std::chrono::duration<R, P>&& dea
 bool DataSource::stop(Runtime::QueryTerminationType graceful) {
     using namespace std::chrono_literals;
     // Do not call stop from the runningRoutine!
+    Runtime::SourceExecutorPtr executor;
     {
         std::unique_lock lock(startStopMutex);// this mutex guards the thread variable
         wasGracefullyStopped = graceful;
+        executor = sourceExecutor;
     }
 
     refCounter++;
@@ -236,6 +379,10 @@ bool DataSource::stop(Runtime::QueryTerminationType graceful) {
             return true;// it's ok to return true because the source is stopped
         } else {
             x_DEBUG("DataSource {} was running, retrieving future now...", operatorId);
+            if (executor) {
+                // run the last iteration now instead of after the gathering interval
+                executor->wakeUp(this);
+            }
             auto expected = false;
             x_ASSERT2_FMT(wasStarted && futureRetrieved.compare_exchange_strong(expected, true)
                                 && detail::waitForFuture(completedPromise.get_future(), 10min),
@@ -266,6 +413,8 @@ bool DataSource::stop(Runtime::QueryTerminationType graceful) {
 
 void DataSource::setGatheringInterval(std::chrono::milliseconds interval) { this->gatheringInterval = interval; }
 
+void DataSource::onGatheringIntervalChange(std::chrono::milliseconds) {}
+
 void DataSource::open() { bufferManager = localBufferManager->createFixedSizeBufferPool(numSourceLocalBuffers); }
 
 void DataSource::close() {
@@ -293,32 +442,97 @@ void DataSource::runningRoutine() {
             runningRoutineWithGatheringInterval();
         } else if (gatheringMode == GatheringMode::INGESTION_RATE_MODE) {
             runningRoutineWithIngestionRate();
+        } else if (gatheringMode == GatheringMode::REPLAY_MODE) {
+            runningRoutineWithReplay();
         } else if (gatheringMode == GatheringMode::ADAPTIVE_MODE) {
             runningRoutineAdaptiveGatheringInterval();
         } else if (gatheringMode == GatheringMode::ADAPTIVE_MODE_OVERSAMPLER) {
             runningRoutineAdaptiveGatheringIntervalOversampler();
+        } else if (gatheringMode == GatheringMode::FUSED_ADAPTIVE_MODE) {
+            joinFusedGatheringGroup();
+            runningRoutineAdaptiveGatheringInterval();
+            leaveFusedGatheringGroup();
         }
         completedPromise.set_value(true);
+    } catch (...) {
+        failRunningRoutine(std::current_exception());
+    }
+    x_DEBUG("DataSource {} end runningRoutine", operatorId);
+}
+
+void DataSource::failRunningRoutine(std::exception_ptr expPtr) {
+    if (!expPtr) {
+        return;
+    }
+    leaveFusedGatheringGroup();
+    try {
+        std::rethrow_exception(expPtr);
     } catch (std::exception const& exception) {
         queryManager->notifySourceFailure(shared_from_base<DataSource>(), exception.what());
-        completedPromise.set_exception(std::make_exception_ptr(exception));
+        completedPromise.set_exception(expPtr);
     } catch (...) {
-        try {
-            auto expPtr = std::current_exception();
-            if (expPtr) {
-                completedPromise.set_exception(expPtr);
-                std::rethrow_exception(expPtr);
+        x_ERROR("DataSource {}: running routine failed with an unknown exception", operatorId);
+        completedPromise.set_exception(expPtr);
+    }
+}
+
+bool DataSource::supportsSourceExecutor() const {
+    // the ingestion rate and replay modes pace every buffer and need a thread of their own
+    return gatheringMode != GatheringMode::INGESTION_RATE_MODE && gatheringMode != GatheringMode::REPLAY_MODE;
+}
+
+int DataSource::getReadinessFileDescriptor() const { return -1; }
+
+std::optional<std::chrono::milliseconds> DataSource::runningRoutineIteration() {
+    try {
+        if (!openedBySourceExecutor) {
+            x_ASSERT(this->operatorId != 0, "The id of the source is not set properly");
+            x_DEBUG("DataSource {}: Running Data Source of type={} interval={} on the source executor",
+                      operatorId,
+                      magic_enum::enum_name(getType()),
+                      gatheringInterval.count());
+            if (gatheringMode == GatheringMode::ADAPTIVE_MODE || gatheringMode == GatheringMode::ADAPTIVE_MODE_OVERSAMPLER
+                || gatheringMode == GatheringMode::FUSED_ADAPTIVE_MODE) {
+                initAdaptiveGathering();
             }
-        } catch (std::exception const& exception) {
-            queryManager->notifySourceFailure(shared_from_base<DataSource>(), exception.what());
+            joinFusedGatheringGroup();
+            open();
+            openedBySourceExecutor = true;
         }
+
+        if (running) {
+            if (gatheringMode == GatheringMode::INTERVAL_MODE) {
+                gatheringIntervalIteration();
+            } else if (gatheringMode == GatheringMode::ADAPTIVE_MODE || gatheringMode == GatheringMode::FUSED_ADAPTIVE_MODE) {
+                adaptiveGatheringIntervalIteration(true);
+            } else if (gatheringMode == GatheringMode::ADAPTIVE_MODE_OVERSAMPLER) {
+                adaptiveGatheringIntervalIteration(false);
+            } else {
+                x_THROW_RUNTIME_ERROR("DataSource " << operatorId << ": gathering mode is not supported by the source executor");
+            }
+        }
+
+        if (running) {
+            // the dedicated source thread does not sleep on the gathering interval between iterations, so the source is
+            // rescheduled right away as well, behind the other ready sources or until its readiness file descriptor fires
+            return std::chrono::milliseconds(0);
+        }
+
+        x_DEBUG("DataSource {} call close", operatorId);
+        close();
+        leaveFusedGatheringGroup();
+        completedPromise.set_value(true);
+    } catch (...) {
+        running = false;
+        failRunningRoutine(std::current_exception());
     }
-    x_DEBUG("DataSource {} end runningRoutine", operatorId);
+    x_DEBUG("DataSource {} end runningRoutine on the source executor", operatorId);
+    return std::nullopt;
 }
 
 void DataSource::runningRoutineWithIngestionRate() {
     x_ASSERT(this->operatorId != 0, "The id of the source is not set properly");
-    x_ASSERT(gatheringIngestionRate >= 10, "As we generate on 100 ms base we need at least an ingestion rate of 10");
+    x_ASSERT(gatheringIngestionRate > 0, "The ingestion rate mode needs an ingestion rate greater than zero");
     std::string thName = "DataSrc-" + std::to_string(operatorId);
     setThreadName(thName.c_str());
 
@@ -335,77 +549,101 @@ void DataSource::runningRoutineWithIngestionRate() {
     }
     open();
 
-    uint64_t nextPeriodStartTime = 0;
-    uint64_t curPeriod = 0;
+    // every buffer gets its own slot in an absolute schedule, so the rate neither drifts nor bursts per period
+    Util::RatePacer pacer(static_cast<double>(gatheringIngestionRate));
     uint64_t processedOverallBufferCnt = 0;
-    uint64_t buffersToProducePer100Ms = gatheringIngestionRate / 10;
+    while (running && (processedOverallBufferCnt < numberOfBuffersToProduce || numberOfBuffersToProduce == 0)) {
+        pacer.waitForNextEvent();
+        auto optBuf = receiveData();
+        if (!optBuf.has_value()) {
+            x_ERROR("DataSource: Buffer is invalid");
+            running = false;
+            break;
+        }
+        x_TRACE("DataSource: add task for buffer");
+        emitWorkFromSource(optBuf.value());
+        processedOverallBufferCnt++;
+    }
+    reportIngestionRate(pacer);
+
+    // like the interval mode, the source stays alive until it is stopped
     while (running) {
-        //create as many tuples as requested and then sleep
-        auto startPeriod =
-            std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
-        uint64_t buffersProcessedCnt = 0;
-
-        //produce buffers until limit for this second or for all perionds is reached or source is topped
-        while (buffersProcessedCnt < buffersToProducePer100Ms && running
-               && (processedOverallBufferCnt < numberOfBuffersToProduce || numberOfBuffersToProduce == 0)) {
-            auto optBuf = receiveData();
-
-            if (optBuf.has_value()) {
-                // here we got a valid buffer
-                x_TRACE("DataSource: add task for buffer");
-                auto& buf = optBuf.value();
-                emitWorkFromSource(buf);
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+    x_DEBUG("DataSource {} call close", operatorId);
+    close();
+    x_DEBUG("DataSource {} end running", operatorId);
+}
 
-                buffersProcessedCnt++;
-                processedOverallBufferCnt++;
-            } else {
-                x_ERROR("DataSource: Buffer is invalid");
-                running = false;
-            }
-            x_TRACE("DataSource: buffersProcessedCnt={} buffersPerSecond={}", buffersProcessedCnt, gatheringIngestionRate);
-        }
+void DataSource::runningRoutineWithReplay() {
+    x_ASSERT(this->operatorId != 0, "The id of the source is not set properly");
+    x_ASSERT(gatheringIngestionRate > 0, "The replay mode needs an ingestion rate greater than zero");
+    std::string thName = "DataSrc-" + std::to_string(operatorId);
+    setThreadName(thName.c_str());
 
-        uint64_t endPeriod =
-            std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
-
-        //next point in time when to start producing again
-        nextPeriodStartTime = uint64_t(startPeriod + (100));
-        x_TRACE("DataSource: startTimeSendBuffers={} endTimeSendBuffers={} nextPeriodStartTime={}",
-                  startPeriod,
-                  endPeriod,
-                  nextPeriodStartTime);
-
-        //If this happens then the second was not enough to create so many tuples and the ingestion rate should be decreased
-        if (nextPeriodStartTime < endPeriod) {
-            x_ERROR(
-                "Creating buffer(s) for DataSource took longer than periodLength. nextPeriodStartTime={} endTimeSendBuffers={}",
-                nextPeriodStartTime,
-                endPeriod);
-        }
+    x_DEBUG("DataSource {} Running Data Source of type={} in replay mode with ingestion rate={}",
+              operatorId,
+              magic_enum::enum_name(getType()),
+              gatheringIngestionRate);
+    open();
 
-        uint64_t sleepCnt = 0;
-        uint64_t curTime =
-            std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
-        //wait until the next period starts
-        while (curTime < nextPeriodStartTime) {
-            curTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch())
-                          .count();
+    // generate the data up front, so that the emission loop only copies and emits buffers
+    auto numberOfBuffersToGenerate = numSourceLocalBuffers;
+    if (numberOfBuffersToProduce > 0) {
+        numberOfBuffersToGenerate = std::min(numberOfBuffersToGenerate, numberOfBuffersToProduce);
+    }
+    std::vector<Runtime::TupleBuffer> replayBuffers;
+    replayBuffers.reserve(numberOfBuffersToGenerate);
+    while (running && replayBuffers.size() < numberOfBuffersToGenerate) {
+        auto optBuf = receiveData();
+        if (!optBuf.has_value()) {
+            break;
+        }
+        auto& buffer = optBuf.value();
+        if (buffer.getNumberOfChildrenBuffer() > 0) {
+            x_THROW_RUNTIME_ERROR("DataSource " << operatorId << ": the replay mode does not support buffers with child buffers");
         }
-        x_DEBUG("DataSource: Done with period {} and overall buffers={} sleepCnt={} startPeriod={} endPeriod={} "
-                  "nextPeriodStartTime={} curTime={}",
-                  curPeriod++,
-                  processedOverallBufferCnt,
-                  sleepCnt,
-                  startPeriod,
-                  endPeriod,
-                  nextPeriodStartTime,
-                  curTime);
-    }//end of while
+        auto replayBuffer = localBufferManager->getUnpooledBuffer(buffer.getBufferSize()).value();
+        std::memcpy(replayBuffer.getBuffer(), buffer.getBuffer(), buffer.getBufferSize());
+        replayBuffer.setNumberOfTuples(buffer.getNumberOfTuples());
+        replayBuffers.emplace_back(std::move(replayBuffer));
+    }
+    x_DEBUG("DataSource {}: generated {} buffers for replay", operatorId, replayBuffers.size());
+    generatedTuples = 0;
+    generatedBuffers = 0;
+
+    Util::RatePacer pacer(static_cast<double>(gatheringIngestionRate));
+    while (running && !replayBuffers.empty()
+           && (generatedBuffers < numberOfBuffersToProduce || numberOfBuffersToProduce == 0)) {
+        auto& replayBuffer = replayBuffers[generatedBuffers % replayBuffers.size()];
+        auto buffer = bufferManager->getBufferBlocking();
+        std::memcpy(buffer.getBuffer(), replayBuffer.getBuffer(), std::min(buffer.getBufferSize(), replayBuffer.getBufferSize()));
+        buffer.setNumberOfTuples(replayBuffer.getNumberOfTuples());
+        pacer.waitForNextEvent();
+        emitWorkFromSource(buffer);
+        generatedTuples += replayBuffer.getNumberOfTuples();
+        generatedBuffers++;
+    }
+    reportIngestionRate(pacer);
+
+    while (running) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
     x_DEBUG("DataSource {} call close", operatorId);
     close();
     x_DEBUG("DataSource {} end running", operatorId);
 }
 
+void DataSource::reportIngestionRate(const Util::RatePacer& pacer) {
+    achievedIngestionRate = pacer.getAchievedRate();
+    x_INFO("DataSource {}: emitted {} buffers at {} buffers/s for a target of {} buffers/s, the schedule was restarted {} times",
+             operatorId,
+             pacer.getNumberOfEvents(),
+             pacer.getAchievedRate(),
+             pacer.getTargetRate(),
+             pacer.getNumberOfRestarts());
+}
+
 void DataSource::runningRoutineWithGatheringInterval() {
     x_ASSERT(this->operatorId != 0, "The id of the source is not set properly");
     std::string thName = "DataSrc-" + std::to_string(operatorId);
@@ -422,49 +660,8 @@ void DataSource::runningRoutineWithGatheringInterval() {
         x_DEBUG("DataSource: the user specify to produce {} buffers", numberOfBuffersToProduce);
     }
     open();
-    uint64_t numberOfBuffersProduced = 0;
     while (running) {
-        //check if already produced enough buffer
-        if (numberOfBuffersToProduce == 0 || numberOfBuffersProduced < numberOfBuffersToProduce) {
-            auto optBuf = receiveData();// note that receiveData might block
-            if (!running) {             // necessary if source stops while receiveData is called due to stricter shutdown logic
-                break;
-            }
-            //this checks we received a valid output buffer
-            if (optBuf.has_value()) {
-                auto& buf = optBuf.value();
-                x_TRACE("DataSource produced buffer {} type= {} string={}: Received Data: {} tuples iteration= {} "
-                          "operatorId={} orgID={}",
-                          operatorId,
-                          magic_enum::enum_name(getType()),
-                          toString(),
-                          buf.getNumberOfTuples(),
-                          numberOfBuffersProduced,
-                          this->operatorId,
-                          this->operatorId);
-
-                if (Logger::getInstance()->getCurrentLogLevel() == LogLevel::LOG_TRACE) {
-                    auto layout = Runtime::MemoryLayouts::RowLayout::create(schema, buf.getBufferSize());
-                    auto buffer = Runtime::MemoryLayouts::DynamicTupleBuffer(layout, buf);
-                    x_TRACE("DataSource produced buffer content={}", buffer.toString(schema));
-                }
-
-                emitWorkFromSource(buf);
-                ++numberOfBuffersProduced;
-            } else {
-                x_DEBUG("DataSource {}: stopping cause of invalid buffer", operatorId);
-                running = false;
-                x_DEBUG("DataSource {}: Thread going to terminating with graceful exit.", operatorId);
-            }
-        } else {
-            x_DEBUG("DataSource {}: Receiving thread terminated ... stopping because cnt={} smaller than "
-                      "numBuffersToProcess={} now return",
-                      operatorId,
-                      numberOfBuffersProduced,
-                      numberOfBuffersToProduce);
-            running = false;
-        }
-        x_TRACE("DataSource {} : Data Source finished processing iteration {}", operatorId, numberOfBuffersProduced);
+        gatheringIntervalIteration();
 
         // this checks if the interval is zero or a ZMQ_Source, we don't create a watermark-only buffer
         if (getType() != SourceType::ZMQ_SOURCE && gatheringInterval.count() > 0) {
@@ -477,6 +674,50 @@ void DataSource::runningRoutineWithGatheringInterval() {
     x_DEBUG("DataSource {} end running", operatorId);
 }
 
+void DataSource::gatheringIntervalIteration() {
+    //check if already produced enough buffer
+    if (numberOfBuffersToProduce == 0 || numberOfBuffersProduced < numberOfBuffersToProduce) {
+        auto optBuf = receiveData();// note that receiveData might block
+        if (!running) {             // necessary if source stops while receiveData is called due to stricter shutdown logic
+            return;
+        }
+        //this checks we received a valid output buffer
+        if (optBuf.has_value()) {
+            auto& buf = optBuf.value();
+            x_TRACE("DataSource produced buffer {} type= {} string={}: Received Data: {} tuples iteration= {} "
+                      "operatorId={} orgID={}",
+                      operatorId,
+                      magic_enum::enum_name(getType()),
+                      toString(),
+                      buf.getNumberOfTuples(),
+                      numberOfBuffersProduced,
+                      this->operatorId,
+                      this->operatorId);
+
+            if (Logger::getInstance()->getCurrentLogLevel() == LogLevel::LOG_TRACE) {
+                auto layout = Runtime::MemoryLayouts::RowLayout::create(schema, buf.getBufferSize());
+                auto buffer = Runtime::MemoryLayouts::DynamicTupleBuffer(layout, buf);
+                x_TRACE("DataSource produced buffer content={}", buffer.toString(schema));
+            }
+
+            emitWorkFromSource(buf);
+            ++numberOfBuffersProduced;
+        } else {
+            x_DEBUG("DataSource {}: stopping cause of invalid buffer", operatorId);
+            running = false;
+            x_DEBUG("DataSource {}: Thread going to terminating with graceful exit.", operatorId);
+        }
+    } else {
+        x_DEBUG("DataSource {}: Receiving thread terminated ... stopping because cnt={} smaller than "
+                  "numBuffersToProcess={} now return",
+                  operatorId,
+                  numberOfBuffersProduced,
+                  numberOfBuffersToProduce);
+        running = false;
+    }
+    x_TRACE("DataSource {} : Data Source finished processing iteration {}", operatorId, numberOfBuffersProduced);
+}
+
 void DataSource::runningRoutineAdaptiveGatheringInterval() {
     x_ASSERT(this->operatorId != 0, "The id of the source is not set properly");
     std::string thName = "DataSrc-" + std::to_string(operatorId);
@@ -494,55 +735,12 @@ void DataSource::runningRoutineAdaptiveGatheringInterval() {
         x_TRACE("DataSource: the user specify to produce {} buffers", numberOfBuffersToProduce);
     }
 
-    this->kFilter->setGatheringInterval(this->gatheringInterval);
-    this->kFilter->setGatheringIntervalRange(std::chrono::milliseconds{8000});
+    initAdaptiveGathering();
 
     open();
-    uint64_t numberOfBuffersProduced = 0;
     while (running) {
-        //check if already produced enough buffer
-        if (numberOfBuffersToProduce == 0 || numberOfBuffersProduced < numberOfBuffersToProduce) {
-            auto optBuf = receiveData();// note that receiveData might block
-            if (!running) {             // necessary if source stops while receiveData is called due to stricter shutdown logic
-                break;
-            }
-
-            //this checks we received a valid output buffer
-            if (optBuf.has_value()) {
-                auto& buf = optBuf.value();
-                auto numOfTuples = buf.getNumberOfTuples();
-                auto records = buf.getBuffer<Sensors::SingleSensor>();
-                double currentIntervalInSeconds = this->gatheringInterval.count() / 1000.;
-                for (uint64_t i = 0; i < numOfTuples; ++i) {
-                    this->lastValuesBuf.emplace(records[i].value);
-                    this->lastIntervalBuf.emplace(currentIntervalInSeconds);
-                }
-
-                // use a vector, find mean interval at the same time
-                double totalIntervalInseconds = 0;
-                for (uint64_t idx=0; idx < this->lastValuesBuf.size(); ++idx) {
-                    totalIntervalInseconds += this->lastIntervalBuf.at(idx);
-                }
-                totalIntervalInseconds /= this->lastValuesBuf.size();
-                double skewedIntervalInseconds = (totalIntervalInseconds + currentIntervalInSeconds) / 2.;
+        adaptiveGatheringIntervalIteration(true);
 
-                std::tuple<bool, double> res = x::Util::computeNyquistAndEnergy(this->lastValuesBuf.toVector(), skewedIntervalInseconds);
-                if (std::get<0>(res)) { // nyq rate is smaller than current skewed median interval
-                    this->kFilter->setSlowestInterval(std::move(std::chrono::milliseconds(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::duration<double>(std::get<1>(res))))));
-                }
-
-                this->kFilter->updateFromTupleBuffer(buf);
-                this->gatheringInterval = this->kFilter->getNewGatheringInterval();
-
-                 emitWorkFromSource(buf);
-                ++numberOfBuffersProduced;
-            } else {
-                x_ERROR("DataSource {}: stopping cause of invalid buffer", operatorId);
-                running = false;
-            }
-        } else {
-            running = false;
-        }
         // this checks if the interval is zero or a ZMQ_Source, we don't create a watermark-only buffer
         if (getType() != SourceType::ZMQ_SOURCE && gatheringInterval.count() > 0) {
             x_TRACE("DataSource {} sleeping on interval {}", operatorId, gatheringInterval.count());
@@ -570,62 +768,98 @@ void DataSource::runningRoutineAdaptiveGatheringIntervalOversampler() {
         x_TRACE("DataSource: the user specify to produce {} buffers", numberOfBuffersToProduce);
     }
 
-    this->kFilter->setGatheringInterval(this->gatheringInterval);
-    this->kFilter->setGatheringIntervalRange(std::chrono::milliseconds{8000});
+    initAdaptiveGathering();
 
     open();
-    uint64_t numberOfBuffersProduced = 0;
     while (running) {
-        //check if already produced enough buffer
-        if (numberOfBuffersToProduce == 0 || numberOfBuffersProduced < numberOfBuffersToProduce) {
-            auto optBuf = receiveData();// note that receiveData might block
-            if (!running) {             // necessary if source stops while receiveData is called due to stricter shutdown logic
-                break;
-            }
-
-            //this checks we received a valid output buffer
-            if (optBuf.has_value()) {
-                auto& buf = optBuf.value();
-                auto numOfTuples = buf.getNumberOfTuples();
-                auto records = buf.getBuffer<Sensors::SingleSensor>();
-                double currentIntervalInSeconds = this->gatheringInterval.count() / 1000.;
-                for (uint64_t i = 0; i < numOfTuples; ++i) {
-                    this->lastValuesBuf.emplace(records[i].value);
-                    this->lastIntervalBuf.emplace(currentIntervalInSeconds);
-                }
+        adaptiveGatheringIntervalIteration(false);
 
-                // use a vector, find mean interval at the same time
-                double totalIntervalInseconds = 0;
-                for (uint64_t idx=0; idx < this->lastValuesBuf.size(); ++idx) {
-                    totalIntervalInseconds += this->lastIntervalBuf.at(idx);
-                }
-                totalIntervalInseconds /= this->lastValuesBuf.size();
-                double skewedIntervalInseconds = (totalIntervalInseconds + currentIntervalInSeconds) / 2.;
+        // this checks if the interval is zero or a ZMQ_Source, we don't create a watermark-only buffer
+        if (getType() != SourceType::ZMQ_SOURCE && gatheringInterval.count() > 0) {
+            x_TRACE("DataSource {} sleeping on interval {}", operatorId, gatheringInterval.count());
+//            std::this_thread::sleep_for(gatheringInterval);
+        }
+    }
 
-                std::tuple<bool, double> res = x::Util::computeNyquistAndEnergy(this->lastValuesBuf.toVector(), skewedIntervalInseconds);
-                if (std::get<0>(res)) { // nyq rate is smaller than current skewed median interval
-                    this->kFilter->setSlowestInterval(std::move(std::chrono::milliseconds(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::duration<double>(std::get<1>(res))))));
-                }
+    close();
+}
 
-                this->kFilter->getNewGatheringInterval();
+void DataSource::adaptiveGatheringIntervalIteration(bool applyNewGatheringInterval) {
+    //check if already produced enough buffer
+    if (numberOfBuffersToProduce == 0 || numberOfBuffersProduced < numberOfBuffersToProduce) {
+        auto optBuf = receiveData();// note that receiveData might block
+        if (!running) {             // necessary if source stops while receiveData is called due to stricter shutdown logic
+            return;
+        }
 
+        //this checks we received a valid output buffer
+        if (optBuf.has_value()) {
+            auto& buf = optBuf.value();
+            applyGatheringPolicy();
+            if (!adaptiveValueReader) {
                 emitWorkFromSource(buf);
                 ++numberOfBuffersProduced;
+                return;
+            }
+
+            auto numOfTuples = buf.getNumberOfTuples();
+            auto numberOfFields = adaptiveValueReader->getNumberOfFields();
+            auto previousGatheringInterval = this->gatheringInterval;
+            adaptiveValueReader->read(buf, adaptiveValues);
+            double currentIntervalInSeconds = this->gatheringInterval.count() / 1000.;
+            for (uint64_t i = 0; i < numOfTuples; ++i) {
+                this->lastValuesSpectrum.push(adaptiveValues[i * numberOfFields]);
+                this->lastIntervalBuf.emplace(currentIntervalInSeconds);
+            }
+
+            // find mean interval over the window
+            double totalIntervalInseconds = 0;
+            for (uint64_t idx=0; idx < this->lastIntervalBuf.size(); ++idx) {
+                totalIntervalInseconds += this->lastIntervalBuf.at(idx);
+            }
+            totalIntervalInseconds /= this->lastIntervalBuf.size();
+            double skewedIntervalInseconds = (totalIntervalInseconds + currentIntervalInSeconds) / 2.;
+
+            std::tuple<bool, double> res = this->lastValuesSpectrum.computeNyquistAndEnergy(skewedIntervalInseconds);
+            if (std::get<0>(res)) { // nyq rate is smaller than current skewed median interval
+                auto slowestInterval = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::duration<double>(std::get<1>(res)));
+                if (policySlowestInterval && policySlowestInterval.value() < slowestInterval) {
+                    slowestInterval = policySlowestInterval.value();// the coordinator bounds the nyquist interval
+                }
+                if (fusedGatheringGroup) {
+                    fusedGatheringGroup->setSlowestInterval(fusedGatheringGroupMemberId, slowestInterval);
+                } else {
+                    this->kFilter->setSlowestInterval(slowestInterval);
+                }
+            }
+
+            if (fusedGatheringGroup) {
+                // the group fuses the latest values of all members into one observation
+                if (numOfTuples > 0) {
+                    this->gatheringInterval = fusedGatheringGroup->submit(fusedGatheringGroupMemberId,
+                                                                          adaptiveValues.data() + (numOfTuples - 1) * numberOfFields);
+                }
+            } else if (applyNewGatheringInterval) {
+                this->kFilter->updateFromValues(adaptiveValues.data(), numOfTuples);
+                this->gatheringInterval = this->kFilter->getNewGatheringInterval();
             } else {
-                x_ERROR("DataSource {}: stopping cause of invalid buffer", operatorId);
-                running = false;
+                // the oversampler keeps gathering on the original interval
+                this->kFilter->getNewGatheringInterval();
             }
+            if (this->gatheringInterval != previousGatheringInterval) {
+                onGatheringIntervalChange(this->gatheringInterval);
+                recordGatheringInterval();
+            }
+
+            emitWorkFromSource(buf);
+            ++numberOfBuffersProduced;
         } else {
+            x_ERROR("DataSource {}: stopping cause of invalid buffer", operatorId);
             running = false;
         }
-        // this checks if the interval is zero or a ZMQ_Source, we don't create a watermark-only buffer
-        if (getType() != SourceType::ZMQ_SOURCE && gatheringInterval.count() > 0) {
-            x_TRACE("DataSource {} sleeping on interval {}", operatorId, gatheringInterval.count());
-//            std::this_thread::sleep_for(gatheringInterval);
-        }
+    } else {
+        running = false;
     }
-
-    close();
 }
 
 bool DataSource::injectEpochBarrier(uint64_t epochBarrier, uint64_t queryId) {
@@ -643,6 +877,9 @@ uint64_t DataSource::getNumBuffersToProcess() const { return numberOfBuffersToPr
 
 std::chrono::milliseconds DataSource::getGatheringInterval() const { return gatheringInterval; }
 uint64_t DataSource::getGatheringIntervalCount() const { return gatheringInterval.count(); }
+
+double DataSource::getAchievedIngestionRate() const { return achievedIngestionRate; }
+const std::string& DataSource::getPhysicalSourceName() const { return physicalSourceName; }
 std::vector<Schema::MemoryLayoutType> DataSource::getSupportedLayouts() { return {Schema::MemoryLayoutType::ROW_LAYOUT}; }
 
 bool DataSource::checkSupportedLayoutTypes(SchemaPtr& schema) {
@@ -0,0 +1,51 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Sources/KafkaOffsetTracker.hpp>
+#include <Util/Logger/Logger.hpp>
+
+namespace x {
+
+void KafkaOffsetTracker::track(uint64_t watermark, PartitionOffsets nextOffsets) {
+    std::unique_lock lock(mutex);
+    x_ASSERT(pendingBuffers.empty() || pendingBuffers.back().first <= watermark,
+             "KafkaOffsetTracker: watermark " << watermark << " is smaller than the watermark of the previous buffer");
+    pendingBuffers.emplace_back(watermark, std::move(nextOffsets));
+}
+
+void KafkaOffsetTracker::acknowledge(uint64_t epochBarrier) {
+    std::unique_lock lock(mutex);
+    while (!pendingBuffers.empty() && pendingBuffers.front().first < epochBarrier) {
+        // later buffers hold later offsets, so they overwrite the offsets of earlier ones
+        for (const auto& [partition, offset] : pendingBuffers.front().second) {
+            committableOffsets[partition] = offset;
+        }
+        pendingBuffers.pop_front();
+    }
+}
+
+std::optional<KafkaOffsetTracker::PartitionOffsets> KafkaOffsetTracker::takeCommittableOffsets() {
+    std::unique_lock lock(mutex);
+    if (committableOffsets.empty()) {
+        return std::nullopt;
+    }
+    return std::exchange(committableOffsets, {});
+}
+
+uint64_t KafkaOffsetTracker::getNumberOfPendingBuffers() const {
+    std::unique_lock lock(mutex);
+    return pendingBuffers.size();
+}
+
+}// namespace x
@@ -14,13 +14,18 @@
 #ifdef ENABLE_KAFKA_BUILD
 #include <API/AttributeField.hpp>
 #include <Common/PhysicalTypes/DefaultPhysicalTypeFactory.hpp>
+#include <Runtime/MemoryLayout/RowLayout.hpp>
 #include <Runtime/QueryManager.hpp>
 #include <Runtime/TupleBuffer.hpp>
 #include <Sources/DataSource.hpp>
 #include <Sources/KafkaSource.hpp>
 #include <Sources/Parsers/JSONParser.hpp>
+#include <Sources/Parsers/OnDemandJSONParser.hpp>
 #include <Util/Logger/Logger.hpp>
 #include <cppkafka/cppkafka.h>
+#include <algorithm>
+#include <charconv>
+#include <chrono>
 #include <cstdint>
 #include <cstring>
 #include <filesystem>
@@ -85,10 +90,47 @@ KafkaSource::KafkaSource(SchemaPtr schema,
 
     switch (kafkaSourceType->getInputFormat()->getValue()) {
         case Configurations::InputFormat::JSON:
-            inputParser = std::make_unique<JSONParser>(schema->getSize(), schemaKeys, physicalTypes);
+            if (kafkaSourceType->getOnDemandJSONParsing()->getValue()) {
+                auto parser = std::make_unique<OnDemandJSONParser>(schema->getSize(), schemaKeys, physicalTypes);
+                onDemandJSONParser = parser.get();
+                inputParser = std::move(parser);
+            } else {
+                inputParser = std::make_unique<JSONParser>(schema->getSize(), schemaKeys, physicalTypes);
+            }
+            break;
+        case Configurations::InputFormat::BINARY:
+            if (!std::dynamic_pointer_cast<Runtime::MemoryLayouts::RowLayout>(memoryLayout)) {
+                x_THROW_RUNTIME_ERROR("KafkaSource: the BINARY input format requires the row layout");
+            }
+            binaryInput = true;
             break;
         default: break;
     }
+
+    // without configured partitions, the group id names the only partition
+    partitions = parsePartitions(kafkaSourceType->getPartitions()->getValue());
+    if (partitions.empty()) {
+        partitions.push_back(std::atoi(groupId.c_str()));
+    }
+}
+
+std::vector<int32_t> KafkaSource::parsePartitions(const std::string& partitionList) {
+    std::vector<int32_t> parsedPartitions;
+    std::stringstream partitionStream(partitionList);
+    std::string partition;
+    while (std::getline(partitionStream, partition, ',')) {
+        if (partition.empty()) {
+            continue;
+        }
+        int32_t parsedPartition = -1;
+        auto [end, error] = std::from_chars(partition.data(), partition.data() + partition.size(), parsedPartition);
+        if (error != std::errc() || end != partition.data() + partition.size() || parsedPartition < 0) {
+            x_THROW_RUNTIME_ERROR("KafkaSource: invalid partition '" << partition << "' in the partition list '" << partitionList
+                                                                     << "', expected comma separated non-negative numbers");
+        }
+        parsedPartitions.push_back(parsedPartition);
+    }
+    return parsedPartitions;
 }
 
 KafkaSource::~KafkaSource() {
@@ -118,7 +160,48 @@ std::optional<Runtime::TupleBuffer> KafkaSource::receiveData() {
         x_ERROR("KafkaSource::receiveData: Failed to fill the TupleBuffer. Error: {}.", e.what());
         throw e;
     }
-    return tupleBuffer.getBuffer();
+    auto buffer = tupleBuffer.getBuffer();
+    if (!autoCommit) {
+        // the offsets are committed once a barrier above the watermark of this buffer is injected
+        buffer.setWatermark(maxMessageTimestamp);
+        offsetTracker.track(maxMessageTimestamp, consumedOffsets);
+    }
+    return buffer;
+}
+
+bool KafkaSource::injectEpochBarrier(uint64_t epochBarrier, uint64_t queryId) {
+    offsetTracker.acknowledge(epochBarrier);
+    return DataSource::injectEpochBarrier(epochBarrier, queryId);
+}
+
+void KafkaSource::completeMessage(const cppkafka::Message& message) {
+    consumedOffsets[message.get_partition()] = message.get_offset() + 1;
+    // messages without a timestamp would leave the watermark at 0, so no epoch barrier would ever acknowledge their
+    // offsets, instead they are stamped with the time at which the source consumed them
+    uint64_t timestamp = 0;
+    if (auto messageTimestamp = message.get_timestamp()) {
+        timestamp = std::max<int64_t>(messageTimestamp->get_timestamp().count(), 0);
+    }
+    if (timestamp == 0) {
+        timestamp = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch())
+                        .count();
+    }
+    maxMessageTimestamp = std::max(maxMessageTimestamp, timestamp);
+    ++nextMessage;
+    positionInMessage = 0;
+}
+
+void KafkaSource::commitAcknowledgedOffsets() {
+    auto offsets = offsetTracker.takeCommittableOffsets();
+    if (!offsets.has_value()) {
+        return;
+    }
+    cppkafka::TopicPartitionList topicPartitions;
+    for (const auto& [partition, offset] : offsets.value()) {
+        topicPartitions.emplace_back(topic, partition, offset);
+    }
+    consumer->async_commit(topicPartitions);
+    x_DEBUG("KafkaSource commits acknowledged offsets of {} partitions", topicPartitions.size());
 }
 
 bool KafkaSource::fillBuffer(Runtime::MemoryLayouts::DynamicTupleBuffer& tupleBuffer) {
@@ -131,42 +214,76 @@ bool KafkaSource::fillBuffer(Runtime::MemoryLayouts::DynamicTupleBuffer& tupleBu
     bool flushIntervalPassed = false;
 
     while (tupleCount < tupleBufferCapacity && !flushIntervalPassed) {
-        x_DEBUG("KafkaSource tries to receive data...");
-        //poll a batch of messages and put it into a vector
-        messages = consumer->poll_batch(batchSize);
-        consumer->async_commit();
-
-        //iterate over the polled message buffer
-        if (!messages.empty()) {
-
+        if (nextMessage == messages.size()) {
+            x_DEBUG("KafkaSource tries to receive data...");
+            //poll a batch of messages and put it into a vector
+            messages = consumer->poll_batch(batchSize);
+            if (autoCommit) {
+                consumer->async_commit();
+            } else {
+                commitAcknowledgedOffsets();
+            }
+            nextMessage = 0;
+            positionInMessage = 0;
             x_TRACE("KafkaSource poll {} ", messages.size());
+        }
 
-            for (auto& message : messages) {
-                if (tupleCount < tupleBufferCapacity) {
-
-                    if (message.get_error()) {
-                        if (!message.is_eof()) {
-                            x_ERROR("KafkaSource received error notification: {}", message.get_error().to_string());
-                            throw message.get_error();
-                        }
-                        x_WARNING("KafkaSource reached end of topic");
-                        tupleBuffer.setNumberOfTuples(tupleCount);
-                        return true;
-                    }
-                    inputParser->writeInputTupleToTupleBuffer(std::string(message.get_payload()),
-                                                              tupleCount,
-                                                              tupleBuffer,
-                                                              schema,
-                                                              localBufferManager);
+        //iterate over the polled message buffer, messages that do not fit into this buffer are kept for the next one
+        while (nextMessage < messages.size() && tupleCount < tupleBufferCapacity) {
+            auto& message = messages[nextMessage];
+            if (message.get_error()) {
+                if (!message.is_eof()) {
+                    x_ERROR("KafkaSource received error notification: {}", message.get_error().to_string());
+                    throw message.get_error();
+                }
+                x_WARNING("KafkaSource reached end of topic");
+                ++nextMessage;
+                tupleBuffer.setNumberOfTuples(tupleCount);
+                return true;
+            }
+            if (binaryInput) {
+                // a payload holds whole tuples in the row layout, which are copied as they are
+                const auto& payload = message.get_payload();
+                if (payload.get_size() % tupleSize != 0) {
+                    x_THROW_RUNTIME_ERROR("KafkaSource::fillBuffer: binary payload of "
+                                          << payload.get_size() << " bytes does not hold whole tuples of " << tupleSize
+                                          << " bytes");
+                }
+                auto numberOfTuples =
+                    std::min<uint64_t>((payload.get_size() - positionInMessage) / tupleSize, tupleBufferCapacity - tupleCount);
+                std::memcpy(tupleBuffer.getBuffer().getBuffer<uint8_t>() + tupleCount * tupleSize,
+                            payload.get_data() + positionInMessage,
+                            numberOfTuples * tupleSize);
+                positionInMessage += numberOfTuples * tupleSize;
+                tupleCount += numberOfTuples;
+                if (positionInMessage == payload.get_size()) {
+                    completeMessage(message);
+                }
+                continue;
+            }
+            if (onDemandJSONParser) {
+                // a payload may hold several newline-delimited records, each one becomes a tuple
+                const auto& payload = message.get_payload();
+                if (onDemandJSONParser->writeNextRecordToTupleBuffer(
+                        std::string_view(reinterpret_cast<const char*>(payload.get_data()), payload.get_size()),
+                        positionInMessage,
+                        tupleCount,
+                        tupleBuffer,
+                        schema,
+                        localBufferManager)) {
                     tupleCount++;
                 } else {
-                    // FIXME: how to handle messages that are of size > tupleBufferCapacity
-                    // NOTE: this will lead to missing tuples as we drop messages that do not fit in the buffer
-                    x_ERROR("KafkaSource polled messages do not fit into a single buffer");
-                    tupleBuffer.setNumberOfTuples(tupleCount);
-                    return true;
+                    completeMessage(message);
                 }
+                continue;
             }
+            inputParser->writeInputTupleToTupleBuffer(std::string(message.get_payload()),
+                                                      tupleCount,
+                                                      tupleBuffer,
+                                                      schema,
+                                                      localBufferManager);
+            tupleCount++;
+            completeMessage(message);
         }
         // If bufferFlushIntervalMs was defined by the user (> 0), we check whether the time on receiving
         // and writing data exceeds the user defined limit (bufferFlushIntervalMs).
@@ -219,12 +336,13 @@ bool KafkaSource::connect() {
             x_DEBUG("KafkaSource Got revoked {}", partitionsAsString);
         });
 
-        // Subscribe to the topic
+        // Assign all partitions to this consumer, their messages are interleaved in the polled batches
         std::vector<cppkafka::TopicPartition> vec;
-        cppkafka::TopicPartition assignment(topic, std::atoi(groupId.c_str()));
-        vec.push_back(assignment);
+        for (auto partition : partitions) {
+            vec.emplace_back(topic, partition);
+        }
         consumer->assign(vec);
-        x_DEBUG("kafka source={} connect to topic={} partition={}", this->operatorId, topic, std::atoi(groupId.c_str()));
+        x_DEBUG("kafka source={} connect to topic={} partitions={}", this->operatorId, topic, partitions.size());
 
         x_DEBUG("kafka source starts producing");
 
@@ -245,6 +363,8 @@ std::string KafkaSource::getGroupId() const { return groupId; }
 
 uint64_t KafkaSource::getBatchSize() const { return batchSize; }
 
+const std::vector<int32_t>& KafkaSource::getPartitions() const { return partitions; }
+
 bool KafkaSource::isAutoCommit() const { return autoCommit; }
 
 const std::chrono::milliseconds& KafkaSource::getKafkaConsumerTimeout() const { return kafkaConsumerTimeout; }
@@ -20,7 +20,6 @@
 #include <Sources/GeneratorSource.hpp>
 #include <Sources/LambdaSource.hpp>
 #include <Util/Core.hpp>
-#include <Util/magicenum/magic_enum.hpp>
 #include <chrono>
 #include <utility>
 
@@ -53,12 +52,11 @@ LambdaSource::LambdaSource(
                       physicalSourceName),
       generationFunction(std::move(generationFunction)) {
     x_DEBUG("Create LambdaSource with id={} func is {}", operatorId, (this->generationFunction ? "callable" : "not callable"));
-    if (this->gatheringMode == GatheringMode::INTERVAL_MODE || this->gatheringMode == GatheringMode::ADAPTIVE_MODE) {
-        this->gatheringInterval = std::chrono::milliseconds(gatheringValue);
-    } else if (this->gatheringMode == GatheringMode::INGESTION_RATE_MODE) {
+    if (this->gatheringMode == GatheringMode::INGESTION_RATE_MODE || this->gatheringMode == GatheringMode::REPLAY_MODE) {
         this->gatheringIngestionRate = gatheringValue;
     } else {
-        x_THROW_RUNTIME_ERROR("Mode not implemented " << magic_enum::enum_name(gatheringMode));
+        // all other modes start from the gathering interval
+        this->gatheringInterval = std::chrono::milliseconds(gatheringValue);
     }
     numberOfTuplesToProduce = this->localBufferManager->getBufferSize() / this->schema->getSchemaSizeInBytes();
     this->sourceAffinity = sourceAffinity;
@@ -23,9 +23,12 @@
 #include <Sources/MQTTSource.hpp>
 #include <Sources/Parsers/CSVParser.hpp>
 #include <Sources/Parsers/JSONParser.hpp>
+#include <Sources/Parsers/OnDemandJSONParser.hpp>
+#include <Util/Common.hpp>
 #include <Util/Core.hpp>
 #include <Util/Logger/Logger.hpp>
 #include <Util/magicenum/magic_enum.hpp>
+#include <algorithm>
 #include <cassert>
 #include <cstdint>
 #include <cstring>
@@ -70,10 +73,20 @@ MQTTSource::MQTTSource(SchemaPtr schema,
       cleanSession(sourceConfig->getCleanSession()->getValue()),
       bufferFlushIntervalMs(sourceConfig->getFlushIntervalMS()->getValue()),
       readTimeoutInMs(sourceConfig->getFlushIntervalMS()->getValue() > 0 ? sourceConfig->getFlushIntervalMS()->getValue() : 100),
-      numberOfTuplesToProducePerBuffer(sourceConfig->getNumberOfTuplesToProducePerBuffer()->getValue()) {
+      numberOfTuplesToProducePerBuffer(sourceConfig->getNumberOfTuplesToProducePerBuffer()->getValue()),
+      batchedConsumption(sourceConfig->getBatchedConsumption()->getValue()) {
 
     numberOfBuffersToProduce = sourceConfig->getNumberOfBuffersToProduce()->getValue();
     gatheringInterval = std::chrono::milliseconds(sourceConfig->getGatheringInterval()->getValue());
+    std::vector<std::string> adaptiveValueFields;
+    auto configuredFields = sourceConfig->getAdaptiveValueFields()->getValue();
+    for (const auto& fieldName : Util::splitWithStringDelimiter<std::string>(configuredFields, ",")) {
+        adaptiveValueFields.emplace_back(Util::trim(fieldName));
+    }
+    if (!adaptiveValueFields.empty()) {
+        setAdaptiveValueFields(adaptiveValueFields);
+    }
+    setFusedGatheringGroup(sourceConfig->getFusedGatheringGroup()->getValue());
 
     if (cleanSession) {
         uint32_t randomizeClientId = random();
@@ -98,11 +111,18 @@ MQTTSource::MQTTSource(SchemaPtr schema,
 
     switch (sourceConfig->getInputFormat()->getValue()) {
         case Configurations::InputFormat::JSON:
-            inputParser = std::make_unique<JSONParser>(schema->getSize(), schemaKeys, physicalTypes);
+            if (sourceConfig->getOnDemandJSONParsing()->getValue()) {
+                auto parser = std::make_unique<OnDemandJSONParser>(schema->getSize(), schemaKeys, physicalTypes);
+                onDemandJSONParser = parser.get();
+                inputParser = std::move(parser);
+            } else {
+                inputParser = std::make_unique<JSONParser>(schema->getSize(), schemaKeys, physicalTypes);
+            }
             break;
         case Configurations::InputFormat::CSV:
             inputParser = std::make_unique<CSVParser>(schema->getSize(), physicalTypes, ",");
             break;
+        case Configurations::InputFormat::BINARY: x_THROW_RUNTIME_ERROR("MQTTSource: the BINARY input format is not supported");
     }
 
     x_TRACE("MQTTSource::MQTTSource: Init MQTTSource to {} with client id: {}.", serverAddress, clientId);
@@ -154,6 +174,9 @@ std::string MQTTSource::toString() const {
 }
 
 bool MQTTSource::fillBuffer(Runtime::MemoryLayouts::DynamicTupleBuffer& tupleBuffer) {
+    if (batchedConsumption) {
+        return fillBufferFromBatches(tupleBuffer);
+    }
 
     // determine how many tuples fit into the buffer
     if (numberOfTuplesToProducePerBuffer > 0) {
@@ -177,20 +200,39 @@ bool MQTTSource::fillBuffer(Runtime::MemoryLayouts::DynamicTupleBuffer& tupleBuf
             // If connected is false, constantly check if we are reconnected again and if so, resubscribe.
             if (connected) {
                 // Using try_consume_message_for(), because it is non-blocking.
-                auto message = client->try_consume_message_for(std::chrono::milliseconds(readTimeoutInMs));
-                if (message) {// Check if message was received correctly (not nullptr)
-                    x_TRACE("Client consume message: '{}'", message->get_payload_str());
-                    receivedMessageString = message->get_payload_str();
-                    if (!inputParser->writeInputTupleToTupleBuffer(receivedMessageString,
-                                                                   tupleCount,
-                                                                   tupleBuffer,
-                                                                   schema,
-                                                                   localBufferManager)) {
-                        x_ERROR("MQTTSource::getBuffer: Failed to write input tuple to TupleBuffer.");
-                        return false;
+                // A pending message still holds records that did not fit into the previous buffer.
+                if (!pendingMessage) {
+                    pendingMessage = client->try_consume_message_for(std::chrono::milliseconds(readTimeoutInMs));
+                    pendingPosition = 0;
+                }
+                if (pendingMessage) {// Check if message was received correctly (not nullptr)
+                    x_TRACE("Client consume message: '{}'", pendingMessage->get_payload_str());
+                    if (onDemandJSONParser) {
+                        // a payload may hold several newline-delimited records, each one becomes a tuple
+                        if (onDemandJSONParser->writeNextRecordToTupleBuffer(pendingMessage->get_payload(),
+                                                                             pendingPosition,
+                                                                             tupleCount,
+                                                                             tupleBuffer,
+                                                                             schema,
+                                                                             localBufferManager)) {
+                            tupleCount++;
+                        } else {
+                            pendingMessage.reset();
+                        }
+                    } else {
+                        receivedMessageString = pendingMessage->get_payload_str();
+                        pendingMessage.reset();
+                        if (!inputParser->writeInputTupleToTupleBuffer(receivedMessageString,
+                                                                       tupleCount,
+                                                                       tupleBuffer,
+                                                                       schema,
+                                                                       localBufferManager)) {
+                            x_ERROR("MQTTSource::getBuffer: Failed to write input tuple to TupleBuffer.");
+                            return false;
+                        }
+                        tupleCount++;
                     }
                     x_TRACE("MQTTSource::fillBuffer: Tuples processed for current buffer: {} / {}", tupleCount, tuplesThisPass);
-                    tupleCount++;
                 } else if (!client->is_connected()) {// message is a nullptr. Check if still connected to broker.
                     x_WARNING("MQTTSource::fillBuffer: Not connected anymore!");
                     connected = false;
@@ -232,6 +274,93 @@ bool MQTTSource::fillBuffer(Runtime::MemoryLayouts::DynamicTupleBuffer& tupleBuf
     return true;
 }
 
+bool MQTTSource::fillBufferFromBatches(Runtime::MemoryLayouts::DynamicTupleBuffer& tupleBuffer) {
+    tuplesThisPass = numberOfTuplesToProducePerBuffer > 0 ? numberOfTuplesToProducePerBuffer : tupleBuffer.getCapacity();
+    x_TRACE("MQTTSource::fillBufferFromBatches: Fill buffer with #tuples= {}  of size= {}", tuplesThisPass, tupleSize);
+
+    uint64_t tupleCount = 0;
+    // the deadline is monotonic, so that clock adjustments neither flush a buffer early nor delay it
+    const auto flushDeadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(bufferFlushIntervalMs);
+    try {
+        while (tupleCount < tuplesThisPass) {
+            if (nextMessageInBatch == messageBatch.size()) {
+                messageBatch.clear();
+                nextMessageInBatch = 0;
+                if (connected) {
+                    auto waitTime = std::chrono::milliseconds(readTimeoutInMs);
+                    if (bufferFlushIntervalMs > 0 && tupleCount > 0) {
+                        waitTime = std::min(waitTime,
+                                            std::chrono::ceil<std::chrono::milliseconds>(
+                                                std::max(flushDeadline - std::chrono::steady_clock::now(),
+                                                         std::chrono::steady_clock::duration::zero())));
+                    }
+                    mqtt::const_message_ptr message;
+                    if (client->try_consume_message_for(&message, waitTime)) {
+                        // drain the queue without waiting, at most as many messages as tuples fit into the buffer
+                        do {
+                            messageBatch.emplace_back(std::move(message));
+                        } while (messageBatch.size() < tuplesThisPass - tupleCount && client->try_consume_message(&message));
+                        x_TRACE("MQTTSource::fillBufferFromBatches: drained {} messages", messageBatch.size());
+                    }
+                }
+                if (messageBatch.empty()) {
+                    checkConnection();
+                }
+            }
+
+            // parse the batch, payloads are passed to the parser without copying them
+            while (nextMessageInBatch < messageBatch.size() && tupleCount < tuplesThisPass) {
+                const auto& payload = messageBatch[nextMessageInBatch]->get_payload();
+                if (onDemandJSONParser) {
+                    if (onDemandJSONParser->writeNextRecordToTupleBuffer(payload,
+                                                                         pendingPosition,
+                                                                         tupleCount,
+                                                                         tupleBuffer,
+                                                                         schema,
+                                                                         localBufferManager)) {
+                        tupleCount++;
+                        continue;
+                    }
+                    pendingPosition = 0;
+                } else {
+                    if (!inputParser->writeInputTupleToTupleBuffer(payload, tupleCount, tupleBuffer, schema, localBufferManager)) {
+                        x_ERROR("MQTTSource::fillBufferFromBatches: Failed to write input tuple to TupleBuffer.");
+                        return false;
+                    }
+                    tupleCount++;
+                }
+                messageBatch[nextMessageInBatch++].reset();
+            }
+
+            if (bufferFlushIntervalMs > 0 && tupleCount > 0 && std::chrono::steady_clock::now() >= flushDeadline) {
+                x_TRACE("MQTTSource::fillBufferFromBatches: Reached TupleBuffer flush interval.");
+                break;
+            }
+        }
+    } catch (const mqtt::exception& error) {
+        x_ERROR("MQTTSource::fillBufferFromBatches: {}", error.what());
+        return false;
+    } catch (std::exception& error) {
+        x_ERROR("MQTTSource::fillBufferFromBatches: General Error: {}", error.what());
+        return false;
+    }
+    tupleBuffer.setNumberOfTuples(tupleCount);
+    generatedTuples += tupleCount;
+    generatedBuffers++;
+    return true;
+}
+
+void MQTTSource::checkConnection() {
+    if (connected && !client->is_connected()) {
+        x_WARNING("MQTTSource::checkConnection: Not connected anymore!");
+        connected = false;
+    } else if (!connected && client->is_connected()) {
+        x_DEBUG("MQTTSource::checkConnection: Reconnected, subscribing again!");
+        client->subscribe(topic, magic_enum::enum_integer(qualityOfService))->wait_for(readTimeoutInMs);
+        connected = true;
+    }
+}
+
 bool MQTTSource::connect() {
     if (!connected) {
         x_DEBUG("MQTTSource was !connect now connect: connected");
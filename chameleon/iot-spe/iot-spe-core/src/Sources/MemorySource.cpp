@@ -62,7 +62,7 @@ MemorySource::MemorySource(SchemaPtr schema,
     this->numberOfBuffersToProduce = numBuffersToProcess;
     if (gatheringMode == GatheringMode::INTERVAL_MODE) {
         this->gatheringInterval = std::chrono::milliseconds(gatheringValue);
-    } else if (gatheringMode == GatheringMode::INGESTION_RATE_MODE) {
+    } else if (gatheringMode == GatheringMode::INGESTION_RATE_MODE || gatheringMode == GatheringMode::REPLAY_MODE) {
         this->gatheringIngestionRate = gatheringValue;
     } else {
         x_THROW_RUNTIME_ERROR("Mode not implemented " << magic_enum::enum_name(gatheringMode));
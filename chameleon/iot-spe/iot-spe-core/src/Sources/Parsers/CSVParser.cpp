@@ -13,18 +13,23 @@
 */
 
 #include <API/Schema.hpp>
-#include <Common/PhysicalTypes/BasicPhysicalType.hpp>
 #include <Exceptions/RuntimeException.hpp>
 #include <Runtime/MemoryLayout/DynamicTupleBuffer.hpp>
 #include <Sources/Parsers/CSVParser.hpp>
+#include <Sources/Parsers/CSVTokenizer.hpp>
 #include <Util/Common.hpp>
 #include <Util/Core.hpp>
 #include <Util/Logger/Logger.hpp>
+#include <cstring>
 #include <string>
 
 using namespace std::string_literals;
 namespace x {
 
+namespace {
+constexpr uint32_t POSITION_MASK = ~CSVTokenizer::LINE_END;
+}// namespace
+
 CSVParser::CSVParser(uint64_t numberOfSchemaFields, std::vector<x::PhysicalTypePtr> physicalTypes, std::string delimiter)
     : Parser(physicalTypes), numberOfSchemaFields(numberOfSchemaFields), physicalTypes(std::move(physicalTypes)),
       delimiter(std::move(delimiter)) {}
@@ -58,4 +63,44 @@ bool CSVParser::writeInputTupleToTupleBuffer(const std::string& csvInputLine,
     }
     return true;
 }
-}// namespace x
\ No newline at end of file
+
+bool CSVParser::writeTokenizedLineToTupleBuffer(const char* block,
+                                                uint64_t lineStart,
+                                                const uint32_t* separators,
+                                                uint64_t numberOfSeparators,
+                                                uint64_t tupleCount,
+                                                Runtime::MemoryLayouts::DynamicTupleBuffer& tupleBuffer,
+                                                const SchemaPtr& schema,
+                                                const Runtime::BufferManagerPtr& bufferManager) {
+    x_TRACE("CSVParser::writeTokenizedLineToTupleBuffer: Current TupleCount:  {}", tupleCount);
+    x_ASSERT(numberOfSeparators > 0 && (separators[numberOfSeparators - 1] & CSVTokenizer::LINE_END),
+             "CSVParser: a tokenized line has to end with a line end");
+
+    // like splitWithStringDelimiter, an empty last field does not count
+    auto lineEnd = separators[numberOfSeparators - 1] & POSITION_MASK;
+    auto lastFieldStart = numberOfSeparators > 1 ? (separators[numberOfSeparators - 2] & POSITION_MASK) + 1 : lineStart;
+    auto numberOfFields = lastFieldStart == lineEnd ? numberOfSeparators - 1 : numberOfSeparators;
+    if (numberOfFields != schema->getSize()) {
+        x_THROW_RUNTIME_ERROR(
+            "CSVParser: The input line does not contain the right number of delimited fields. Fields in schema: "
+            + std::to_string(schema->getSize()) + " Fields in line: " + std::to_string(numberOfFields)
+            + " Schema: " + schema->toString() + " Line: " + std::string(block + lineStart, lineEnd - lineStart));
+    }
+
+    prepareNumericFieldWriters(tupleBuffer);
+    auto fieldStart = lineStart;
+    for (uint64_t j = 0; j < numberOfSchemaFields; j++) {
+        auto fieldEnd = separators[j] & POSITION_MASK;
+        if (!writeNumericFieldValue(block + fieldStart, block + fieldEnd, j, tupleBuffer, tupleCount)) {
+            writeFieldValueToTupleBuffer(std::string(block + fieldStart, fieldEnd - fieldStart),
+                                         j,
+                                         tupleBuffer,
+                                         schema,
+                                         tupleCount,
+                                         bufferManager);
+        }
+        fieldStart = fieldEnd + 1;
+    }
+    return true;
+}
+}// namespace x
@@ -0,0 +1,121 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Sources/Parsers/CSVTokenizer.hpp>
+#include <Util/Logger/Logger.hpp>
+#ifdef HAS_AVX
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace x {
+
+namespace {
+constexpr uint64_t BYTES_PER_ITERATION = 64;
+
+/**
+ * @brief compares 64 bytes against the delimiter and the line feed
+ * @param separatorMask bit i is set if data[i] is the delimiter or a line feed
+ * @param lineEndMask bit i is set if data[i] is a line feed
+ */
+inline void findSeparators(const char* data, char delimiter, uint64_t& separatorMask, uint64_t& lineEndMask) {
+#ifdef HAS_AVX
+    const auto delimiters = _mm256_set1_epi8(delimiter);
+    const auto lineFeeds = _mm256_set1_epi8('\n');
+    const auto low = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+    const auto high = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + 32));
+    auto lowLineEnds = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(low, lineFeeds)));
+    auto highLineEnds = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(high, lineFeeds)));
+    auto lowDelimiters = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(low, delimiters)));
+    auto highDelimiters = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(high, delimiters)));
+    lineEndMask = lowLineEnds | (static_cast<uint64_t>(highLineEnds) << 32);
+    separatorMask = lineEndMask | lowDelimiters | (static_cast<uint64_t>(highDelimiters) << 32);
+#elif defined(__SSE2__)
+    const auto delimiters = _mm_set1_epi8(delimiter);
+    const auto lineFeeds = _mm_set1_epi8('\n');
+    lineEndMask = 0;
+    separatorMask = 0;
+    for (uint64_t i = 0; i < BYTES_PER_ITERATION; i += 16) {
+        const auto bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        auto lineEnds = static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, lineFeeds))));
+        auto delimiterBits = static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, delimiters))));
+        lineEndMask |= lineEnds << i;
+        separatorMask |= (lineEnds | delimiterBits) << i;
+    }
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+    // NEON has no movemask, so every comparison result keeps one bit per byte and pairwise additions pack them
+    static const uint8_t bitsPerLane[16] = {0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80,
+                                            0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80};
+    const auto bits = vld1q_u8(bitsPerLane);
+    const auto toMask = [&bits](uint8x16_t c0, uint8x16_t c1, uint8x16_t c2, uint8x16_t c3) {
+        auto sum0 = vpaddq_u8(vandq_u8(c0, bits), vandq_u8(c1, bits));
+        auto sum1 = vpaddq_u8(vandq_u8(c2, bits), vandq_u8(c3, bits));
+        sum0 = vpaddq_u8(sum0, sum1);
+        sum0 = vpaddq_u8(sum0, sum0);
+        return vgetq_lane_u64(vreinterpretq_u64_u8(sum0), 0);
+    };
+    const auto* bytes = reinterpret_cast<const uint8_t*>(data);
+    const auto delimiters = vdupq_n_u8(static_cast<uint8_t>(delimiter));
+    const auto lineFeeds = vdupq_n_u8('\n');
+    const auto b0 = vld1q_u8(bytes);
+    const auto b1 = vld1q_u8(bytes + 16);
+    const auto b2 = vld1q_u8(bytes + 32);
+    const auto b3 = vld1q_u8(bytes + 48);
+    lineEndMask = toMask(vceqq_u8(b0, lineFeeds), vceqq_u8(b1, lineFeeds), vceqq_u8(b2, lineFeeds), vceqq_u8(b3, lineFeeds));
+    separatorMask =
+        lineEndMask | toMask(vceqq_u8(b0, delimiters), vceqq_u8(b1, delimiters), vceqq_u8(b2, delimiters), vceqq_u8(b3, delimiters));
+#else
+    lineEndMask = 0;
+    separatorMask = 0;
+    for (uint64_t i = 0; i < BYTES_PER_ITERATION; ++i) {
+        lineEndMask |= static_cast<uint64_t>(data[i] == '\n') << i;
+        separatorMask |= static_cast<uint64_t>(data[i] == '\n' || data[i] == delimiter) << i;
+    }
+#endif
+}
+}// namespace
+
+CSVTokenizer::CSVTokenizer(char delimiter) : delimiter(delimiter) {
+    x_ASSERT(delimiter != '\n', "CSVTokenizer: the delimiter must not be a line feed");
+}
+
+void CSVTokenizer::tokenize(const char* data, uint64_t size, std::vector<uint32_t>& separators) const {
+    x_ASSERT(size <= MAX_BLOCK_SIZE, "CSVTokenizer: block of " << size << " bytes is too large");
+    uint64_t position = 0;
+    for (; position + BYTES_PER_ITERATION <= size; position += BYTES_PER_ITERATION) {
+        uint64_t separatorMask;
+        uint64_t lineEndMask;
+        findSeparators(data + position, delimiter, separatorMask, lineEndMask);
+        while (separatorMask != 0) {
+            auto bit = static_cast<uint64_t>(__builtin_ctzll(separatorMask));
+            auto lineEnd = static_cast<uint32_t>((lineEndMask >> bit) & 1) * LINE_END;
+            separators.emplace_back(static_cast<uint32_t>(position + bit) | lineEnd);
+            separatorMask &= separatorMask - 1;
+        }
+    }
+    for (; position < size; ++position) {
+        if (data[position] == '\n') {
+            separators.emplace_back(static_cast<uint32_t>(position) | LINE_END);
+        } else if (data[position] == delimiter) {
+            separators.emplace_back(static_cast<uint32_t>(position));
+        }
+    }
+}
+
+char CSVTokenizer::getDelimiter() const { return delimiter; }
+
+}// namespace x
@@ -0,0 +1,247 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Exceptions/RuntimeException.hpp>
+#include <Sources/Parsers/OnDemandJSONParser.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <utility>
+
+namespace x {
+
+namespace {
+/// the number of characters of a malformed record that are shown in an error message
+constexpr uint64_t ERROR_CONTEXT_LENGTH = 64;
+
+inline bool isWhitespace(char character) {
+    return character == ' ' || character == '\t' || character == '\n' || character == '\r';
+}
+
+inline const char* skipWhitespace(const char* position, const char* end) {
+    while (position != end && isWhitespace(*position)) {
+        ++position;
+    }
+    return position;
+}
+
+inline std::string_view getErrorContext(const char* position, const char* end) {
+    return {position, std::min<uint64_t>(end - position, ERROR_CONTEXT_LENGTH)};
+}
+
+/**
+ * @brief skips the string that starts with the quote at position
+ * @return the position behind the closing quote
+ */
+const char* skipString(const char* position, const char* end) {
+    const auto* searchStart = position + 1;
+    while (true) {
+        const auto* quote = static_cast<const char*>(memchr(searchStart, '"', end - searchStart));
+        if (quote == nullptr) {
+            x_THROW_RUNTIME_ERROR("OnDemandJSONParser: unterminated string: " << getErrorContext(position, end));
+        }
+        // a quote is escaped by an odd number of backslashes
+        const auto* backslash = quote;
+        while (backslash != searchStart && backslash[-1] == '\\') {
+            --backslash;
+        }
+        if ((quote - backslash) % 2 == 0) {
+            return quote + 1;
+        }
+        searchStart = quote + 1;
+    }
+}
+
+/**
+ * @brief skips the value that starts at position, nested objects and arrays are skipped as a whole
+ * @return the position behind the value
+ */
+const char* skipValue(const char* position, const char* end) {
+    if (position == end) {
+        return position;
+    }
+    if (*position == '"') {
+        return skipString(position, end);
+    }
+    if (*position == '{' || *position == '[') {
+        const auto* valueStart = position;
+        uint64_t depth = 0;
+        while (position != end) {
+            switch (*position) {
+                case '"': position = skipString(position, end); continue;
+                case '{':
+                case '[': ++depth; break;
+                case '}':
+                case ']':
+                    if (--depth == 0) {
+                        return position + 1;
+                    }
+                    break;
+                default: break;
+            }
+            ++position;
+        }
+        x_THROW_RUNTIME_ERROR("OnDemandJSONParser: unterminated value: " << getErrorContext(valueStart, end));
+    }
+    // numbers and literals end at the next structural character
+    while (position != end && *position != ',' && *position != '}' && *position != ']' && !isWhitespace(*position)) {
+        ++position;
+    }
+    return position;
+}
+}// namespace
+
+OnDemandJSONParser::OnDemandJSONParser(uint64_t numberOfSchemaFields,
+                                       std::vector<std::string> schemaKeys,
+                                       std::vector<PhysicalTypePtr> physicalTypes)
+    : Parser(std::move(physicalTypes)), numberOfSchemaFields(numberOfSchemaFields), schemaKeys(std::move(schemaKeys)),
+      fieldWrittenByObject(numberOfSchemaFields, 0) {}
+
+bool OnDemandJSONParser::writeInputTupleToTupleBuffer(const std::string& jsonTuple,
+                                                      uint64_t tupleCount,
+                                                      Runtime::MemoryLayouts::DynamicTupleBuffer& tupleBuffer,
+                                                      const SchemaPtr& schema,
+                                                      const Runtime::BufferManagerPtr& bufferManager) {
+    x_TRACE("OnDemandJSONParser::writeInputTupleToTupleBuffer: Current TupleCount:  {}", tupleCount);
+    const auto* end = jsonTuple.data() + jsonTuple.size();
+    const auto* position = skipWhitespace(parseObject(jsonTuple.data(), end, tupleCount, tupleBuffer, schema, bufferManager), end);
+    if (position != end) {
+        x_THROW_RUNTIME_ERROR("OnDemandJSONParser: unexpected characters behind the json object: "
+                              << getErrorContext(position, end));
+    }
+    // like the JSONParser, a missing key is not an error itself
+    return numberOfWrittenFields == numberOfSchemaFields;
+}
+
+bool OnDemandJSONParser::writeNextRecordToTupleBuffer(std::string_view payload,
+                                                      uint64_t& position,
+                                                      uint64_t tupleCount,
+                                                      Runtime::MemoryLayouts::DynamicTupleBuffer& tupleBuffer,
+                                                      const SchemaPtr& schema,
+                                                      const Runtime::BufferManagerPtr& bufferManager) {
+    const auto* end = payload.data() + payload.size();
+    const auto* recordStart = skipWhitespace(payload.data() + std::min<uint64_t>(position, payload.size()), end);
+    if (recordStart == end) {
+        position = payload.size();
+        return false;
+    }
+    const auto* recordEnd = parseObject(recordStart, end, tupleCount, tupleBuffer, schema, bufferManager);
+    if (numberOfWrittenFields != numberOfSchemaFields) {
+        x_THROW_RUNTIME_ERROR("OnDemandJSONParser: the record does not contain the key " << getMissingSchemaKey() << ": "
+                                                                                        << getErrorContext(recordStart, end));
+    }
+    position = recordEnd - payload.data();
+    return true;
+}
+
+const char* OnDemandJSONParser::parseObject(const char* begin,
+                                            const char* end,
+                                            uint64_t tupleCount,
+                                            Runtime::MemoryLayouts::DynamicTupleBuffer& tupleBuffer,
+                                            const SchemaPtr& schema,
+                                            const Runtime::BufferManagerPtr& bufferManager) {
+    prepareNumericFieldWriters(tupleBuffer);
+    ++objectNumber;
+    numberOfWrittenFields = 0;
+    nextExpectedField = 0;
+
+    const auto* position = skipWhitespace(begin, end);
+    if (position == end || *position != '{') {
+        x_THROW_RUNTIME_ERROR("OnDemandJSONParser: expected a json object: " << getErrorContext(begin, end));
+    }
+    position = skipWhitespace(position + 1, end);
+    if (position != end && *position == '}') {
+        return position + 1;
+    }
+
+    while (true) {
+        if (position == end || *position != '"') {
+            x_THROW_RUNTIME_ERROR("OnDemandJSONParser: expected a key: " << getErrorContext(begin, end));
+        }
+        const auto* keyEnd = skipString(position, end);
+        auto fieldIndex = findSchemaField(std::string_view(position + 1, keyEnd - position - 2));
+        position = skipWhitespace(keyEnd, end);
+        if (position == end || *position != ':') {
+            x_THROW_RUNTIME_ERROR("OnDemandJSONParser: expected a colon behind a key: " << getErrorContext(begin, end));
+        }
+        position = skipWhitespace(position + 1, end);
+        const auto* valueEnd = skipValue(position, end);
+        if (valueEnd == position) {
+            x_THROW_RUNTIME_ERROR("OnDemandJSONParser: expected a value behind a key: " << getErrorContext(begin, end));
+        }
+
+        // a null value counts as a missing key, all values of other keys are skipped without being parsed
+        if (fieldIndex < numberOfSchemaFields && std::string_view(position, valueEnd - position) != "null") {
+            const auto* valueBegin = position;
+            const auto* valueLast = valueEnd;
+            if (*valueBegin == '"') {
+                // like the JSONParser, strings are passed without their quotes, also without single quotes
+                ++valueBegin;
+                --valueLast;
+                while (valueBegin != valueLast && *valueBegin == '\'') {
+                    ++valueBegin;
+                }
+                while (valueLast != valueBegin && valueLast[-1] == '\'') {
+                    --valueLast;
+                }
+            }
+            if (!writeNumericFieldValue(valueBegin, valueLast, fieldIndex, tupleBuffer, tupleCount)) {
+                writeFieldValueToTupleBuffer(std::string(valueBegin, valueLast),
+                                             fieldIndex,
+                                             tupleBuffer,
+                                             schema,
+                                             tupleCount,
+                                             bufferManager);
+            }
+            if (fieldWrittenByObject[fieldIndex] != objectNumber) {
+                fieldWrittenByObject[fieldIndex] = objectNumber;
+                ++numberOfWrittenFields;
+            }
+        }
+
+        position = skipWhitespace(valueEnd, end);
+        if (position != end && *position == ',') {
+            position = skipWhitespace(position + 1, end);
+        } else if (position != end && *position == '}') {
+            return position + 1;
+        } else {
+            x_THROW_RUNTIME_ERROR("OnDemandJSONParser: expected a comma or the end of the object: "
+                                  << getErrorContext(begin, end));
+        }
+    }
+}
+
+uint64_t OnDemandJSONParser::findSchemaField(std::string_view key) {
+    if (nextExpectedField < numberOfSchemaFields && schemaKeys[nextExpectedField] == key) {
+        return nextExpectedField++;
+    }
+    for (uint64_t fieldIndex = 0; fieldIndex < numberOfSchemaFields; ++fieldIndex) {
+        if (schemaKeys[fieldIndex] == key) {
+            nextExpectedField = fieldIndex + 1;
+            return fieldIndex;
+        }
+    }
+    return numberOfSchemaFields;
+}
+
+const std::string& OnDemandJSONParser::getMissingSchemaKey() const {
+    for (uint64_t fieldIndex = 0; fieldIndex < numberOfSchemaFields; ++fieldIndex) {
+        if (fieldWrittenByObject[fieldIndex] != objectNumber) {
+            return schemaKeys[fieldIndex];
+        }
+    }
+    return schemaKeys.front();
+}
+}// namespace x
@@ -18,18 +18,97 @@
 #include <Common/PhysicalTypes/PhysicalType.hpp>
 #include <Runtime/FixedSizeBufferPool.hpp>
 #include <Runtime/MemoryLayout/DynamicTupleBuffer.hpp>
+#include <Runtime/MemoryLayout/RowLayout.hpp>
 #include <Runtime/QueryManager.hpp>
 #include <Sources/Parsers/Parser.hpp>
 #include <Util/Common.hpp>
 #include <Util/Core.hpp>
 #include <Util/Logger/Logger.hpp>
+#include <charconv>
 #include <cstring>
 #include <string>
 #include <utility>
 
 namespace x {
 
-Parser::Parser(std::vector<PhysicalTypePtr> physicalTypes) : physicalTypes(std::move(physicalTypes)) {}
+namespace {
+inline bool isBlank(char character) { return character == ' ' || character == '\t' || character == '\r'; }
+
+/**
+ * @brief parses a value with std::from_chars and stores it as the native type of the field
+ * @tparam Parsed the type the std::sto* function of writeFieldValueToTupleBuffer returns for this native type
+ * @return false if the value is not a number that is only surrounded by blanks
+ */
+template<typename Parsed, typename Stored>
+bool parseValue(const char* begin, const char* end, uint8_t* address) {
+    while (begin != end && isBlank(*begin)) {
+        ++begin;
+    }
+    Parsed value;
+    auto [position, error] = std::from_chars(begin, end, value);
+    if (error != std::errc()) {
+        return false;
+    }
+    while (position != end && isBlank(*position)) {
+        ++position;
+    }
+    if (position != end) {
+        return false;
+    }
+    auto storedValue = static_cast<Stored>(value);
+    std::memcpy(address, &storedValue, sizeof(Stored));// fields in the row layout are not aligned
+    return true;
+}
+}// namespace
+
+Parser::Parser(std::vector<PhysicalTypePtr> physicalTypes) : physicalTypes(std::move(physicalTypes)) {
+    for (const auto& physicalType : this->physicalTypes) {
+        auto nativeType = physicalType->isBasicType() ? std::dynamic_pointer_cast<BasicPhysicalType>(physicalType)->nativeType
+                                                      : BasicPhysicalType::NativeType::UNDEFINED;
+        fieldWriters.emplace_back(FieldWriter{nativeType, 0, 0});
+    }
+}
+
+void Parser::prepareNumericFieldWriters(const Runtime::MemoryLayouts::DynamicTupleBuffer& tupleBuffer) {
+    const auto& memoryLayout = tupleBuffer.getMemoryLayout();
+    if (fieldWriterLayout == memoryLayout) {
+        return;
+    }
+    x_ASSERT(memoryLayout->getFieldSizes().size() == fieldWriters.size(),
+             "Parser: memory layout does not match the physical types of the parser");
+    auto isRowLayout = std::dynamic_pointer_cast<Runtime::MemoryLayouts::RowLayout>(memoryLayout) != nullptr;
+    for (uint64_t fieldIndex = 0; fieldIndex < fieldWriters.size(); ++fieldIndex) {
+        // the row layout strides over whole tuples, the column layout over the values of one column
+        fieldWriters[fieldIndex].offset = memoryLayout->getFieldOffset(0, fieldIndex);
+        fieldWriters[fieldIndex].stride =
+            isRowLayout ? memoryLayout->getTupleSize() : memoryLayout->getFieldSizes()[fieldIndex];
+    }
+    fieldWriterLayout = memoryLayout;
+}
+
+bool Parser::writeNumericFieldValue(const char* begin,
+                                    const char* end,
+                                    uint64_t schemaFieldIndex,
+                                    Runtime::MemoryLayouts::DynamicTupleBuffer& tupleBuffer,
+                                    uint64_t tupleCount) const {
+    const auto& fieldWriter = fieldWriters[schemaFieldIndex];
+    auto* address = tupleBuffer.getBuffer().getBuffer<uint8_t>() + fieldWriter.offset + tupleCount * fieldWriter.stride;
+    switch (fieldWriter.nativeType) {
+        case BasicPhysicalType::NativeType::INT_8: return parseValue<int, int8_t>(begin, end, address);
+        case BasicPhysicalType::NativeType::INT_16: return parseValue<long, int16_t>(begin, end, address);
+        case BasicPhysicalType::NativeType::INT_32: return parseValue<long, int32_t>(begin, end, address);
+        case BasicPhysicalType::NativeType::INT_64: return parseValue<long long, int64_t>(begin, end, address);
+        case BasicPhysicalType::NativeType::UINT_8: return parseValue<int, uint8_t>(begin, end, address);
+        case BasicPhysicalType::NativeType::UINT_16: return parseValue<unsigned long, uint16_t>(begin, end, address);
+        case BasicPhysicalType::NativeType::UINT_32: return parseValue<unsigned long, uint32_t>(begin, end, address);
+        case BasicPhysicalType::NativeType::UINT_64: return parseValue<unsigned long long, uint64_t>(begin, end, address);
+#ifdef __cpp_lib_to_chars
+        case BasicPhysicalType::NativeType::FLOAT: return parseValue<float, float>(begin, end, address);
+        case BasicPhysicalType::NativeType::DOUBLE: return parseValue<double, double>(begin, end, address);
+#endif
+        default: return false;// CHAR, TEXT, BOOLEAN, and char arrays
+    }
+}
 
 void Parser::writeFieldValueToTupleBuffer(std::string inputString,
                                           uint64_t schemaFieldIndex,
@@ -0,0 +1,134 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Sources/PartitionedFileReader.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/ThreadNaming.hpp>
+#include <utility>
+
+namespace x {
+
+PartitionedFileReader::PartitionedFileReader(uint64_t numberOfPartitions,
+                                             uint32_t numberOfThreads,
+                                             PartitionParser partitionParser,
+                                             uint64_t maxPartitionsInFlight)
+    : numberOfPartitions(numberOfPartitions), numberOfThreads(numberOfThreads),
+      maxPartitionsInFlight(maxPartitionsInFlight > 0 ? maxPartitionsInFlight : 2 * uint64_t{numberOfThreads}),
+      partitionParser(std::move(partitionParser)), partitionsInFlight(this->maxPartitionsInFlight) {
+    x_ASSERT(numberOfThreads > 0, "PartitionedFileReader needs at least one thread");
+}
+
+PartitionedFileReader::~PartitionedFileReader() { stop(); }
+
+void PartitionedFileReader::start() {
+    std::unique_lock lock(mutex);
+    if (started) {
+        return;
+    }
+    started = true;
+    running = true;
+    for (uint32_t i = 0; i < numberOfThreads; ++i) {
+        readerThreads.emplace_back([this, i]() {
+            setThreadName("FileReader-%d", i);
+            readerRoutine();
+        });
+    }
+    x_DEBUG("PartitionedFileReader: started {} threads for {} partitions", numberOfThreads, numberOfPartitions);
+}
+
+void PartitionedFileReader::stop() {
+    {
+        std::unique_lock lock(mutex);
+        running = false;
+        // releases the buffers, so that a reader that waits for a buffer can finish its partition
+        for (auto& partition : partitionsInFlight) {
+            partition = Partition();
+        }
+    }
+    partitionParsed.notify_all();
+    windowAdvanced.notify_all();
+    for (auto& thread : readerThreads) {
+        if (thread.joinable()) {
+            thread.join();
+        }
+    }
+    readerThreads.clear();
+}
+
+std::optional<Runtime::TupleBuffer> PartitionedFileReader::next() {
+    std::unique_lock lock(mutex);
+    while (nextPartitionToEmit < numberOfPartitions) {
+        auto& partition = getPartition(nextPartitionToEmit);
+        partitionParsed.wait(lock, [this, &partition]() {
+            return !running || partition.parsed;
+        });
+        if (!running) {
+            return std::nullopt;
+        }
+        if (partition.error) {
+            std::rethrow_exception(partition.error);
+        }
+        if (nextBufferToEmit < partition.buffers.size()) {
+            return std::move(partition.buffers[nextBufferToEmit++]);
+        }
+        partition = Partition();
+        nextBufferToEmit = 0;
+        ++nextPartitionToEmit;
+        windowAdvanced.notify_all();
+    }
+    return std::nullopt;
+}
+
+uint64_t PartitionedFileReader::getNumberOfPartitions() const { return numberOfPartitions; }
+
+PartitionedFileReader::Partition& PartitionedFileReader::getPartition(uint64_t partitionIndex) {
+    return partitionsInFlight[partitionIndex % maxPartitionsInFlight];
+}
+
+void PartitionedFileReader::readerRoutine() {
+    while (true) {
+        uint64_t partitionIndex;
+        {
+            std::unique_lock lock(mutex);
+            windowAdvanced.wait(lock, [this]() {
+                return !running || nextPartitionToParse >= numberOfPartitions
+                    || nextPartitionToParse < nextPartitionToEmit + maxPartitionsInFlight;
+            });
+            if (!running || nextPartitionToParse >= numberOfPartitions) {
+                break;
+            }
+            partitionIndex = nextPartitionToParse++;
+        }
+
+        Partition partition;
+        try {
+            partitionParser(partitionIndex, partition.buffers);
+        } catch (...) {
+            x_ERROR("PartitionedFileReader: failed to parse partition {}", partitionIndex);
+            partition.buffers.clear();
+            partition.error = std::current_exception();
+        }
+        partition.parsed = true;
+
+        std::unique_lock lock(mutex);
+        if (!running) {
+            break;
+        }
+        getPartition(partitionIndex) = std::move(partition);
+        partitionParsed.notify_all();
+    }
+    x_DEBUG("PartitionedFileReader: reader terminated");
+}
+
+}// namespace x
@@ -13,10 +13,15 @@
 */
 
 #include <Runtime/FixedSizeBufferPool.hpp>
+#include <Runtime/MemoryLayout/MemoryLayout.hpp>
 #include <Runtime/QueryManager.hpp>
+#include <Sensors/I2CBus.hpp>
+#include <Sensors/SimulatedBus.hpp>
 #include <Sources/DataSource.hpp>
 #include <Sources/SenseSource.hpp>
 #include <Util/Logger/Logger.hpp>
+#include <Util/magicenum/magic_enum.hpp>
+#include <cstring>
 #include <sstream>
 #include <string>
 #include <utility>
@@ -29,6 +34,7 @@ SenseSource::SenseSource(SchemaPtr schema,
                          Runtime::BufferManagerPtr bufferManager,
                          Runtime::QueryManagerPtr queryManager,
                          std::string udfs,
+                         const SenseSourceTypePtr& senseSourceType,
                          OperatorId operatorId,
                          OriginId originId,
                          size_t numSourceLocalBuffers,
@@ -40,16 +46,47 @@ SenseSource::SenseSource(SchemaPtr schema,
                  operatorId,
                  originId,
                  numSourceLocalBuffers,
-                 GatheringMode::INTERVAL_MODE,
+                 senseSourceType ? senseSourceType->getGatheringMode()->getValue() : GatheringMode::INTERVAL_MODE,
                  physicalSourceName,
                  std::move(successors)),
-      udfs(std::move(udfs)) {}
+      udfs(std::move(udfs)), tupleSize(this->schema->getSchemaSizeInBytes()) {
+    if (!senseSourceType || senseSourceType->getBusType()->getValue().empty()) {
+        return;
+    }
+    auto busTypeName = senseSourceType->getBusType()->getValue();
+    busPath = senseSourceType->getBusPath()->getValue();
+    busAddress = static_cast<int>(senseSourceType->getBusAddress()->getValue());
+    numberOfTuplesToProducePerBuffer = senseSourceType->getNumberOfTuplesToProducePerBuffer()->getValue();
+    gatheringInterval = std::chrono::milliseconds(senseSourceType->getGatheringInterval()->getValue());
+    configuredGatheringInterval = gatheringInterval;
+    tupleBytes.resize(tupleSize);
+
+    switch (magic_enum::enum_cast<Sensors::BusType>(busTypeName).value_or(Sensors::BusType::UART)) {
+        case Sensors::BusType::SIMULATED: {
+            auto sampleInterval = std::chrono::milliseconds(senseSourceType->getBusSampleInterval()->getValue());
+            bus = std::make_shared<Sensors::SimulatedBus>(busPath.c_str(), tupleSize, sampleInterval);
+            break;
+        }
+#ifdef __linux__
+        case Sensors::BusType::I2C: {
+            bus = std::make_shared<Sensors::I2CBus>(busPath.c_str());
+            break;
+        }
+#endif
+        default: x_THROW_RUNTIME_ERROR("SenseSource: bus type " << busTypeName << " is not supported");
+    }
+    bus->setPollingInterval(gatheringInterval);
+}
 
 std::optional<Runtime::TupleBuffer> SenseSource::receiveData() {
     x_DEBUG("SenseSource::receiveData called");
     auto buf = bufferManager->getBufferBlocking();
     fillBuffer(buf);
     x_DEBUG("SenseSource::receiveData filled buffer with tuples={}", buf.getNumberOfTuples());
+    if (bus && buf.getNumberOfTuples() == 0) {
+        // the recording ended or the sensor cannot be read anymore
+        return std::nullopt;
+    }
     return buf;
 }
 
@@ -59,10 +96,86 @@ std::string SenseSource::toString() const {
     return ss.str();
 }
 
-void SenseSource::fillBuffer(Runtime::TupleBuffer&) {}
+void SenseSource::fillBuffer(Runtime::TupleBuffer& buffer) {
+    if (!bus) {
+        return;
+    }
+    auto capacity = memoryLayout->getCapacity();
+    auto tuplesToRead = numberOfTuplesToProducePerBuffer == 0 ? capacity : std::min(capacity, numberOfTuplesToProducePerBuffer);
+    auto& fieldSizes = memoryLayout->getFieldSizes();
+    auto* bufferStart = buffer.getBuffer<uint8_t>();
+
+    uint64_t tupleCount = 0;
+    while (tupleCount < tuplesToRead && running) {
+        if (!bus->poll(0, static_cast<int>(tupleSize), tupleBytes.data())) {
+            x_DEBUG("SenseSource {}: cannot read from bus {}", operatorId, busPath);
+            break;
+        }
+        pollingTimeInMs += bus->getPollingInterval().count();
+        // the registers hold the fields in schema order, the memory layout decides where they go
+        uint64_t offsetInTuple = 0;
+        for (uint64_t fieldIndex = 0; fieldIndex < fieldSizes.size(); ++fieldIndex) {
+            std::memcpy(bufferStart + memoryLayout->getFieldOffset(tupleCount, fieldIndex),
+                        tupleBytes.data() + offsetInTuple,
+                        fieldSizes[fieldIndex]);
+            offsetInTuple += fieldSizes[fieldIndex];
+        }
+        ++tupleCount;
+    }
+    buffer.setNumberOfTuples(tupleCount);
+    generatedTuples += tupleCount;
+    generatedBuffers++;
+}
+
+void SenseSource::open() {
+    DataSource::open();
+    if (bus && !bus->init(busAddress)) {
+        x_THROW_RUNTIME_ERROR("SenseSource: cannot control sensor " << busAddress << " on bus " << busPath);
+    }
+}
+
+void SenseSource::close() {
+    if (bus) {
+        x_INFO("SenseSource {}: {} bus reads instead of {} on the configured interval of {}ms, saved {}%",
+               operatorId,
+               getNumberOfBusReads(),
+               getNumberOfBaselineBusReads(),
+               configuredGatheringInterval.count(),
+               getReadSavings() * 100);
+    }
+    DataSource::close();
+}
+
+bool SenseSource::supportsSourceExecutor() const { return !bus && DataSource::supportsSourceExecutor(); }
+
+void SenseSource::onGatheringIntervalChange(std::chrono::milliseconds newGatheringInterval) {
+    if (bus) {
+        x_TRACE("SenseSource {}: poll bus every {}ms", operatorId, newGatheringInterval.count());
+        bus->setPollingInterval(newGatheringInterval);
+    }
+}
 
 SourceType SenseSource::getType() const { return SourceType::SENSE_SOURCE; }
 
 const string& SenseSource::getUdfs() const { return udfs; }
 
+Sensors::GenericBusPtr SenseSource::getBus() const { return bus; }
+
+uint64_t SenseSource::getNumberOfBusReads() const { return bus ? bus->getNumberOfReads() : 0; }
+
+uint64_t SenseSource::getNumberOfBaselineBusReads() const {
+    if (configuredGatheringInterval.count() == 0) {
+        return getNumberOfBusReads();
+    }
+    return pollingTimeInMs / configuredGatheringInterval.count();
+}
+
+double SenseSource::getReadSavings() const {
+    auto baselineReads = getNumberOfBaselineBusReads();
+    if (baselineReads == 0) {
+        return 0;
+    }
+    return 1.0 - static_cast<double>(getNumberOfBusReads()) / static_cast<double>(baselineReads);
+}
+
 }// namespace x
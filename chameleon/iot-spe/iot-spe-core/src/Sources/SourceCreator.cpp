@@ -276,6 +276,7 @@ DataSourcePtr createSenseSource(const SchemaPtr& schema,
                                 const Runtime::BufferManagerPtr& bufferManager,
                                 const Runtime::QueryManagerPtr& queryManager,
                                 const std::string& udfs,
+                                const SenseSourceTypePtr& senseSourceType,
                                 OperatorId operatorId,
                                 OriginId originId,
                                 size_t numSourceLocalBuffers,
@@ -285,6 +286,7 @@ DataSourcePtr createSenseSource(const SchemaPtr& schema,
                                          bufferManager,
                                          queryManager,
                                          udfs,
+                                         senseSourceType,
                                          operatorId,
                                          originId,
                                          numSourceLocalBuffers,
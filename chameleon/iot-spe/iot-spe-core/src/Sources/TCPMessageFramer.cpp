@@ -0,0 +1,125 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Exceptions/RuntimeException.hpp>
+#include <Sources/TCPMessageFramer.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+
+namespace x {
+
+TCPMessageFramer::TCPMessageFramer(Configurations::TCPDecideMessageSize decideMessageSize,
+                                   char tupleSeparator,
+                                   uint64_t messageSize,
+                                   uint64_t bytesUsedForMessageSize,
+                                   uint64_t initialCapacity)
+    : decideMessageSize(decideMessageSize), tupleSeparator(tupleSeparator), messageSize(messageSize),
+      bytesUsedForMessageSize(bytesUsedForMessageSize), buffer(std::max<uint64_t>(initialCapacity, 1)) {
+    if (decideMessageSize == Configurations::TCPDecideMessageSize::USER_SPECIFIED_BUFFER_SIZE && messageSize == 0) {
+        x_THROW_RUNTIME_ERROR("TCPMessageFramer: the message size has to be larger than zero");
+    }
+    if (decideMessageSize == Configurations::TCPDecideMessageSize::BUFFER_SIZE_FROM_SOCKET && bytesUsedForMessageSize == 0) {
+        x_THROW_RUNTIME_ERROR("TCPMessageFramer: the size prefix of a message has to be larger than zero");
+    }
+}
+
+std::pair<char*, uint64_t> TCPMessageFramer::getWritableSpace() {
+    auto numberOfBufferedBytes = writePosition - readPosition;
+    auto neededBytes = std::max(requiredBytes, numberOfBufferedBytes + 1);
+    if (numberOfBufferedBytes == 0 || writePosition == buffer.size() || readPosition + neededBytes > buffer.size()) {
+        // only the bytes of the incomplete message are moved
+        std::memmove(buffer.data(), buffer.data() + readPosition, numberOfBufferedBytes);
+        scanPosition -= std::min(scanPosition, readPosition);
+        readPosition = 0;
+        writePosition = numberOfBufferedBytes;
+        if (neededBytes > buffer.size()) {
+            buffer.resize(std::max<uint64_t>(neededBytes, 2 * buffer.size()));
+        }
+    }
+    return {buffer.data() + writePosition, buffer.size() - writePosition};
+}
+
+void TCPMessageFramer::commitWrite(uint64_t numberOfBytes) {
+    x_ASSERT(writePosition + numberOfBytes <= buffer.size(), "TCPMessageFramer: more bytes written than space was free");
+    writePosition += numberOfBytes;
+}
+
+std::optional<std::string_view> TCPMessageFramer::nextMessage() {
+    while (readPosition < writePosition) {
+        auto* begin = buffer.data() + readPosition;
+        auto numberOfBufferedBytes = writePosition - readPosition;
+        std::string_view message;
+        switch (decideMessageSize) {
+            case Configurations::TCPDecideMessageSize::TUPLE_SEPARATOR: {
+                auto searchStart = std::max(scanPosition, readPosition);
+                auto* separator =
+                    static_cast<const char*>(memchr(buffer.data() + searchStart, tupleSeparator, writePosition - searchStart));
+                if (separator == nullptr) {
+                    scanPosition = writePosition;
+                    return std::nullopt;
+                }
+                message = std::string_view(begin, separator - begin);
+                readPosition += message.size() + 1;
+                break;
+            }
+            case Configurations::TCPDecideMessageSize::USER_SPECIFIED_BUFFER_SIZE: {
+                if (numberOfBufferedBytes < messageSize) {
+                    requiredBytes = messageSize;
+                    return std::nullopt;
+                }
+                message = std::string_view(begin, messageSize);
+                readPosition += messageSize;
+                break;
+            }
+            case Configurations::TCPDecideMessageSize::BUFFER_SIZE_FROM_SOCKET: {
+                if (numberOfBufferedBytes < bytesUsedForMessageSize) {
+                    requiredBytes = bytesUsedForMessageSize;
+                    return std::nullopt;
+                }
+                // the size prefix is decoded in place, leading blanks are allowed and trailing characters are ignored
+                const auto* prefixEnd = begin + bytesUsedForMessageSize;
+                const auto* digits = begin;
+                while (digits != prefixEnd && (*digits == ' ' || *digits == '\0')) {
+                    ++digits;
+                }
+                uint64_t size = 0;
+                auto [position, errorCode] = std::from_chars(digits, prefixEnd, size);
+                if (errorCode != std::errc() || position == digits) {
+                    x_THROW_RUNTIME_ERROR("TCPMessageFramer: invalid message size: "
+                                          << std::string_view(begin, bytesUsedForMessageSize));
+                }
+                if (numberOfBufferedBytes < bytesUsedForMessageSize + size) {
+                    requiredBytes = bytesUsedForMessageSize + size;
+                    return std::nullopt;
+                }
+                message = std::string_view(prefixEnd, size);
+                readPosition += bytesUsedForMessageSize + size;
+                break;
+            }
+        }
+        requiredBytes = 0;
+        if (!message.empty()) {
+            return message;
+        }
+    }
+    return std::nullopt;
+}
+
+uint64_t TCPMessageFramer::getNumberOfBufferedBytes() const { return writePosition - readPosition; }
+
+uint64_t TCPMessageFramer::getCapacity() const { return buffer.size(); }
+
+}// namespace x
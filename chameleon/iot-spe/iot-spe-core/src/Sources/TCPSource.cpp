@@ -21,6 +21,7 @@
 #include <Sources/Parsers/JSONParser.hpp>
 #include <Sources/TCPSource.hpp>
 #include <Util/Logger/Logger.hpp>
+#include <algorithm>
 #include <arpa/inet.h>
 #include <chrono>
 #include <cstring>
@@ -29,7 +30,7 @@
 #include <sstream>
 #include <string>
 #include <sys/socket.h>// For socket functions
-#include <unistd.h>    // For read
+#include <unistd.h>    // For close
 #include <utility>
 #include <vector>
 
@@ -54,7 +55,17 @@ TCPSource::TCPSource(SchemaPtr schema,
                  gatheringMode,
                  physicalSourceName,
                  std::move(executableSuccessors)),
-      tupleSize(schema->getSchemaSizeInBytes()), sourceConfig(std::move(tcpSourceType)), circularBuffer(2048) {
+      tupleSize(schema->getSchemaSizeInBytes()), sourceConfig(std::move(tcpSourceType)),
+      binaryInput(sourceConfig->getInputFormat()->getValue() == Configurations::InputFormat::BINARY),
+      receiveTuplesDirectly(binaryInput
+                            && sourceConfig->getDecideMessageSize()->getValue()
+                                != Configurations::TCPDecideMessageSize::BUFFER_SIZE_FROM_SOCKET),
+      messageFramer(receiveTuplesDirectly ? Configurations::TCPDecideMessageSize::TUPLE_SEPARATOR
+                                          : sourceConfig->getDecideMessageSize()->getValue(),
+                    sourceConfig->getTupleSeparator()->getValue(),
+                    sourceConfig->getSocketBufferSize()->getValue(),
+                    sourceConfig->getBytesUsedForSocketBufferSizeTransfer()->getValue()),
+      partialTuple(receiveTuplesDirectly ? tupleSize : 0) {
 
     //init physical types
     std::vector<std::string> schemaKeys;
@@ -78,6 +89,11 @@ TCPSource::TCPSource(SchemaPtr schema,
         case Configurations::InputFormat::CSV:
             inputParser = std::make_unique<CSVParser>(schema->getSize(), physicalTypes, ",");
             break;
+        case Configurations::InputFormat::BINARY:
+            if (!std::dynamic_pointer_cast<Runtime::MemoryLayouts::RowLayout>(memoryLayout)) {
+                x_THROW_RUNTIME_ERROR("TCPSource: the BINARY input format requires the row layout");
+            }
+            break;
     }
 
     x_TRACE("TCPSource::TCPSource: Init TCPSource.");
@@ -133,10 +149,15 @@ std::optional<Runtime::TupleBuffer> TCPSource::receiveData() {
             if (!running) {
                 return std::nullopt;
             }
-            fillBuffer(tupleBuffer);
+            if (!fillBuffer(tupleBuffer)) {
+                return std::nullopt;
+            }
+            if (tupleBuffer.getNumberOfTuples() == 0 && endOfStream) {
+                x_DEBUG("TCPSource::receiveData: the server closed the connection.");
+                return std::nullopt;
+            }
         } while (tupleBuffer.getNumberOfTuples() == 0);
     } catch (const std::exception& e) {
-        delete[] messageBuffer;
         x_ERROR("TCPSource::receiveData: Failed to fill the TupleBuffer. Error: {}.", e.what());
         throw e;
     }
@@ -155,128 +176,59 @@ bool TCPSource::fillBuffer(Runtime::MemoryLayouts::DynamicTupleBuffer& tupleBuff
     auto flushIntervalTimerStart = std::chrono::system_clock::now();
     //init flush interval value
     bool flushIntervalPassed = false;
-    //need this to indicate that the whole tuple was successfully received from the circular buffer
-    bool popped = true;
-    //init tuple size
-    uint64_t inputTupleSize = 0;
-    //init size of received data from socket with 0
-    int64_t bufferSizeReceived = 0;
+    //binary tuples are written to the buffer as they are, which requires the row layout
+    auto* tupleBufferStart = tupleBuffer.getBuffer().getBuffer<char>();
+    //the received bytes of the binary tuple at tupleCount, starting with the part that did not fit into the previous buffer
+    uint64_t bytesOfPartialTuple = partialTupleSize;
+    if (partialTupleSize > 0) {
+        std::memcpy(tupleBufferStart, partialTuple.data(), partialTupleSize);
+        partialTupleSize = 0;
+    }
     //receive data until tupleBuffer capacity reached or flushIntervalPassed
     while (tupleCount < tuplesThisPass && !flushIntervalPassed) {
-        //if circular buffer is not full obtain data from socket
-        if (!circularBuffer.full()) {
-            //create new buffer with size equal to free space in circular buffer
-            messageBuffer = new char[circularBuffer.capacity() - circularBuffer.size()];
-            //fill created buffer with data from socket. Socket returns the number of bytes it actually sent.
-            //might send more than one tuple at a time, hence we need to extract one tuple below in switch case.
-            //user needs to specify how to find out tuple size when creating TCPSource
-            bufferSizeReceived = read(sockfd, messageBuffer, circularBuffer.capacity() - circularBuffer.size());
-            //if read method returned -1 an error occurred during read.
-            if (bufferSizeReceived == -1) {
-                delete[] messageBuffer;
-                x_ERROR("TCPSource::fillBuffer: an error occurred while reading from socket. Error: {}", strerror(errno));
-                return false;
+        if (receiveTuplesDirectly) {
+            // fixed-size binary tuples are received directly into the free space of the tuple buffer
+            if (endOfStream) {
+                break;
             }
-            //if size of received data is not 0 (no data received), push received data to circular buffer
-            else if (bufferSizeReceived != 0) {
-                x_DEBUG("TCPSOURCE::fillBuffer: bytes send: {}.", bufferSizeReceived);
-                x_DEBUG("TCPSOURCE::fillBuffer: print current buffer: {}.", messageBuffer);
-                //push the received data into the circularBuffer
-                circularBuffer.push(messageBuffer, bufferSizeReceived);
+            auto filledBytes = tupleCount * tupleSize + bytesOfPartialTuple;
+            auto bytesReceived = receive(tupleBufferStart + filledBytes, tuplesThisPass * tupleSize - filledBytes);
+            if (bytesReceived < 0) {
+                return false;
             }
-            //delete allocated buffer
-            delete[] messageBuffer;
-        }
-
-        if (!circularBuffer.empty()) {
-            //switch case depends on the message receiving that was chosen when creating the source. Three choices are available:
-            switch (sourceConfig->getDecideMessageSize()->getValue()) {
-                // The user inputted a tuple separator that indicates the end of a tuple. We're going to search for that
-                // tuple seperator and assume that all data until then belongs to the current tuple
-                case Configurations::TCPDecideMessageSize::TUPLE_SEPARATOR:
-                    try {
-                        // search the circularBuffer until Tuple seperator is found to obtain size of tuple
-                        inputTupleSize = sizeUntilSearchToken(sourceConfig->getTupleSeparator()->getValue());
-                        // allocate buffer with size of tuple
-                        messageBuffer = new char[inputTupleSize];
-                        x_DEBUG("TCPSOURCE::fillBuffer: Pop Bytes from Circular Buffer to obtain Tuple of size: '{}'.",
-                                  inputTupleSize);
-                        x_DEBUG("TCPSOURCE::fillBuffer: current circular buffer size: '{}'.", circularBuffer.size());
-                        //copy and delete tuple from circularBuffer, delete tuple separator
-                        popped = popGivenNumberOfValues(inputTupleSize, true);
-                        break;
-                    } catch (const std::exception& e) {
-                        x_ERROR("Failed to obtain tupleSize searching for separator token. Error: {}", e.what());
-                        throw e;
+            filledBytes += bytesReceived;
+            tupleCount = filledBytes / tupleSize;
+            bytesOfPartialTuple = filledBytes % tupleSize;
+        } else if (binaryInput) {
+            // each message of a binary stream holds whole tuples, which are copied without a parser
+            if (pendingMessage.empty()) {
+                if (auto nextMessage = messageFramer.nextMessage()) {
+                    if (nextMessage->size() % tupleSize != 0) {
+                        x_THROW_RUNTIME_ERROR("TCPSource::fillBuffer: binary message of " << nextMessage->size()
+                                                                                          << " bytes does not hold whole tuples of "
+                                                                                          << tupleSize << " bytes");
                     }
-                // The user inputted a fixed buffer size.
-                case Configurations::TCPDecideMessageSize::USER_SPECIFIED_BUFFER_SIZE:
-                    try {
-                        //set tupleSize to user specified tuple size
-                        inputTupleSize = sourceConfig->getSocketBufferSize()->getValue();
-                        //allocate buffer with tupleSize
-                        messageBuffer = new char[inputTupleSize];
-                        x_DEBUG("TCPSOURCE::fillBuffer: Pop Bytes from Circular Buffer to obtain Tuple of size: '{}'.",
-                                  inputTupleSize);
-                        x_DEBUG("TCPSOURCE::fillBuffer: current circular buffer size: '{}'.", circularBuffer.size());
-                        //copy and delete tuple from circularBuffer
-                        popped = popGivenNumberOfValues(inputTupleSize, false);
-                    } catch (const std::exception& e) {
-                        x_ERROR("Failed to obtain tupleSize with user inputted size. Error: {}", e.what());
-                        throw e;
-                    }
-                    break;
-                // Before each message, the server uses a fixed number of bytes (bytesUsedForSocketBufferSizeTransfer)
-                // to indicate the size of the next tuple.
-                case Configurations::TCPDecideMessageSize::BUFFER_SIZE_FROM_SOCKET:
-                    //when receiving buffer size from socket, we need to check that the buffer was actually popped during the last run, otherwise,
-                    //we loose the transmitted size and obtain bytes from the tuple that weren't meant to transmit the size.
-                    //This might happen if the size of the tuple was sent and popped, but we only received half of the tuple
-                    //then we won't overwrite the tupleSize but try again to pop the next message.
-                    if (popped) {
-                        try {
-                            x_DEBUG("TCPSOURCE::fillBuffer: obtain socket buffer size");
-                            //create buffer to save buffer size from socket in aka the number of bytes indicating the size of the next tuple
-                            messageBuffer = new char[sourceConfig->getBytesUsedForSocketBufferSizeTransfer()->getValue() + 1];
-                            //copy and delete the size of the next tuple from the circular buffer
-                            popped = popGivenNumberOfValues(sourceConfig->getBytesUsedForSocketBufferSizeTransfer()->getValue(),
-                                                            false);
-                            x_DEBUG("TCPSOURCE::fillBuffer: socket buffer size is: {}.", messageBuffer);
-                            //if we successfully obtained the tuple size from the buffer convert bufferSizeFromSocket to an integer and delete the char*
-                            if (popped) {
-                                inputTupleSize = std::stoi(messageBuffer);
-                                x_DEBUG("TCPSOURCE::fillBuffer: socket buffer size is: {}.", inputTupleSize);
-                            }
-                            delete[] messageBuffer;
-                        } catch (const std::exception& e) {
-                            x_ERROR("TCPSource::fillBuffer: Failed to retrieve the tupleSize from Message Buffer. Error: {}",
-                                      e.what());
-                            throw e;
-                        }
-                    }
-                    //allocate the messageBuffer for one tuple with the new tupleSize
-                    messageBuffer = new char[inputTupleSize + 1];
-                    x_TRACE("Pop Bytes from Circular Buffer to obtain Tuple of size: '{}'.", inputTupleSize);
-                    x_TRACE("current circular buffer size: '{}'.", circularBuffer.size());
-                    //obtain the tuple from the circular buffer
-                    popped = popGivenNumberOfValues(inputTupleSize, false);
+                    pendingMessage = *nextMessage;
+                } else if (endOfStream) {
                     break;
-            }
-
-            x_TRACE("TCPSOURCE::fillBuffer: Successfully prepared tuples? '{}'", popped);
-            //if we were able to obtain a complete tuple from the circular buffer, we are going to forward it ot the appropriate parser
-            if (inputTupleSize != 0 && popped) {
-                std::string buf(messageBuffer, inputTupleSize);
-                x_TRACE("TCPSOURCE::fillBuffer: Client consume message: '{}'.", buf);
-                if (sourceConfig->getInputFormat()->getValue() == Configurations::InputFormat::JSON) {
-                    x_TRACE("TCPSOURCE::fillBuffer: Client consume message: '{}'.", buf);
-                    inputParser->writeInputTupleToTupleBuffer(buf, tupleCount, tupleBuffer, schema, localBufferManager);
-                } else {
-                    inputParser->writeInputTupleToTupleBuffer(buf, tupleCount, tupleBuffer, schema, localBufferManager);
+                } else if (!receiveMessages()) {
+                    return false;
                 }
-                tupleCount++;
             }
-            delete[] messageBuffer;
+            auto numberOfTuples = std::min(pendingMessage.size() / tupleSize, tuplesThisPass - tupleCount);
+            std::memcpy(tupleBufferStart + tupleCount * tupleSize, pendingMessage.data(), numberOfTuples * tupleSize);
+            pendingMessage.remove_prefix(numberOfTuples * tupleSize);
+            tupleCount += numberOfTuples;
+        } else if (auto nextMessage = messageFramer.nextMessage()) {
+            // the message is decoded in place, only the parsers need it as string
+            message.assign(nextMessage->data(), nextMessage->size());
+            x_TRACE("TCPSOURCE::fillBuffer: Client consume message: '{}'.", message);
+            inputParser->writeInputTupleToTupleBuffer(message, tupleCount, tupleBuffer, schema, localBufferManager);
+            tupleCount++;
+        } else if (endOfStream) {
+            break;
+        } else if (!receiveMessages()) {
+            return false;
         }
         // If bufferFlushIntervalMs was defined by the user (> 0), we check whether the time on receiving
         // and writing data exceeds the user defined limit (bufferFlushIntervalMs).
@@ -289,36 +241,39 @@ bool TCPSource::fillBuffer(Runtime::MemoryLayouts::DynamicTupleBuffer& tupleBuff
             flushIntervalPassed = true;
         }
     }
+    if (bytesOfPartialTuple > 0) {
+        // keep the received part of the next tuple for the next buffer
+        std::memcpy(partialTuple.data(), tupleBufferStart + tupleCount * tupleSize, bytesOfPartialTuple);
+        partialTupleSize = bytesOfPartialTuple;
+    }
     tupleBuffer.setNumberOfTuples(tupleCount);
     generatedTuples += tupleCount;
     generatedBuffers++;
     return true;
 }
 
-uint64_t TCPSource::sizeUntilSearchToken(char token) {
-    uint64_t places = 0;
-    for (auto itr = circularBuffer.end() - 1; itr != circularBuffer.begin() - 1; --itr) {
-        if (*itr == token) {
-            return places;
-        }
-        ++places;
+int64_t TCPSource::receive(char* target, uint64_t size) {
+    int64_t bytesReceived;
+    do {
+        bytesReceived = recv(sockfd, target, size, 0);
+    } while (bytesReceived < 0 && errno == EINTR);
+    if (bytesReceived < 0) {
+        x_ERROR("TCPSource::fillBuffer: an error occurred while reading from socket. Error: {}", strerror(errno));
+    } else if (bytesReceived == 0) {
+        endOfStream = true;
     }
-    return places;
+    x_TRACE("TCPSOURCE::fillBuffer: bytes received: {}.", bytesReceived);
+    return bytesReceived;
 }
 
-bool TCPSource::popGivenNumberOfValues(uint64_t numberOfValuesToPop, bool popTextDivider) {
-    if (circularBuffer.size() >= numberOfValuesToPop) {
-        for (uint64_t i = 0; i < numberOfValuesToPop; ++i) {
-            char popped = circularBuffer.pop();
-            messageBuffer[i] = popped;
-        }
-        messageBuffer[numberOfValuesToPop] = '\0';
-        if (popTextDivider) {
-            circularBuffer.pop();
-        }
-        return true;
+bool TCPSource::receiveMessages() {
+    auto [freeSpace, freeSpaceSize] = messageFramer.getWritableSpace();
+    auto bytesReceived = receive(freeSpace, freeSpaceSize);
+    if (bytesReceived < 0) {
+        return false;
     }
-    return false;
+    messageFramer.commitWrite(bytesReceived);
+    return true;
 }
 
 void TCPSource::close() {
@@ -16,6 +16,7 @@
 #include <Runtime/QueryManager.hpp>
 #include <Sources/ZmqSource.hpp>
 #include <Util/Logger/Logger.hpp>
+#include <array>
 #include <cstdint>
 #include <cstring>
 
@@ -64,35 +65,25 @@ std::optional<Runtime::TupleBuffer> ZmqSource::receiveData() {
     x_DEBUG("ZMQSource: receiveData ", this->toString());
     if (connect()) {
         try {
-
-            // Receive metadata
-            auto const metadataSize = sizeof(uint64_t) * 2;
-            zmq::message_t metadata{metadataSize};
-
-            // TODO: Clarify following comment: envelope - not needed at the moment
-            if (auto const receivedSize = socket.recv(metadata).value_or(0); receivedSize != metadataSize) {
-                x_ERROR("ZMQSource: Error: Unexpected payload size. Expected: {} Received: {}", metadataSize, receivedSize);
-                return std::nullopt;
-            }
-
-            auto buffer = bufferManager->getBufferBlocking();
-            buffer.setNumberOfTuples(static_cast<uint64_t*>(metadata.data())[0]);
-            buffer.setWatermark(static_cast<uint64_t*>(metadata.data())[1]);
-            x_DEBUG("ZMQSource received #tups  {}  watermark= {}", buffer.getNumberOfTuples(), buffer.getWatermark());
-
-            // Receive payload
-            // XXX: I guess we don't actually know the size here, it would be nice to be able to check that here
-            zmq::mutable_buffer payload{buffer.getBuffer(), buffer.getBufferSize()};
-            if (auto const receivedSize = socket.recv(payload); !receivedSize.has_value()) {
-                x_ERROR("ZMQSource: Error: Unexpected payload size. Expected: {} Received: {}",
-                          buffer.getBufferSize(),
-                          receivedSize.has_value());
-                return std::nullopt;
-            } else {
-                x_DEBUG("ZMQSource: received buffer of size  {}", receivedSize.has_value());
-                return buffer;
+            // Wait for the first buffer, then take the buffers that are already queued on the socket, at most one per
+            // local buffer. They are handed out one per call, so the running routine emits and counts each of them.
+            if (receivedBuffers.empty()) {
+                auto buffer = receiveBuffer(zmq::recv_flags::none);
+                if (!buffer.has_value()) {
+                    return std::nullopt;
+                }
+                receivedBuffers.emplace_back(std::move(buffer.value()));
+                while (receivedBuffers.size() < numSourceLocalBuffers) {
+                    auto nextBuffer = receiveBuffer(zmq::recv_flags::dontwait);
+                    if (!nextBuffer.has_value()) {
+                        break;
+                    }
+                    receivedBuffers.emplace_back(std::move(nextBuffer.value()));
+                }
             }
-
+            auto buffer = std::move(receivedBuffers.front());
+            receivedBuffers.pop_front();
+            return buffer;
         } catch (const zmq::error_t& ex) {
             x_ERROR("ZMQSOURCE error: {}", ex.what());
             return std::nullopt;
@@ -106,6 +97,47 @@ std::optional<Runtime::TupleBuffer> ZmqSource::receiveData() {
     }
 }
 
+std::optional<Runtime::TupleBuffer> ZmqSource::receiveBuffer(zmq::recv_flags flags) {
+    // Receive metadata, i.e., number of tuples and watermark, without allocating a message
+    std::array<uint64_t, 2> metadata{};
+    auto const metadataSize = socket.recv(zmq::mutable_buffer(metadata.data(), sizeof(metadata)), flags);
+    if (!metadataSize.has_value()) {
+        return std::nullopt;// nothing queued
+    }
+    if (metadataSize->truncated() || metadataSize->size != sizeof(metadata)) {
+        x_ERROR("ZMQSource: Error: Unexpected metadata size. Expected: {} Received: {}",
+                sizeof(metadata),
+                metadataSize->untruncated_size);
+        // drop the remaining parts of the malformed message, so that the next receive starts at an envelope
+        while (socket.get(zmq::sockopt::rcvmore)) {
+            zmq::message_t part;
+            (void) socket.recv(part);
+        }
+        return std::nullopt;
+    }
+    if (!socket.get(zmq::sockopt::rcvmore)) {
+        x_ERROR("ZMQSource: Error: Received metadata without payload");
+        return std::nullopt;
+    }
+
+    // Receive payload directly into the pooled buffer, it is the second part of the same message
+    auto buffer = bufferManager->getBufferBlocking();
+    auto const payloadSize = socket.recv(zmq::mutable_buffer(buffer.getBuffer(), buffer.getBufferSize()));
+    if (!payloadSize.has_value() || payloadSize->truncated()) {
+        x_ERROR("ZMQSource: Error: Unexpected payload size. Expected at most: {} Received: {}",
+                buffer.getBufferSize(),
+                payloadSize.has_value() ? payloadSize->untruncated_size : 0);
+        return std::nullopt;
+    }
+    buffer.setNumberOfTuples(metadata[0]);
+    buffer.setWatermark(metadata[1]);
+    x_DEBUG("ZMQSource received #tups  {}  watermark= {} size= {}",
+            buffer.getNumberOfTuples(),
+            buffer.getWatermark(),
+            payloadSize->size);
+    return buffer;
+}
+
 std::string ZmqSource::toString() const {
     std::stringstream ss;
     ss << "ZMQ_SOURCE(";
@@ -0,0 +1,83 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Util/GatheringPolicy.hpp>
+#include <Util/KalmanFilterBase.hpp>
+#include <sstream>
+
+namespace x {
+
+bool GatheringPolicy::empty() const {
+    return !gatheringInterval && !gatheringIntervalRange && !slowestInterval && !fastestInterval && !lambda;
+}
+
+void GatheringPolicy::merge(const GatheringPolicy& other) {
+    if (other.gatheringInterval) {
+        gatheringInterval = other.gatheringInterval;
+    }
+    if (other.gatheringIntervalRange) {
+        gatheringIntervalRange = other.gatheringIntervalRange;
+    }
+    if (other.slowestInterval) {
+        slowestInterval = other.slowestInterval;
+    }
+    if (other.fastestInterval) {
+        fastestInterval = other.fastestInterval;
+    }
+    if (other.lambda) {
+        lambda = other.lambda;
+    }
+}
+
+void GatheringPolicy::applyTo(KalmanFilterBase& kFilter) const {
+    if (gatheringInterval) {
+        kFilter.setGatheringInterval(gatheringInterval.value());
+    }
+    if (gatheringIntervalRange) {
+        kFilter.setGatheringIntervalRange(gatheringIntervalRange.value());
+    }
+    if (fastestInterval) {
+        kFilter.setFastestInterval(fastestInterval.value());
+    }
+    if (slowestInterval) {
+        kFilter.setSlowestInterval(slowestInterval.value());
+    }
+    if (lambda) {
+        kFilter.setLambda(lambda.value());
+    }
+}
+
+std::string GatheringPolicy::toString() const {
+    std::stringstream ss;
+    ss << "GatheringPolicy(";
+    if (gatheringInterval) {
+        ss << "gatheringInterval=" << gatheringInterval->count() << "ms ";
+    }
+    if (gatheringIntervalRange) {
+        ss << "gatheringIntervalRange=" << gatheringIntervalRange->count() << "ms ";
+    }
+    if (slowestInterval) {
+        ss << "slowestInterval=" << slowestInterval->count() << "ms ";
+    }
+    if (fastestInterval) {
+        ss << "fastestInterval=" << fastestInterval->count() << "ms ";
+    }
+    if (lambda) {
+        ss << "lambda=" << lambda.value();
+    }
+    ss << ")";
+    return ss.str();
+}
+
+}// namespace x
@@ -0,0 +1,165 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Util/GroupCommitFileWriter.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/ThreadNaming.hpp>
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+namespace x::Util {
+
+GroupCommitFileWriter::GroupCommitFileWriter(const std::string& filePath,
+                                             bool syncToDisk,
+                                             uint64_t maxBatchSizeInBytes,
+                                             uint64_t queueCapacity)
+    : filePath(filePath), syncToDisk(syncToDisk), maxBatchSizeInBytes(std::max<uint64_t>(maxBatchSizeInBytes, 1)),
+      pendingWrites(std::max<uint64_t>(queueCapacity, 1)) {
+    fileDescriptor = ::open(filePath.c_str(), O_WRONLY | O_CREAT | O_CLOEXEC, 0644);
+    if (fileDescriptor < 0) {
+        x_THROW_RUNTIME_ERROR("GroupCommitFileWriter: cannot open file " << filePath << ". Error: " << strerror(errno));
+    }
+    auto fileSize = ::lseek(fileDescriptor, 0, SEEK_END);
+    if (fileSize < 0) {
+        ::close(fileDescriptor);
+        x_THROW_RUNTIME_ERROR("GroupCommitFileWriter: cannot seek to the end of file " << filePath
+                                                                                      << ". Error: " << strerror(errno));
+    }
+    fileOffset = fileSize;
+    writerThread = std::thread([this]() {
+        setThreadName("FileWriter");
+        writerRoutine();
+    });
+    x_DEBUG("GroupCommitFileWriter: opened file {} at offset {} syncToDisk={}", filePath, fileOffset, syncToDisk);
+}
+
+GroupCommitFileWriter::~GroupCommitFileWriter() { stop(); }
+
+bool GroupCommitFileWriter::write(std::string data, std::function<void()> onWritten) {
+    if (!running || failed) {
+        x_ERROR("GroupCommitFileWriter: cannot write to file {}, the writer is {}", filePath, failed ? "failed" : "stopped");
+        return false;
+    }
+    // blocks only if the writer thread falls behind by queueCapacity writes
+    pendingWrites.blockingWrite(PendingWrite{std::move(data), std::move(onWritten)});
+    return true;
+}
+
+bool GroupCommitFileWriter::stop() {
+    bool expected = true;
+    if (running.compare_exchange_strong(expected, false)) {
+        pendingWrites.blockingWrite(PendingWrite{{}, {}, true});
+        writerThread.join();
+        if (::close(fileDescriptor) != 0) {
+            x_ERROR("GroupCommitFileWriter: cannot close file {}. Error: {}", filePath, strerror(errno));
+            failed = true;
+        }
+        x_DEBUG("GroupCommitFileWriter: closed file {} after {} bytes in {} batches",
+                  filePath,
+                  numberOfWrittenBytes.load(),
+                  numberOfBatches.load());
+    }
+    return !failed;
+}
+
+uint64_t GroupCommitFileWriter::getNumberOfWrittenBytes() const { return numberOfWrittenBytes; }
+
+uint64_t GroupCommitFileWriter::getNumberOfBatches() const { return numberOfBatches; }
+
+void GroupCommitFileWriter::writerRoutine() {
+    std::vector<PendingWrite> batch;
+    bool stopped = false;
+    while (!stopped) {
+        PendingWrite pendingWrite;
+        pendingWrites.blockingRead(pendingWrite);
+        // everything that queued up while the last batch was written goes into the next one
+        uint64_t batchSizeInBytes = 0;
+        do {
+            if (pendingWrite.isStopMarker) {
+                stopped = true;
+                break;
+            }
+            batchSizeInBytes += pendingWrite.data.size();
+            batch.emplace_back(std::move(pendingWrite));
+        } while (batchSizeInBytes < maxBatchSizeInBytes && pendingWrites.read(pendingWrite));
+
+        if (!batch.empty() && !failed) {
+            try {
+                if (writeBatch(batch)) {
+                    for (auto& write : batch) {
+                        if (write.onWritten) {
+                            write.onWritten();
+                        }
+                    }
+                } else {
+                    failed = true;
+                }
+            } catch (std::exception const& exception) {
+                x_ERROR("GroupCommitFileWriter: completion of a batch for file {} failed with {}", filePath, exception.what());
+                failed = true;
+            }
+        }
+        batch.clear();
+    }
+}
+
+bool GroupCommitFileWriter::writeBatch(std::vector<PendingWrite>& batch) {
+    std::vector<iovec> ioVectors;
+    ioVectors.reserve(batch.size());
+    for (auto& write : batch) {
+        if (!write.data.empty()) {
+            ioVectors.emplace_back(iovec{write.data.data(), write.data.size()});
+        }
+    }
+
+    uint64_t nextVector = 0;
+    while (nextVector < ioVectors.size()) {
+        auto numberOfVectors = std::min<uint64_t>(ioVectors.size() - nextVector, IOV_MAX);
+        auto writtenBytes = ::pwritev(fileDescriptor, &ioVectors[nextVector], numberOfVectors, fileOffset);
+        if (writtenBytes < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            x_ERROR("GroupCommitFileWriter: cannot write to file {}. Error: {}", filePath, strerror(errno));
+            return false;
+        }
+        fileOffset += writtenBytes;
+        numberOfWrittenBytes += writtenBytes;
+
+        // skip the completely written vectors and continue a partial write where it stopped
+        auto remainingBytes = static_cast<uint64_t>(writtenBytes);
+        while (remainingBytes > 0 && remainingBytes >= ioVectors[nextVector].iov_len) {
+            remainingBytes -= ioVectors[nextVector].iov_len;
+            ++nextVector;
+        }
+        if (remainingBytes > 0) {
+            ioVectors[nextVector].iov_base = static_cast<char*>(ioVectors[nextVector].iov_base) + remainingBytes;
+            ioVectors[nextVector].iov_len -= remainingBytes;
+        }
+    }
+
+    if (syncToDisk && ::fdatasync(fileDescriptor) != 0) {
+        x_ERROR("GroupCommitFileWriter: cannot sync file {}. Error: {}", filePath, strerror(errno));
+        return false;
+    }
+    ++numberOfBatches;
+    return true;
+}
+
+}// namespace x::Util
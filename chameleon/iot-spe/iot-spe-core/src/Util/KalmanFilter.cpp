@@ -13,17 +13,13 @@
 */
 
 #include <API/Schema.hpp>
-#include <Runtime/TupleBuffer.hpp>
-#include <Sensors/Values/SingleSensor.hpp>
 #include <Util/KalmanFilter.hpp>
 #include <Util/Logger/Logger.hpp>
 #include <cmath>
 #include <ctime>
 
 namespace x {
-KalmanFilter::KalmanFilter(const uint64_t errorWindowSize) : kfErrorWindow(errorWindowSize) {
-    this->calculateTotalEstimationErrorDivider(errorWindowSize);
-};
+KalmanFilter::KalmanFilter(const uint64_t errorWindowSize) : KalmanFilterBase(errorWindowSize){};
 
 KalmanFilter::KalmanFilter(double timeStep,
                            const Eigen::MatrixXd F,
@@ -32,11 +28,17 @@ KalmanFilter::KalmanFilter(double timeStep,
                            const Eigen::MatrixXd R,
                            const Eigen::MatrixXd P,
                            const uint64_t errorWindowSize)
-    : m(H.rows()), n(F.rows()), stateTransitionModel(F), observationModel(H), processNoiseCovariance(Q),
-      measurementNoiseCovariance(R), estimateCovariance(P), identityMatrix(n, n), xHat(n), xHatNew(n), innovationError(n),
-      valueVector(1), timeStep(timeStep), kfErrorWindow(errorWindowSize) {
-    this->calculateTotalEstimationErrorDivider(errorWindowSize);
+    : KalmanFilterBase(errorWindowSize), m(H.rows()), n(F.rows()), stateTransitionModel(F), observationModel(H),
+      processNoiseCovariance(Q), measurementNoiseCovariance(R), estimateCovariance(P), identityMatrix(n, n), xHat(n), xHatNew(n),
+      innovationError(n), valueVector(1) {
+    this->timeStep = timeStep;
     identityMatrix.setIdentity();
+    xHat.setZero();
+}
+
+std::unique_ptr<KalmanFilter> KalmanFilter::createRandomWalk(uint64_t numberOfValues, uint64_t errorWindowSize) {
+    Eigen::MatrixXd identity = Eigen::MatrixXd::Identity(numberOfValues, numberOfValues);
+    return std::make_unique<KalmanFilter>(1.0 / 30, identity, identity, .05 * identity, 5 * identity, 10 * identity, errorWindowSize);
 }
 
 void KalmanFilter::init() {
@@ -122,9 +124,8 @@ void KalmanFilter::update(const Eigen::VectorXd& measuredValues) {
         (identityMatrix - kalmanGain * observationModel) * estimateCovariance;// updated a-posteriori estimate covariance
     xHat = xHatNew;                                                           // updated xHat
 
-    // update estimation error, eq.8
-    this->estimationError =
-        std::sqrt(((innovationError * measuredValues.inverse()) * (innovationError * measuredValues.inverse())).trace());
+    // update estimation error, eq.8, relative innovation error per measurement
+    this->estimationError = (innovationError.array() / measuredValues.array()).matrix().norm();
     this->kfErrorWindow.emplace(this->estimationError);// store result in error window
     // update timestep
     currentTime += timeStep;
@@ -141,133 +142,19 @@ void KalmanFilter::update(const Eigen::VectorXd& measuredValues, double newTimeS
     this->update(measuredValues);
 }
 
-double KalmanFilter::getTotalEstimationError() { return this->calculateTotalEstimationError(); }
-
-float KalmanFilter::calculateTotalEstimationError() {
-    float j = 1;// eq. 9 iterator
-    float totalError = 0;
-    for (auto errorValue : kfErrorWindow) {
-        totalError += (errorValue / j);
-        ++j;
-    }
-    return totalError / totalEstimationErrorDivider;
-}
-
-void KalmanFilter::calculateTotalEstimationErrorDivider(int size) {
-    totalEstimationErrorDivider = size > 0 ? 0 : 1;
-    for (int i = 1; i <= size; ++i) {
-        totalEstimationErrorDivider += (1.0 / i);
-    }
-}
-
-std::chrono::milliseconds KalmanFilter::getNewGatheringIntervalBaseline() {
-    // eq. 10
-    auto totalEstimationError = this->calculateTotalEstimationError();
-    auto powerOfEuler = (totalEstimationError + lambda) / lambda;
-    auto thetaPart = theta * (1 - std::pow(eulerConstant, powerOfEuler));
-    auto newGatheringIntervalCandidate = this->gatheringInterval.count() + thetaPart;
-    if (newGatheringIntervalCandidate >= gatheringIntervalReceived.count() - (gatheringIntervalRange.count() / 2)
-        && newGatheringIntervalCandidate <= gatheringIntervalReceived.count() + (gatheringIntervalRange.count() / 2)) {// eq. 7
-        // remove fractional part from double
-        this->gatheringInterval = std::chrono::milliseconds((int) trunc(newGatheringIntervalCandidate));
-    }
-    return this->gatheringInterval;
-}
-
-std::chrono::milliseconds KalmanFilter::getNewGatheringInterval() {
-    auto currentEstimationError = this->getEstimationErrorDifference();
-    if (currentEstimationError > 0.6) {  // indicates immediate change
-        auto frequencyCandidate = this->frequencyExponentialDecay();
-        if (frequencyCandidate < this->fastestInterval.count()) {
-            this->gatheringInterval = this->fastestInterval;
-        } else {
-            this->gatheringInterval = std::chrono::milliseconds((int) trunc(frequencyCandidate));
-        }
-    } else if (currentEstimationError < .24) {  // indicates consecutive similarity
-        auto frequencyCandidate = this->frequencyExponentialGrowth();
-        if (frequencyCandidate > this->slowestInterval.count()) {
-            this->gatheringInterval = this->slowestInterval;
-        } else {
-            this->gatheringInterval = std::chrono::milliseconds((int) trunc(frequencyCandidate));
-        }
-    }
-    return this->gatheringInterval;
-}
-
-void KalmanFilter::updateFromTupleBuffer(Runtime::TupleBuffer& tupleBuffer) {
-    auto numOfTuples = tupleBuffer.getNumberOfTuples();
-    auto records = tupleBuffer.getBuffer<Sensors::SingleSensor>();
-    for (uint64_t i = 0; i < numOfTuples; ++i) {
-        this->valueVector << records[i].value;
+void KalmanFilter::updateFromValues(const double* measurements, uint64_t numberOfMeasurements) {
+    auto measurementSize = getMeasurementSize();
+    this->valueVector.resize(measurementSize);
+    for (uint64_t i = 0; i < numberOfMeasurements; ++i) {
+        this->valueVector = Eigen::Map<const Eigen::VectorXd>(measurements + i * measurementSize, measurementSize);
         this->update(valueVector);
     }
 }
 
-double KalmanFilter::getCurrentStep() { return currentTime; }
+uint64_t KalmanFilter::getMeasurementSize() const { return observationModel.rows(); }
+
 Eigen::VectorXd KalmanFilter::getState() { return xHat; }
 Eigen::MatrixXd KalmanFilter::getError() { return estimateCovariance; }
 Eigen::MatrixXd KalmanFilter::getInnovationError() { return innovationError; }
-double KalmanFilter::getEstimationError() { return estimationError; }
-double KalmanFilter::getEstimationErrorDifference() { return kfErrorWindow[0] - kfErrorWindow[1]; }
-uint64_t KalmanFilter::getTheta() { return theta; }
-float KalmanFilter::getLambda() { return lambda; }
-
-void KalmanFilter::setLambda(float newLambda) { this->lambda = newLambda; }
-
-void KalmanFilter::setGatheringInterval(std::chrono::milliseconds gatheringIntervalInMillis) {
-    this->gatheringInterval = gatheringIntervalInMillis;
-    this->gatheringIntervalReceived = gatheringIntervalInMillis;
-    this->initialInterval = gatheringIntervalInMillis;
-    this->slowestInterval = std::chrono::milliseconds((int) trunc(gatheringIntervalInMillis.count() * 1.5));
-    this->fastestInterval = std::chrono::milliseconds((int) trunc(gatheringIntervalInMillis.count() * 0.5));
-}
-
-void KalmanFilter::setGatheringIntervalRange(std::chrono::milliseconds gatheringIntervalRange) {
-    this->gatheringIntervalRange = gatheringIntervalRange;
-}
-
-void KalmanFilter::setGatheringIntervalWithRange(std::chrono::milliseconds gatheringIntervalInMillis,
-                                                 std::chrono::milliseconds gatheringIntervalRange) {
-    this->setGatheringInterval(gatheringIntervalInMillis);
-    this->setGatheringIntervalRange(gatheringIntervalRange);
-}
-
-void KalmanFilter::setSlowestInterval(std::chrono::milliseconds gatheringIntervalInMillis) {
-    x_TRACE("KalmanFilter::setSlowestInterval: {}ms to {}ms", this->slowestInterval.count(), gatheringIntervalInMillis.count());
-    this->slowestInterval = gatheringIntervalInMillis;
-    if (this->slowestInterval < this->fastestInterval) {
-        this->fastestInterval = 3 * this->slowestInterval;
-    }
-}
-
-void KalmanFilter::setFastestInterval(std::chrono::milliseconds gatheringIntervalInMillis) {
-    this->fastestInterval = gatheringIntervalInMillis;
-}
-
-double KalmanFilter::frequencyExponentialDecay() {
-    auto newCandidate = this->gatheringInterval.count() * std::pow((1 - .25), this->decreaseCounter);
-    if (std::isinf(newCandidate)) {
-        return this->gatheringInterval.count();
-    }
-    if (decreaseCounter < this->maxValue) {
-        ++this->decreaseCounter;
-    }
-    this->increaseCounter = 1;
-    return newCandidate;
-}
-
-double KalmanFilter::frequencyExponentialGrowth() {
-    auto newCandidate = this->gatheringInterval.count() * std::pow((1 + .25), this->increaseCounter);
-    if (std::isinf(newCandidate)) {
-        return this->gatheringInterval.count();
-    }
-    if (increaseCounter < this->maxValue) {
-        ++this->increaseCounter;
-    }
-    this->decreaseCounter = 1;
-    return newCandidate;
-}
-
-std::chrono::milliseconds KalmanFilter::getCurrentGatheringInterval() { return this->gatheringInterval; }
 
 }// namespace x
\ No newline at end of file
@@ -0,0 +1,245 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Util/KalmanFilterBank.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <cmath>
+#include <ctime>
+#ifdef HAS_AVX
+#include <immintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace x {
+
+/**
+ * @brief View on one filter of the bank. Keeps the error window and
+ * gathering interval of that filter, the state lives in the bank.
+ */
+class KalmanFilterBank::BankedFilter : public KalmanFilterBase {
+  public:
+    BankedFilter(KalmanFilterBank& bank, uint64_t filterId, uint64_t errorWindowSize)
+        : KalmanFilterBase(errorWindowSize), bank(bank), filterId(filterId) {
+        this->timeStep = bank.model.timeStep;
+        this->initialTimestamp = std::time(nullptr);
+        this->currentTime = this->initialTimestamp;
+    }
+
+    void init() override {
+        bank.reset(filterId);
+        this->initialTimestamp = std::time(nullptr);
+        this->currentTime = this->initialTimestamp;
+    }
+
+    void updateFromValues(const double* measurements, uint64_t numberOfMeasurements) override {
+        for (uint64_t i = 0; i < numberOfMeasurements; ++i) {
+            bank.update(filterId, measurements[i]);
+        }
+    }
+
+    [[nodiscard]] uint64_t getMeasurementSize() const override { return 1; }
+
+    void recordEstimationError(double error) {
+        this->estimationError = error;
+        this->kfErrorWindow.emplace(error);// store result in error window
+        this->currentTime += this->timeStep;
+    }
+
+  private:
+    KalmanFilterBank& bank;
+    uint64_t filterId;
+};
+
+KalmanFilterBank::KalmanFilterBank(uint64_t numberOfFilters, Model model, uint64_t errorWindowSize)
+    : numberOfFilters(numberOfFilters), model(model), value(numberOfFilters, 0.), rate(numberOfFilters, 0.),
+      covariance00(numberOfFilters, model.initialCovariance), covariance01(numberOfFilters, 0.),
+      covariance11(numberOfFilters, model.type == ModelType::SCALAR ? 0. : model.initialCovariance),
+      estimationErrors(numberOfFilters, 0.) {
+    filters.reserve(numberOfFilters);
+    for (uint64_t filterId = 0; filterId < numberOfFilters; ++filterId) {
+        filters.emplace_back(std::make_unique<BankedFilter>(*this, filterId, errorWindowSize));
+    }
+}
+
+KalmanFilterBank::KalmanFilterBank(uint64_t numberOfFilters) : KalmanFilterBank(numberOfFilters, Model()) {}
+
+KalmanFilterBank::~KalmanFilterBank() = default;
+
+KalmanFilterBase& KalmanFilterBank::getFilter(uint64_t filterId) {
+    x_ASSERT(filterId < numberOfFilters, "KalmanFilterBank: filter " << filterId << " out of range " << numberOfFilters);
+    return *filters[filterId];
+}
+
+void KalmanFilterBank::reset(uint64_t filterId, double initialValue) {
+    value[filterId] = initialValue;
+    rate[filterId] = 0.;
+    covariance00[filterId] = model.initialCovariance;
+    covariance01[filterId] = 0.;
+    covariance11[filterId] = model.type == ModelType::SCALAR ? 0. : model.initialCovariance;
+    estimationErrors[filterId] = 0.;
+}
+
+void KalmanFilterBank::update(const double* measurements) {
+    auto firstScalar = updateVectorized(numberOfFilters, measurements);
+    updateRange(firstScalar, numberOfFilters, measurements + firstScalar);
+    for (uint64_t filterId = 0; filterId < numberOfFilters; ++filterId) {
+        filters[filterId]->recordEstimationError(estimationErrors[filterId]);
+    }
+}
+
+void KalmanFilterBank::update(uint64_t filterId, double measurement) {
+    updateRange(filterId, filterId + 1, &measurement);
+    filters[filterId]->recordEstimationError(estimationErrors[filterId]);
+}
+
+void KalmanFilterBank::updateRange(uint64_t begin, uint64_t end, const double* measurements) {
+    const double dt = model.timeStep;
+    const double q = model.processNoise;
+    const double q01 = model.processNoiseCovariance01;
+    const double r = model.measurementNoise;
+    if (model.type == ModelType::SCALAR) {
+        for (uint64_t i = begin; i < end; ++i) {
+            // predict: x' = x, p' = p + q
+            double p = covariance00[i] + q;
+            // update with scalar innovation covariance s = p' + r
+            double measurement = measurements[i - begin];
+            double innovation = measurement - value[i];
+            double gain = p / (p + r);
+            value[i] += gain * innovation;
+            covariance00[i] = (1 - gain) * p;
+            estimationErrors[i] = std::abs(innovation / measurement);// eq. 8
+        }
+        return;
+    }
+
+    for (uint64_t i = begin; i < end; ++i) {
+        // predict: x' = F x, P' = F P F^T + Q
+        double predictedValue = value[i] + dt * rate[i];
+        double p00 = covariance00[i] + 2 * dt * covariance01[i] + dt * dt * covariance11[i] + q;
+        double p01 = covariance01[i] + dt * covariance11[i] + q01;
+        double p11 = covariance11[i] + q;
+        // update with scalar innovation covariance s = H P' H^T + r = p00 + r
+        double measurement = measurements[i - begin];
+        double innovation = measurement - predictedValue;
+        double innovationCovariance = p00 + r;
+        double gain0 = p00 / innovationCovariance;
+        double gain1 = p01 / innovationCovariance;
+        value[i] = predictedValue + gain0 * innovation;
+        rate[i] += gain1 * innovation;
+        covariance00[i] = (1 - gain0) * p00;
+        covariance01[i] = (1 - gain0) * p01;
+        covariance11[i] = p11 - gain1 * p01;
+        estimationErrors[i] = std::abs(innovation / measurement);// eq. 8
+    }
+}
+
+#ifdef HAS_AVX
+uint64_t KalmanFilterBank::updateVectorized(uint64_t end, const double* measurements) {
+    constexpr uint64_t lanes = 4;
+    const __m256d dt = _mm256_set1_pd(model.timeStep);
+    const __m256d twoDt = _mm256_set1_pd(2 * model.timeStep);
+    const __m256d dtSquared = _mm256_set1_pd(model.timeStep * model.timeStep);
+    const __m256d q = _mm256_set1_pd(model.processNoise);
+    const __m256d q01 = _mm256_set1_pd(model.processNoiseCovariance01);
+    const __m256d r = _mm256_set1_pd(model.measurementNoise);
+    const __m256d one = _mm256_set1_pd(1.);
+    const __m256d signMask = _mm256_set1_pd(-0.);
+    const bool isScalarModel = model.type == ModelType::SCALAR;
+
+    uint64_t i = 0;
+    for (; i + lanes <= end; i += lanes) {
+        __m256d z = _mm256_loadu_pd(measurements + i);
+        __m256d x0 = _mm256_loadu_pd(value.data() + i);
+        __m256d p00 = _mm256_add_pd(_mm256_loadu_pd(covariance00.data() + i), q);
+        __m256d innovation;
+        __m256d gain0;
+        if (isScalarModel) {
+            innovation = _mm256_sub_pd(z, x0);
+            gain0 = _mm256_div_pd(p00, _mm256_add_pd(p00, r));
+        } else {
+            __m256d x1 = _mm256_loadu_pd(rate.data() + i);
+            __m256d c01 = _mm256_loadu_pd(covariance01.data() + i);
+            __m256d c11 = _mm256_loadu_pd(covariance11.data() + i);
+            x0 = _mm256_add_pd(x0, _mm256_mul_pd(dt, x1));
+            p00 = _mm256_add_pd(p00, _mm256_add_pd(_mm256_mul_pd(twoDt, c01), _mm256_mul_pd(dtSquared, c11)));
+            __m256d p01 = _mm256_add_pd(_mm256_add_pd(c01, _mm256_mul_pd(dt, c11)), q01);
+            __m256d p11 = _mm256_add_pd(c11, q);
+            innovation = _mm256_sub_pd(z, x0);
+            __m256d innovationCovariance = _mm256_add_pd(p00, r);
+            gain0 = _mm256_div_pd(p00, innovationCovariance);
+            __m256d gain1 = _mm256_div_pd(p01, innovationCovariance);
+            _mm256_storeu_pd(rate.data() + i, _mm256_add_pd(x1, _mm256_mul_pd(gain1, innovation)));
+            _mm256_storeu_pd(covariance01.data() + i, _mm256_mul_pd(_mm256_sub_pd(one, gain0), p01));
+            _mm256_storeu_pd(covariance11.data() + i, _mm256_sub_pd(p11, _mm256_mul_pd(gain1, p01)));
+        }
+        _mm256_storeu_pd(value.data() + i, _mm256_add_pd(x0, _mm256_mul_pd(gain0, innovation)));
+        _mm256_storeu_pd(covariance00.data() + i, _mm256_mul_pd(_mm256_sub_pd(one, gain0), p00));
+        // eq. 8, |innovation / z| by clearing the sign bit
+        _mm256_storeu_pd(estimationErrors.data() + i, _mm256_andnot_pd(signMask, _mm256_div_pd(innovation, z)));
+    }
+    return i;
+}
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+uint64_t KalmanFilterBank::updateVectorized(uint64_t end, const double* measurements) {
+    constexpr uint64_t lanes = 2;
+    const float64x2_t dt = vdupq_n_f64(model.timeStep);
+    const float64x2_t twoDt = vdupq_n_f64(2 * model.timeStep);
+    const float64x2_t dtSquared = vdupq_n_f64(model.timeStep * model.timeStep);
+    const float64x2_t q = vdupq_n_f64(model.processNoise);
+    const float64x2_t q01 = vdupq_n_f64(model.processNoiseCovariance01);
+    const float64x2_t r = vdupq_n_f64(model.measurementNoise);
+    const float64x2_t one = vdupq_n_f64(1.);
+    const bool isScalarModel = model.type == ModelType::SCALAR;
+
+    uint64_t i = 0;
+    for (; i + lanes <= end; i += lanes) {
+        float64x2_t z = vld1q_f64(measurements + i);
+        float64x2_t x0 = vld1q_f64(value.data() + i);
+        float64x2_t p00 = vaddq_f64(vld1q_f64(covariance00.data() + i), q);
+        float64x2_t innovation;
+        float64x2_t gain0;
+        if (isScalarModel) {
+            innovation = vsubq_f64(z, x0);
+            gain0 = vdivq_f64(p00, vaddq_f64(p00, r));
+        } else {
+            float64x2_t x1 = vld1q_f64(rate.data() + i);
+            float64x2_t c01 = vld1q_f64(covariance01.data() + i);
+            float64x2_t c11 = vld1q_f64(covariance11.data() + i);
+            x0 = vaddq_f64(x0, vmulq_f64(dt, x1));
+            p00 = vaddq_f64(p00, vaddq_f64(vmulq_f64(twoDt, c01), vmulq_f64(dtSquared, c11)));
+            float64x2_t p01 = vaddq_f64(vaddq_f64(c01, vmulq_f64(dt, c11)), q01);
+            float64x2_t p11 = vaddq_f64(c11, q);
+            innovation = vsubq_f64(z, x0);
+            float64x2_t innovationCovariance = vaddq_f64(p00, r);
+            gain0 = vdivq_f64(p00, innovationCovariance);
+            float64x2_t gain1 = vdivq_f64(p01, innovationCovariance);
+            vst1q_f64(rate.data() + i, vaddq_f64(x1, vmulq_f64(gain1, innovation)));
+            vst1q_f64(covariance01.data() + i, vmulq_f64(vsubq_f64(one, gain0), p01));
+            vst1q_f64(covariance11.data() + i, vsubq_f64(p11, vmulq_f64(gain1, p01)));
+        }
+        vst1q_f64(value.data() + i, vaddq_f64(x0, vmulq_f64(gain0, innovation)));
+        vst1q_f64(covariance00.data() + i, vmulq_f64(vsubq_f64(one, gain0), p00));
+        vst1q_f64(estimationErrors.data() + i, vabsq_f64(vdivq_f64(innovation, z)));// eq. 8
+    }
+    return i;
+}
+#else
+uint64_t KalmanFilterBank::updateVectorized(uint64_t, const double*) {
+    // no vector unit, everything goes through the scalar kernel
+    return 0;
+}
+#endif
+
+}// namespace x
@@ -0,0 +1,143 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Util/KalmanFilterBase.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <cmath>
+
+namespace x {
+KalmanFilterBase::KalmanFilterBase(const uint64_t errorWindowSize) : kfErrorWindow(errorWindowSize) {
+    this->calculateTotalEstimationErrorDivider(errorWindowSize);
+}
+
+double KalmanFilterBase::getTotalEstimationError() { return this->calculateTotalEstimationError(); }
+
+float KalmanFilterBase::calculateTotalEstimationError() {
+    float j = 1;// eq. 9 iterator
+    float totalError = 0;
+    for (auto errorValue : kfErrorWindow) {
+        totalError += (errorValue / j);
+        ++j;
+    }
+    return totalError / totalEstimationErrorDivider;
+}
+
+void KalmanFilterBase::calculateTotalEstimationErrorDivider(int size) {
+    totalEstimationErrorDivider = size > 0 ? 0 : 1;
+    for (int i = 1; i <= size; ++i) {
+        totalEstimationErrorDivider += (1.0 / i);
+    }
+}
+
+std::chrono::milliseconds KalmanFilterBase::getNewGatheringIntervalBaseline() {
+    // eq. 10
+    auto totalEstimationError = this->calculateTotalEstimationError();
+    auto powerOfEuler = (totalEstimationError + lambda) / lambda;
+    auto thetaPart = theta * (1 - std::pow(eulerConstant, powerOfEuler));
+    auto newGatheringIntervalCandidate = this->gatheringInterval.count() + thetaPart;
+    if (newGatheringIntervalCandidate >= gatheringIntervalReceived.count() - (gatheringIntervalRange.count() / 2)
+        && newGatheringIntervalCandidate <= gatheringIntervalReceived.count() + (gatheringIntervalRange.count() / 2)) {// eq. 7
+        // remove fractional part from double
+        this->gatheringInterval = std::chrono::milliseconds((int) trunc(newGatheringIntervalCandidate));
+    }
+    return this->gatheringInterval;
+}
+
+std::chrono::milliseconds KalmanFilterBase::getNewGatheringInterval() {
+    auto currentEstimationError = this->getEstimationErrorDifference();
+    if (currentEstimationError > 0.6) {  // indicates immediate change
+        auto frequencyCandidate = this->frequencyExponentialDecay();
+        if (frequencyCandidate < this->fastestInterval.count()) {
+            this->gatheringInterval = this->fastestInterval;
+        } else {
+            this->gatheringInterval = std::chrono::milliseconds((int) trunc(frequencyCandidate));
+        }
+    } else if (currentEstimationError < .24) {  // indicates consecutive similarity
+        auto frequencyCandidate = this->frequencyExponentialGrowth();
+        if (frequencyCandidate > this->slowestInterval.count()) {
+            this->gatheringInterval = this->slowestInterval;
+        } else {
+            this->gatheringInterval = std::chrono::milliseconds((int) trunc(frequencyCandidate));
+        }
+    }
+    return this->gatheringInterval;
+}
+
+double KalmanFilterBase::getCurrentStep() { return currentTime; }
+double KalmanFilterBase::getEstimationError() { return estimationError; }
+double KalmanFilterBase::getEstimationErrorDifference() { return kfErrorWindow[0] - kfErrorWindow[1]; }
+uint64_t KalmanFilterBase::getTheta() { return theta; }
+float KalmanFilterBase::getLambda() { return lambda; }
+
+void KalmanFilterBase::setLambda(float newLambda) { this->lambda = newLambda; }
+
+void KalmanFilterBase::setGatheringInterval(std::chrono::milliseconds gatheringIntervalInMillis) {
+    this->gatheringInterval = gatheringIntervalInMillis;
+    this->gatheringIntervalReceived = gatheringIntervalInMillis;
+    this->initialInterval = gatheringIntervalInMillis;
+    this->slowestInterval = std::chrono::milliseconds((int) trunc(gatheringIntervalInMillis.count() * 1.5));
+    this->fastestInterval = std::chrono::milliseconds((int) trunc(gatheringIntervalInMillis.count() * 0.5));
+}
+
+void KalmanFilterBase::setGatheringIntervalRange(std::chrono::milliseconds gatheringIntervalRange) {
+    this->gatheringIntervalRange = gatheringIntervalRange;
+}
+
+void KalmanFilterBase::setGatheringIntervalWithRange(std::chrono::milliseconds gatheringIntervalInMillis,
+                                                     std::chrono::milliseconds gatheringIntervalRange) {
+    this->setGatheringInterval(gatheringIntervalInMillis);
+    this->setGatheringIntervalRange(gatheringIntervalRange);
+}
+
+void KalmanFilterBase::setSlowestInterval(std::chrono::milliseconds gatheringIntervalInMillis) {
+    x_TRACE("KalmanFilterBase::setSlowestInterval: {}ms to {}ms",
+            this->slowestInterval.count(),
+            gatheringIntervalInMillis.count());
+    this->slowestInterval = gatheringIntervalInMillis;
+    if (this->slowestInterval < this->fastestInterval) {
+        this->fastestInterval = 3 * this->slowestInterval;
+    }
+}
+
+void KalmanFilterBase::setFastestInterval(std::chrono::milliseconds gatheringIntervalInMillis) {
+    this->fastestInterval = gatheringIntervalInMillis;
+}
+
+double KalmanFilterBase::frequencyExponentialDecay() {
+    auto newCandidate = this->gatheringInterval.count() * std::pow((1 - .25), this->decreaseCounter);
+    if (std::isinf(newCandidate)) {
+        return this->gatheringInterval.count();
+    }
+    if (decreaseCounter < this->maxValue) {
+        ++this->decreaseCounter;
+    }
+    this->increaseCounter = 1;
+    return newCandidate;
+}
+
+double KalmanFilterBase::frequencyExponentialGrowth() {
+    auto newCandidate = this->gatheringInterval.count() * std::pow((1 + .25), this->increaseCounter);
+    if (std::isinf(newCandidate)) {
+        return this->gatheringInterval.count();
+    }
+    if (increaseCounter < this->maxValue) {
+        ++this->increaseCounter;
+    }
+    this->decreaseCounter = 1;
+    return newCandidate;
+}
+
+std::chrono::milliseconds KalmanFilterBase::getCurrentGatheringInterval() { return this->gatheringInterval; }
+
+}// namespace x
@@ -56,16 +56,21 @@ void MQTTClientWrapper::disconnect() {
     }
 }
 
-void MQTTClientWrapper::sendPayload(std::string payload) {
+mqtt::delivery_token_ptr MQTTClientWrapper::sendPayload(std::string payload, mqtt::iaction_listener* deliveryListener) {
     if (asyncClient) {
         //qualityOfService to enable cleanSessions(require > 0), retained not necessary (broker can store up to 1
         // -> retained message, which is delivered to a newly subscribed client(correct topic) first)
-        sendTopic->publish(std::move(payload), qualityOfService, false);
-    } else {
-        auto pubmsg = mqtt::make_message(topic, payload);
-        pubmsg->set_qos(qualityOfService);
-        (*syncClient).publish(pubmsg);
+        if (deliveryListener) {
+            return asyncClient->publish(mqtt::make_message(topic, std::move(payload), qualityOfService, false),
+                                        nullptr,
+                                        *deliveryListener);
+        }
+        return sendTopic->publish(std::move(payload), qualityOfService, false);
     }
+    auto pubmsg = mqtt::make_message(topic, std::move(payload));
+    pubmsg->set_qos(qualityOfService);
+    (*syncClient).publish(pubmsg);
+    return nullptr;
 }
 
 uint64_t MQTTClientWrapper::getNumberOfUnsentMessages() {
@@ -0,0 +1,112 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Runtime/detail/TupleBufferImpl.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/MappedFile.hpp>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <limits>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace x::Util {
+
+namespace {
+/// madvise expects page-aligned addresses
+uint64_t alignToPage(uint64_t position) {
+    static const auto pageSize = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+    return position - position % pageSize;
+}
+}// namespace
+
+MappedFilePtr MappedFile::create(const std::string& path) {
+    auto fileDescriptor = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fileDescriptor < 0) {
+        x_THROW_RUNTIME_ERROR("MappedFile: Cannot open file: " << path << " Error: " << strerror(errno));
+    }
+    struct stat fileStatus {};
+    if (fstat(fileDescriptor, &fileStatus) != 0 || !S_ISREG(fileStatus.st_mode)) {
+        ::close(fileDescriptor);
+        x_THROW_RUNTIME_ERROR("MappedFile: " << path << " is not a regular file");
+    }
+    auto size = static_cast<uint64_t>(fileStatus.st_size);
+    uint8_t* data = nullptr;
+    if (size > 0) {
+        // private and writable, so that consumers of wrapped buffers that write in place get copies of the pages
+        auto* mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fileDescriptor, 0);
+        if (mapping == MAP_FAILED) {
+            ::close(fileDescriptor);
+            x_THROW_RUNTIME_ERROR("MappedFile: Cannot map file: " << path << " Error: " << strerror(errno));
+        }
+        data = static_cast<uint8_t*>(mapping);
+        if (madvise(data, size, MADV_SEQUENTIAL) != 0) {
+            x_WARNING("MappedFile: madvise failed for {}. Error: {}", path, strerror(errno));
+        }
+    }
+    x_DEBUG("MappedFile: mapped {} with {} bytes", path, size);
+    auto mappedFile = MappedFilePtr(new MappedFile(path, fileDescriptor, data, size));
+    mappedFile->willRead(0);
+    return mappedFile;
+}
+
+MappedFile::MappedFile(std::string path, int fileDescriptor, uint8_t* data, uint64_t size)
+    : path(std::move(path)), fileDescriptor(fileDescriptor), data(data), size(size) {}
+
+MappedFile::~MappedFile() {
+    if (data != nullptr) {
+        munmap(data, size);
+    }
+    ::close(fileDescriptor);
+}
+
+const char* MappedFile::getData() const { return reinterpret_cast<const char*>(data); }
+
+uint64_t MappedFile::getSize() const { return size; }
+
+const std::string& MappedFile::getPath() const { return path; }
+
+void MappedFile::willRead(uint64_t position) {
+    if (position + READ_AHEAD_SIZE < readAheadEnd) {
+        readAheadEnd = position;// the reader jumped back, e.g., to replay the file from the start
+    }
+    // request the next window when the reader has consumed half of the current one
+    if (readAheadEnd >= size || position + READ_AHEAD_SIZE / 2 < readAheadEnd) {
+        return;
+    }
+    auto start = alignToPage(std::max(position, readAheadEnd));
+    auto end = std::min(size, position + READ_AHEAD_SIZE);
+    if (madvise(data + start, end - start, MADV_WILLNEED) != 0) {
+        x_DEBUG("MappedFile: read ahead failed for {}. Error: {}", path, strerror(errno));
+    }
+    readAheadEnd = end;
+}
+
+Runtime::TupleBuffer MappedFile::wrap(uint64_t position, uint64_t size) {
+    x_ASSERT(size > 0 && position + size <= this->size, "MappedFile: range is outside of " << path);
+    x_ASSERT(size <= std::numeric_limits<uint32_t>::max(), "MappedFile: range is too large for a TupleBuffer");
+    return Runtime::TupleBuffer::wrapMemory(data + position,
+                                            size,
+                                            [mappedFile = shared_from_this()](Runtime::detail::MemorySegment* segment,
+                                                                              Runtime::BufferRecycler*) mutable {
+                                                // deleting the segment destroys this callback, so keep the mapping alive
+                                                auto keepAlive = std::move(mappedFile);
+                                                delete segment;
+                                            });
+}
+
+}// namespace x::Util
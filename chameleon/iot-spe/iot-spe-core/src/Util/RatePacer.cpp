@@ -0,0 +1,67 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Util/Logger/Logger.hpp>
+#include <Util/RatePacer.hpp>
+#include <thread>
+
+namespace x::Util {
+
+RatePacer::RatePacer(double targetRate, std::chrono::nanoseconds spinThreshold, std::chrono::nanoseconds maxLag)
+    : targetRate(targetRate), interval(targetRate > 0 ? 1e9 / targetRate : 0), spinThreshold(spinThreshold), maxLag(maxLag) {
+    if (targetRate <= 0) {
+        x_THROW_RUNTIME_ERROR("RatePacer: the target rate has to be positive but is " << targetRate);
+    }
+}
+
+void RatePacer::waitForNextEvent() {
+    auto now = Clock::now();
+    if (numberOfEvents == 0) {
+        firstEvent = scheduleStart = now;
+    } else {
+        auto deadline = scheduleStart
+            + std::chrono::duration_cast<Clock::duration>(interval * static_cast<double>(numberOfEvents - scheduleOffset));
+        if (now > deadline + maxLag) {
+            // the lag is not caught up with a burst of events
+            scheduleStart = now;
+            scheduleOffset = numberOfEvents;
+            ++numberOfRestarts;
+        } else if (now < deadline) {
+            if (deadline - now > spinThreshold) {
+                std::this_thread::sleep_for(deadline - now - spinThreshold);
+            }
+            while ((now = Clock::now()) < deadline) {
+                // spin for the remaining time, sleeping is not precise enough
+            }
+        }
+    }
+    lastEvent = now;
+    ++numberOfEvents;
+}
+
+uint64_t RatePacer::getNumberOfEvents() const { return numberOfEvents; }
+
+double RatePacer::getTargetRate() const { return targetRate; }
+
+double RatePacer::getAchievedRate() const {
+    if (numberOfEvents == 0) {
+        return 0;
+    }
+    auto duration = std::chrono::duration<double>(lastEvent - firstEvent + interval);
+    return static_cast<double>(numberOfEvents) / duration.count();
+}
+
+uint64_t RatePacer::getNumberOfRestarts() const { return numberOfRestarts; }
+
+}// namespace x::Util
@@ -0,0 +1,210 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <API/QueryAPI.hpp>
+#include <BaseIntegrationTest.hpp>
+#include <Catalogs/Source/PhysicalSource.hpp>
+#include <Catalogs/Source/PhysicalSourceTypes/CSVSourceType.hpp>
+#include <Components/xCoordinator.hpp>
+#include <Components/xWorker.hpp>
+#include <Configurations/Coordinator/CoordinatorConfiguration.hpp>
+#include <Configurations/Worker/WorkerConfiguration.hpp>
+#include <REST/ServerTypes.hpp>
+#include <Runtime/Execution/ExecutableQueryPlan.hpp>
+#include <Runtime/NodeEngine.hpp>
+#include <Services/GatheringPolicyService.hpp>
+#include <Services/QueryService.hpp>
+#include <Sources/DataSource.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/TestUtils.hpp>
+#include <cpr/cpr.h>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <memory>
+#include <nlohmann/json.hpp>
+
+using namespace std;
+
+namespace x {
+using namespace Configurations;
+
+class GatheringPolicyControllerTest : public Testing::BaseIntegrationTest {
+  public:
+    static void SetUpTestCase() {
+        x::Logger::setupLogging("GatheringPolicyControllerTest.log", x::LogLevel::LOG_DEBUG);
+        x_INFO("Setup GatheringPolicyControllerTest test class.");
+    }
+
+    static void TearDownTestCase() { x_INFO("Tear down GatheringPolicyControllerTest test class."); }
+
+    void startCoordinator() {
+        x_INFO("GatheringPolicyControllerTest: Start coordinator");
+        coordinatorConfig = CoordinatorConfiguration::createDefault();
+        coordinatorConfig->rpcPort = *rpcCoordinatorPort;
+        coordinatorConfig->restPort = *restPort;
+        coordinator = std::make_shared<xCoordinator>(coordinatorConfig);
+        ASSERT_EQ(coordinator->startCoordinator(false), *rpcCoordinatorPort);
+        ASSERT_TRUE(TestUtils::checkRESTServerStartedOrTimeout(coordinatorConfig->restPort.getValue(), 5));
+    }
+
+    void stopCoordinator() { ASSERT_TRUE(coordinator->stopCoordinator(true)); }
+
+    cpr::Response postPolicy(const nlohmann::json& request) {
+        auto future = cpr::PostAsync(cpr::Url{BASE_URL + std::to_string(*restPort) + "/v1/x/gatheringPolicy/policy"},
+                                     cpr::Header{{"Content-Type", "application/json"}},
+                                     cpr::Body{request.dump()});
+        future.wait();
+        return future.get();
+    }
+
+    CoordinatorConfigurationPtr coordinatorConfig;
+    xCoordinatorPtr coordinator;
+};
+
+/**
+ * @brief a policy posted to the coordinator reaches the running source on the worker via the SetGatheringPolicy RPC,
+ * and the worker reports the new gathering interval back
+ */
+TEST_F(GatheringPolicyControllerTest, testSetGatheringPolicyOnRunningSource) {
+    startCoordinator();
+    std::string testSchema = "Schema::create()->addField(createField(\"id\", BasicType::UINT64))->"
+                             "addField(createField(\"value\", BasicType::FLOAT64));";
+    coordinator->getSourceCatalogService()->registerLogicalSource("gathering_stream", testSchema);
+
+    // one tuple per buffer on a slow interval keeps the source running until the query is stopped
+    std::string testCSVFileName = getTestResourceFolder() / "gatheringPolicy.csv";
+    std::ofstream outCsv(testCSVFileName);
+    for (uint64_t i = 0; i < 1000; ++i) {
+        outCsv << i << "," << i * 0.5 << "\n";
+    }
+    outCsv.close();
+
+    WorkerConfigurationPtr workerConfig = WorkerConfiguration::create();
+    workerConfig->coordinatorPort = *rpcCoordinatorPort;
+    workerConfig->gatheringIntervalReportPeriod = 100;
+    auto csvSourceType = CSVSourceType::create();
+    csvSourceType->setFilePath(testCSVFileName);
+    csvSourceType->setGatheringInterval(200);
+    csvSourceType->setNumberOfTuplesToProducePerBuffer(1);
+    csvSourceType->setNumberOfBuffersToProduce(1000);
+    // the oversampler keeps its interval, so the test observes exactly the interval of the policy
+    csvSourceType->setGatheringMode(GatheringMode::ADAPTIVE_MODE_OVERSAMPLER);
+    workerConfig->physicalSources.add(PhysicalSource::create("gathering_stream", "gathering_physical", csvSourceType));
+    xWorkerPtr wrk = std::make_shared<xWorker>(std::move(workerConfig));
+    ASSERT_TRUE(wrk->start(/**blocking**/ false, /**withConnect**/ true));
+
+    auto queryService = coordinator->getQueryService();
+    auto queryCatalogService = coordinator->getQueryCatalogService();
+    auto query = Query::from("gathering_stream").sink(NullOutputSinkDescriptor::create());
+    QueryId queryId = queryService->addQueryRequest(query.getQueryPlan()->toString(),
+                                                    query.getQueryPlan(),
+                                                    Optimizer::PlacementStrategy::BottomUp,
+                                                    FaultToleranceType::NONE,
+                                                    LineageType::IN_MEMORY);
+    ASSERT_NE(queryId, INVALID_QUERY_ID);
+    ASSERT_TRUE(TestUtils::waitForQueryToStart(queryId, queryCatalogService));
+
+    std::vector<DataSourcePtr> sources;
+    for (auto querySubPlanId : wrk->getNodeEngine()->getSubQueryIds(queryId)) {
+        auto plan = wrk->getNodeEngine()->getExecutableQueryPlan(querySubPlanId);
+        sources.insert(sources.end(), plan->getSources().begin(), plan->getSources().end());
+    }
+    ASSERT_EQ(sources.size(), 1UL);
+    EXPECT_EQ(sources[0]->getGatheringInterval(), std::chrono::milliseconds(200));
+
+    nlohmann::json request;
+    request["logicalSourceName"] = "gathering_stream";
+    request["gatheringInterval"] = 20;
+    request["lambda"] = 0.4;
+    auto response = postPolicy(request);
+    ASSERT_EQ(response.status_code, 200L);
+    auto responseJson = nlohmann::json::parse(response.text);
+    EXPECT_TRUE(responseJson["success"].get<bool>());
+    EXPECT_EQ(responseJson["numberOfUpdatedSources"].get<uint64_t>(), 1UL);
+
+    // the source applies the policy on its own thread before its next iteration
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (sources[0]->getGatheringInterval() != std::chrono::milliseconds(20) && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    EXPECT_EQ(sources[0]->getGatheringInterval(), std::chrono::milliseconds(20));
+
+    // the worker reports the interval change to the coordinator
+    auto gatheringPolicyService = coordinator->getGatheringPolicyService();
+    deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (gatheringPolicyService->getGatheringIntervalSamples("gathering_physical").empty()
+           && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    auto samples = gatheringPolicyService->getGatheringIntervalSamples("gathering_physical");
+    ASSERT_FALSE(samples.empty());
+    EXPECT_EQ(samples.back().gatheringInterval, std::chrono::milliseconds(20));
+
+    auto future = cpr::GetAsync(cpr::Url{BASE_URL + std::to_string(*restPort) + "/v1/x/gatheringPolicy/policy"},
+                                cpr::Parameters{{"logicalSourceName", "gathering_stream"}});
+    future.wait();
+    auto getResponse = future.get();
+    ASSERT_EQ(getResponse.status_code, 200L);
+    auto policyJson = nlohmann::json::parse(getResponse.text);
+    EXPECT_EQ(policyJson["gatheringInterval"].get<uint64_t>(), 20UL);
+    EXPECT_FLOAT_EQ(policyJson["lambda"].get<float>(), 0.4F);
+    EXPECT_FALSE(policyJson.contains("slowestInterval"));
+
+    queryService->validateAndQueueStopQueryRequest(queryId);
+    EXPECT_TRUE(TestUtils::checkStoppedOrTimeout(queryId, queryCatalogService));
+    EXPECT_TRUE(wrk->stop(true));
+    stopCoordinator();
+}
+
+/**
+ * @brief malformed policies are rejected before they are sent to any worker
+ */
+TEST_F(GatheringPolicyControllerTest, testSetGatheringPolicyInvalidRequests) {
+    startCoordinator();
+    coordinator->getSourceCatalogService()->registerLogicalSource("gathering_stream",
+                                                                  "Schema::create()->addField(\"id\", BasicType::UINT64);");
+
+    nlohmann::json missingName;
+    missingName["gatheringInterval"] = 100;
+    EXPECT_EQ(postPolicy(missingName).status_code, 400L);
+
+    nlohmann::json emptyPolicy;
+    emptyPolicy["logicalSourceName"] = "gathering_stream";
+    EXPECT_EQ(postPolicy(emptyPolicy).status_code, 400L);
+
+    nlohmann::json negativeInterval;
+    negativeInterval["logicalSourceName"] = "gathering_stream";
+    negativeInterval["gatheringInterval"] = -5;
+    EXPECT_EQ(postPolicy(negativeInterval).status_code, 400L);
+
+    nlohmann::json invertedBounds;
+    invertedBounds["logicalSourceName"] = "gathering_stream";
+    invertedBounds["fastestInterval"] = 500;
+    invertedBounds["slowestInterval"] = 100;
+    EXPECT_EQ(postPolicy(invertedBounds).status_code, 400L);
+
+    // a logical source without physical sources is not found
+    nlohmann::json noPhysicalSources;
+    noPhysicalSources["logicalSourceName"] = "gathering_stream";
+    noPhysicalSources["gatheringInterval"] = 100;
+    EXPECT_EQ(postPolicy(noPhysicalSources).status_code, 404L);
+
+    auto future = cpr::GetAsync(cpr::Url{BASE_URL + std::to_string(*restPort) + "/v1/x/gatheringPolicy/policy"},
+                                cpr::Parameters{{"logicalSourceName", "gathering_stream"}});
+    future.wait();
+    EXPECT_EQ(future.get().status_code, 404L);
+    stopCoordinator();
+}
+
+}// namespace x
@@ -0,0 +1,99 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <BaseIntegrationTest.hpp>
+#include <gtest/gtest.h>
+
+#include <Runtime/GatheringIntervalCollector.hpp>
+#include <Util/FixedSizeKalmanFilter.hpp>
+#include <Util/GatheringPolicy.hpp>
+#include <Util/Logger/Logger.hpp>
+
+namespace x::Runtime {
+
+/**
+ * Tests for the worker side of the gathering-interval control plane:
+ * the policies set by the coordinator and the collector of the reported intervals.
+ */
+class GatheringPolicyTest : public Testing::BaseUnitTest {
+  public:
+    static void SetUpTestCase() {
+        x::Logger::setupLogging("GatheringPolicyTest.log", x::LogLevel::LOG_DEBUG);
+        x_INFO("Setup GatheringPolicyTest test class.");
+    }
+};
+
+/**
+ * @brief a later policy overwrites only the fields it sets
+ */
+TEST_F(GatheringPolicyTest, mergeOverwritesSetFields) {
+    GatheringPolicy policy;
+    EXPECT_TRUE(policy.empty());
+    policy.gatheringInterval = std::chrono::milliseconds(100);
+    policy.lambda = 0.5F;
+
+    GatheringPolicy update;
+    update.lambda = 0.2F;
+    update.slowestInterval = std::chrono::milliseconds(400);
+    policy.merge(update);
+
+    EXPECT_FALSE(policy.empty());
+    EXPECT_EQ(policy.gatheringInterval, std::chrono::milliseconds(100));
+    EXPECT_EQ(policy.slowestInterval, std::chrono::milliseconds(400));
+    EXPECT_FALSE(policy.fastestInterval.has_value());
+    EXPECT_FLOAT_EQ(policy.lambda.value(), 0.2F);
+}
+
+/**
+ * @brief applying a policy changes only the settings it sets
+ */
+TEST_F(GatheringPolicyTest, applyToKalmanFilter) {
+    FixedSizeKalmanFilter<3, 1> kFilter;
+    kFilter.init();
+    kFilter.setGatheringInterval(std::chrono::milliseconds(1000));
+    auto lambda = kFilter.getLambda();
+
+    GatheringPolicy policy;
+    policy.gatheringInterval = std::chrono::milliseconds(250);
+    policy.applyTo(kFilter);
+    EXPECT_EQ(kFilter.getCurrentGatheringInterval(), std::chrono::milliseconds(250));
+    EXPECT_FLOAT_EQ(kFilter.getLambda(), lambda);
+
+    GatheringPolicy lambdaPolicy;
+    lambdaPolicy.lambda = 0.9F;
+    lambdaPolicy.applyTo(kFilter);
+    EXPECT_EQ(kFilter.getCurrentGatheringInterval(), std::chrono::milliseconds(250));
+    EXPECT_FLOAT_EQ(kFilter.getLambda(), 0.9F);
+}
+
+/**
+ * @brief the collector returns the samples in order and drops the oldest ones beyond its capacity
+ */
+TEST_F(GatheringPolicyTest, collectorDrainsAndDropsOldestSamples) {
+    GatheringIntervalCollector collector(3);
+    for (uint64_t i = 0; i < 5; ++i) {
+        collector.record(GatheringIntervalSample{"sensor", 1, i, std::chrono::milliseconds(100 * (i + 1)), 0.0});
+    }
+
+    auto samples = collector.drain();
+    ASSERT_EQ(samples.size(), 3U);
+    for (uint64_t i = 0; i < samples.size(); ++i) {
+        EXPECT_EQ(samples[i].timestampInMs, i + 2);
+        EXPECT_EQ(samples[i].gatheringInterval, std::chrono::milliseconds(100 * (i + 3)));
+    }
+    EXPECT_EQ(collector.getNumberOfDroppedSamples(), 2U);
+    EXPECT_TRUE(collector.drain().empty());
+}
+
+}// namespace x::Runtime
@@ -19,6 +19,7 @@
 #include <Runtime/BufferManager.hpp>
 #include <Runtime/MemoryLayout/ColumnLayoutField.hpp>
 #include <Runtime/MemoryLayout/DynamicTupleBuffer.hpp>
+#include <Runtime/MemoryLayout/FieldValueReader.hpp>
 #include <Runtime/MemoryLayout/RowLayoutField.hpp>
 #include <Util/magicenum/magic_enum.hpp>
 namespace x::Runtime::MemoryLayouts {
@@ -104,6 +105,25 @@ TEST_P(DynamicMemoryLayoutTestParameterized, toStringTestRowLayout) {
     EXPECT_EQ(dynamicBuffer->toString(schema), expectedOutput);
 }
 
+TEST_P(DynamicMemoryLayoutTestParameterized, fieldValueReaderTest) {
+    for (int i = 0; i < 10; i++) {
+        dynamicBuffer->pushRecordToBuffer(std::make_tuple((uint16_t) i, true, i * 2.5));
+    }
+
+    FieldValueReader reader(dynamicBuffer->getMemoryLayout(), {"t3", "t1"});
+    ASSERT_EQ(reader.getNumberOfFields(), 2);
+    std::vector<double> values;
+    reader.read(dynamicBuffer->getBuffer(), values);
+    ASSERT_EQ(values.size(), 20);
+    for (int i = 0; i < 10; i++) {
+        EXPECT_EQ(values[i * 2], i * 2.5);
+        EXPECT_EQ(values[i * 2 + 1], i);
+    }
+
+    EXPECT_ANY_THROW(FieldValueReader(dynamicBuffer->getMemoryLayout(), {"t2"}));
+    EXPECT_ANY_THROW(FieldValueReader(dynamicBuffer->getMemoryLayout(), {"t4"}));
+}
+
 INSTANTIATE_TEST_CASE_P(TestInputs,
                         DynamicMemoryLayoutTestParameterized,
                         ::testing::Values(Schema::MemoryLayoutType::COLUMNAR_LAYOUT, Schema::MemoryLayoutType::ROW_LAYOUT),
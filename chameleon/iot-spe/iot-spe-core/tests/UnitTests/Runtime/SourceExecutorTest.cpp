@@ -0,0 +1,387 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <API/Schema.hpp>
+#include <BaseIntegrationTest.hpp>
+#include <Catalogs/Source/PhysicalSourceTypes/TCPSourceType.hpp>
+#include <Configurations/Worker/WorkerConfiguration.hpp>
+#include <Runtime/FixedSizeBufferPool.hpp>
+#include <Runtime/NodeEngine.hpp>
+#include <Runtime/NodeEngineBuilder.hpp>
+#include <Runtime/QueryManager.hpp>
+#include <Runtime/SourceExecutor.hpp>
+#include <Sources/DataSource.hpp>
+#include <Sources/TCPSource.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/TestUtils.hpp>
+#include <arpa/inet.h>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <gtest/gtest.h>
+#include <mutex>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+namespace x::Runtime {
+
+namespace {
+constexpr uint64_t NUMBER_OF_SOURCE_LOCAL_BUFFERS = 4;
+constexpr auto WAIT_TIMEOUT = std::chrono::seconds(10);
+
+/**
+ * @brief polls the predicate until it holds or the timeout expires
+ */
+bool waitUntil(const std::function<bool()>& predicate, std::chrono::milliseconds timeout = WAIT_TIMEOUT) {
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (!predicate()) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+}// namespace
+
+/**
+ * @brief source that records every iteration the executor runs. If it has a readiness file descriptor, it reads the
+ * available bytes as tuples and completes once the peer closes the connection. It is not part of a query plan,
+ * so it closes without injecting an end of stream.
+ */
+class ExecutorTestSource : public DataSource {
+  public:
+    ExecutorTestSource(const SchemaPtr& schema,
+                       BufferManagerPtr bufferManager,
+                       QueryManagerPtr queryManager,
+                       OperatorId operatorId,
+                       std::chrono::milliseconds gatheringInterval,
+                       int readinessFileDescriptor = -1)
+        : DataSource(schema,
+                     std::move(bufferManager),
+                     std::move(queryManager),
+                     operatorId,
+                     operatorId,
+                     NUMBER_OF_SOURCE_LOCAL_BUFFERS,
+                     GatheringMode::INTERVAL_MODE,
+                     "executor-test-source"),
+          readinessFileDescriptor(readinessFileDescriptor) {
+        this->gatheringInterval = gatheringInterval;
+    }
+
+    std::optional<TupleBuffer> receiveData() override {
+        auto iteration = ++numberOfIterations;
+        {
+            std::unique_lock lock(mutex);
+            iterationTimes.emplace_back(std::chrono::steady_clock::now());
+        }
+        if (iteration == failAtIteration) {
+            x_THROW_RUNTIME_ERROR("ExecutorTestSource: failure in iteration " << iteration);
+        }
+        if (iteration == completeAtIteration) {
+            return std::nullopt;
+        }
+        auto buffer = bufferManager->getBufferBlocking();
+        if (readinessFileDescriptor >= 0) {
+            std::array<char, 64> data{};
+            auto bytesRead = ::read(readinessFileDescriptor, data.data(), data.size());
+            if (bytesRead == 0) {
+                return std::nullopt;// the peer closed the connection
+            }
+            // the first iteration and the stop iteration run without the socket being readable
+            buffer.setNumberOfTuples(bytesRead > 0 ? bytesRead : 0);
+            receivedTuples += buffer.getNumberOfTuples();
+        }
+        return buffer;
+    }
+
+    void close() override {
+        bufferManager->destroy();
+        closed = true;
+    }
+
+    int getReadinessFileDescriptor() const override { return readinessFileDescriptor; }
+
+    std::string toString() const override { return "ExecutorTestSource"; }
+
+    SourceType getType() const override { return SourceType::TEST_SOURCE; }
+
+    std::vector<std::chrono::steady_clock::time_point> getIterationTimes() const {
+        std::unique_lock lock(mutex);
+        return iterationTimes;
+    }
+
+    std::atomic<uint64_t> numberOfIterations{0};
+    std::atomic<uint64_t> receivedTuples{0};
+    std::atomic<bool> closed{false};
+    uint64_t failAtIteration{0};
+    uint64_t completeAtIteration{0};
+
+  private:
+    int readinessFileDescriptor;
+    mutable std::mutex mutex;
+    std::vector<std::chrono::steady_clock::time_point> iterationTimes;
+};
+
+/**
+ * @brief TCP source that counts the emitted tuples instead of handing the buffers to a successor. It is not part of a
+ * query plan, so it closes without injecting an end of stream.
+ */
+class CountingTCPSource : public TCPSource {
+  public:
+    CountingTCPSource(const SchemaPtr& schema,
+                      BufferManagerPtr bufferManager,
+                      QueryManagerPtr queryManager,
+                      TCPSourceTypePtr tcpSourceType,
+                      OperatorId operatorId)
+        : TCPSource(schema,
+                    std::move(bufferManager),
+                    std::move(queryManager),
+                    std::move(tcpSourceType),
+                    operatorId,
+                    operatorId,
+                    NUMBER_OF_SOURCE_LOCAL_BUFFERS,
+                    GatheringMode::INTERVAL_MODE,
+                    "executor-test-tcp-source",
+                    {}) {}
+
+    void emitWork(TupleBuffer& buffer) override { emittedTuples += buffer.getNumberOfTuples(); }
+
+    void close() override {
+        bufferManager->destroy();
+        closed = true;
+    }
+
+    std::atomic<uint64_t> emittedTuples{0};
+    std::atomic<bool> closed{false};
+};
+
+class SourceExecutorTest : public Testing::BaseIntegrationTest {
+  public:
+    static void SetUpTestCase() {
+        x::Logger::setupLogging("SourceExecutorTest.log", x::LogLevel::LOG_DEBUG);
+        x_INFO("Setup SourceExecutorTest test class.");
+    }
+
+    void SetUp() override {
+        Testing::BaseIntegrationTest::SetUp();
+        auto workerConfiguration = WorkerConfiguration::create();
+        workerConfiguration->numberOfSourceExecutorThreads.setValue(2);
+        nodeEngine = NodeEngineBuilder::create(workerConfiguration)
+                         .setQueryStatusListener(std::make_shared<DummyQueryListener>())
+                         .build();
+        schema = Schema::create()->addField("value", BasicType::UINT64);
+        sourceExecutor = nodeEngine->getQueryManager()->getSourceExecutor();
+        ASSERT_NE(sourceExecutor, nullptr);
+    }
+
+    void TearDown() override {
+        sourceExecutor.reset();
+        ASSERT_TRUE(nodeEngine->stop());
+        Testing::BaseIntegrationTest::TearDown();
+    }
+
+    std::shared_ptr<ExecutorTestSource> createSource(OperatorId operatorId,
+                                                     std::chrono::milliseconds gatheringInterval,
+                                                     int readinessFileDescriptor = -1) {
+        return std::make_shared<ExecutorTestSource>(schema,
+                                                    nodeEngine->getBufferManager(),
+                                                    nodeEngine->getQueryManager(),
+                                                    operatorId,
+                                                    gatheringInterval,
+                                                    readinessFileDescriptor);
+    }
+
+    NodeEnginePtr nodeEngine{nullptr};
+    SourceExecutorPtr sourceExecutor{nullptr};
+    SchemaPtr schema;
+};
+
+/**
+ * @brief a source without a readiness file descriptor runs its iterations back to back until it completes, like in
+ * the dedicated source thread, which does not sleep on the gathering interval either
+ */
+TEST_F(SourceExecutorTest, sourceIsRescheduledWithoutGatheringInterval) {
+    auto gatheringInterval = std::chrono::seconds(60);
+    auto source = createSource(1, gatheringInterval);
+    source->completeAtIteration = 6;
+
+    auto start = std::chrono::steady_clock::now();
+    ASSERT_TRUE(source->start());
+    ASSERT_TRUE(waitUntil([&]() {
+        return source->closed.load();
+    }));
+    ASSERT_TRUE(waitUntil([&]() {
+        return sourceExecutor->getNumberOfSources() == 0;
+    }));
+    EXPECT_EQ(source->numberOfIterations, 6UL);
+    EXPECT_EQ(source->getIterationTimes().size(), 6UL);
+    EXPECT_LT(std::chrono::steady_clock::now() - start, gatheringInterval);
+    EXPECT_TRUE(source->stop(QueryTerminationType::Graceful));
+}
+
+/**
+ * @brief a source with a readiness file descriptor runs as soon as data arrives instead of after its gathering interval
+ */
+TEST_F(SourceExecutorTest, readinessFileDescriptorWakesUpSource) {
+    std::array<int, 2> sockets{};
+    ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, sockets.data()), 0);
+    auto source = createSource(1, std::chrono::seconds(60), sockets[0]);
+
+    auto start = std::chrono::steady_clock::now();
+    ASSERT_TRUE(source->start());
+    ASSERT_TRUE(waitUntil([&]() {
+        return source->numberOfIterations == 1;
+    }));
+
+    ASSERT_EQ(::write(sockets[1], "abc", 3), 3);
+    ASSERT_TRUE(waitUntil([&]() {
+        return source->receivedTuples == 3;
+    }));
+    ASSERT_EQ(::write(sockets[1], "de", 2), 2);
+    ASSERT_TRUE(waitUntil([&]() {
+        return source->receivedTuples == 5;
+    }));
+    EXPECT_EQ(source->numberOfIterations, 3UL);
+
+    // the source completes once it reads the end of the connection
+    ::close(sockets[1]);
+    ASSERT_TRUE(waitUntil([&]() {
+        return sourceExecutor->getNumberOfSources() == 0;
+    }));
+    EXPECT_TRUE(source->closed);
+    EXPECT_EQ(source->numberOfIterations, 4UL);
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(60));
+    EXPECT_TRUE(source->stop(QueryTerminationType::Graceful));
+    ::close(sockets[0]);
+}
+
+/**
+ * @brief stopping a source that waits for data runs the last iteration right away and closes the source
+ */
+TEST_F(SourceExecutorTest, stopWakesUpWaitingSource) {
+    std::array<int, 2> sockets{};
+    ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, sockets.data()), 0);
+    auto source = createSource(1, std::chrono::seconds(60), sockets[0]);
+    ASSERT_TRUE(source->start());
+    ASSERT_TRUE(waitUntil([&]() {
+        return source->numberOfIterations == 1;
+    }));
+    ASSERT_EQ(sourceExecutor->getNumberOfSources(), 1UL);
+
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_TRUE(source->stop(QueryTerminationType::HardStop));
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(10));
+    EXPECT_TRUE(source->closed);
+    EXPECT_EQ(source->numberOfIterations, 1UL);
+    ASSERT_TRUE(waitUntil([&]() {
+        return sourceExecutor->getNumberOfSources() == 0;
+    }));
+    ::close(sockets[0]);
+    ::close(sockets[1]);
+}
+
+/**
+ * @brief an exception in an iteration fails the source, removes it from the executor, and leaves other sources running
+ */
+TEST_F(SourceExecutorTest, exceptionFailsSource) {
+    auto failingSource = createSource(1, std::chrono::milliseconds(5));
+    failingSource->failAtIteration = 3;
+    auto otherSource = createSource(2, std::chrono::milliseconds(5));
+
+    ASSERT_TRUE(failingSource->start());
+    ASSERT_TRUE(otherSource->start());
+    ASSERT_TRUE(waitUntil([&]() {
+        return sourceExecutor->getNumberOfSources() == 1;
+    }));
+    EXPECT_EQ(failingSource->numberOfIterations, 3UL);
+    EXPECT_FALSE(failingSource->closed);
+
+    // the failed source is not scheduled again, while the other source keeps running
+    auto otherIterations = otherSource->numberOfIterations.load();
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_EQ(failingSource->numberOfIterations, 3UL);
+    EXPECT_GT(otherSource->numberOfIterations, otherIterations);
+
+    // stop retrieves the failed future of the source without rethrowing
+    EXPECT_TRUE(failingSource->stop(QueryTerminationType::HardStop));
+    EXPECT_TRUE(otherSource->stop(QueryTerminationType::HardStop));
+    EXPECT_TRUE(otherSource->closed);
+    ASSERT_TRUE(waitUntil([&]() {
+        return sourceExecutor->getNumberOfSources() == 0;
+    }));
+}
+
+/**
+ * @brief a TCP source blocks on its socket until the buffer is full, so a peer that sends less than one buffer and then
+ * stalls must not pin a thread of the executor: the source keeps its own thread and the executor drives the other sources
+ */
+TEST_F(SourceExecutorTest, tcpSourceWithStalledPeerKeepsItsOwnThread) {
+    auto listenSocket = ::socket(AF_INET, SOCK_STREAM, 0);
+    ASSERT_GE(listenSocket, 0);
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socklen_t addressLength = sizeof(address);
+    ASSERT_EQ(::bind(listenSocket, reinterpret_cast<sockaddr*>(&address), addressLength), 0);
+    ASSERT_EQ(::listen(listenSocket, 1), 0);
+    ASSERT_EQ(::getsockname(listenSocket, reinterpret_cast<sockaddr*>(&address), &addressLength), 0);
+
+    auto tcpSourceType = TCPSourceType::create();
+    tcpSourceType->setSocketHost("127.0.0.1");
+    tcpSourceType->setSocketPort(ntohs(address.sin_port));
+    tcpSourceType->setInputFormat(Configurations::InputFormat::CSV);
+    tcpSourceType->setDecideMessageSize(Configurations::TCPDecideMessageSize::TUPLE_SEPARATOR);
+    tcpSourceType->setTupleSeparator('\n');
+    // without a flush interval, the source waits for a full buffer
+    tcpSourceType->setFlushIntervalMS(0);
+    auto tcpSource = std::make_shared<CountingTCPSource>(schema,
+                                                         nodeEngine->getBufferManager(),
+                                                         nodeEngine->getQueryManager(),
+                                                         tcpSourceType,
+                                                         1);
+    EXPECT_FALSE(tcpSource->supportsSourceExecutor());
+    ASSERT_TRUE(tcpSource->start());
+    auto peer = ::accept(listenSocket, nullptr, nullptr);
+    ASSERT_GE(peer, 0);
+    EXPECT_EQ(sourceExecutor->getNumberOfSources(), 0UL);
+
+    // the peer sends two tuples, less than one buffer, and stalls
+    ASSERT_EQ(::send(peer, "1\n2\n", 4, MSG_NOSIGNAL), 4);
+    auto otherSource = createSource(2, std::chrono::milliseconds(0));
+    otherSource->completeAtIteration = 6;
+    ASSERT_TRUE(otherSource->start());
+    ASSERT_TRUE(waitUntil([&]() {
+        return otherSource->closed.load();
+    }));
+    EXPECT_EQ(otherSource->numberOfIterations, 6UL);
+    EXPECT_EQ(tcpSource->emittedTuples, 0UL);
+    EXPECT_FALSE(tcpSource->closed);
+
+    // the source emits the partial buffer and completes once the peer closes the connection
+    ::close(peer);
+    ASSERT_TRUE(waitUntil([&]() {
+        return tcpSource->closed.load();
+    }));
+    EXPECT_EQ(tcpSource->emittedTuples, 2UL);
+    EXPECT_TRUE(tcpSource->stop(QueryTerminationType::Graceful));
+    EXPECT_TRUE(otherSource->stop(QueryTerminationType::Graceful));
+    ::close(listenSocket);
+}
+
+}// namespace x::Runtime
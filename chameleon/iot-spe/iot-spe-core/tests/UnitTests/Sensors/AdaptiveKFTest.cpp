@@ -13,9 +13,12 @@
 */
 
 #include <Catalogs/Source/PhysicalSource.hpp>
+#include <Runtime/FusedGatheringGroup.hpp>
 #include <Runtime/NodeEngine.hpp>
 #include <Runtime/NodeEngineBuilder.hpp>
+#include <Util/FixedSizeKalmanFilter.hpp>
 #include <Util/KalmanFilter.hpp>
+#include <Util/KalmanFilterBank.hpp>
 #include <Util/Logger/Logger.hpp>
 
 #include <Configurations/Worker/QueryCompilerConfiguration.hpp>
@@ -58,9 +61,9 @@ class AdaptiveKFTest : public Testing::BaseIntegrationTest {
         workerConfiguration->numberOfBuffersInSourceLocalBufferPool.setValue(12);
         workerConfiguration->numberOfBuffersPerWorker.setValue(12);
 
-        auto nodeEngine = Runtime::NodeEngineBuilder::create(workerConfiguration)
-                              .setQueryStatusListener(std::make_shared<DummyQueryListener>())
-                              .build();
+        nodeEngine = Runtime::NodeEngineBuilder::create(workerConfiguration)
+                         .setQueryStatusListener(std::make_shared<DummyQueryListener>())
+                         .build();
 
         now_ms = std::chrono::time_point_cast<std::chrono::milliseconds>(std::chrono::system_clock::now());
         // Fake measurements for y with noise
@@ -77,6 +80,8 @@ class AdaptiveKFTest : public Testing::BaseIntegrationTest {
     void TearDown() override {
         x_INFO("Tear down AdaptiveKFTest class.");
         x_DEBUG("Tear down OperatorOperatorCodeGenerationTest test case.");
+        ASSERT_TRUE(nodeEngine->stop());
+        nodeEngine.reset();
         dataPort.reset();
         Testing::BaseIntegrationTest::TearDown();
     }
@@ -470,4 +475,165 @@ TEST_F(AdaptiveKFTest, kfUpdateUnusualValueTest) {
     EXPECT_NE(abnormalEstimationError, normalEstimationError);
     EXPECT_GT(abnormalEstimationError, normalEstimationError);
 }
-}// namespace x
\ No newline at end of file
+
+TEST_F(AdaptiveKFTest, kfFixedSizeMatchesDynamicTest) {
+    // both filters use the default 3-state model
+    KalmanFilter kfDynamic;
+    FixedSizeKalmanFilter<3, 1> kfFixed;
+    kfDynamic.init();
+    kfFixed.init();
+
+    Eigen::VectorXd y(1);
+    FixedSizeKalmanFilter<3, 1>::MeasurementVector yFixed;
+    for (auto measurement : measurements) {
+        y << measurement;
+        yFixed << measurement;
+        kfDynamic.update(y);
+        kfFixed.update(yFixed);
+
+        // closed-form gain yields the same state and error as the general inverse
+        for (int i = 0; i < 3; ++i) {
+            EXPECT_NEAR(kfDynamic.getState()(i), kfFixed.getState()(i), 1e-6);
+        }
+        EXPECT_NEAR(kfDynamic.getEstimationError(), kfFixed.getEstimationError(), 1e-6);
+    }
+    EXPECT_EQ(kfDynamic.getNewGatheringInterval(), kfFixed.getNewGatheringInterval());
+}
+
+TEST_F(AdaptiveKFTest, kfBankMatchesSingleFiltersTest) {
+    // odd number of filters, so that both the vectorized and the scalar kernel are used
+    const uint64_t numberOfFilters = 7;
+    KalmanFilterBank::Model model;
+    KalmanFilterBank bank(numberOfFilters, model, 2);
+
+    // the same constant velocity model as a single fixed-size filter
+    using ReferenceFilter = FixedSizeKalmanFilter<2, 1>;
+    ReferenceFilter::StateMatrix F;
+    F << 1, model.timeStep, 0, 1;
+    ReferenceFilter::ObservationMatrix H;
+    H << 1, 0;
+    ReferenceFilter::StateMatrix Q;
+    Q << model.processNoise, model.processNoiseCovariance01, model.processNoiseCovariance01, model.processNoise;
+    ReferenceFilter::MeasurementMatrix R;
+    R << model.measurementNoise;
+    ReferenceFilter::StateMatrix P = ReferenceFilter::StateMatrix::Identity() * model.initialCovariance;
+    std::vector<std::unique_ptr<ReferenceFilter>> referenceFilters;
+    for (uint64_t i = 0; i < numberOfFilters; ++i) {
+        referenceFilters.emplace_back(std::make_unique<ReferenceFilter>(model.timeStep, F, H, Q, R, P, 2));
+        referenceFilters.back()->init();
+    }
+
+    std::vector<double> stepMeasurements(numberOfFilters);
+    ReferenceFilter::MeasurementVector y;
+    for (auto measurement : measurements) {
+        for (uint64_t i = 0; i < numberOfFilters; ++i) {
+            stepMeasurements[i] = measurement + i;
+        }
+        bank.update(stepMeasurements.data());
+        for (uint64_t i = 0; i < numberOfFilters; ++i) {
+            y << stepMeasurements[i];
+            referenceFilters[i]->update(y);
+            EXPECT_NEAR(referenceFilters[i]->getState()(0), bank.getValueEstimate(i), 1e-6);
+            EXPECT_NEAR(referenceFilters[i]->getState()(1), bank.getRateEstimate(i), 1e-6);
+            EXPECT_NEAR(referenceFilters[i]->getEstimationError(), bank.getEstimationError(i), 1e-6);
+            EXPECT_EQ(referenceFilters[i]->getNewGatheringInterval(), bank.getFilter(i).getNewGatheringInterval());
+        }
+    }
+}
+
+TEST_F(AdaptiveKFTest, kfUpdateFromMultivariateValuesTest) {
+    // two fields per tuple, one random walk per field, as used by sources with several adaptive value fields
+    auto dynamicFilterPtr = KalmanFilter::createRandomWalk(2);
+    auto& dynamicFilter = *dynamicFilterPtr;
+    using FixedFilter = FixedSizeKalmanFilter<2, 2>;
+    FixedFilter::StateMatrix fixedIdentity = FixedFilter::StateMatrix::Identity();
+    FixedFilter fixedFilter(1.0 / 30, fixedIdentity, fixedIdentity, .05 * fixedIdentity, 5 * fixedIdentity, 10 * fixedIdentity);
+    ASSERT_EQ(dynamicFilter.getMeasurementSize(), 2);
+    ASSERT_EQ(fixedFilter.getMeasurementSize(), 2);
+
+    std::vector<double> values;
+    for (auto measurement : measurements) {
+        values.emplace_back(measurement);
+        values.emplace_back(2 * measurement + 1);
+    }
+    dynamicFilter.updateFromValues(values.data(), measurements.size());
+    fixedFilter.updateFromValues(values.data(), measurements.size());
+    EXPECT_NEAR(dynamicFilter.getState()(0), fixedFilter.getState()(0), 1e-6);
+    EXPECT_NEAR(dynamicFilter.getState()(1), fixedFilter.getState()(1), 1e-6);
+    EXPECT_NEAR(dynamicFilter.getEstimationError(), fixedFilter.getEstimationError(), 1e-6);
+}
+
+TEST_F(AdaptiveKFTest, fusedGatheringGroupTest) {
+    // three accelerometer axes as separate members, one decision per round of submissions
+    Runtime::FusedGatheringGroup group("accelerometer");
+    auto x = group.join(1, std::chrono::milliseconds(100));
+    auto y = group.join(1, std::chrono::milliseconds(100));
+    auto z = group.join(1, std::chrono::milliseconds(50));
+    ASSERT_EQ(group.getNumberOfMembers(), 3);
+    ASSERT_EQ(group.getMeasurementSize(), 3);
+    EXPECT_EQ(group.getGatheringInterval(), std::chrono::milliseconds(50));
+
+    for (uint64_t i = 0; i < measurements.size(); ++i) {
+        auto value = measurements[i];
+        auto otherValue = 2 * value;
+        group.submit(x, &value);
+        group.submit(y, &otherValue);
+        EXPECT_EQ(group.getNumberOfUpdates(), i);
+        group.submit(z, &value);
+        EXPECT_EQ(group.getNumberOfUpdates(), i + 1);
+    }
+
+    // the group stops waiting for a member that left
+    group.leave(z);
+    auto value = measurements[0];
+    group.submit(x, &value);
+    EXPECT_EQ(group.getNumberOfUpdates(), measurements.size());
+    group.submit(y, &value);
+    EXPECT_EQ(group.getNumberOfUpdates(), measurements.size() + 1);
+    EXPECT_EQ(group.getNumberOfMembers(), 2);
+    EXPECT_GT(group.getGatheringInterval().count(), 0);
+}
+
+TEST_F(AdaptiveKFTest, fusedGatheringGroupRejoinTest) {
+    // a redeployed member leaves and joins again, e.g., when its query is restarted
+    auto queryManager = nodeEngine->getQueryManager();
+    auto [group, xAxis] = queryManager->joinFusedGatheringGroup("accelerometer", 1, std::chrono::milliseconds(100));
+    auto [sameGroup, yAxis] = queryManager->joinFusedGatheringGroup("accelerometer", 2, std::chrono::milliseconds(100));
+    ASSERT_EQ(group, sameGroup);
+    ASSERT_EQ(group->getMeasurementSize(), 3);
+
+    double xValue = 1.0;
+    std::vector<double> yValues = {100.0, 100.0};
+    for (uint64_t i = 0; i < 20; ++i) {
+        group->submit(xAxis, &xValue);
+        group->submit(yAxis, yValues.data());
+    }
+
+    // the values of the member that left are no longer part of the filter
+    queryManager->leaveFusedGatheringGroup(group, yAxis);
+    EXPECT_EQ(group->getMeasurementSize(), 1);
+    auto [rejoinedGroup, zAxis] = queryManager->joinFusedGatheringGroup("accelerometer", 1, std::chrono::milliseconds(100));
+    EXPECT_EQ(rejoinedGroup, group);
+    EXPECT_EQ(zAxis, yAxis);
+    EXPECT_EQ(group->getNumberOfMembers(), 2);
+    EXPECT_EQ(group->getMeasurementSize(), 2);
+
+    double zValue = -5.0;
+    auto numberOfUpdates = group->getNumberOfUpdates();
+    for (uint64_t i = 0; i < 200; ++i) {
+        group->submit(xAxis, &xValue);
+        group->submit(zAxis, &zValue);
+    }
+    EXPECT_EQ(group->getNumberOfUpdates(), numberOfUpdates + 200);
+    ASSERT_EQ(group->getEstimate(xAxis).size(), 1);
+    ASSERT_EQ(group->getEstimate(zAxis).size(), 1);
+    EXPECT_NEAR(group->getEstimate(xAxis)[0], xValue, 0.1);
+    EXPECT_NEAR(group->getEstimate(zAxis)[0], zValue, 0.1);
+
+    // the group is dropped with its last member
+    queryManager->leaveFusedGatheringGroup(group, xAxis);
+    EXPECT_EQ(queryManager->getFusedGatheringGroup("accelerometer"), group);
+    queryManager->leaveFusedGatheringGroup(group, zAxis);
+    EXPECT_EQ(queryManager->getFusedGatheringGroup("accelerometer"), nullptr);
+}
+}// namespace x
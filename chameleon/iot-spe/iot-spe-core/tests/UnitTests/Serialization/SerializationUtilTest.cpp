@@ -45,6 +45,7 @@
 #include <Operators/LogicalOperators/BroadcastLogicalOperatorNode.hpp>
 #include <Operators/LogicalOperators/JoinLogicalOperatorNode.hpp>
 #include <Operators/LogicalOperators/Sinks/FileSinkDescriptor.hpp>
+#include <Operators/LogicalOperators/Sinks/KafkaSinkDescriptor.hpp>
 #include <Operators/LogicalOperators/Sinks/NetworkSinkDescriptor.hpp>
 #include <Operators/LogicalOperators/Sinks/PrintSinkDescriptor.hpp>
 #include <Operators/LogicalOperators/Sinks/SinkLogicalOperatorNode.hpp>
@@ -360,6 +361,18 @@ TEST_F(SerializationUtilTest, sinkDescriptorSerialization) {
         EXPECT_TRUE(sink->equal(deserializedSourceDescriptor));
     }
 
+    {
+        auto sink = KafkaSinkDescriptor::create("CSV_FORMAT", "test", "localhost:9092", 1000, 32, 0, 4096);
+        SerializableOperator_SinkDetails sinkDescriptor;
+        OperatorSerializationUtil::serializeSinkDescriptor(*sink, sinkDescriptor, 0);
+        auto deserializedSourceDescriptor = OperatorSerializationUtil::deserializeSinkDescriptor(sinkDescriptor);
+        EXPECT_TRUE(sink->equal(deserializedSourceDescriptor));
+        auto kafkaSinkDescriptor = deserializedSourceDescriptor->as<KafkaSinkDescriptor>();
+        EXPECT_EQ(kafkaSinkDescriptor->getMaxInFlightMessages(), 32u);
+        EXPECT_EQ(kafkaSinkDescriptor->getLingerTimeInMs(), 0u);
+        EXPECT_EQ(kafkaSinkDescriptor->getBatchSizeInBytes(), 4096u);
+    }
+
     {
         Network::NodeLocation nodeLocation{1, "localhost", 31337};
         Network::xPartition xPartition{1, 22, 33, 44};
@@ -17,6 +17,9 @@
 #include <Runtime/NodeEngine.hpp>
 #include <Runtime/NodeEngineBuilder.hpp>
 #include <Runtime/QueryManager.hpp>
+#include <Runtime/WorkerContext.hpp>
+#include <Runtime/xThread.hpp>
+#include <Sinks/Formats/CsvFormat.hpp>
 #include <Sinks/Mediums/KafkaSink.hpp>
 #include <Sinks/SinkCreator.hpp>
 
@@ -27,8 +30,14 @@
 #include <Util/Logger/Logger.hpp>
 #include <Util/TestUtils.hpp>
 
+#include <chrono>
+#include <cppkafka/cppkafka.h>
+#include <functional>
 #include <gtest/gtest.h>
+#include <librdkafka/rdkafka_mock.h>
 #include <string>
+#include <thread>
+#include <vector>
 
 #ifndef OPERATORID
 #define OPERATORID 1
@@ -43,7 +52,50 @@ const std::string KAFKA_BROKER = "localhost:9092";
 namespace x {
 
 /**
-* NOTE: this test requires a running kafka instance
+ * @brief in-process mock cluster of librdkafka that stands in for a kafka broker with a topic of one partition
+ */
+class KafkaBrokerStandIn {
+  public:
+    explicit KafkaBrokerStandIn(const std::string& topic)
+        : topic(topic), producer(cppkafka::Configuration{{"test.mock.num.brokers", "1"}}) {
+        mockCluster = rd_kafka_handle_mock_cluster(producer.get_handle());
+        rd_kafka_mock_topic_create(mockCluster, topic.c_str(), 1, 1);
+    }
+
+    std::string getBrokers() const { return rd_kafka_mock_cluster_bootstraps(mockCluster); }
+
+    /**
+     * @brief delays every response of the broker, so that messages stay in flight for at least the round trip time
+     */
+    void setRoundTripTime(std::chrono::milliseconds roundTripTime) {
+        rd_kafka_mock_broker_set_rtt(mockCluster, 1, static_cast<int>(roundTripTime.count()));
+    }
+
+    /**
+     * @brief reads the payloads of the topic from its beginning until numberOfMessages were read or the timeout expired
+     */
+    std::vector<std::string> consume(uint64_t numberOfMessages, std::chrono::milliseconds timeout) {
+        cppkafka::Consumer consumer(cppkafka::Configuration{{"metadata.broker.list", getBrokers()}, {"group.id", "sinkTest"}});
+        consumer.assign({cppkafka::TopicPartition(topic, 0, cppkafka::TopicPartition::OFFSET_BEGINNING)});
+        std::vector<std::string> payloads;
+        auto deadline = std::chrono::steady_clock::now() + timeout;
+        while (payloads.size() < numberOfMessages && std::chrono::steady_clock::now() < deadline) {
+            auto message = consumer.poll(std::chrono::milliseconds(100));
+            if (message && !message.get_error()) {
+                payloads.emplace_back(message.get_payload());
+            }
+        }
+        return payloads;
+    }
+
+  private:
+    std::string topic;
+    cppkafka::Producer producer;
+    rd_kafka_mock_cluster_t* mockCluster;
+};
+
+/**
+* NOTE: the tests in RUNNING_KAFKA_INSTANCE require a running kafka instance, the others use KafkaBrokerStandIn
 */
 class KafkaSinkTest : public Testing::BaseIntegrationTest {
   public:
@@ -90,6 +142,49 @@ class KafkaSinkTest : public Testing::BaseIntegrationTest {
         return buffer;
     }
 
+    /**
+     * @brief creates a buffer of origin 1 with the single tuple (key, key)
+     */
+    Runtime::TupleBuffer createBuffer(uint32_t key, uint64_t watermark, uint64_t sequenceNumber) {
+        auto buffer = nodeEngine->getBufferManager()->getBufferBlocking();
+        buffer.getBuffer<uint32_t>()[0] = key;
+        buffer.getBuffer<uint32_t>()[1] = key;
+        buffer.setNumberOfTuples(1);
+        buffer.setWatermark(watermark);
+        buffer.setSequenceNumber(sequenceNumber);
+        buffer.setOriginId(1);
+        return buffer;
+    }
+
+    std::shared_ptr<KafkaSink> createSink(const std::string& brokers,
+                                          FaultToleranceType faultToleranceType,
+                                          uint64_t maxInFlightMessages) {
+        auto format = std::make_shared<CsvFormat>(testSchema, nodeEngine->getBufferManager());
+        return std::make_shared<KafkaSink>(format,
+                                           nodeEngine,
+                                           1,
+                                           brokers,
+                                           topic,
+                                           OPERATORID,
+                                           OPERATORID,
+                                           10 * 1000,
+                                           faultToleranceType,
+                                           1,
+                                           maxInFlightMessages,
+                                           0);
+    }
+
+    static bool waitUntil(const std::function<bool()>& predicate) {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (!predicate()) {
+            if (std::chrono::steady_clock::now() > deadline) {
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return true;
+    }
+
     Runtime::NodeEnginePtr nodeEngine{nullptr};
     Testing::BorrowedPortPtr dataPort;
     SchemaPtr testSchema;
@@ -105,16 +200,44 @@ class KafkaSinkTest : public Testing::BaseIntegrationTest {
 * Tests basic set up of Kafka sink
 */
 TEST_F(KafkaSinkTest, KafkaSinkInit) {
-    auto kafkaSink =
-        createCsvKafkaSink(testSchema, OPERATORID, OPERATORID, nodeEngine, 1, brokers, topic, 1, FaultToleranceType::NONE, 1);
+    auto kafkaSink = createCsvKafkaSink(testSchema,
+                                        OPERATORID,
+                                        OPERATORID,
+                                        nodeEngine,
+                                        1,
+                                        brokers,
+                                        topic,
+                                        1,
+                                        FaultToleranceType::NONE,
+                                        1,
+                                        32,
+                                        10,
+                                        4096);
+    auto physicalKafkaSink = std::dynamic_pointer_cast<KafkaSink>(kafkaSink);
+    ASSERT_NE(physicalKafkaSink, nullptr);
+    EXPECT_EQ(physicalKafkaSink->getMaxInFlightMessages(), 32u);
+    EXPECT_EQ(physicalKafkaSink->getLingerTimeInMs(), 10u);
+    EXPECT_EQ(physicalKafkaSink->getBatchSizeInBytes(), 4096u);
+    physicalKafkaSink->shutdown();
 }
 
 /**
 * Test if schema, Kafka server address, clientId, user, and topic are the same
 */
 TEST_F(KafkaSinkTest, KafkaSourcePrint) {
-    auto kafkaSink =
-        createCsvKafkaSink(testSchema, OPERATORID, OPERATORID, nodeEngine, 1, brokers, topic, 1, FaultToleranceType::NONE, 1);
+    auto kafkaSink = createCsvKafkaSink(testSchema,
+                                        OPERATORID,
+                                        OPERATORID,
+                                        nodeEngine,
+                                        1,
+                                        brokers,
+                                        topic,
+                                        1,
+                                        FaultToleranceType::NONE,
+                                        1,
+                                        KafkaSink::DEFAULT_MAX_IN_FLIGHT_MESSAGES,
+                                        KafkaSink::DEFAULT_LINGER_TIME_IN_MS,
+                                        KafkaSink::DEFAULT_BATCH_SIZE_IN_BYTES);
 
     std::string expected = "KAFKA_SINK(BROKER(localhost:9092), TOPIC(sinkTest).";
 
@@ -123,6 +246,83 @@ TEST_F(KafkaSinkTest, KafkaSourcePrint) {
     x_DEBUG("kafka string={}", kafkaSink->toString());
 }
 
+/**
+* Test if the in-flight window of the producer is configured and empty before any buffer is written
+*/
+TEST_F(KafkaSinkTest, KafkaSinkInFlightWindow) {
+    auto format = std::make_shared<CsvFormat>(testSchema, nodeEngine->getBufferManager());
+    auto kafkaSink = std::make_shared<KafkaSink>(format,
+                                                 nodeEngine,
+                                                 1,
+                                                 brokers,
+                                                 topic,
+                                                 OPERATORID,
+                                                 OPERATORID,
+                                                 1,
+                                                 FaultToleranceType::NONE,
+                                                 1,
+                                                 16);
+
+    EXPECT_EQ(kafkaSink->getMaxInFlightMessages(), 16u);
+    EXPECT_EQ(kafkaSink->getNumberOfInFlightMessages(), 0u);
+    EXPECT_EQ(kafkaSink->getNumberOfFailedMessages(), 0u);
+    kafkaSink->shutdown();
+}
+
+/**
+* Test if buffers wait in order once the in-flight window is full and are produced as acknowledgements free the window
+*/
+TEST_F(KafkaSinkTest, KafkaSinkQueuesMessagesWhenWindowIsFull) {
+    KafkaBrokerStandIn broker(topic);
+    broker.setRoundTripTime(std::chrono::milliseconds(500));
+    auto kafkaSink = createSink(broker.getBrokers(), FaultToleranceType::NONE, 2);
+    Runtime::WorkerContext workerContext(Runtime::xThread::getId(), nodeEngine->getBufferManager(), 64);
+
+    for (uint32_t key = 0; key < 5; ++key) {
+        auto buffer = createBuffer(key, 0, key + 1);
+        ASSERT_TRUE(kafkaSink->writeData(buffer, workerContext));
+    }
+    EXPECT_EQ(kafkaSink->getNumberOfInFlightMessages(), 2u);
+    EXPECT_EQ(kafkaSink->getNumberOfQueuedMessages(), 3u);
+
+    ASSERT_TRUE(waitUntil([&]() {
+        return kafkaSink->getNumberOfInFlightMessages() == 0 && kafkaSink->getNumberOfQueuedMessages() == 0;
+    }));
+    EXPECT_EQ(kafkaSink->getNumberOfFailedMessages(), 0u);
+    std::vector<std::string> expectedPayloads{"0,0\n", "1,1\n", "2,2\n", "3,3\n", "4,4\n"};
+    EXPECT_EQ(broker.consume(5, std::chrono::seconds(10)), expectedPayloads);
+    kafkaSink->shutdown();
+}
+
+/**
+* Test if the watermark of a buffer is only updated after its message was acknowledged
+*/
+TEST_F(KafkaSinkTest, KafkaSinkUpdatesWatermarkAfterDelivery) {
+    KafkaBrokerStandIn broker(topic);
+    broker.setRoundTripTime(std::chrono::milliseconds(500));
+    auto kafkaSink = createSink(broker.getBrokers(), FaultToleranceType::AT_LEAST_ONCE, 1);
+    Runtime::WorkerContext workerContext(Runtime::xThread::getId(), nodeEngine->getBufferManager(), 64);
+
+    auto firstBuffer = createBuffer(1, 10, 1);
+    auto secondBuffer = createBuffer(2, 20, 2);
+    ASSERT_TRUE(kafkaSink->writeData(firstBuffer, workerContext));
+    ASSERT_TRUE(kafkaSink->writeData(secondBuffer, workerContext));
+    EXPECT_EQ(kafkaSink->getCurrentEpochBarrier(), 0u);
+
+    // the second message is only produced after the acknowledgement of the first one, which takes one round trip
+    ASSERT_TRUE(waitUntil([&]() {
+        return kafkaSink->getCurrentEpochBarrier() > 0;
+    }));
+    EXPECT_EQ(kafkaSink->getCurrentEpochBarrier(), 10u);
+    EXPECT_EQ(kafkaSink->getNumberOfInFlightMessages() + kafkaSink->getNumberOfQueuedMessages(), 1u);
+
+    ASSERT_TRUE(waitUntil([&]() {
+        return kafkaSink->getCurrentEpochBarrier() == 20;
+    }));
+    EXPECT_EQ(kafkaSink->getNumberOfFailedMessages(), 0u);
+    kafkaSink->shutdown();
+}
+
 #ifdef RUNNING_KAFKA_INSTANCE
 /**
  * Tests if obtained value is valid.
@@ -23,16 +23,22 @@
 #include <Runtime/NodeEngineBuilder.hpp>
 #include <Runtime/TupleBuffer.hpp>
 #include <Runtime/WorkerContext.hpp>
+#include <Sinks/Formats/CsvFormat.hpp>
 #include <Sinks/Formats/JsonFormat.hpp>
 #include <Sinks/Mediums/MQTTSink.hpp>
 #include <Sinks/SinkCreator.hpp>
 #include <Sources/SourceCreator.hpp>
 #include <Util/Core.hpp>
 #include <Util/Logger/Logger.hpp>
+#include <Util/MQTTBrokerStandIn.hpp>
 #include <Util/TestUtils.hpp>
+#include <chrono>
 #include <gtest/gtest.h>
 #include <memory>
 #include <random>
+#include <string_view>
+#include <thread>
+#include <vector>
 using namespace x;
 /**
  * @brief this class implements tests for the MQTTSink class
@@ -159,9 +165,53 @@ class MQTTTSinkTest : public Testing::BaseIntegrationTest {
         return false;
     }
 
+    /**
+     * @brief creates an asynchronous sink that publishes csv formatted tuples with QoS 1 to the broker stand-in
+     */
+    MQTTSinkPtr createSink(const Testing::MQTTBrokerStandIn& broker,
+                           uint64_t tuplesPerMessage,
+                           FaultToleranceType faultToleranceType = FaultToleranceType::NONE) {
+        SinkFormatPtr format = std::make_shared<CsvFormat>(testSchema, nodeEngine->getBufferManager());
+        return std::make_shared<MQTTSink>(format,
+                                          nodeEngine,
+                                          1,
+                                          0,
+                                          0,
+                                          broker.getAddress(),
+                                          CLIENT_ID,
+                                          TOPIC,
+                                          USER,
+                                          120,
+                                          MQTTSinkDescriptor::TimeUnits::milliseconds,
+                                          0,
+                                          MQTTSinkDescriptor::ServiceQualities::atLeastOnce,
+                                          true,
+                                          faultToleranceType,
+                                          1,
+                                          tuplesPerMessage);
+    }
+
+    /**
+     * @brief creates a buffer of origin 1 whose i-th tuple is (i, 10 * i)
+     */
+    Runtime::TupleBuffer createBuffer(uint32_t numberOfTuples, uint64_t watermark, uint64_t sequenceNumber) {
+        auto buffer = nodeEngine->getBufferManager()->getBufferBlocking();
+        for (uint32_t i = 0; i < numberOfTuples; ++i) {
+            buffer.getBuffer<uint32_t>()[2 * i] = i;
+            buffer.getBuffer<uint32_t>()[2 * i + 1] = 10 * i;
+        }
+        buffer.setNumberOfTuples(numberOfTuples);
+        buffer.setWatermark(watermark);
+        buffer.setSequenceNumber(sequenceNumber);
+        buffer.setOriginId(1);
+        return buffer;
+    }
+
     /* Will be called after all tests in this class are finished. */
     static void TearDownTestCase() { x_DEBUG("Tear down MQTT test class."); }
 
+    const std::chrono::seconds WAIT_TIMEOUT = std::chrono::seconds(10);
+
   protected:
     Testing::BorrowedPortPtr dataPort;
 };
@@ -193,6 +243,86 @@ TEST_F(MQTTTSinkTest, testMQTTClientCreation) {
     ASSERT_FALSE(mqttSink->toString().empty());
 }
 
+TEST_F(MQTTTSinkTest, testMQTTClientCreationWithTuplesPerMessage) {
+    auto mqttSink = createMQTTSink(testSchema,
+                                   0,
+                                   0,
+                                   nodeEngine,
+                                   1,
+                                   LOCAL_ADDRESS,
+                                   CLIENT_ID,
+                                   TOPIC,
+                                   USER,
+                                   120,
+                                   MQTTSinkDescriptor::TimeUnits::milliseconds,
+                                   0,
+                                   MQTTSinkDescriptor::ServiceQualities::atLeastOnce,
+                                   true,
+                                   FaultToleranceType::NONE,
+                                   1,
+                                   64);
+    x_INFO("{}", mqttSink->toString());
+    EXPECT_NE(mqttSink->toString().find("TUPLES_PER_MESSAGE=64"), std::string::npos);
+    EXPECT_EQ(std::dynamic_pointer_cast<MQTTSink>(mqttSink)->getTuplesPerMessage(), 64u);
+    EXPECT_EQ(std::dynamic_pointer_cast<MQTTSink>(mqttSink)->getNumberOfBuffersInFlight(), 0u);
+}
+
+/* - Messages of several tuples ---------------------------------------------------- */
+TEST_F(MQTTTSinkTest, testSplitIntoMessages) {
+    using Payloads = std::vector<std::string_view>;
+    EXPECT_EQ(MQTTSink::splitIntoMessages("1,1\n2,2\n3,3\n4,4\n5,5\n", 2), (Payloads{"1,1\n2,2", "3,3\n4,4", "5,5"}));
+    EXPECT_EQ(MQTTSink::splitIntoMessages("1,1\n2,2\n3,3\n4,4\n", 2), (Payloads{"1,1\n2,2", "3,3\n4,4"}));
+    // the last line lacks its line break
+    EXPECT_EQ(MQTTSink::splitIntoMessages("1,1\n2,2\n3,3", 2), (Payloads{"1,1\n2,2", "3,3"}));
+    EXPECT_EQ(MQTTSink::splitIntoMessages("1,1\n2,2", 2), (Payloads{"1,1\n2,2"}));
+    EXPECT_EQ(MQTTSink::splitIntoMessages("1,1\n2,2\n", 1), (Payloads{"1,1", "2,2"}));
+    EXPECT_EQ(MQTTSink::splitIntoMessages("1,1\n2,2\n", 64), (Payloads{"1,1\n2,2"}));
+    EXPECT_TRUE(MQTTSink::splitIntoMessages("", 2).empty());
+}
+
+TEST_F(MQTTTSinkTest, testMQTTSinkPublishesTuplesPerMessage) {
+    Testing::MQTTBrokerStandIn broker;
+    auto mqttSink = createSink(broker, 2);
+    ASSERT_TRUE(mqttSink->connect());
+    Runtime::WorkerContext workerContext(Runtime::xThread::getId(), nodeEngine->getBufferManager(), 64);
+
+    auto buffer = createBuffer(5, 0, 1);
+    ASSERT_TRUE(mqttSink->writeData(buffer, workerContext));
+    ASSERT_TRUE(broker.waitForPublishedPayloads(TOPIC, 3, WAIT_TIMEOUT));
+    EXPECT_EQ(broker.getPublishedPayloads(TOPIC), (std::vector<std::string>{"0,0\n1,10", "2,20\n3,30", "4,40"}));
+    mqttSink->shutdown();
+    EXPECT_EQ(mqttSink->getNumberOfBuffersInFlight(), 0u);
+}
+
+/* - Release of delivered buffers ---------------------------------------------------- */
+TEST_F(MQTTTSinkTest, testMQTTSinkReleasesBuffersOnDelivery) {
+    Testing::MQTTBrokerStandIn broker;
+    broker.holdAcknowledgements();
+    auto mqttSink = createSink(broker, 1, FaultToleranceType::AT_LEAST_ONCE);
+    ASSERT_TRUE(mqttSink->connect());
+    Runtime::WorkerContext workerContext(Runtime::xThread::getId(), nodeEngine->getBufferManager(), 64);
+
+    auto firstBuffer = createBuffer(2, 10, 1);
+    auto secondBuffer = createBuffer(1, 20, 2);
+    ASSERT_TRUE(mqttSink->writeData(firstBuffer, workerContext));
+    ASSERT_TRUE(mqttSink->writeData(secondBuffer, workerContext));
+    ASSERT_TRUE(broker.waitForPublishedPayloads(TOPIC, 3, WAIT_TIMEOUT));
+
+    // the sink keeps the buffers and their watermarks until the broker acknowledges their messages
+    EXPECT_EQ(mqttSink->getNumberOfBuffersInFlight(), 2u);
+    EXPECT_EQ(mqttSink->getCurrentEpochBarrier(), 0u);
+
+    // the delivery callback releases the buffers without a further write
+    broker.releaseAcknowledgements();
+    auto deadline = std::chrono::steady_clock::now() + WAIT_TIMEOUT;
+    while (mqttSink->getNumberOfBuffersInFlight() > 0 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(mqttSink->getNumberOfBuffersInFlight(), 0u);
+    EXPECT_EQ(mqttSink->getCurrentEpochBarrier(), 20u);
+    mqttSink->shutdown();
+}
+
 /* - MQTT Client SetUp / Connect to Broker ---------------------------------------------------- */
 TEST_F(MQTTTSinkTest, DISABLED_testMQTTConnectToBrokerAsynchronous) {
     uint64_t maxBufferedMSGs = 120;
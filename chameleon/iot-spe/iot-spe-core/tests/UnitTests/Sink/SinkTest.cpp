@@ -25,7 +25,10 @@
 #include <Runtime/NodeEngine.hpp>
 #include <Runtime/NodeEngineBuilder.hpp>
 #include <Runtime/WorkerContext.hpp>
+#include <Sinks/Formats/CsvFormat.hpp>
+#include <Sinks/Formats/JsonFormat.hpp>
 #include <Sinks/Mediums/FileSink.hpp>
+#include <Sinks/Mediums/NullOutputSink.hpp>
 #include <Sinks/SinkCreator.hpp>
 #include <Sources/SourceCreator.hpp>
 #include <Util/Common.hpp>
@@ -34,6 +37,7 @@
 #include <Util/TestUtils.hpp>
 #include <gtest/gtest.h>
 #include <ostream>
+#include <thread>
 
 #include <Monitoring/MetricCollectors/CpuCollector.hpp>
 #include <Monitoring/MetricCollectors/DiskCollector.hpp>
@@ -140,6 +144,141 @@ TEST_F(SinkTest, testCSVFileSink) {
     buffer.release();
 }
 
+TEST_F(SinkTest, testCSVFileSinkWithGroupCommit) {
+    auto nodeEngine = this->nodeEngine;
+    Runtime::WorkerContext wctx(Runtime::xThread::getId(), nodeEngine->getBufferManager(), 64);
+    const DataSinkPtr csvSink = createCSVFileSink(test_schema,
+                                                  0,
+                                                  0,
+                                                  nodeEngine,
+                                                  1,
+                                                  path_to_csv_file,
+                                                  false,
+                                                  false,
+                                                  FaultToleranceType::NONE,
+                                                  1,
+                                                  FileSinkWriteMode::GROUP_COMMIT);
+
+    std::string expectedContent = Util::toCSVString(test_schema);
+    for (uint64_t i = 0; i < 10; ++i) {
+        TupleBuffer buffer = nodeEngine->getBufferManager()->getBufferBlocking();
+        for (uint64_t j = 0; j < 4; ++j) {
+            buffer.getBuffer<int32_t>()[2 * j] = i;
+            buffer.getBuffer<uint32_t>()[2 * j + 1] = j;
+        }
+        buffer.setNumberOfTuples(4);
+        expectedContent += Util::printTupleBufferAsCSV(buffer, test_schema);
+        EXPECT_TRUE(csvSink->writeData(buffer, wctx));
+    }
+    // the writer thread writes all pending buffers on shutdown
+    csvSink->shutdown();
+
+    std::ifstream ifs(path_to_csv_file.c_str());
+    std::string fileContent((std::istreambuf_iterator<char>(ifs)), (std::istreambuf_iterator<char>()));
+    EXPECT_EQ(fileContent, expectedContent);
+    TupleBuffer lateBuffer = nodeEngine->getBufferManager()->getBufferBlocking();
+    EXPECT_FALSE(csvSink->writeData(lateBuffer, wctx));
+}
+
+TEST_F(SinkTest, testCsvFormatWithTimestamp) {
+    auto schema = Schema::create()
+                      ->addField("KEY", DataTypeFactory::createInt32())
+                      ->addField("VALUE", DataTypeFactory::createDouble())
+                      ->addField("FLAG", DataTypeFactory::createBoolean());
+    TupleBuffer buffer = nodeEngine->getBufferManager()->getBufferBlocking();
+    auto rowLayout = Runtime::MemoryLayouts::RowLayout::create(schema, buffer.getBufferSize());
+    auto dynamicBuffer = Runtime::MemoryLayouts::DynamicTupleBuffer(rowLayout, buffer);
+    for (uint64_t i = 0; i < 3; ++i) {
+        dynamicBuffer[i]["KEY"].write<int32_t>(-static_cast<int32_t>(i));
+        dynamicBuffer[i]["VALUE"].write<double>(i * 0.25);
+        dynamicBuffer[i]["FLAG"].write<bool>(i % 2 == 0);
+    }
+    dynamicBuffer.setNumberOfTuples(3);
+
+    // without a timestamp, the format writes the same content as Util::printTupleBufferAsCSV
+    auto csvFormat = std::make_shared<CsvFormat>(schema, nodeEngine->getBufferManager());
+    EXPECT_EQ(csvFormat->getFormattedBuffer(buffer), "0,0.000000,1\n-1,0.250000,0\n-2,0.500000,1\n");
+    EXPECT_EQ(csvFormat->getFormattedBuffer(buffer), Util::printTupleBufferAsCSV(buffer, schema));
+
+    // the timestamp is appended to every line, the schema of the format is not modified
+    auto csvFormatWithTimestamp = std::make_shared<CsvFormat>(schema, nodeEngine->getBufferManager(), true);
+    EXPECT_TRUE(csvFormatWithTimestamp->getFormattedSchema().ends_with(",timestamp\n"));
+    for (uint64_t i = 0; i < 2; ++i) {
+        auto lines = Util::splitWithStringDelimiter<std::string>(csvFormatWithTimestamp->getFormattedBuffer(buffer), "\n");
+        ASSERT_EQ(lines.size(), 3u);
+        for (const auto& line : lines) {
+            auto values = Util::splitWithStringDelimiter<std::string>(line, ",");
+            ASSERT_EQ(values.size(), 4u);
+            EXPECT_GT(std::stoull(values[3]), 0u);
+        }
+    }
+    EXPECT_EQ(schema->getSize(), 3u);
+}
+
+TEST_F(SinkTest, testJsonFormat) {
+    auto schema = Schema::create()
+                      ->addField("KEY", DataTypeFactory::createUInt64())
+                      ->addField("VALUE", DataTypeFactory::createFloat())
+                      ->addField("FLAG", DataTypeFactory::createBoolean())
+                      ->addField("NAME", DataTypeFactory::createText());
+    TupleBuffer buffer = nodeEngine->getBufferManager()->getBufferBlocking();
+    auto rowLayout = Runtime::MemoryLayouts::RowLayout::create(schema, buffer.getBufferSize());
+    auto dynamicBuffer = Runtime::MemoryLayouts::DynamicTupleBuffer(rowLayout, buffer);
+    std::array<std::string, 2> names{"car", "say \"hi\"\n"};
+    for (uint64_t i = 0; i < names.size(); ++i) {
+        dynamicBuffer[i]["KEY"].write<uint64_t>(i);
+        dynamicBuffer[i]["VALUE"].write<float>(1.5f + i);
+        dynamicBuffer[i]["FLAG"].write<bool>(i == 0);
+        auto childBuffer = nodeEngine->getBufferManager()->getBufferBlocking();
+        *childBuffer.getBuffer<uint32_t>() = names[i].size();
+        std::memcpy(childBuffer.getBuffer<char>() + sizeof(uint32_t), names[i].data(), names[i].size());
+        dynamicBuffer[i]["NAME"].write<Runtime::TupleBuffer::xtedTupleBufferKey>(buffer.storeChildBuffer(childBuffer));
+    }
+    dynamicBuffer.setNumberOfTuples(names.size());
+
+    auto jsonFormat = std::make_shared<JsonFormat>(schema, nodeEngine->getBufferManager());
+    EXPECT_EQ(jsonFormat->getFormattedSchema(), "");
+    EXPECT_EQ(jsonFormat->getFormattedBuffer(buffer),
+              "{\"KEY\":0,\"VALUE\":1.5,\"FLAG\":true,\"NAME\":\"car\"}\n"
+              "{\"KEY\":1,\"VALUE\":2.5,\"FLAG\":false,\"NAME\":\"say \\\"hi\\\"\\n\"}\n");
+}
+
+#ifdef ENABLE_ARROW_BUILD
+TEST_F(SinkTest, testArrowFileSinkWritesOneRecordBatch) {
+    auto nodeEngine = this->nodeEngine;
+    auto pathToArrowFile = getTestResourceFolder() / "sink.arrows";
+    Runtime::WorkerContext wctx(Runtime::xThread::getId(), nodeEngine->getBufferManager(), 64);
+    const DataSinkPtr arrowSink = createArrowIPCFileSink(test_schema, 0, 0, nodeEngine, 1, pathToArrowFile, false);
+
+    for (uint64_t i = 0; i < 10; ++i) {
+        TupleBuffer buffer = nodeEngine->getBufferManager()->getBufferBlocking();
+        for (uint64_t j = 0; j < 4; ++j) {
+            buffer.getBuffer<int32_t>()[2 * j] = i;
+            buffer.getBuffer<uint32_t>()[2 * j + 1] = j;
+        }
+        buffer.setNumberOfTuples(4);
+        EXPECT_TRUE(arrowSink->writeData(buffer, wctx));
+    }
+    // the tuples of all buffers are written as one record batch when the sink shuts down
+    arrowSink->shutdown();
+
+    auto inputFile = arrow::io::ReadableFile::Open(pathToArrowFile).ValueOrDie();
+    auto reader = arrow::ipc::RecordBatchStreamReader::Open(inputFile).ValueOrDie();
+    std::shared_ptr<arrow::RecordBatch> recordBatch;
+    ASSERT_TRUE(reader->ReadNext(&recordBatch).ok());
+    ASSERT_NE(recordBatch, nullptr);
+    ASSERT_EQ(recordBatch->num_rows(), 40);
+    auto keys = std::static_pointer_cast<arrow::Int32Array>(recordBatch->column(0));
+    auto values = std::static_pointer_cast<arrow::UInt32Array>(recordBatch->column(1));
+    for (int64_t row = 0; row < recordBatch->num_rows(); ++row) {
+        EXPECT_EQ(keys->Value(row), row / 4);
+        EXPECT_EQ(values->Value(row), static_cast<uint32_t>(row % 4));
+    }
+    ASSERT_TRUE(reader->ReadNext(&recordBatch).ok());
+    EXPECT_EQ(recordBatch, nullptr);
+}
+#endif
+
 TEST_F(SinkTest, testCSVPrintSink) {
     PhysicalSourcePtr sourceConf = PhysicalSource::create("x", "x1");
     auto nodeEngine = this->nodeEngine;
@@ -217,6 +356,31 @@ TEST_F(SinkTest, testNullOutSink) {
     //cout << "Buffer Content= " << bufferContent << endl;
 }
 
+TEST_F(SinkTest, testNullOutSinkConcurrentWrites) {
+    constexpr uint64_t numberOfWorkers = 4;
+    constexpr uint64_t numberOfBuffersPerWorker = 100;
+    auto nullSink = std::dynamic_pointer_cast<NullOutputSink>(createNullOutputSink(1, 0, nodeEngine, numberOfWorkers));
+
+    std::vector<std::thread> workers;
+    for (uint64_t worker = 0; worker < numberOfWorkers; ++worker) {
+        workers.emplace_back([this, &nullSink]() {
+            // every thread has its own worker id and thus its own shard
+            Runtime::WorkerContext wctx(Runtime::xThread::getId(), nodeEngine->getBufferManager(), 1);
+            auto buffer = nodeEngine->getBufferManager()->getBufferBlocking();
+            buffer.setNumberOfTuples(10);
+            for (uint64_t i = 0; i < numberOfBuffersPerWorker; ++i) {
+                EXPECT_TRUE(nullSink->writeData(buffer, wctx));
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    EXPECT_EQ(nullSink->getNumberOfReceivedBuffers(), numberOfWorkers * numberOfBuffersPerWorker);
+    EXPECT_EQ(nullSink->getNumberOfReceivedTuples(), numberOfWorkers * numberOfBuffersPerWorker * 10);
+}
+
 TEST_F(SinkTest, testCSVZMQSink) {
     PhysicalSourcePtr sourceConf = PhysicalSource::create("x", "x1");
     auto nodeEngine = this->nodeEngine;
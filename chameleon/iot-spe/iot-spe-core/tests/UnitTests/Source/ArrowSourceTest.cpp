@@ -0,0 +1,324 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#ifdef ENABLE_ARROW_BUILD
+#include <API/Schema.hpp>
+#include <BaseIntegrationTest.hpp>
+#include <Catalogs/Source/PhysicalSource.hpp>
+#include <Catalogs/Source/PhysicalSourceTypes/ArrowSourceType.hpp>
+#include <Configurations/Worker/WorkerConfiguration.hpp>
+#include <Runtime/MemoryLayout/ColumnLayout.hpp>
+#include <Runtime/MemoryLayout/DynamicTupleBuffer.hpp>
+#include <Runtime/NodeEngine.hpp>
+#include <Runtime/NodeEngineBuilder.hpp>
+#include <Sources/ArrowSource.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/TestUtils.hpp>
+#include <gtest/gtest.h>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <arrow/api.h>
+#include <arrow/io/api.h>
+#include <arrow/ipc/api.h>
+
+namespace x {
+
+class ArrowSourceProxy : public ArrowSource {
+  public:
+    ArrowSourceProxy(SchemaPtr schema,
+                     Runtime::BufferManagerPtr bufferManager,
+                     Runtime::QueryManagerPtr queryManager,
+                     ArrowSourceTypePtr arrowSourceType)
+        : ArrowSource(schema,
+                      bufferManager,
+                      queryManager,
+                      arrowSourceType,
+                      1,
+                      1,
+                      12,
+                      GatheringMode::INTERVAL_MODE,
+                      "defaultPhysicalSourceName",
+                      {}){};
+
+    Runtime::MemoryLayouts::MemoryLayoutPtr getMemoryLayout() const { return memoryLayout; }
+
+  private:
+    FRIEND_TEST(ArrowSourceTest, testColumnarLayoutSequentialReader);
+    FRIEND_TEST(ArrowSourceTest, testColumnarLayoutPartitionedReader);
+    FRIEND_TEST(ArrowSourceTest, testCopySlicedArrayToColumn);
+    FRIEND_TEST(ArrowSourceTest, testCopyArrayToColumnFallsBack);
+};
+
+/**
+ * Tests that the arrow source writes the record batches of an Arrow IPC file into buffers of the columnar layout.
+ */
+class ArrowSourceTest : public Testing::BaseIntegrationTest {
+  public:
+    using Tuple = std::tuple<int64_t, double, uint32_t, bool>;
+
+    static void SetUpTestCase() {
+        x::Logger::setupLogging("ArrowSourceTest.log", x::LogLevel::LOG_DEBUG);
+        x_INFO("Setup ArrowSourceTest test class.");
+    }
+
+    void SetUp() override {
+        Testing::BaseIntegrationTest::SetUp();
+        auto workerConfigurations = Configurations::WorkerConfiguration::create();
+        workerConfigurations->physicalSources.add(PhysicalSource::create("x", "x1"));
+        nodeEngine = Runtime::NodeEngineBuilder::create(workerConfigurations)
+                         .setQueryStatusListener(std::make_shared<DummyQueryListener>())
+                         .build();
+        // the boolean column is not copied as a whole and takes the value by value path
+        columnarSchema = Schema::create(Schema::MemoryLayoutType::COLUMNAR_LAYOUT)
+                             ->addField("id", BasicType::INT64)
+                             ->addField("value", BasicType::FLOAT64)
+                             ->addField("count", BasicType::UINT32)
+                             ->addField("flag", BasicType::BOOLEAN);
+        filePath = getTestResourceFolder() / "columnar.arrow";
+        ASSERT_TRUE(writeArrowFile(filePath, NUMBER_OF_BATCHES, ROWS_PER_BATCH).ok());
+    }
+
+    void TearDown() override {
+        ASSERT_TRUE(nodeEngine->stop());
+        Testing::BaseIntegrationTest::TearDown();
+    }
+
+    static void TearDownTestCase() { x_INFO("Tear down ArrowSourceTest test class."); }
+
+    /// the values of the i-th row of the file
+    static Tuple expectedTuple(uint64_t i) {
+        return {static_cast<int64_t>(i) - 10, i * 0.5, static_cast<uint32_t>(i * 3), i % 3 == 0};
+    }
+
+    /// writes an Arrow IPC stream with the given number of record batches, the rows count up across the batches
+    static arrow::Status writeArrowFile(const std::string& path, uint64_t numberOfBatches, uint64_t rowsPerBatch) {
+        auto arrowSchema = arrow::schema({arrow::field("id", arrow::int64()),
+                                          arrow::field("value", arrow::float64()),
+                                          arrow::field("count", arrow::uint32()),
+                                          arrow::field("flag", arrow::boolean())});
+        ARROW_ASSIGN_OR_RAISE(auto outputStream, arrow::io::FileOutputStream::Open(path));
+        ARROW_ASSIGN_OR_RAISE(auto writer, arrow::ipc::MakeStreamWriter(outputStream, arrowSchema));
+        for (uint64_t batch = 0; batch < numberOfBatches; ++batch) {
+            arrow::Int64Builder idBuilder;
+            arrow::DoubleBuilder valueBuilder;
+            arrow::UInt32Builder countBuilder;
+            arrow::BooleanBuilder flagBuilder;
+            for (uint64_t row = batch * rowsPerBatch; row < (batch + 1) * rowsPerBatch; ++row) {
+                auto [id, value, count, flag] = expectedTuple(row);
+                ARROW_RETURN_NOT_OK(idBuilder.Append(id));
+                ARROW_RETURN_NOT_OK(valueBuilder.Append(value));
+                ARROW_RETURN_NOT_OK(countBuilder.Append(count));
+                ARROW_RETURN_NOT_OK(flagBuilder.Append(flag));
+            }
+            std::vector<std::shared_ptr<arrow::Array>> arrays(4);
+            ARROW_RETURN_NOT_OK(idBuilder.Finish(&arrays[0]));
+            ARROW_RETURN_NOT_OK(valueBuilder.Finish(&arrays[1]));
+            ARROW_RETURN_NOT_OK(countBuilder.Finish(&arrays[2]));
+            ARROW_RETURN_NOT_OK(flagBuilder.Finish(&arrays[3]));
+            ARROW_RETURN_NOT_OK(writer->WriteRecordBatch(*arrow::RecordBatch::Make(arrowSchema, rowsPerBatch, arrays)));
+        }
+        ARROW_RETURN_NOT_OK(writer->Close());
+        return outputStream->Close();
+    }
+
+    ArrowSourceTypePtr createSourceType(uint32_t numberOfTuplesToProducePerBuffer, uint32_t numberOfReaderThreads) {
+        auto sourceType = ArrowSourceType::create();
+        sourceType->setFilePath(filePath);
+        sourceType->setNumberOfTuplesToProducePerBuffer(numberOfTuplesToProducePerBuffer);
+        sourceType->setNumberOfBuffersToProduce(0);
+        sourceType->setNumberOfReaderThreads(numberOfReaderThreads);
+        return sourceType;
+    }
+
+    /// reads all buffers of the source and returns their tuples in the order of the buffers
+    static std::vector<Tuple> readAllTuples(ArrowSourceProxy& source, std::vector<uint64_t>& tuplesPerBuffer) {
+        std::vector<Tuple> tuples;
+        while (auto buffer = source.receiveData()) {
+            auto dynamicBuffer = Runtime::MemoryLayouts::DynamicTupleBuffer(source.getMemoryLayout(), buffer.value());
+            tuplesPerBuffer.emplace_back(dynamicBuffer.getNumberOfTuples());
+            for (uint64_t i = 0; i < dynamicBuffer.getNumberOfTuples(); ++i) {
+                tuples.emplace_back(dynamicBuffer[i][0].read<int64_t>(),
+                                    dynamicBuffer[i][1].read<double>(),
+                                    dynamicBuffer[i][2].read<uint32_t>(),
+                                    dynamicBuffer[i][3].read<bool>());
+            }
+        }
+        return tuples;
+    }
+
+    static std::vector<Tuple> expectedTuples() {
+        std::vector<Tuple> tuples;
+        for (uint64_t i = 0; i < NUMBER_OF_BATCHES * ROWS_PER_BATCH; ++i) {
+            tuples.emplace_back(expectedTuple(i));
+        }
+        return tuples;
+    }
+
+    // five tuples per buffer do not divide the batches, so buffers start and end within batches
+    static constexpr uint64_t NUMBER_OF_BATCHES = 3;
+    static constexpr uint64_t ROWS_PER_BATCH = 7;
+    static constexpr uint32_t TUPLES_PER_BUFFER = 5;
+
+    Runtime::NodeEnginePtr nodeEngine{nullptr};
+    SchemaPtr columnarSchema;
+    std::string filePath;
+};
+
+/**
+ * @brief the sequential reader fills buffers across batch boundaries from slices of the record batches
+ */
+TEST_F(ArrowSourceTest, testColumnarLayoutSequentialReader) {
+    ArrowSourceProxy source(columnarSchema,
+                            nodeEngine->getBufferManager(),
+                            nodeEngine->getQueryManager(),
+                            createSourceType(TUPLES_PER_BUFFER, 1));
+    ASSERT_NE(std::dynamic_pointer_cast<Runtime::MemoryLayouts::ColumnLayout>(source.getMemoryLayout()), nullptr);
+    source.open();
+    std::vector<uint64_t> tuplesPerBuffer;
+    EXPECT_EQ(readAllTuples(source, tuplesPerBuffer), expectedTuples());
+    EXPECT_EQ(tuplesPerBuffer, (std::vector<uint64_t>{5, 5, 5, 5, 1}));
+    EXPECT_TRUE(source.fileEnded);
+    EXPECT_EQ(source.getNumberOfGeneratedTuples(), NUMBER_OF_BATCHES * ROWS_PER_BATCH);
+}
+
+/**
+ * @brief the partitioned reader converts every record batch on its own, so the last buffer of a batch is partial
+ */
+TEST_F(ArrowSourceTest, testColumnarLayoutPartitionedReader) {
+    ArrowSourceProxy source(columnarSchema,
+                            nodeEngine->getBufferManager(),
+                            nodeEngine->getQueryManager(),
+                            createSourceType(TUPLES_PER_BUFFER, 2));
+    ASSERT_NE(std::dynamic_pointer_cast<Runtime::MemoryLayouts::ColumnLayout>(source.getMemoryLayout()), nullptr);
+    source.open();
+    std::vector<uint64_t> tuplesPerBuffer;
+    EXPECT_EQ(readAllTuples(source, tuplesPerBuffer), expectedTuples());
+    EXPECT_EQ(tuplesPerBuffer, (std::vector<uint64_t>{5, 2, 5, 2, 5, 2}));
+    EXPECT_TRUE(source.fileEnded);
+    EXPECT_EQ(source.getNumberOfGeneratedTuples(), NUMBER_OF_BATCHES * ROWS_PER_BATCH);
+}
+
+/**
+ * @brief the partitioned reader produces the tuples of the sequential reader in file order, also with full buffers
+ * that span several record batches on the sequential path
+ */
+TEST_F(ArrowSourceTest, testPartitionedReaderMatchesSequentialReader) {
+    ASSERT_TRUE(writeArrowFile(filePath, 16, 100).ok());
+    for (auto tuplesPerBuffer : {0u, 3u, TUPLES_PER_BUFFER}) {
+        ArrowSourceProxy sequentialSource(columnarSchema,
+                                          nodeEngine->getBufferManager(),
+                                          nodeEngine->getQueryManager(),
+                                          createSourceType(tuplesPerBuffer, 1));
+        sequentialSource.open();
+        std::vector<uint64_t> sequentialTuplesPerBuffer;
+        auto sequentialTuples = readAllTuples(sequentialSource, sequentialTuplesPerBuffer);
+        ASSERT_EQ(sequentialTuples.size(), 16 * 100UL);
+        EXPECT_EQ(sequentialTuples.front(), expectedTuple(0));
+        EXPECT_EQ(sequentialTuples.back(), expectedTuple(16 * 100 - 1));
+
+        for (auto numberOfReaderThreads : {2u, 3u, 8u}) {
+            ArrowSourceProxy partitionedSource(columnarSchema,
+                                               nodeEngine->getBufferManager(),
+                                               nodeEngine->getQueryManager(),
+                                               createSourceType(tuplesPerBuffer, numberOfReaderThreads));
+            partitionedSource.open();
+            std::vector<uint64_t> partitionedTuplesPerBuffer;
+            EXPECT_EQ(readAllTuples(partitionedSource, partitionedTuplesPerBuffer), sequentialTuples)
+                << "tuplesPerBuffer=" << tuplesPerBuffer << " numberOfReaderThreads=" << numberOfReaderThreads;
+        }
+    }
+}
+
+/**
+ * @brief a sliced array is copied from its offset into the column at the requested tuple index
+ */
+TEST_F(ArrowSourceTest, testCopySlicedArrayToColumn) {
+    ArrowSourceProxy source(columnarSchema,
+                            nodeEngine->getBufferManager(),
+                            nodeEngine->getQueryManager(),
+                            createSourceType(TUPLES_PER_BUFFER, 1));
+    source.open();
+    arrow::Int64Builder builder;
+    for (int64_t i = 0; i < 10; ++i) {
+        ASSERT_TRUE(builder.Append(i * 100).ok());
+    }
+    std::shared_ptr<arrow::Array> array;
+    ASSERT_TRUE(builder.Finish(&array).ok());
+    auto slice = array->Slice(3, 4);
+    ASSERT_EQ(slice->offset(), 3);
+
+    auto buffer = source.allocateBuffer();
+    for (uint64_t i = 0; i < 8; ++i) {
+        buffer[i][0].write<int64_t>(-1);
+    }
+    ASSERT_TRUE(source.copyArrowArrayToColumn(2, 0, buffer, slice));
+    std::vector<int64_t> column;
+    for (uint64_t i = 0; i < 8; ++i) {
+        column.emplace_back(buffer[i][0].read<int64_t>());
+    }
+    EXPECT_EQ(column, (std::vector<int64_t>{-1, -1, 300, 400, 500, 600, -1, -1}));
+}
+
+/**
+ * @brief arrays that do not match the type of their column, boolean arrays and row layouts are not copied as a whole
+ */
+TEST_F(ArrowSourceTest, testCopyArrayToColumnFallsBack) {
+    ArrowSourceProxy source(columnarSchema,
+                            nodeEngine->getBufferManager(),
+                            nodeEngine->getQueryManager(),
+                            createSourceType(TUPLES_PER_BUFFER, 1));
+    source.open();
+    arrow::Int32Builder int32Builder;
+    ASSERT_TRUE(int32Builder.AppendValues(std::vector<int32_t>{7, 8, 9}).ok());
+    std::shared_ptr<arrow::Array> int32Array;
+    ASSERT_TRUE(int32Builder.Finish(&int32Array).ok());
+    arrow::BooleanBuilder booleanBuilder;
+    ASSERT_TRUE(booleanBuilder.AppendValues(std::vector<bool>{true, false, true}).ok());
+    std::shared_ptr<arrow::Array> booleanArray;
+    ASSERT_TRUE(booleanBuilder.Finish(&booleanArray).ok());
+    arrow::UInt32Builder uint32Builder;
+    ASSERT_TRUE(uint32Builder.AppendValues(std::vector<uint32_t>{7, 8, 9}).ok());
+    std::shared_ptr<arrow::Array> uint32Array;
+    ASSERT_TRUE(uint32Builder.Finish(&uint32Array).ok());
+
+    auto buffer = source.allocateBuffer();
+    for (uint64_t i = 0; i < 3; ++i) {
+        buffer[i][0].write<int64_t>(-1);
+        buffer[i][3].write<bool>(false);
+    }
+    // the int32 array does not match the int64 column and leaves the column untouched
+    EXPECT_FALSE(source.copyArrowArrayToColumn(0, 0, buffer, int32Array));
+    for (uint64_t i = 0; i < 3; ++i) {
+        EXPECT_EQ(buffer[i][0].read<int64_t>(), -1);
+    }
+    // the boolean column is written value by value by the caller
+    EXPECT_FALSE(source.copyArrowArrayToColumn(0, 3, buffer, booleanArray));
+    for (uint64_t i = 0; i < 3; ++i) {
+        EXPECT_FALSE(buffer[i][3].read<bool>());
+    }
+
+    auto rowSchema = Schema::create(Schema::MemoryLayoutType::ROW_LAYOUT)->copyFields(columnarSchema);
+    ArrowSourceProxy rowSource(rowSchema,
+                               nodeEngine->getBufferManager(),
+                               nodeEngine->getQueryManager(),
+                               createSourceType(TUPLES_PER_BUFFER, 1));
+    rowSource.open();
+    auto rowBuffer = rowSource.allocateBuffer();
+    EXPECT_FALSE(rowSource.copyArrowArrayToColumn(0, 2, rowBuffer, uint32Array));
+}
+
+}// namespace x
+#endif// ENABLE_ARROW_BUILD
@@ -0,0 +1,177 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <BaseIntegrationTest.hpp>
+#include <gtest/gtest.h>
+
+#include <API/Schema.hpp>
+#include <Common/PhysicalTypes/DefaultPhysicalTypeFactory.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <Runtime/MemoryLayout/ColumnLayout.hpp>
+#include <Runtime/MemoryLayout/DynamicTupleBuffer.hpp>
+#include <Runtime/MemoryLayout/RowLayout.hpp>
+#include <Sources/Parsers/CSVParser.hpp>
+#include <Sources/Parsers/CSVTokenizer.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace x {
+
+/**
+ * Tests the SIMD tokenizer of csv blocks and the parsing of tokenized lines by the CSVParser.
+ */
+class CSVTokenizerTest : public Testing::BaseUnitTest {
+  public:
+    static void SetUpTestCase() {
+        x::Logger::setupLogging("CSVTokenizerTest.log", x::LogLevel::LOG_DEBUG);
+        x_INFO("Setup CSVTokenizerTest test class.");
+    }
+
+    /// tokenizes the data byte by byte
+    static std::vector<uint32_t> tokenizeScalar(const std::string& data, char delimiter) {
+        std::vector<uint32_t> separators;
+        for (uint64_t i = 0; i < data.size(); ++i) {
+            if (data[i] == '\n') {
+                separators.emplace_back(static_cast<uint32_t>(i) | CSVTokenizer::LINE_END);
+            } else if (data[i] == delimiter) {
+                separators.emplace_back(static_cast<uint32_t>(i));
+            }
+        }
+        return separators;
+    }
+
+    /// parses all lines of the data into a buffer with the given memory layout
+    static uint64_t parseLines(const std::string& data,
+                               const SchemaPtr& schema,
+                               const Runtime::MemoryLayouts::MemoryLayoutPtr& memoryLayout,
+                               Runtime::MemoryLayouts::DynamicTupleBuffer& buffer,
+                               const Runtime::BufferManagerPtr& bufferManager) {
+        std::vector<PhysicalTypePtr> physicalTypes;
+        for (const auto& field : schema->fields) {
+            physicalTypes.emplace_back(DefaultPhysicalTypeFactory().getPhysicalType(field->getDataType()));
+        }
+        CSVParser parser(schema->getSize(), physicalTypes, ",");
+        CSVTokenizer tokenizer(',');
+        std::vector<uint32_t> separators;
+        tokenizer.tokenize(data.data(), data.size(), separators);
+
+        uint64_t tupleCount = 0;
+        uint64_t lineStart = 0;
+        uint64_t firstSeparator = 0;
+        for (uint64_t i = 0; i < separators.size(); ++i) {
+            if (separators[i] & CSVTokenizer::LINE_END) {
+                parser.writeTokenizedLineToTupleBuffer(data.data(),
+                                                       lineStart,
+                                                       separators.data() + firstSeparator,
+                                                       i - firstSeparator + 1,
+                                                       tupleCount++,
+                                                       buffer,
+                                                       schema,
+                                                       bufferManager);
+                lineStart = (separators[i] & ~CSVTokenizer::LINE_END) + 1;
+                firstSeparator = i + 1;
+            }
+        }
+        EXPECT_EQ(memoryLayout, buffer.getMemoryLayout());
+        return tupleCount;
+    }
+};
+
+/**
+ * @brief Tests that delimiters and line feeds are found in blocks of all sizes around the 64 byte steps of the scan
+ */
+TEST_F(CSVTokenizerTest, tokenizeMatchesScalarScan) {
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int> characters(0, 9);
+    CSVTokenizer tokenizer(';');
+    for (uint64_t size = 0; size < 300; ++size) {
+        std::string data(size, 'a');
+        for (auto& character : data) {
+            auto draw = characters(generator);
+            character = draw == 0 ? '\n' : draw < 3 ? ';' : static_cast<char>('0' + draw);
+        }
+        std::vector<uint32_t> separators;
+        tokenizer.tokenize(data.data(), data.size(), separators);
+        EXPECT_EQ(separators, tokenizeScalar(data, ';')) << "block size " << size;
+    }
+}
+
+/**
+ * @brief Tests that the tokenizer appends to the separators and ignores the line feed as delimiter of other blocks
+ */
+TEST_F(CSVTokenizerTest, tokenizeAppendsSeparators) {
+    CSVTokenizer tokenizer(',');
+    std::string data = "1,2\n3,4\n";
+    std::vector<uint32_t> separators{7};
+    tokenizer.tokenize(data.data(), data.size(), separators);
+    std::vector<uint32_t> expected{7, 1, 3 | CSVTokenizer::LINE_END, 5, 7 | CSVTokenizer::LINE_END};
+    EXPECT_EQ(separators, expected);
+    EXPECT_EQ(tokenizer.getDelimiter(), ',');
+}
+
+/**
+ * @brief Tests that tokenized lines are written to the row and to the column layout
+ */
+TEST_F(CSVTokenizerTest, writeTokenizedLinesToTupleBuffer) {
+    auto schema = Schema::create()
+                      ->addField("id", BasicType::UINT64)
+                      ->addField("delta", BasicType::INT8)
+                      ->addField("value", BasicType::FLOAT64)
+                      ->addField("ratio", BasicType::FLOAT32)
+                      ->addField("valid", BasicType::BOOLEAN);
+    // blanks around numbers and a carriage return at the line end are accepted, 0x10 falls back to std::stod
+    std::string data = "1,-5,0.25,1.5,true\n2, 7 ,-1e3,2.5,0\r\n18446744073709551615,-128,0x10,0,false\n";
+    auto bufferManager = std::make_shared<Runtime::BufferManager>(4096, 4);
+
+    std::vector<Runtime::MemoryLayouts::MemoryLayoutPtr> memoryLayouts{
+        Runtime::MemoryLayouts::RowLayout::create(schema, bufferManager->getBufferSize()),
+        Runtime::MemoryLayouts::ColumnLayout::create(schema, bufferManager->getBufferSize())};
+    for (const auto& memoryLayout : memoryLayouts) {
+        auto buffer = Runtime::MemoryLayouts::DynamicTupleBuffer(memoryLayout, bufferManager->getBufferBlocking());
+        ASSERT_EQ(parseLines(data, schema, memoryLayout, buffer, bufferManager), 3u);
+        EXPECT_EQ(buffer[0][0].read<uint64_t>(), 1u);
+        EXPECT_EQ(buffer[0][1].read<int8_t>(), -5);
+        EXPECT_DOUBLE_EQ(buffer[0][2].read<double>(), 0.25);
+        EXPECT_FLOAT_EQ(buffer[0][3].read<float>(), 1.5f);
+        EXPECT_TRUE(buffer[0][4].read<bool>());
+        EXPECT_EQ(buffer[1][0].read<uint64_t>(), 2u);
+        EXPECT_EQ(buffer[1][1].read<int8_t>(), 7);
+        EXPECT_DOUBLE_EQ(buffer[1][2].read<double>(), -1000.0);
+        EXPECT_FALSE(buffer[1][4].read<bool>());
+        EXPECT_EQ(buffer[2][0].read<uint64_t>(), std::numeric_limits<uint64_t>::max());
+        EXPECT_EQ(buffer[2][1].read<int8_t>(), std::numeric_limits<int8_t>::min());
+        EXPECT_DOUBLE_EQ(buffer[2][2].read<double>(), 16.0);
+        EXPECT_FALSE(buffer[2][4].read<bool>());
+    }
+}
+
+/**
+ * @brief Tests that a line with a wrong number of fields is rejected and that an empty last field does not count
+ */
+TEST_F(CSVTokenizerTest, writeTokenizedLineChecksNumberOfFields) {
+    auto schema = Schema::create()->addField("id", BasicType::UINT64)->addField("value", BasicType::INT32);
+    auto bufferManager = std::make_shared<Runtime::BufferManager>(4096, 4);
+    auto memoryLayout = Runtime::MemoryLayouts::RowLayout::create(schema, bufferManager->getBufferSize());
+    auto buffer = Runtime::MemoryLayouts::DynamicTupleBuffer(memoryLayout, bufferManager->getBufferBlocking());
+
+    ASSERT_EQ(parseLines("3,4,\n", schema, memoryLayout, buffer, bufferManager), 1u);
+    EXPECT_EQ(buffer[0][0].read<uint64_t>(), 3u);
+    EXPECT_EQ(buffer[0][1].read<int32_t>(), 4);
+    EXPECT_ANY_THROW(parseLines("1,2,3\n", schema, memoryLayout, buffer, bufferManager));
+    EXPECT_ANY_THROW(parseLines("1\n", schema, memoryLayout, buffer, bufferManager));
+}
+
+}// namespace x
@@ -0,0 +1,115 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <BaseIntegrationTest.hpp>
+#include <gtest/gtest.h>
+
+#include <Sources/KafkaOffsetTracker.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <thread>
+#include <vector>
+
+namespace x {
+
+/**
+ * Tests that the KafkaOffsetTracker only releases the offsets of buffers acknowledged by an epoch barrier.
+ */
+class KafkaOffsetTrackerTest : public Testing::BaseUnitTest {
+  public:
+    static void SetUpTestCase() {
+        x::Logger::setupLogging("KafkaOffsetTrackerTest.log", x::LogLevel::LOG_DEBUG);
+        x_INFO("Setup KafkaOffsetTrackerTest test class.");
+    }
+};
+
+/**
+ * @brief offsets are only committable for buffers with a smaller watermark than the barrier
+ */
+TEST_F(KafkaOffsetTrackerTest, acknowledgeBuffersBelowBarrier) {
+    KafkaOffsetTracker tracker;
+    tracker.track(10, {{0, 5}});
+    tracker.track(20, {{0, 9}});
+    tracker.track(30, {{0, 12}});
+    EXPECT_FALSE(tracker.takeCommittableOffsets().has_value());
+
+    // the barrier equals the watermark of the second buffer, which is not acknowledged yet
+    tracker.acknowledge(20);
+    auto offsets = tracker.takeCommittableOffsets();
+    ASSERT_TRUE(offsets.has_value());
+    EXPECT_EQ(offsets.value(), (KafkaOffsetTracker::PartitionOffsets{{0, 5}}));
+    EXPECT_EQ(tracker.getNumberOfPendingBuffers(), 2u);
+
+    // offsets are handed out only once
+    EXPECT_FALSE(tracker.takeCommittableOffsets().has_value());
+
+    tracker.acknowledge(31);
+    offsets = tracker.takeCommittableOffsets();
+    ASSERT_TRUE(offsets.has_value());
+    EXPECT_EQ(offsets.value(), (KafkaOffsetTracker::PartitionOffsets{{0, 12}}));
+    EXPECT_EQ(tracker.getNumberOfPendingBuffers(), 0u);
+}
+
+/**
+ * @brief the committable offsets of several partitions hold the latest acknowledged offset of each partition
+ */
+TEST_F(KafkaOffsetTrackerTest, mergeOffsetsOfPartitions) {
+    KafkaOffsetTracker tracker;
+    tracker.track(1, {{0, 3}});
+    tracker.track(2, {{0, 3}, {1, 7}});
+    tracker.track(3, {{0, 4}, {1, 7}, {2, 1}});
+    tracker.track(4, {{0, 6}, {1, 8}, {2, 1}});
+
+    tracker.acknowledge(4);
+    auto offsets = tracker.takeCommittableOffsets();
+    ASSERT_TRUE(offsets.has_value());
+    EXPECT_EQ(offsets.value(), (KafkaOffsetTracker::PartitionOffsets{{0, 4}, {1, 7}, {2, 1}}));
+
+    // a smaller barrier than before does not acknowledge anything
+    tracker.acknowledge(2);
+    EXPECT_FALSE(tracker.takeCommittableOffsets().has_value());
+    EXPECT_EQ(tracker.getNumberOfPendingBuffers(), 1u);
+}
+
+/**
+ * @brief barriers are acknowledged by another thread while the source thread tracks and commits
+ */
+TEST_F(KafkaOffsetTrackerTest, acknowledgeConcurrently) {
+    constexpr uint64_t numberOfBuffers = 10000;
+    KafkaOffsetTracker tracker;
+    std::thread acknowledger([&tracker]() {
+        for (uint64_t barrier = 0; barrier <= numberOfBuffers + 1; barrier += 7) {
+            tracker.acknowledge(barrier);
+        }
+        tracker.acknowledge(numberOfBuffers + 1);
+    });
+
+    int64_t lastCommittedOffset = 0;
+    for (uint64_t i = 1; i <= numberOfBuffers; ++i) {
+        tracker.track(i, {{0, static_cast<int64_t>(i)}});
+        if (auto offsets = tracker.takeCommittableOffsets()) {
+            EXPECT_GT(offsets->at(0), lastCommittedOffset);
+            lastCommittedOffset = offsets->at(0);
+        }
+    }
+    acknowledger.join();
+    if (auto offsets = tracker.takeCommittableOffsets()) {
+        EXPECT_GT(offsets->at(0), lastCommittedOffset);
+        lastCommittedOffset = offsets->at(0);
+    }
+    // the final barrier may have arrived before all buffers were tracked
+    EXPECT_LE(lastCommittedOffset, static_cast<int64_t>(numberOfBuffers));
+    EXPECT_EQ(lastCommittedOffset + tracker.getNumberOfPendingBuffers(), numberOfBuffers);
+}
+
+}// namespace x
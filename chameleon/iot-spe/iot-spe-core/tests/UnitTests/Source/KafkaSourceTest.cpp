@@ -31,8 +31,11 @@
 #include <cppkafka/cppkafka.h>
 #include <cstring>
 #include <gtest/gtest.h>
+#include <librdkafka/rdkafka_mock.h>
+#include <set>
 #include <string>
 #include <thread>
+#include <vector>
 
 #ifndef OPERATORID
 #define OPERATORID 1
@@ -47,7 +50,53 @@ const std::string KAFKA_BROKER = "localhost:9092";
 namespace x {
 
 /**
- * NOTE: this test requires a running kafka instance
+ * @brief in-process mock cluster of librdkafka that stands in for a kafka broker. Its producer writes the test messages.
+ */
+class KafkaBrokerStandIn {
+  public:
+    KafkaBrokerStandIn(const std::string& topic, int numberOfPartitions)
+        : topic(topic), producer(cppkafka::Configuration{{"test.mock.num.brokers", "1"}}) {
+        mockCluster = rd_kafka_handle_mock_cluster(producer.get_handle());
+        rd_kafka_mock_topic_create(mockCluster, topic.c_str(), numberOfPartitions, 1);
+    }
+
+    std::string getBrokers() const { return rd_kafka_mock_cluster_bootstraps(mockCluster); }
+
+    void produce(int32_t partition, const std::string& payload, std::chrono::milliseconds timestamp) {
+        producer.produce(cppkafka::MessageBuilder(topic).partition(partition).timestamp(timestamp).payload(payload));
+        producer.flush();
+    }
+
+    /**
+     * @return the committed offset of the consumer group on the partition or a negative value if nothing was committed
+     */
+    int64_t getCommittedOffset(const std::string& groupId, int32_t partition) {
+        cppkafka::Consumer consumer(cppkafka::Configuration{{"metadata.broker.list", getBrokers()}, {"group.id", groupId}});
+        auto offsets = consumer.get_offsets_committed({cppkafka::TopicPartition(topic, partition)});
+        return offsets.empty() ? -1 : offsets.front().get_offset();
+    }
+
+  private:
+    std::string topic;
+    cppkafka::Producer producer;
+    rd_kafka_mock_cluster_t* mockCluster;
+};
+
+/**
+ * @brief exposes the protected members of the source, which is consumed without a query
+ */
+class KafkaSourceProxy : public KafkaSource {
+  public:
+    using KafkaSource::KafkaSource;
+
+  private:
+    FRIEND_TEST(KafkaSourceTest, KafkaSourceConsumesConfiguredPartitions);
+    FRIEND_TEST(KafkaSourceTest, KafkaSourceSplitsBinaryPayloadAcrossBuffers);
+    FRIEND_TEST(KafkaSourceTest, KafkaSourceCommitsOffsetsAfterEpochBarrier);
+};
+
+/**
+ * NOTE: the tests in RUNNING_KAFKA_INSTANCE require a running kafka instance, the others use KafkaBrokerStandIn
  */
 class KafkaSourceTest : public Testing::BaseIntegrationTest {
   public:
@@ -78,6 +127,31 @@ class KafkaSourceTest : public Testing::BaseIntegrationTest {
     /* Will be called after all tests in this class are finished. */
     static void TearDownTestCase() { x_DEBUG("KAFKASOURCETEST::TearDownTestCases() Tear down KAFKASourceTest test class."); }
 
+    std::shared_ptr<KafkaSourceProxy> createSourceProxy(const std::string& brokerList, bool autoCommit) {
+        return std::make_shared<KafkaSourceProxy>(test_schema,
+                                                  nodeEngine->getBufferManager(),
+                                                  nodeEngine->getQueryManager(),
+                                                  0,
+                                                  brokerList,
+                                                  topic,
+                                                  groupId,
+                                                  autoCommit,
+                                                  100,
+                                                  "earliest",
+                                                  kafkaSourceType,
+                                                  OPERATORID,
+                                                  OPERATORID,
+                                                  NUMSOURCELOCALBUFFERS,
+                                                  10,
+                                                  "defaultPhysicalStreamName",
+                                                  std::vector<Runtime::Execution::SuccessorExecutablePipeline>());
+    }
+
+    static std::vector<uint32_t> readValues(const Runtime::TupleBuffer& buffer) {
+        auto* values = buffer.getBuffer<uint32_t>();
+        return {values, values + buffer.getNumberOfTuples()};
+    }
+
     Runtime::NodeEnginePtr nodeEngine{nullptr};
 
     SchemaPtr test_schema;
@@ -146,6 +220,109 @@ TEST_F(KafkaSourceTest, KafkaSourcePrint) {
     SUCCEED();
 }
 
+/**
+ * Tests that invalid entries in the partition list are rejected when the source is created
+ */
+TEST_F(KafkaSourceTest, KafkaSourceInvalidPartitions) {
+    EXPECT_EQ(KafkaSource::parsePartitions("0,,2"), std::vector<int32_t>({0, 2}));
+    EXPECT_TRUE(KafkaSource::parsePartitions("").empty());
+    for (const auto* partitions : {"0,a", "1x", "-1", "99999999999"}) {
+        kafkaSourceType->setPartitions(partitions);
+        EXPECT_THROW(createSourceProxy(brokers, true), std::runtime_error) << partitions;
+    }
+}
+
+/**
+ * Tests that the source only consumes the configured partitions of the topic
+ */
+TEST_F(KafkaSourceTest, KafkaSourceConsumesConfiguredPartitions) {
+    KafkaBrokerStandIn broker(topic, 3);
+    for (int32_t partition = 0; partition < 3; ++partition) {
+        broker.produce(partition, R"({"var": )" + std::to_string(partition) + "}", std::chrono::milliseconds(1000));
+    }
+    kafkaSourceType->setPartitions("0,2");
+    auto kafkaSource = createSourceProxy(broker.getBrokers(), true);
+    EXPECT_EQ(kafkaSource->getPartitions(), std::vector<int32_t>({0, 2}));
+
+    kafkaSource->running = true;
+    std::multiset<uint32_t> values;
+    while (values.size() < 2) {
+        auto buffer = kafkaSource->receiveData();
+        ASSERT_TRUE(buffer.has_value());
+        auto bufferValues = readValues(buffer.value());
+        values.insert(bufferValues.begin(), bufferValues.end());
+    }
+    kafkaSource->running = false;
+    EXPECT_EQ(values, std::multiset<uint32_t>({0, 2}));
+}
+
+/**
+ * Tests that a BINARY payload that holds more tuples than fit into a buffer continues in the next buffer
+ */
+TEST_F(KafkaSourceTest, KafkaSourceSplitsBinaryPayloadAcrossBuffers) {
+    KafkaBrokerStandIn broker(topic, 1);
+    auto tuplesPerBuffer = nodeEngine->getBufferManager()->getBufferSize() / sizeof(uint32_t);
+    std::vector<uint32_t> tuples(tuplesPerBuffer + tuplesPerBuffer / 2);
+    for (uint32_t i = 0; i < tuples.size(); ++i) {
+        tuples[i] = i;
+    }
+    broker.produce(0,
+                   std::string(reinterpret_cast<const char*>(tuples.data()), tuples.size() * sizeof(uint32_t)),
+                   std::chrono::milliseconds(1000));
+    kafkaSourceType->setPartitions("0");
+    kafkaSourceType->setInputFormat(Configurations::InputFormat::BINARY);
+    auto kafkaSource = createSourceProxy(broker.getBrokers(), true);
+
+    kafkaSource->running = true;
+    auto firstBuffer = kafkaSource->receiveData();
+    auto secondBuffer = kafkaSource->receiveData();
+    kafkaSource->running = false;
+    ASSERT_TRUE(firstBuffer.has_value());
+    ASSERT_TRUE(secondBuffer.has_value());
+    EXPECT_EQ(firstBuffer->getNumberOfTuples(), tuplesPerBuffer);
+    EXPECT_EQ(secondBuffer->getNumberOfTuples(), tuples.size() - tuplesPerBuffer);
+
+    auto values = readValues(firstBuffer.value());
+    auto secondValues = readValues(secondBuffer.value());
+    values.insert(values.end(), secondValues.begin(), secondValues.end());
+    EXPECT_EQ(values, tuples);
+}
+
+/**
+ * Tests that without autoCommit the offsets of a buffer are only committed after an epoch barrier above its watermark
+ */
+TEST_F(KafkaSourceTest, KafkaSourceCommitsOffsetsAfterEpochBarrier) {
+    KafkaBrokerStandIn broker(topic, 1);
+    kafkaSourceType->setPartitions("0");
+    auto kafkaSource = createSourceProxy(broker.getBrokers(), false);
+    kafkaSource->running = true;
+
+    broker.produce(0, R"({"var": 1})", std::chrono::milliseconds(1000));
+    auto firstBuffer = kafkaSource->receiveData();
+    ASSERT_TRUE(firstBuffer.has_value());
+    EXPECT_EQ(firstBuffer->getWatermark(), 1000UL);
+
+    broker.produce(0, R"({"var": 2})", std::chrono::milliseconds(2000));
+    auto secondBuffer = kafkaSource->receiveData();
+    ASSERT_TRUE(secondBuffer.has_value());
+    EXPECT_EQ(secondBuffer->getWatermark(), 2000UL);
+    EXPECT_LT(broker.getCommittedOffset(groupId, 0), 0);
+
+    // the source is not part of a query, so propagating the barrier fails after the offsets were acknowledged
+    EXPECT_THROW(kafkaSource->injectEpochBarrier(1500, 1), std::runtime_error);
+    EXPECT_LT(broker.getCommittedOffset(groupId, 0), 0);
+
+    // the acknowledged offsets are committed with the next poll, the second buffer is still pending
+    broker.produce(0, R"({"var": 3})", std::chrono::milliseconds(3000));
+    ASSERT_TRUE(kafkaSource->receiveData().has_value());
+    kafkaSource->running = false;
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (broker.getCommittedOffset(groupId, 0) < 0 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+    EXPECT_EQ(broker.getCommittedOffset(groupId, 0), 1);
+}
+
 #ifdef RUNNING_KAFKA_INSTANCE
 /**
  * Tests if obtained value is valid.
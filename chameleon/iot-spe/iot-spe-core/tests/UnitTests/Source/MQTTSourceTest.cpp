@@ -20,11 +20,17 @@
 #include <Operators/LogicalOperators/Sources/MQTTSourceDescriptor.hpp>
 #include <Runtime/NodeEngine.hpp>
 #include <Runtime/NodeEngineBuilder.hpp>
+#include <Sources/MQTTSource.hpp>
 #include <Sources/SourceCreator.hpp>
 #include <Util/Logger/Logger.hpp>
+#include <Util/MQTTBrokerStandIn.hpp>
+#include <chrono>
+#include <future>
 #include <gtest/gtest.h>
 #include <iostream>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include <Common/Identifiers.hpp>
 #include <Components/xCoordinator.hpp>
@@ -63,6 +69,32 @@
 
 namespace x {
 
+class MQTTSourceProxy : public MQTTSource {
+  public:
+    MQTTSourceProxy(SchemaPtr schema,
+                    Runtime::BufferManagerPtr bufferManager,
+                    Runtime::QueryManagerPtr queryManager,
+                    const MQTTSourceTypePtr& mqttSourceType)
+        : MQTTSource(schema,
+                     bufferManager,
+                     queryManager,
+                     mqttSourceType,
+                     OPERATORID,
+                     ORIGINID,
+                     NUMSOURCELOCALBUFFERS,
+                     GatheringMode::INTERVAL_MODE,
+                     PHYSICALSOURCENAME,
+                     {}){};
+
+    /// the source is not part of a query plan, so it does not send an end of stream
+    void close() override { bufferManager->destroy(); }
+
+  private:
+    FRIEND_TEST(MQTTSourceTest, testBatchedConsumptionDrainsAtMostOneBuffer);
+    FRIEND_TEST(MQTTSourceTest, testBatchedConsumptionCarriesMessageToNextBuffer);
+    FRIEND_TEST(MQTTSourceTest, testBatchedConsumptionFlushesAtDeadline);
+};
+
 class MQTTSourceTest : public Testing::BaseIntegrationTest {
   public:
     /* Will be called before any test in this class are executed. */
@@ -94,12 +126,60 @@ class MQTTSourceTest : public Testing::BaseIntegrationTest {
     /* Will be called after all tests in this class are finished. */
     static void TearDownTestCase() { x_DEBUG("MQTTSOURCETEST::TearDownTestCases() Tear down MQTTSourceTest test class."); }
 
+    /**
+     * @brief creates a source that consumes the topic of the broker in batches
+     */
+    std::shared_ptr<MQTTSourceProxy> createBatchedSource(const Testing::MQTTBrokerStandIn& broker,
+                                                         uint32_t tuplesPerBuffer,
+                                                         float flushIntervalMs,
+                                                         bool onDemandJSONParsing) {
+        mqttSourceType->setUrl(broker.getAddress());
+        mqttSourceType->setClientId("x-mqtt-test-client");
+        mqttSourceType->setUserName("x-mqtt-test-user");
+        mqttSourceType->setTopic(TOPIC);
+        mqttSourceType->setCleanSession(true);
+        mqttSourceType->setBatchedConsumption(true);
+        mqttSourceType->setNumberOfTuplesToProducePerBuffer(tuplesPerBuffer);
+        mqttSourceType->setFlushIntervalMS(flushIntervalMs);
+        mqttSourceType->setOnDemandJSONParsing(onDemandJSONParsing);
+        auto source = std::make_shared<MQTTSourceProxy>(test_schema, bufferManager, queryManager, mqttSourceType);
+        source->open();
+        return source;
+    }
+
+    /**
+     * @brief receives the first buffer on another thread, as the source subscribes to the topic only when it connects
+     * in receiveData, and publishes the payloads once the subscription reached the broker
+     */
+    static std::optional<Runtime::TupleBuffer> receiveFirstBuffer(Testing::MQTTBrokerStandIn& broker,
+                                                                  const std::shared_ptr<MQTTSourceProxy>& source,
+                                                                  const std::vector<std::string>& payloads) {
+        auto firstBuffer = std::async(std::launch::async, [&source]() {
+            return source->receiveData();
+        });
+        EXPECT_TRUE(broker.waitForSubscription(TOPIC, WAIT_TIMEOUT));
+        for (const auto& payload : payloads) {
+            broker.publish(TOPIC, payload);
+        }
+        return firstBuffer.get();
+    }
+
+    /**
+     * @brief the values of the var field of all tuples in the buffer
+     */
+    static std::vector<uint32_t> readValues(Runtime::TupleBuffer& buffer) {
+        const auto* values = buffer.getBuffer<uint32_t>();
+        return {values, values + buffer.getNumberOfTuples()};
+    }
+
     Runtime::NodeEnginePtr nodeEngine{nullptr};
     Runtime::BufferManagerPtr bufferManager;
     Runtime::QueryManagerPtr queryManager;
     SchemaPtr test_schema;
     uint64_t buffer_size{};
     MQTTSourceTypePtr mqttSourceType;
+    inline static const std::string TOPIC = "x/mqtt/source/test";
+    static constexpr std::chrono::seconds WAIT_TIMEOUT = std::chrono::seconds(10);
 };
 
 /**
@@ -154,6 +234,119 @@ TEST_F(MQTTSourceTest, MQTTSourcePrint) {
     SUCCEED();
 }
 
+/**
+ * Tests that batched consumption is configured from a config map and can be reset
+ */
+TEST_F(MQTTSourceTest, MQTTSourceBatchedConsumptionConfig) {
+    std::map<std::string, std::string> sourceConfigMap{{Configurations::URL_CONFIG, "tcp://127.0.0.1:1883"},
+                                                       {Configurations::CLIENT_ID_CONFIG, "x-mqtt-test-client"},
+                                                       {Configurations::USER_NAME_CONFIG, "x-mqtt-test-user"},
+                                                       {Configurations::TOPIC_CONFIG, "v1/devices/me/telemetry"}};
+    auto singleMessageSourceType = MQTTSourceType::create(sourceConfigMap);
+    sourceConfigMap.emplace(Configurations::BATCHED_CONSUMPTION_CONFIG, "true");
+    auto batchedSourceType = MQTTSourceType::create(sourceConfigMap);
+    EXPECT_TRUE(batchedSourceType->getBatchedConsumption()->getValue());
+    EXPECT_FALSE(singleMessageSourceType->getBatchedConsumption()->getValue());
+    EXPECT_FALSE(batchedSourceType->equal(singleMessageSourceType));
+
+    auto mqttSource = createMQTTSource(test_schema,
+                                       bufferManager,
+                                       queryManager,
+                                       batchedSourceType,
+                                       OPERATORID,
+                                       ORIGINID,
+                                       NUMSOURCELOCALBUFFERS,
+                                       PHYSICALSOURCENAME,
+                                       SUCCESSORS);
+    EXPECT_TRUE(std::dynamic_pointer_cast<MQTTSource>(mqttSource)->getSourceConfigPtr()->getBatchedConsumption()->getValue());
+
+    batchedSourceType->setBatchedConsumption(false);
+    EXPECT_TRUE(batchedSourceType->equal(singleMessageSourceType));
+}
+
+/**
+ * Tests that a batch drains at most as many queued messages as tuples fit into the buffer, the remaining messages stay in
+ * the queue of the client and are consumed by the next buffers in their order
+ */
+TEST_F(MQTTSourceTest, testBatchedConsumptionDrainsAtMostOneBuffer) {
+    Testing::MQTTBrokerStandIn broker;
+    auto source = createBatchedSource(broker, 2, 500, false);
+
+    auto firstBuffer = receiveFirstBuffer(broker,
+                                          source,
+                                          {R"({"var":1})", R"({"var":2})", R"({"var":3})", R"({"var":4})", R"({"var":5})"});
+    ASSERT_TRUE(firstBuffer.has_value());
+    EXPECT_EQ(readValues(*firstBuffer), (std::vector<uint32_t>{1, 2}));
+    EXPECT_LE(source->messageBatch.size(), 2UL);
+    EXPECT_EQ(source->nextMessageInBatch, source->messageBatch.size());
+
+    auto secondBuffer = source->receiveData();
+    ASSERT_TRUE(secondBuffer.has_value());
+    EXPECT_EQ(readValues(*secondBuffer), (std::vector<uint32_t>{3, 4}));
+    EXPECT_LE(source->messageBatch.size(), 2UL);
+
+    // the last message does not fill the buffer, thus it is flushed at the deadline
+    auto thirdBuffer = source->receiveData();
+    ASSERT_TRUE(thirdBuffer.has_value());
+    EXPECT_EQ(readValues(*thirdBuffer), (std::vector<uint32_t>{5}));
+    source->close();
+}
+
+/**
+ * Tests that a message with newline-delimited records that does not fit into the buffer stays in the batch, and that the
+ * next buffer continues with its remaining records before it consumes further messages
+ */
+TEST_F(MQTTSourceTest, testBatchedConsumptionCarriesMessageToNextBuffer) {
+    Testing::MQTTBrokerStandIn broker;
+    auto source = createBatchedSource(broker, 3, 500, true);
+
+    auto firstBuffer = receiveFirstBuffer(broker,
+                                          source,
+                                          {"{\"var\":0}\n{\"var\":1}\n{\"var\":2}\n{\"var\":3}\n{\"var\":4}", R"({"var":5})"});
+    ASSERT_TRUE(firstBuffer.has_value());
+    EXPECT_EQ(readValues(*firstBuffer), (std::vector<uint32_t>{0, 1, 2}));
+    ASSERT_LT(source->nextMessageInBatch, source->messageBatch.size());
+    EXPECT_NE(source->messageBatch[source->nextMessageInBatch], nullptr);
+
+    auto secondBuffer = source->receiveData();
+    ASSERT_TRUE(secondBuffer.has_value());
+    EXPECT_EQ(readValues(*secondBuffer), (std::vector<uint32_t>{3, 4, 5}));
+    EXPECT_EQ(source->nextMessageInBatch, source->messageBatch.size());
+    source->close();
+}
+
+/**
+ * Tests that a partially filled buffer is flushed once the flush interval passed, but an empty buffer is not flushed
+ */
+TEST_F(MQTTSourceTest, testBatchedConsumptionFlushesAtDeadline) {
+    Testing::MQTTBrokerStandIn broker;
+    const auto flushInterval = std::chrono::milliseconds(200);
+    auto source = createBatchedSource(broker, 10, flushInterval.count(), false);
+
+    auto start = std::chrono::steady_clock::now();
+    auto firstBuffer = receiveFirstBuffer(broker, source, {R"({"var":1})", R"({"var":2})", R"({"var":3})"});
+    auto published = std::chrono::steady_clock::now();
+    ASSERT_TRUE(firstBuffer.has_value());
+    EXPECT_EQ(readValues(*firstBuffer), (std::vector<uint32_t>{1, 2, 3}));
+    EXPECT_GE(std::chrono::steady_clock::now() - start, flushInterval);
+    EXPECT_LT(std::chrono::steady_clock::now() - published, WAIT_TIMEOUT / 5);
+
+    // no message arrives within the flush interval, thus the source keeps waiting instead of flushing an empty buffer
+    const auto publishDelay = 2 * flushInterval;
+    start = std::chrono::steady_clock::now();
+    auto secondBuffer = std::async(std::launch::async, [&source]() {
+        return source->receiveData();
+    });
+    std::this_thread::sleep_for(publishDelay);
+    EXPECT_EQ(secondBuffer.wait_for(std::chrono::milliseconds(0)), std::future_status::timeout);
+    broker.publish(TOPIC, R"({"var":4})");
+    auto buffer = secondBuffer.get();
+    ASSERT_TRUE(buffer.has_value());
+    EXPECT_EQ(readValues(*buffer), (std::vector<uint32_t>{4}));
+    EXPECT_GE(std::chrono::steady_clock::now() - start, publishDelay);
+    source->close();
+}
+
 /**
  * Tests if obtained value is valid.
  */
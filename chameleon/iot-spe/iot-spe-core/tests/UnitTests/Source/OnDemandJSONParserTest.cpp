@@ -0,0 +1,192 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <BaseIntegrationTest.hpp>
+#include <gtest/gtest.h>
+
+#include <API/Schema.hpp>
+#include <Common/PhysicalTypes/DefaultPhysicalTypeFactory.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <Runtime/MemoryLayout/ColumnLayout.hpp>
+#include <Runtime/MemoryLayout/DynamicTupleBuffer.hpp>
+#include <Runtime/MemoryLayout/RowLayout.hpp>
+#include <Sources/Parsers/JSONParser.hpp>
+#include <Sources/Parsers/OnDemandJSONParser.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <string>
+#include <vector>
+
+namespace x {
+
+/**
+ * Tests the single-pass OnDemandJSONParser against the document-based JSONParser.
+ */
+class OnDemandJSONParserTest : public Testing::BaseUnitTest {
+  public:
+    static void SetUpTestCase() {
+        x::Logger::setupLogging("OnDemandJSONParserTest.log", x::LogLevel::LOG_DEBUG);
+        x_INFO("Setup OnDemandJSONParserTest test class.");
+    }
+
+    void SetUp() override {
+        Testing::BaseUnitTest::SetUp();
+        schema = Schema::create()
+                     ->addField("id", BasicType::UINT64)
+                     ->addField("delta", BasicType::INT16)
+                     ->addField("value", BasicType::FLOAT64)
+                     ->addField("valid", BasicType::BOOLEAN);
+        for (const auto& field : schema->fields) {
+            physicalTypes.emplace_back(DefaultPhysicalTypeFactory().getPhysicalType(field->getDataType()));
+            schemaKeys.emplace_back(field->getName());
+        }
+        bufferManager = std::make_shared<Runtime::BufferManager>(4096, 4);
+    }
+
+    /// checks that both buffers hold the same tuples
+    static void expectSameTuples(Runtime::MemoryLayouts::DynamicTupleBuffer& expected,
+                                 Runtime::MemoryLayouts::DynamicTupleBuffer& actual,
+                                 uint64_t numberOfTuples) {
+        for (uint64_t tupleIndex = 0; tupleIndex < numberOfTuples; ++tupleIndex) {
+            EXPECT_EQ(expected[tupleIndex][0].read<uint64_t>(), actual[tupleIndex][0].read<uint64_t>()) << tupleIndex;
+            EXPECT_EQ(expected[tupleIndex][1].read<int16_t>(), actual[tupleIndex][1].read<int16_t>()) << tupleIndex;
+            EXPECT_DOUBLE_EQ(expected[tupleIndex][2].read<double>(), actual[tupleIndex][2].read<double>()) << tupleIndex;
+            EXPECT_EQ(expected[tupleIndex][3].read<bool>(), actual[tupleIndex][3].read<bool>()) << tupleIndex;
+        }
+    }
+
+    SchemaPtr schema;
+    std::vector<PhysicalTypePtr> physicalTypes;
+    std::vector<std::string> schemaKeys;
+    Runtime::BufferManagerPtr bufferManager;
+};
+
+/**
+ * @brief Tests that both parsers write the same tuples for reordered keys, unknown keys, nested values, and escapes
+ */
+TEST_F(OnDemandJSONParserTest, writesSameTuplesAsJSONParser) {
+    std::vector<std::string> objects{
+        R"({"id":1,"delta":-5,"value":0.25,"valid":true})",
+        R"( { "valid" : false , "value" : -1e3 , "delta" : 7 , "id" : 2 } )",
+        R"({"id":"3","note":"a \"}\" b\\","delta":"-12","nested":{"a":[1,{"b":"]"}]},"value":"1.5","valid":"true"})",
+        R"({"list":[],"id":18446744073709551615,"delta":-32768,"value":16,"valid":0,"id2":{}})"};
+
+    std::vector<Runtime::MemoryLayouts::MemoryLayoutPtr> memoryLayouts{
+        Runtime::MemoryLayouts::RowLayout::create(schema, bufferManager->getBufferSize()),
+        Runtime::MemoryLayouts::ColumnLayout::create(schema, bufferManager->getBufferSize())};
+    for (const auto& memoryLayout : memoryLayouts) {
+        JSONParser jsonParser(schema->getSize(), schemaKeys, physicalTypes);
+        OnDemandJSONParser onDemandParser(schema->getSize(), schemaKeys, physicalTypes);
+        auto expected = Runtime::MemoryLayouts::DynamicTupleBuffer(memoryLayout, bufferManager->getBufferBlocking());
+        auto actual = Runtime::MemoryLayouts::DynamicTupleBuffer(memoryLayout, bufferManager->getBufferBlocking());
+        for (uint64_t tupleCount = 0; tupleCount < objects.size(); ++tupleCount) {
+            ASSERT_TRUE(jsonParser.writeInputTupleToTupleBuffer(objects[tupleCount], tupleCount, expected, schema, bufferManager));
+            ASSERT_TRUE(
+                onDemandParser.writeInputTupleToTupleBuffer(objects[tupleCount], tupleCount, actual, schema, bufferManager));
+        }
+        expectSameTuples(expected, actual, objects.size());
+        EXPECT_EQ(actual[3][0].read<uint64_t>(), std::numeric_limits<uint64_t>::max());
+        EXPECT_EQ(actual[3][1].read<int16_t>(), std::numeric_limits<int16_t>::min());
+    }
+}
+
+/**
+ * @brief Tests that a payload with newline-delimited records is parsed record by record
+ */
+TEST_F(OnDemandJSONParserTest, writeNextRecordParsesNewlineDelimitedRecords) {
+    auto memoryLayout = Runtime::MemoryLayouts::RowLayout::create(schema, bufferManager->getBufferSize());
+    auto buffer = Runtime::MemoryLayouts::DynamicTupleBuffer(memoryLayout, bufferManager->getBufferBlocking());
+    OnDemandJSONParser parser(schema->getSize(), schemaKeys, physicalTypes);
+    std::string payload = "{\"id\":1,\"delta\":1,\"value\":1.0,\"valid\":true}\n"
+                          "{\"id\":2,\"delta\":2,\"value\":2.0,\"valid\":false}\r\n"
+                          "\n"
+                          "{\"id\":3,\"delta\":3,\"value\":3.0,\"valid\":true}\n";
+
+    uint64_t position = 0;
+    uint64_t tupleCount = 0;
+    while (parser.writeNextRecordToTupleBuffer(payload, position, tupleCount, buffer, schema, bufferManager)) {
+        ++tupleCount;
+    }
+    ASSERT_EQ(tupleCount, 3u);
+    EXPECT_EQ(position, payload.size());
+    for (uint64_t tupleIndex = 0; tupleIndex < tupleCount; ++tupleIndex) {
+        EXPECT_EQ(buffer[tupleIndex][0].read<uint64_t>(), tupleIndex + 1);
+        EXPECT_EQ(buffer[tupleIndex][1].read<int16_t>(), static_cast<int16_t>(tupleIndex + 1));
+        EXPECT_DOUBLE_EQ(buffer[tupleIndex][2].read<double>(), static_cast<double>(tupleIndex + 1));
+    }
+
+    // a position behind the last record is kept, e.g., for a payload that was consumed completely before
+    EXPECT_FALSE(parser.writeNextRecordToTupleBuffer(payload, position, 0, buffer, schema, bufferManager));
+    position = 0;
+    EXPECT_FALSE(parser.writeNextRecordToTupleBuffer(" \n", position, 0, buffer, schema, bufferManager));
+}
+
+/**
+ * @brief Tests that missing and null keys are rejected like by the JSONParser, and that records with them are errors
+ */
+TEST_F(OnDemandJSONParserTest, rejectsMissingKeys) {
+    auto memoryLayout = Runtime::MemoryLayouts::RowLayout::create(schema, bufferManager->getBufferSize());
+    auto buffer = Runtime::MemoryLayouts::DynamicTupleBuffer(memoryLayout, bufferManager->getBufferBlocking());
+    OnDemandJSONParser parser(schema->getSize(), schemaKeys, physicalTypes);
+
+    EXPECT_FALSE(parser.writeInputTupleToTupleBuffer(R"({"id":1,"delta":1,"value":1.0})", 0, buffer, schema, bufferManager));
+    EXPECT_FALSE(parser.writeInputTupleToTupleBuffer(R"({"id":1,"delta":1,"value":1.0,"valid":null})",
+                                                     0,
+                                                     buffer,
+                                                     schema,
+                                                     bufferManager));
+    EXPECT_FALSE(parser.writeInputTupleToTupleBuffer("{}", 0, buffer, schema, bufferManager));
+    // a repeated key does not replace a missing one
+    EXPECT_FALSE(parser.writeInputTupleToTupleBuffer(R"({"id":1,"delta":1,"value":1.0,"id":2})",
+                                                     0,
+                                                     buffer,
+                                                     schema,
+                                                     bufferManager));
+    EXPECT_TRUE(parser.writeInputTupleToTupleBuffer(R"({"id":1,"delta":1,"value":1.0,"valid":true})",
+                                                    0,
+                                                    buffer,
+                                                    schema,
+                                                    bufferManager));
+
+    uint64_t position = 0;
+    EXPECT_ANY_THROW(parser.writeNextRecordToTupleBuffer(R"({"id":1,"delta":1,"valid":true})",
+                                                         position,
+                                                         0,
+                                                         buffer,
+                                                         schema,
+                                                         bufferManager));
+}
+
+/**
+ * @brief Tests that malformed objects are errors
+ */
+TEST_F(OnDemandJSONParserTest, rejectsMalformedObjects) {
+    auto memoryLayout = Runtime::MemoryLayouts::RowLayout::create(schema, bufferManager->getBufferSize());
+    auto buffer = Runtime::MemoryLayouts::DynamicTupleBuffer(memoryLayout, bufferManager->getBufferBlocking());
+    OnDemandJSONParser parser(schema->getSize(), schemaKeys, physicalTypes);
+
+    std::vector<std::string> malformedObjects{"",
+                                              "[1,2]",
+                                              R"({"id":1)",
+                                              R"({"id" 1})",
+                                              R"({"id":})",
+                                              R"({"id":1 "delta":2})",
+                                              R"({"note":"unterminated})",
+                                              R"({"nested":{"a":1})",
+                                              R"({"id":1,"delta":1,"value":1.0,"valid":true} trailing)"};
+    for (const auto& object : malformedObjects) {
+        EXPECT_ANY_THROW(parser.writeInputTupleToTupleBuffer(object, 0, buffer, schema, bufferManager)) << object;
+    }
+}
+
+}// namespace x
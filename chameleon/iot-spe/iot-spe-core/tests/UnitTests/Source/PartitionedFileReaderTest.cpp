@@ -0,0 +1,158 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+#include <BaseIntegrationTest.hpp>
+#include <gtest/gtest.h>
+
+#include <Runtime/BufferManager.hpp>
+#include <Sources/PartitionedFileReader.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace x {
+
+/**
+ * Tests that the PartitionedFileReader hands out the buffers of concurrently parsed partitions in file order.
+ */
+class PartitionedFileReaderTest : public Testing::BaseUnitTest {
+  public:
+    static void SetUpTestCase() {
+        x::Logger::setupLogging("PartitionedFileReaderTest.log", x::LogLevel::LOG_DEBUG);
+        x_INFO("Setup PartitionedFileReaderTest test class.");
+    }
+
+    void SetUp() override {
+        Testing::BaseUnitTest::SetUp();
+        bufferManager = std::make_shared<Runtime::BufferManager>(4096, NUMBER_OF_BUFFERS);
+    }
+
+    /// writes the partition index and the index of the buffer in its partition into the buffer
+    static void writeBuffer(Runtime::TupleBuffer& buffer, uint64_t partitionIndex, uint64_t bufferIndex) {
+        buffer.getBuffer<uint64_t>()[0] = partitionIndex;
+        buffer.getBuffer<uint64_t>()[1] = bufferIndex;
+        buffer.setNumberOfTuples(1);
+    }
+
+    static constexpr uint64_t NUMBER_OF_BUFFERS = 1024;
+    Runtime::BufferManagerPtr bufferManager;
+};
+
+/**
+ * @brief partitions that finish out of order are still handed out in file order
+ */
+TEST_F(PartitionedFileReaderTest, testBuffersAreHandedOutInFileOrder) {
+    constexpr uint64_t numberOfPartitions = 64;
+    constexpr uint64_t maxPartitionsInFlight = 6;
+    std::atomic<uint64_t> lastHandedOutPartition{0};
+    std::atomic<bool> windowExceeded{false};
+    PartitionedFileReader reader(
+        numberOfPartitions,
+        4,
+        [&](uint64_t partitionIndex, std::vector<Runtime::TupleBuffer>& buffers) {
+            // the partition handed out last may lag one partition behind the reader
+            if (partitionIndex > lastHandedOutPartition + maxPartitionsInFlight) {
+                windowExceeded = true;
+            }
+            std::mt19937 random(partitionIndex);
+            std::this_thread::sleep_for(std::chrono::microseconds(random() % 2000));
+            for (uint64_t i = 0; i < partitionIndex % 3 + 1; ++i) {
+                auto buffer = bufferManager->getBufferBlocking();
+                writeBuffer(buffer, partitionIndex, i);
+                buffers.emplace_back(buffer);
+            }
+        },
+        maxPartitionsInFlight);
+    reader.start();
+
+    uint64_t expectedPartition = 0;
+    uint64_t expectedBuffer = 0;
+    uint64_t numberOfBuffers = 0;
+    while (auto buffer = reader.next()) {
+        if (expectedBuffer == expectedPartition % 3 + 1) {
+            ++expectedPartition;
+            expectedBuffer = 0;
+        }
+        EXPECT_EQ(buffer->getBuffer<uint64_t>()[0], expectedPartition);
+        EXPECT_EQ(buffer->getBuffer<uint64_t>()[1], expectedBuffer);
+        lastHandedOutPartition = buffer->getBuffer<uint64_t>()[0];
+        ++expectedBuffer;
+        ++numberOfBuffers;
+    }
+    EXPECT_EQ(expectedPartition, numberOfPartitions - 1);
+    uint64_t expectedNumberOfBuffers = 0;
+    for (uint64_t partitionIndex = 0; partitionIndex < numberOfPartitions; ++partitionIndex) {
+        expectedNumberOfBuffers += partitionIndex % 3 + 1;
+    }
+    EXPECT_EQ(numberOfBuffers, expectedNumberOfBuffers);
+    EXPECT_FALSE(windowExceeded);
+    EXPECT_FALSE(reader.next().has_value());
+}
+
+/**
+ * @brief a partition that fails is reported when it would be handed out, after all buffers before it
+ */
+TEST_F(PartitionedFileReaderTest, testFailedPartitionIsRethrownInOrder) {
+    PartitionedFileReader reader(8, 3, [&](uint64_t partitionIndex, std::vector<Runtime::TupleBuffer>& buffers) {
+        if (partitionIndex == 5) {
+            throw std::runtime_error("invalid partition");
+        }
+        auto buffer = bufferManager->getBufferBlocking();
+        writeBuffer(buffer, partitionIndex, 0);
+        buffers.emplace_back(buffer);
+    });
+    reader.start();
+
+    for (uint64_t partitionIndex = 0; partitionIndex < 5; ++partitionIndex) {
+        auto buffer = reader.next();
+        ASSERT_TRUE(buffer.has_value());
+        EXPECT_EQ(buffer->getBuffer<uint64_t>()[0], partitionIndex);
+    }
+    EXPECT_THROW(reader.next(), std::runtime_error);
+}
+
+/**
+ * @brief stopping the reader releases the buffers of partitions that were parsed ahead
+ */
+TEST_F(PartitionedFileReaderTest, testStopReleasesBuffers) {
+    PartitionedFileReader reader(1000, 4, [&](uint64_t partitionIndex, std::vector<Runtime::TupleBuffer>& buffers) {
+        for (uint64_t i = 0; i < 4; ++i) {
+            auto buffer = bufferManager->getBufferBlocking();
+            writeBuffer(buffer, partitionIndex, i);
+            buffers.emplace_back(buffer);
+        }
+    });
+    reader.start();
+    for (uint64_t i = 0; i < 10; ++i) {
+        ASSERT_TRUE(reader.next().has_value());
+    }
+    reader.stop();
+    EXPECT_FALSE(reader.next().has_value());
+    EXPECT_EQ(bufferManager->getAvailableBuffers(), NUMBER_OF_BUFFERS);
+}
+
+/**
+ * @brief a file without partitions ends immediately
+ */
+TEST_F(PartitionedFileReaderTest, testEmptyFile) {
+    PartitionedFileReader reader(0, 2, [](uint64_t, std::vector<Runtime::TupleBuffer>&) {
+        FAIL();
+    });
+    reader.start();
+    EXPECT_FALSE(reader.next().has_value());
+}
+
+}// namespace x
@@ -0,0 +1,151 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <BaseIntegrationTest.hpp>
+#include <gtest/gtest.h>
+
+#include <Sensors/SimulatedBus.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+namespace x::Sensors {
+
+/**
+ * Tests for the simulated sensor bus, which replays a recording of fixed-size samples.
+ * Each sample of the recording holds its index and the index times two.
+ */
+class SimulatedBusTest : public Testing::BaseUnitTest {
+  public:
+    struct Sample {
+        uint64_t index;
+        uint64_t value;
+    };
+
+    static constexpr uint64_t numberOfSamples = 100;
+    std::string recordingPath;
+
+    static void SetUpTestCase() {
+        x::Logger::setupLogging("SimulatedBusTest.log", x::LogLevel::LOG_DEBUG);
+        x_INFO("Setup SimulatedBusTest test class.");
+    }
+
+    void SetUp() override {
+        Testing::BaseUnitTest::SetUp();
+        recordingPath = (std::filesystem::temp_directory_path() / "SimulatedBusTest.bin").string();
+        std::ofstream recording(recordingPath, std::ios::binary | std::ios::trunc);
+        for (uint64_t i = 0; i < numberOfSamples; ++i) {
+            Sample sample{i, 2 * i};
+            recording.write(reinterpret_cast<const char*>(&sample), sizeof(Sample));
+        }
+    }
+
+    void TearDown() override {
+        std::filesystem::remove(recordingPath);
+        Testing::BaseUnitTest::TearDown();
+    }
+};
+
+/**
+ * @brief polling on the sample interval reads every sample once and fails after the recording ended
+ */
+TEST_F(SimulatedBusTest, pollingOnSampleIntervalReadsEverySample) {
+    SimulatedBus bus(recordingPath.c_str(), sizeof(Sample), std::chrono::milliseconds(10));
+    ASSERT_TRUE(bus.init(0));
+    ASSERT_EQ(bus.getNumberOfSamples(), numberOfSamples);
+    bus.setPollingInterval(std::chrono::milliseconds(10));
+
+    Sample sample{};
+    for (uint64_t i = 0; i < numberOfSamples; ++i) {
+        ASSERT_TRUE(bus.poll(0, sizeof(Sample), reinterpret_cast<unsigned char*>(&sample)));
+        EXPECT_EQ(sample.index, i);
+        EXPECT_EQ(sample.value, 2 * i);
+    }
+    EXPECT_FALSE(bus.poll(0, sizeof(Sample), reinterpret_cast<unsigned char*>(&sample)));
+    EXPECT_EQ(bus.getNumberOfReads(), numberOfSamples + 1);
+}
+
+/**
+ * @brief a slower polling interval skips samples, so the recording takes fewer reads
+ */
+TEST_F(SimulatedBusTest, slowerPollingSavesReads) {
+    SimulatedBus bus(recordingPath.c_str(), sizeof(Sample), std::chrono::milliseconds(10));
+    ASSERT_TRUE(bus.init(0));
+    bus.setPollingInterval(std::chrono::milliseconds(40));
+
+    uint64_t value;
+    uint64_t expectedIndex = 0;
+    while (bus.poll(sizeof(uint64_t), sizeof(uint64_t), reinterpret_cast<unsigned char*>(&value))) {
+        EXPECT_EQ(value, 2 * expectedIndex);
+        EXPECT_EQ(bus.getSimulatedTime(), std::chrono::milliseconds(10 * expectedIndex));
+        expectedIndex += 4;
+    }
+    EXPECT_EQ(bus.getNumberOfReads(), numberOfSamples / 4 + 1);
+
+    // the new interval applies from the next poll on
+    ASSERT_TRUE(bus.init(0));
+    bus.poll(0, sizeof(uint64_t), reinterpret_cast<unsigned char*>(&value));
+    bus.setPollingInterval(std::chrono::milliseconds(20));
+    bus.poll(0, sizeof(uint64_t), reinterpret_cast<unsigned char*>(&value));
+    EXPECT_EQ(value, 2u);
+}
+
+/**
+ * @brief a polling interval that is not a multiple of the sample interval keeps the remainder, so the simulated time
+ * follows the polling schedule and the bus reads the sample that the sensor produced last
+ */
+TEST_F(SimulatedBusTest, pollingOnNonMultipleIntervalKeepsSimulatedTime) {
+    SimulatedBus bus(recordingPath.c_str(), sizeof(Sample), std::chrono::milliseconds(10));
+    ASSERT_TRUE(bus.init(0));
+    bus.setPollingInterval(std::chrono::milliseconds(15));
+
+    Sample sample{};
+    uint64_t numberOfPolls = 0;
+    while (bus.poll(0, sizeof(Sample), reinterpret_cast<unsigned char*>(&sample))) {
+        EXPECT_EQ(bus.getSimulatedTime(), std::chrono::milliseconds(15 * numberOfPolls));
+        EXPECT_EQ(sample.index, 15 * numberOfPolls / 10);
+        ++numberOfPolls;
+    }
+    // the polls at 0, 15, ..., 990 ms read a sample, the poll at 1005 ms is behind the end of the recording
+    EXPECT_EQ(numberOfPolls, 67UL);
+    EXPECT_EQ(bus.getNumberOfReads(), 68UL);
+    EXPECT_EQ(bus.getSimulatedTime(), std::chrono::milliseconds(1005));
+
+    // polling faster than the sensor samples reads the same sample again
+    ASSERT_TRUE(bus.init(0));
+    bus.setPollingInterval(std::chrono::milliseconds(4));
+    std::vector<uint64_t> indexes;
+    for (uint64_t i = 0; i < 6; ++i) {
+        ASSERT_TRUE(bus.poll(0, sizeof(Sample), reinterpret_cast<unsigned char*>(&sample)));
+        indexes.emplace_back(sample.index);
+    }
+    EXPECT_EQ(indexes, (std::vector<uint64_t>{0, 0, 0, 1, 1, 2}));
+}
+
+/**
+ * @brief a read after a write returns the written bytes, reads outside of a sample fail
+ */
+TEST_F(SimulatedBusTest, dataMustBeSameReadAfterWrite) {
+    SimulatedBus bus(recordingPath.c_str(), sizeof(Sample), std::chrono::milliseconds(1));
+    ASSERT_TRUE(bus.init(0));
+    uint64_t written = 42;
+    uint64_t read = 0;
+    ASSERT_TRUE(bus.write(sizeof(uint64_t), sizeof(uint64_t), reinterpret_cast<unsigned char*>(&written)));
+    ASSERT_TRUE(bus.read(sizeof(uint64_t), sizeof(uint64_t), reinterpret_cast<unsigned char*>(&read)));
+    EXPECT_EQ(read, written);
+    EXPECT_FALSE(bus.read(sizeof(uint64_t), sizeof(Sample), reinterpret_cast<unsigned char*>(&read)));
+}
+
+}// namespace x::Sensors
@@ -50,11 +50,16 @@
 #include <Util/Logger/Logger.hpp>
 #include <Util/MetricValidator.hpp>
 #include <cstring>
+#include <fstream>
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include <iostream>
 #include <limits>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
 
 namespace x {
 
@@ -390,6 +395,7 @@ class CSVSourceProxy : public CSVSource {
     FRIEND_TEST(SourceTest, testCSVSourceFillBufferFullFile);
     FRIEND_TEST(SourceTest, testCSVSourceFillBufferFullFileColumnLayout);
     FRIEND_TEST(SourceTest, testCSVSourceFillBufferFullFileOnLoop);
+    FRIEND_TEST(SourceTest, testCSVSourcePartitionedReaderMatchesSequentialReader);
 };
 
 class AdaptiveCSVSourceProxy : public CSVSource {
@@ -524,6 +530,61 @@ class LambdaSourceProxy : public LambdaSource {
     FRIEND_TEST(SourceTest, testLambdaSourceInitAndTypeIngestion);
 };
 
+/**
+ * @brief lambda source that records the emitted buffers instead of passing them to a query, so that the running routines
+ * of the ingestion rate and replay modes can run without a query plan
+ */
+class RecordingLambdaSourceProxy : public LambdaSource {
+  public:
+    RecordingLambdaSourceProxy(
+        SchemaPtr schema,
+        Runtime::BufferManagerPtr bufferManager,
+        Runtime::QueryManagerPtr queryManager,
+        uint64_t numbersOfBufferToProduce,
+        uint64_t gatheringValue,
+        std::function<void(x::Runtime::TupleBuffer& buffer, uint64_t numberOfTuplesToProduce)>&& generationFunction,
+        OperatorId operatorId,
+        size_t numSourceLocalBuffers,
+        GatheringMode gatheringMode)
+        : LambdaSource(schema,
+                       bufferManager,
+                       queryManager,
+                       numbersOfBufferToProduce,
+                       gatheringValue,
+                       std::move(generationFunction),
+                       operatorId,
+                       0,
+                       numSourceLocalBuffers,
+                       gatheringMode,
+                       0,
+                       0,
+                       "defaultPhysicalStreamName",
+                       {}){};
+
+    void emitWork(Runtime::TupleBuffer& buffer) override {
+        std::unique_lock lock(mutex);
+        emittedSequenceNumbers.emplace_back(buffer.getSequenceNumber());
+        emittedUserIds.emplace_back(buffer.getBuffer<IngestionRecord>()[0].userId);
+        emittedTuples.emplace_back(buffer.getNumberOfTuples());
+    }
+
+    void close() override { bufferManager->destroy(); }
+
+    uint64_t getNumberOfEmittedBuffers() const {
+        std::unique_lock lock(mutex);
+        return emittedSequenceNumbers.size();
+    }
+
+    mutable std::mutex mutex;
+    std::vector<uint64_t> emittedSequenceNumbers;
+    std::vector<uint64_t> emittedUserIds;
+    std::vector<uint64_t> emittedTuples;
+
+  private:
+    FRIEND_TEST(SourceTest, testLambdaSourceIngestionRateRoutine);
+    FRIEND_TEST(SourceTest, testLambdaSourceReplayRoutine);
+};
+
 class MonitoringSourceProxy : public MonitoringSource {
   public:
     MonitoringSourceProxy(const Monitoring::MetricCollectorPtr& metricCollector,
@@ -1272,7 +1333,7 @@ TEST_F(SourceTest, testBinarySourceWrongPath) {
                                           this->operatorId,
                                           this->numSourceLocalBuffersDefault,
                                           {std::make_shared<NullOutputSink>(this->nodeEngine, 1, 1, 1)});
-            ASSERT_FALSE(bDataSource.input.is_open());
+            ASSERT_EQ(bDataSource.mappedFile, nullptr);
         } catch (std::exception const& exception) {
             auto msg = std::string(exception.what());
             ASSERT_NE(msg.find(std::string("Binary input file is not valid")), std::string::npos);
@@ -1289,7 +1350,7 @@ TEST_F(SourceTest, testBinarySourceCorrectPath) {
                                   this->operatorId,
                                   this->numSourceLocalBuffersDefault,
                                   {std::make_shared<NullOutputSink>(this->nodeEngine, 1, 1, 1)});
-    ASSERT_TRUE(bDataSource.input.is_open());
+    ASSERT_NE(bDataSource.mappedFile, nullptr);
 }
 
 TEST_F(SourceTest, testBinarySourceFillBuffer) {
@@ -1386,7 +1447,7 @@ TEST_F(SourceTest, testCSVSourceWrongFilePath) {
                                      this->operatorId,
                                      this->numSourceLocalBuffersDefault,
                                      {std::make_shared<NullOutputSink>(this->nodeEngine, 1, 1, 1)});
-        ASSERT_FALSE(csvDataSource.input.is_open());
+        ASSERT_EQ(csvDataSource.mappedFile, nullptr);
     } catch (std::exception const& err) {
         std::string msg = err.what();
         EXPECT_TRUE(msg.find(std::string("Could not determine absolute pathname")) != std::string::npos);
@@ -1407,7 +1468,7 @@ TEST_F(SourceTest, testCSVSourceCorrectFilePath) {
                                  this->operatorId,
                                  this->numSourceLocalBuffersDefault,
                                  {std::make_shared<NullOutputSink>(this->nodeEngine, 1, 1, 1)});
-    ASSERT_TRUE(csvDataSource.input.is_open());
+    ASSERT_NE(csvDataSource.mappedFile, nullptr);
 }
 
 TEST_F(SourceTest, testCSVSourceFillBufferFileEnded) {
@@ -1843,6 +1904,81 @@ TEST_F(SourceTest, testCSVSourceCommaFloatingPoint) {
     ASSERT_NEAR(content->longer_precision_decimal, 13.1608002, 0.01);
 }
 
+/**
+ * @brief the partitioned reader produces the tuples of the sequential reader in file order, for files with a header,
+ * without a line feed after the last line, and with partition boundaries that fall into the middle of a line
+ */
+TEST_F(SourceTest, testCSVSourcePartitionedReaderMatchesSequentialReader) {
+    // with full buffers of this schema, the CSV source splits the file into partitions of its minimum size of 64 KiB
+    constexpr uint64_t minPartitionSize = 64 * 1024;
+    constexpr uint64_t numberOfLines = 20000;
+    auto csvSchema = Schema::create()
+                         ->addField("id", BasicType::UINT64)
+                         ->addField("value", BasicType::FLOAT64)
+                         ->addField("delta", BasicType::INT32);
+    using Tuple = std::tuple<uint64_t, double, int32_t>;
+
+    auto readAllTuples = [&](const std::string& filePath, bool skipHeader, uint32_t numberOfReaderThreads) {
+        CSVSourceTypePtr sourceConfig = CSVSourceType::create();
+        sourceConfig->setFilePath(filePath);
+        sourceConfig->setSkipHeader(skipHeader);
+        sourceConfig->setNumberOfBuffersToProduce(0);
+        sourceConfig->setNumberOfTuplesToProducePerBuffer(0);
+        sourceConfig->setNumberOfReaderThreads(numberOfReaderThreads);
+        CSVSourceProxy csvDataSource(csvSchema,
+                                     this->nodeEngine->getBufferManager(),
+                                     this->nodeEngine->getQueryManager(),
+                                     sourceConfig,
+                                     this->operatorId,
+                                     this->numSourceLocalBuffersDefault,
+                                     {std::make_shared<NullOutputSink>(this->nodeEngine, 1, 1, 1)});
+        csvDataSource.open();
+        std::vector<Tuple> tuples;
+        while (auto buffer = csvDataSource.receiveData()) {
+            auto dynamicBuffer = Runtime::MemoryLayouts::DynamicTupleBuffer(csvDataSource.memoryLayout, buffer.value());
+            for (uint64_t i = 0; i < dynamicBuffer.getNumberOfTuples(); ++i) {
+                tuples.emplace_back(dynamicBuffer[i][0].read<uint64_t>(),
+                                    dynamicBuffer[i][1].read<double>(),
+                                    dynamicBuffer[i][2].read<int32_t>());
+            }
+        }
+        EXPECT_TRUE(csvDataSource.fileEnded);
+        return tuples;
+    };
+
+    for (auto skipHeader : {false, true}) {
+        for (auto lastLineFeed : {true, false}) {
+            std::string content = skipHeader ? "id,value,delta\n" : "";
+            auto headerSize = content.size();
+            std::vector<Tuple> expectedTuples;
+            for (uint64_t i = 0; i < numberOfLines; ++i) {
+                // the lines differ in length, so the nominal partition ends fall into lines
+                auto delta = -static_cast<int32_t>(i % 977);
+                content += std::to_string(i) + "," + std::to_string(i * 0.25) + "," + std::to_string(delta);
+                if (i + 1 < numberOfLines || lastLineFeed) {
+                    content += "\n";
+                }
+                expectedTuples.emplace_back(i, i * 0.25, delta);
+            }
+            ASSERT_GT(content.size(), 4 * minPartitionSize);
+            ASSERT_NE(content[headerSize + minPartitionSize - 1], '\n');
+
+            std::string filePath = getTestResourceFolder() / "partitioned.csv";
+            std::ofstream outCsv(filePath, std::ios::binary | std::ios::trunc);
+            outCsv << content;
+            outCsv.close();
+
+            auto sequentialTuples = readAllTuples(filePath, skipHeader, 1);
+            EXPECT_EQ(sequentialTuples, expectedTuples) << "skipHeader=" << skipHeader << " lastLineFeed=" << lastLineFeed;
+            for (auto numberOfReaderThreads : {2u, 4u}) {
+                EXPECT_EQ(readAllTuples(filePath, skipHeader, numberOfReaderThreads), sequentialTuples)
+                    << "skipHeader=" << skipHeader << " lastLineFeed=" << lastLineFeed
+                    << " numberOfReaderThreads=" << numberOfReaderThreads;
+            }
+        }
+    }
+}
+
 /**
  * Tests basic set up of TCP source
  */
@@ -2067,6 +2203,124 @@ TEST_F(SourceTest, testLambdaSourceInitAndTypeIngestion) {
     EXPECT_EQ(lambdaDataSource.getNumberOfGeneratedTuples(), numBuffers * lambdaDataSource.numberOfTuplesToProduce);
 }
 
+/**
+ * @brief the ingestion rate mode generates and emits numberOfBuffersToProduce buffers at the ingestion rate
+ */
+TEST_F(SourceTest, testLambdaSourceIngestionRateRoutine) {
+    constexpr uint64_t numBuffers = 5;
+    constexpr uint64_t ingestionRate = 200;
+    uint64_t numberOfGeneratedBuffers = 0;
+    auto func = [&numberOfGeneratedBuffers](x::Runtime::TupleBuffer& buffer, uint64_t numberOfTuplesToProduce) {
+        auto* records = buffer.getBuffer<IngestionRecord>();
+        for (uint64_t i = 0; i < numberOfTuplesToProduce; i++) {
+            records[i].userId = numberOfGeneratedBuffers;
+        }
+        numberOfGeneratedBuffers++;
+    };
+    auto lambdaDataSource = std::make_shared<RecordingLambdaSourceProxy>(lambdaSchema,
+                                                                         this->nodeEngine->getBufferManager(),
+                                                                         this->nodeEngine->getQueryManager(),
+                                                                         numBuffers,
+                                                                         ingestionRate,
+                                                                         func,
+                                                                         this->operatorId,
+                                                                         this->numSourceLocalBuffersDefault,
+                                                                         GatheringMode::INGESTION_RATE_MODE);
+    lambdaDataSource->running = true;
+    auto start = std::chrono::steady_clock::now();
+    std::thread routine([&lambdaDataSource]() {
+        lambdaDataSource->runningRoutine();
+    });
+    auto deadline = start + std::chrono::seconds(10);
+    while (lambdaDataSource->getNumberOfEmittedBuffers() < numBuffers && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    // 4 intervals of 5ms between the 5 buffers
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(20));
+    // the source stays alive after the last buffer, but does not emit more buffers
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    lambdaDataSource->running = false;
+    routine.join();
+
+    EXPECT_EQ(numberOfGeneratedBuffers, numBuffers);
+    EXPECT_EQ(lambdaDataSource->emittedUserIds, std::vector<uint64_t>({0, 1, 2, 3, 4}));
+    EXPECT_EQ(lambdaDataSource->emittedSequenceNumbers, std::vector<uint64_t>({1, 2, 3, 4, 5}));
+    EXPECT_GT(lambdaDataSource->getAchievedIngestionRate(), 0);
+    EXPECT_LE(lambdaDataSource->getAchievedIngestionRate(), ingestionRate * 1.1);
+}
+
+/**
+ * @brief the replay mode generates at most numSourceLocalBuffers buffers up front and emits them round-robin until
+ * numberOfBuffersToProduce buffers are emitted
+ */
+TEST_F(SourceTest, testLambdaSourceReplayRoutine) {
+    constexpr uint64_t numBuffers = 10;
+    constexpr uint64_t numSourceLocalBuffers = 4;
+    uint64_t numberOfGeneratedBuffers = 0;
+    auto func = [&numberOfGeneratedBuffers](x::Runtime::TupleBuffer& buffer, uint64_t numberOfTuplesToProduce) {
+        auto* records = buffer.getBuffer<IngestionRecord>();
+        for (uint64_t i = 0; i < numberOfTuplesToProduce; i++) {
+            records[i].userId = numberOfGeneratedBuffers;
+        }
+        numberOfGeneratedBuffers++;
+    };
+    auto lambdaDataSource = std::make_shared<RecordingLambdaSourceProxy>(lambdaSchema,
+                                                                         this->nodeEngine->getBufferManager(),
+                                                                         this->nodeEngine->getQueryManager(),
+                                                                         numBuffers,
+                                                                         1000,
+                                                                         func,
+                                                                         this->operatorId,
+                                                                         numSourceLocalBuffers,
+                                                                         GatheringMode::REPLAY_MODE);
+    lambdaDataSource->running = true;
+    std::thread routine([&lambdaDataSource]() {
+        lambdaDataSource->runningRoutine();
+    });
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (lambdaDataSource->getNumberOfEmittedBuffers() < numBuffers && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    lambdaDataSource->running = false;
+    routine.join();
+
+    // the ring holds one buffer per source local buffer, the emitted copies keep their tuples
+    EXPECT_EQ(numberOfGeneratedBuffers, numSourceLocalBuffers);
+    EXPECT_EQ(lambdaDataSource->emittedUserIds, std::vector<uint64_t>({0, 1, 2, 3, 0, 1, 2, 3, 0, 1}));
+    EXPECT_EQ(lambdaDataSource->emittedSequenceNumbers, std::vector<uint64_t>({1, 2, 3, 4, 5, 6, 7, 8, 9, 10}));
+    for (auto numberOfTuples : lambdaDataSource->emittedTuples) {
+        EXPECT_EQ(numberOfTuples, lambdaDataSource->numberOfTuplesToProduce);
+    }
+    EXPECT_EQ(lambdaDataSource->getNumberOfGeneratedBuffers(), numBuffers);
+    EXPECT_EQ(lambdaDataSource->getNumberOfGeneratedTuples(), numBuffers * lambdaDataSource->numberOfTuplesToProduce);
+    EXPECT_GT(lambdaDataSource->getAchievedIngestionRate(), 0);
+
+    // a ring is never larger than the number of buffers to produce
+    numberOfGeneratedBuffers = 0;
+    auto shortDataSource = std::make_shared<RecordingLambdaSourceProxy>(lambdaSchema,
+                                                                        this->nodeEngine->getBufferManager(),
+                                                                        this->nodeEngine->getQueryManager(),
+                                                                        2,
+                                                                        1000,
+                                                                        func,
+                                                                        this->operatorId + 1,
+                                                                        numSourceLocalBuffers,
+                                                                        GatheringMode::REPLAY_MODE);
+    shortDataSource->running = true;
+    std::thread shortRoutine([&shortDataSource]() {
+        shortDataSource->runningRoutine();
+    });
+    deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (shortDataSource->getNumberOfEmittedBuffers() < 2 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    shortDataSource->running = false;
+    shortRoutine.join();
+    EXPECT_EQ(numberOfGeneratedBuffers, 2UL);
+    EXPECT_EQ(shortDataSource->emittedUserIds, std::vector<uint64_t>({0, 1}));
+}
+
 TEST_F(SourceTest, testAdaptiveSource) {
     CSVSourceTypePtr csvSourceType = CSVSourceType::create();
     csvSourceType->setFilePath(this->path_to_chameleon_file);
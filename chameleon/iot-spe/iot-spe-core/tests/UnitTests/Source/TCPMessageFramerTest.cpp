@@ -0,0 +1,102 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <BaseIntegrationTest.hpp>
+#include <gtest/gtest.h>
+
+#include <Sources/TCPMessageFramer.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace x {
+
+/**
+ * Tests the splitting of a TCP byte stream into messages by the TCPMessageFramer.
+ */
+class TCPMessageFramerTest : public Testing::BaseUnitTest {
+  public:
+    static void SetUpTestCase() {
+        x::Logger::setupLogging("TCPMessageFramerTest.log", x::LogLevel::LOG_DEBUG);
+        x_INFO("Setup TCPMessageFramerTest test class.");
+    }
+
+    /// receives the stream in chunks of chunkSize bytes and collects all messages
+    static std::vector<std::string> receiveAll(TCPMessageFramer& framer, const std::string& stream, uint64_t chunkSize) {
+        std::vector<std::string> messages;
+        uint64_t position = 0;
+        while (position < stream.size()) {
+            auto [freeSpace, freeSpaceSize] = framer.getWritableSpace();
+            EXPECT_GT(freeSpaceSize, 0u);
+            auto numberOfBytes = std::min({chunkSize, freeSpaceSize, stream.size() - position});
+            std::memcpy(freeSpace, stream.data() + position, numberOfBytes);
+            framer.commitWrite(numberOfBytes);
+            position += numberOfBytes;
+            while (auto message = framer.nextMessage()) {
+                messages.emplace_back(*message);
+            }
+        }
+        return messages;
+    }
+};
+
+/**
+ * @brief Tests that messages end at the tuple separator, also if they arrive byte by byte or exceed the initial capacity
+ */
+TEST_F(TCPMessageFramerTest, splitsAtTupleSeparator) {
+    std::string longMessage(100, 'x');
+    std::string stream = "1,2,3\n4,5,6\n\n" + longMessage + "\n7,8";
+    std::vector<std::string> expected{"1,2,3", "4,5,6", longMessage};
+    for (uint64_t chunkSize : {1, 3, 7, 1000}) {
+        TCPMessageFramer framer(Configurations::TCPDecideMessageSize::TUPLE_SEPARATOR, '\n', 0, 0, 16);
+        EXPECT_EQ(receiveAll(framer, stream, chunkSize), expected) << "chunk size " << chunkSize;
+        EXPECT_EQ(framer.getNumberOfBufferedBytes(), 3u);
+        EXPECT_GE(framer.getCapacity(), longMessage.size() + 1);
+    }
+}
+
+/**
+ * @brief Tests that messages of a user specified size are split regardless of their content
+ */
+TEST_F(TCPMessageFramerTest, splitsMessagesOfFixedSize) {
+    std::string stream("abcd\nfgh\0jklmnopqr\0", 19);
+    for (uint64_t chunkSize : {1, 5, 64}) {
+        TCPMessageFramer framer(Configurations::TCPDecideMessageSize::USER_SPECIFIED_BUFFER_SIZE, '\n', 4, 0, 6);
+        std::vector<std::string> expected{"abcd", "\nfgh", std::string("\0jkl", 4), "mnop"};
+        EXPECT_EQ(receiveAll(framer, stream, chunkSize), expected) << "chunk size " << chunkSize;
+        EXPECT_EQ(framer.getNumberOfBufferedBytes(), 3u);
+    }
+    EXPECT_ANY_THROW(TCPMessageFramer(Configurations::TCPDecideMessageSize::USER_SPECIFIED_BUFFER_SIZE, '\n', 0, 0));
+}
+
+/**
+ * @brief Tests that the size prefix of a message is decoded in place
+ */
+TEST_F(TCPMessageFramerTest, splitsMessagesWithSizePrefix) {
+    std::string longMessage(300, 'y');
+    std::string stream = "005hello 11hello world000300" + longMessage + "  2ok";
+    std::vector<std::string> expected{"hello", "hello world", longMessage, "ok"};
+    for (uint64_t chunkSize : {1, 4, 1000}) {
+        TCPMessageFramer framer(Configurations::TCPDecideMessageSize::BUFFER_SIZE_FROM_SOCKET, '\n', 0, 3, 8);
+        EXPECT_EQ(receiveAll(framer, stream, chunkSize), expected) << "chunk size " << chunkSize;
+        EXPECT_EQ(framer.getNumberOfBufferedBytes(), 0u);
+    }
+
+    TCPMessageFramer framer(Configurations::TCPDecideMessageSize::BUFFER_SIZE_FROM_SOCKET, '\n', 0, 3);
+    EXPECT_ANY_THROW(receiveAll(framer, "abcdef", 64));
+}
+
+}// namespace x
@@ -18,14 +18,18 @@
 #include <iostream>
 #include <memory>
 #include <thread>
+#include <utility>
+#include <vector>
 #include <zmq.hpp>
 
 #include <API/Schema.hpp>
 #include <BaseIntegrationTest.hpp>
 #include <Catalogs/Source/PhysicalSource.hpp>
+#include <Runtime/FixedSizeBufferPool.hpp>
 #include <Runtime/NodeEngine.hpp>
 #include <Runtime/NodeEngineBuilder.hpp>
 #include <Sources/SourceCreator.hpp>
+#include <Sources/ZmqSource.hpp>
 #include <Util/Logger/Logger.hpp>
 #include <Util/TestUtils.hpp>
 #include <gtest/gtest.h>
@@ -36,6 +40,41 @@ using namespace x;
 #define LOCAL_ADDRESS "127.0.0.1"
 #endif
 
+class ZmqSourceProxy : public ZmqSource {
+  public:
+    ZmqSourceProxy(SchemaPtr schema,
+                   Runtime::BufferManagerPtr bufferManager,
+                   Runtime::QueryManagerPtr queryManager,
+                   uint16_t port,
+                   uint64_t numSourceLocalBuffers)
+        : ZmqSource(schema,
+                    bufferManager,
+                    queryManager,
+                    LOCAL_ADDRESS,
+                    port,
+                    1,
+                    1,
+                    numSourceLocalBuffers,
+                    GatheringMode::INTERVAL_MODE,
+                    "defaultPhysicalStreamName",
+                    {}){};
+
+    /// records the sequence number and the watermark of every emitted buffer instead of handing it to a successor
+    void emitWork(Runtime::TupleBuffer& buffer) override {
+        emittedBuffers.emplace_back(buffer.getSequenceNumber(), buffer.getWatermark());
+    }
+
+    /// the source is not part of a query plan, so it does not send an end of stream
+    void close() override { bufferManager->destroy(); }
+
+    std::vector<std::pair<uint64_t, uint64_t>> emittedBuffers;
+
+  private:
+    FRIEND_TEST(ZMQTest, testZmqSourceDrainsQueuedBuffers);
+    FRIEND_TEST(ZMQTest, testZmqSourceCountsDrainedBuffers);
+    FRIEND_TEST(ZMQTest, testZmqSourceRejectsTruncatedMessages);
+};
+
 class ZMQTest : public Testing::BaseIntegrationTest {
   public:
     /* Will be called before any test in this class are executed. */
@@ -75,6 +114,13 @@ class ZMQTest : public Testing::BaseIntegrationTest {
     /* Will be called after all tests in this class are finished. */
     static void TearDownTestCase() { x_DEBUG("Tear down ZMQTest test class."); }
 
+    /// sends a message with the envelope of the number of tuples and the watermark and a payload of the given size
+    static void sendBuffer(zmq::socket_t& socket, uint64_t numberOfTuples, uint64_t watermark, uint64_t payloadSize = 64) {
+        std::array<uint64_t, 2> envelope{numberOfTuples, watermark};
+        EXPECT_TRUE(socket.send(zmq::buffer(envelope), zmq::send_flags::sndmore).has_value());
+        EXPECT_TRUE(socket.send(zmq::message_t(payloadSize), zmq::send_flags::none).has_value());
+    }
+
     Testing::BorrowedPortPtr zmqPort;
 
     uint64_t tupleCnt{};
@@ -151,6 +197,108 @@ TEST_F(ZMQTest, testZmqSourceReceiveData) {
     receiving_thread.join();
 }
 
+/**
+ * @brief one receive takes the buffers that are queued on the socket, at most one per local buffer, and hands them
+ * out in order with the following receives
+ */
+TEST_F(ZMQTest, testZmqSourceDrainsQueuedBuffers) {
+    constexpr uint64_t numSourceLocalBuffers = 4;
+    ZmqSourceProxy source(test_schema,
+                          nodeEngine->getBufferManager(),
+                          nodeEngine->getQueryManager(),
+                          *zmqPort,
+                          numSourceLocalBuffers);
+    source.open();
+    zmq::context_t context(1);
+    zmq::socket_t socket(context, ZMQ_PUSH);
+    socket.connect(address.c_str());
+
+    // the first receive binds the socket of the source
+    sendBuffer(socket, 1, 1);
+    auto buffer = source.receiveData();
+    ASSERT_TRUE(buffer.has_value());
+    EXPECT_EQ(buffer->getWatermark(), 1UL);
+    buffer.reset();
+
+    for (uint64_t watermark = 2; watermark <= 6; ++watermark) {
+        sendBuffer(socket, watermark, watermark);
+    }
+    // wait until the buffers are queued on the socket of the source
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    buffer = source.receiveData();
+    ASSERT_TRUE(buffer.has_value());
+    EXPECT_EQ(buffer->getWatermark(), 2UL);
+    // buffers 2 to 5 hold all local buffers, buffer 6 stays on the socket
+    EXPECT_EQ(source.bufferManager->getAvailableBuffers(), 0UL);
+    buffer.reset();
+
+    for (uint64_t watermark = 3; watermark <= 6; ++watermark) {
+        buffer = source.receiveData();
+        ASSERT_TRUE(buffer.has_value());
+        EXPECT_EQ(buffer->getNumberOfTuples(), watermark);
+        EXPECT_EQ(buffer->getWatermark(), watermark);
+        buffer.reset();
+    }
+    EXPECT_EQ(source.bufferManager->getAvailableBuffers(), numSourceLocalBuffers);
+}
+
+/**
+ * @brief the running routine emits and counts every drained buffer, so the source stops after numberOfBuffersToProduce
+ * buffers with consecutive sequence numbers
+ */
+TEST_F(ZMQTest, testZmqSourceCountsDrainedBuffers) {
+    ZmqSourceProxy source(test_schema, nodeEngine->getBufferManager(), nodeEngine->getQueryManager(), *zmqPort, 12);
+    source.numberOfBuffersToProduce = 3;
+    source.running = true;
+    zmq::context_t context(1);
+    zmq::socket_t socket(context, ZMQ_PUSH);
+    socket.connect(address.c_str());
+    // the buffers wait in the queue of the publisher until the source binds its socket and arrive together
+    for (uint64_t watermark = 1; watermark <= 5; ++watermark) {
+        sendBuffer(socket, watermark, watermark);
+    }
+
+    source.runningRoutine();
+    EXPECT_FALSE(source.running);
+    EXPECT_EQ(source.emittedBuffers, (std::vector<std::pair<uint64_t, uint64_t>>{{1, 1}, {2, 2}, {3, 3}}));
+}
+
+/**
+ * @brief messages with a truncated envelope, without a payload, or with a payload that exceeds a buffer are dropped
+ * and the source continues with the next message
+ */
+TEST_F(ZMQTest, testZmqSourceRejectsTruncatedMessages) {
+    constexpr uint64_t numSourceLocalBuffers = 12;
+    ZmqSourceProxy source(test_schema,
+                          nodeEngine->getBufferManager(),
+                          nodeEngine->getQueryManager(),
+                          *zmqPort,
+                          numSourceLocalBuffers);
+    source.open();
+    zmq::context_t context(1);
+    zmq::socket_t socket(context, ZMQ_PUSH);
+    socket.connect(address.c_str());
+
+    uint64_t truncatedEnvelope = 1;
+    ASSERT_TRUE(socket.send(zmq::buffer(&truncatedEnvelope, sizeof(truncatedEnvelope)), zmq::send_flags::sndmore).has_value());
+    ASSERT_TRUE(socket.send(zmq::message_t(64), zmq::send_flags::none).has_value());
+    std::array<uint64_t, 2> envelopeWithoutPayload{2, 2};
+    ASSERT_TRUE(socket.send(zmq::buffer(envelopeWithoutPayload), zmq::send_flags::none).has_value());
+    sendBuffer(socket, 3, 3, nodeEngine->getBufferManager()->getBufferSize() + 1);
+    sendBuffer(socket, 4, 4);
+
+    EXPECT_FALSE(source.receiveData().has_value());
+    EXPECT_FALSE(source.receiveData().has_value());
+    EXPECT_FALSE(source.receiveData().has_value());
+    // the buffer of the truncated payload returns to the pool
+    EXPECT_EQ(source.bufferManager->getAvailableBuffers(), numSourceLocalBuffers);
+
+    auto buffer = source.receiveData();
+    ASSERT_TRUE(buffer.has_value());
+    EXPECT_EQ(buffer->getNumberOfTuples(), 4UL);
+    EXPECT_EQ(buffer->getWatermark(), 4UL);
+}
+
 /* - ZeroMQ Data Sink ------------------------------------------------------ */
 TEST_F(ZMQTest, DISABLED_testZmqSinkSendData) {
 
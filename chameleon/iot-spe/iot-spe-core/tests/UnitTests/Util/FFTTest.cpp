@@ -15,9 +15,13 @@
 #include <BaseIntegrationTest.hpp>
 #include <Util/Common.hpp>
 #include <Util/PocketFFT/PocketFFT.hpp>
+#include <Util/SlidingDFT.hpp>
+#include <algorithm>
 #include <cmath>
 #include <complex>
+#include <deque>
 #include <gtest/gtest.h>
+#include <numeric>
 #include <vector>
 
 namespace x {
@@ -150,4 +154,51 @@ TEST(FFTTest, completeFftAnalysis) {
     EXPECT_NEAR(expectedNewNyquist, std::get<1>(res), .1);
 }
 
+TEST(FFTTest, slidingDftMatchesFftPsd) {
+    const uint64_t windowSize = 8;
+    Util::SlidingDFT slidingDft(windowSize);
+    std::vector<double> window;
+    for (uint64_t i = 0; i < 3 * windowSize; ++i) {
+        auto value = std::sin(0.7 * i) + (i % 3);
+        slidingDft.push(value);
+        window.push_back(value);
+        if (window.size() > windowSize) {
+            window.erase(window.begin());
+        }
+    }
+    // detrend the window like computeNyquistAndEnergy does
+    double mean = std::accumulate(window.begin(), window.end(), 0.0) / window.size();
+    std::transform(window.begin(), window.end(), window.begin(), [mean](double x) {
+        return x - mean;
+    });
+    auto fftRes = Util::fft(window);
+    auto expectedPsd = Util::psd(fftRes);
+    auto& psd = slidingDft.getPsd();
+    ASSERT_EQ(expectedPsd.size(), psd.size());
+    for (uint64_t k = 0; k < windowSize; ++k) {
+        EXPECT_NEAR(expectedPsd[k], psd[k], 1e-9);
+    }
+    EXPECT_NEAR(Util::totalEnergy(fftRes), slidingDft.getTotalEnergy(), 1e-9);
+}
+
+TEST(FFTTest, slidingDftNyquistMatchesFullAnalysis) {
+    const uint64_t windowSize = 20;
+    // resync rarely, so that the recurrence itself is checked over many steps
+    Util::SlidingDFT slidingDft(windowSize, 4096);
+    std::deque<double> window;
+    for (uint64_t i = 0; i < 2000; ++i) {
+        auto value = std::sin(0.3 * i) + (i % 7 == 0 ? 3. : 0.);
+        slidingDft.push(value);
+        window.push_back(value);
+        if (window.size() > windowSize) {
+            window.pop_front();
+        }
+        double intervalInSeconds = 0.5 + (i % 5) * 0.1;
+        auto expected = Util::computeNyquistAndEnergy(std::vector<double>(window.begin(), window.end()), intervalInSeconds);
+        auto res = slidingDft.computeNyquistAndEnergy(intervalInSeconds);
+        EXPECT_EQ(std::get<0>(expected), std::get<0>(res));
+        EXPECT_NEAR(std::get<1>(expected), std::get<1>(res), 1e-9);
+    }
+}
+
 }// namespace x
\ No newline at end of file
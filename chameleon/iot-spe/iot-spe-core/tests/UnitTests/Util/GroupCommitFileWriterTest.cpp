@@ -0,0 +1,138 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <BaseIntegrationTest.hpp>
+#include <Exceptions/RuntimeException.hpp>
+#include <Util/GroupCommitFileWriter.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <set>
+#include <sstream>
+#include <thread>
+
+namespace x {
+
+class GroupCommitFileWriterTest : public Testing::BaseUnitTest {
+  public:
+    std::string path;
+
+    static void SetUpTestCase() {
+        x::Logger::setupLogging("GroupCommitFileWriterTest.log", x::LogLevel::LOG_DEBUG);
+        x_INFO("Setup GroupCommitFileWriterTest test class.");
+    }
+
+    void SetUp() override {
+        Testing::BaseUnitTest::SetUp();
+        path = (std::filesystem::temp_directory_path() / "GroupCommitFileWriterTest.txt").string();
+        std::filesystem::remove(path);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove(path);
+        Testing::BaseUnitTest::TearDown();
+    }
+
+    std::string readFile() const {
+        std::ifstream file(path);
+        return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+    }
+};
+
+/**
+ * @brief the writes of concurrent producers are all written once and acknowledged after they are written
+ */
+TEST_F(GroupCommitFileWriterTest, writeConcurrently) {
+    constexpr uint64_t numberOfThreads = 4;
+    constexpr uint64_t writesPerThread = 2000;
+    std::atomic<uint64_t> numberOfAcknowledgedWrites{0};
+    Util::GroupCommitFileWriter writer(path, false, 4096, 64);
+    std::vector<std::thread> producers;
+    for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+        producers.emplace_back([&, thread]() {
+            for (uint64_t i = 0; i < writesPerThread; ++i) {
+                ASSERT_TRUE(writer.write(std::to_string(thread) + ":" + std::to_string(i) + "\n", [&]() {
+                    ++numberOfAcknowledgedWrites;
+                }));
+            }
+        });
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    ASSERT_TRUE(writer.stop());
+    EXPECT_EQ(numberOfAcknowledgedWrites, numberOfThreads * writesPerThread);
+    EXPECT_EQ(writer.getNumberOfWrittenBytes(), std::filesystem::file_size(path));
+    EXPECT_LT(writer.getNumberOfBatches(), numberOfThreads * writesPerThread);
+
+    std::set<std::string> lines;
+    std::stringstream content(readFile());
+    std::string line;
+    while (std::getline(content, line)) {
+        EXPECT_TRUE(lines.insert(line).second) << "duplicate line " << line;
+    }
+    EXPECT_EQ(lines.size(), numberOfThreads * writesPerThread);
+}
+
+/**
+ * @brief a single producer keeps its order, also across batches and with syncing to disk
+ */
+TEST_F(GroupCommitFileWriterTest, keepOrderOfProducer) {
+    std::vector<uint64_t> acknowledged;
+    std::string expected;
+    {
+        Util::GroupCommitFileWriter writer(path, true, 64, 8);
+        for (uint64_t i = 0; i < 500; ++i) {
+            auto data = std::to_string(i) + "\n";
+            expected += data;
+            ASSERT_TRUE(writer.write(data, [&acknowledged, i]() {
+                acknowledged.emplace_back(i);
+            }));
+        }
+        // empty writes are acknowledged as well
+        ASSERT_TRUE(writer.write(""));
+    }
+    EXPECT_EQ(readFile(), expected);
+    ASSERT_EQ(acknowledged.size(), 500u);
+    for (uint64_t i = 0; i < acknowledged.size(); ++i) {
+        EXPECT_EQ(acknowledged[i], i);
+    }
+}
+
+/**
+ * @brief an existing file is appended to, writes after stop are rejected
+ */
+TEST_F(GroupCommitFileWriterTest, appendAndRejectAfterStop) {
+    {
+        std::ofstream file(path);
+        file << "header\n";
+    }
+    Util::GroupCommitFileWriter writer(path);
+    ASSERT_TRUE(writer.write("first\n"));
+    ASSERT_TRUE(writer.write("second\n"));
+    ASSERT_TRUE(writer.stop());
+    EXPECT_FALSE(writer.write("third\n"));
+    EXPECT_EQ(readFile(), "header\nfirst\nsecond\n");
+}
+
+/**
+ * @brief a file that cannot be opened is reported when the writer is created
+ */
+TEST_F(GroupCommitFileWriterTest, failToOpen) {
+    auto invalidPath = (std::filesystem::temp_directory_path() / "GroupCommitFileWriterTest" / "missing" / "file.txt").string();
+    EXPECT_THROW(Util::GroupCommitFileWriter writer(invalidPath), Exceptions::RuntimeException);
+}
+
+}// namespace x
@@ -0,0 +1,102 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <BaseIntegrationTest.hpp>
+#include <Util/MappedFile.hpp>
+#include <gtest/gtest.h>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+namespace x {
+
+class MappedFileTest : public Testing::BaseUnitTest {
+  public:
+    static constexpr uint64_t numberOfValues = 100000;
+    std::string path;
+
+    static void SetUpTestCase() {
+        x::Logger::setupLogging("MappedFileTest.log", x::LogLevel::LOG_DEBUG);
+        x_INFO("Setup MappedFileTest test class.");
+    }
+
+    void SetUp() override {
+        Testing::BaseUnitTest::SetUp();
+        path = (std::filesystem::temp_directory_path() / "MappedFileTest.bin").string();
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        for (uint64_t i = 0; i < numberOfValues; ++i) {
+            file.write(reinterpret_cast<const char*>(&i), sizeof(uint64_t));
+        }
+    }
+
+    void TearDown() override {
+        std::filesystem::remove(path);
+        Testing::BaseUnitTest::TearDown();
+    }
+};
+
+/**
+ * @brief the mapping exposes the content of the file, reading ahead does not change it
+ */
+TEST_F(MappedFileTest, mapFile) {
+    auto mappedFile = Util::MappedFile::create(path);
+    ASSERT_EQ(mappedFile->getSize(), numberOfValues * sizeof(uint64_t));
+    EXPECT_EQ(mappedFile->getPath(), path);
+    for (uint64_t position = 0; position < mappedFile->getSize(); position += 4096) {
+        mappedFile->willRead(position);
+    }
+    mappedFile->willRead(0);
+    for (uint64_t i = 0; i < numberOfValues; ++i) {
+        uint64_t value;
+        std::memcpy(&value, mappedFile->getData() + i * sizeof(uint64_t), sizeof(uint64_t));
+        ASSERT_EQ(value, i);
+    }
+}
+
+/**
+ * @brief a wrapped buffer points into the mapping and keeps it alive, writes to it do not reach the file
+ */
+TEST_F(MappedFileTest, wrapKeepsMappingAlive) {
+    auto mappedFile = Util::MappedFile::create(path);
+    auto buffer = mappedFile->wrap(10 * sizeof(uint64_t), 5 * sizeof(uint64_t));
+    std::weak_ptr<Util::MappedFile> weakMappedFile = mappedFile;
+    mappedFile.reset();
+    ASSERT_FALSE(weakMappedFile.expired());
+    EXPECT_EQ(buffer.getBufferSize(), 5 * sizeof(uint64_t));
+    EXPECT_EQ(buffer.getBuffer<uint64_t>()[0], 10u);
+    buffer.getBuffer<uint64_t>()[0] = 42;
+    buffer.release();
+    EXPECT_TRUE(weakMappedFile.expired());
+
+    uint64_t value;
+    std::ifstream file(path, std::ios::binary);
+    file.seekg(10 * sizeof(uint64_t));
+    file.read(reinterpret_cast<char*>(&value), sizeof(uint64_t));
+    EXPECT_EQ(value, 10u);
+}
+
+/**
+ * @brief empty files can be mapped, missing files cannot
+ */
+TEST_F(MappedFileTest, emptyAndMissingFiles) {
+    auto emptyPath = (std::filesystem::temp_directory_path() / "MappedFileTestEmpty.bin").string();
+    std::ofstream(emptyPath).close();
+    auto mappedFile = Util::MappedFile::create(emptyPath);
+    EXPECT_EQ(mappedFile->getSize(), 0u);
+    EXPECT_EQ(mappedFile->getData(), nullptr);
+    std::filesystem::remove(emptyPath);
+    EXPECT_ANY_THROW(Util::MappedFile::create(emptyPath));
+}
+
+}// namespace x
@@ -0,0 +1,95 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <BaseIntegrationTest.hpp>
+#include <Exceptions/RuntimeException.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/RatePacer.hpp>
+#include <gtest/gtest.h>
+#include <thread>
+
+namespace x {
+
+class RatePacerTest : public Testing::BaseUnitTest {
+  public:
+    static void SetUpTestCase() {
+        x::Logger::setupLogging("RatePacerTest.log", x::LogLevel::LOG_DEBUG);
+        x_INFO("Setup RatePacerTest test class.");
+    }
+};
+
+/**
+ * @brief events are emitted at the target rate
+ */
+TEST_F(RatePacerTest, paceAtTargetRate) {
+    constexpr double targetRate = 20000;
+    Util::RatePacer pacer(targetRate);
+    auto start = Util::RatePacer::Clock::now();
+    for (uint64_t i = 0; i < 4000; ++i) {
+        pacer.waitForNextEvent();
+    }
+    auto duration = std::chrono::duration<double>(Util::RatePacer::Clock::now() - start).count();
+    EXPECT_EQ(pacer.getNumberOfEvents(), 4000u);
+    // 3999 intervals of 50us
+    EXPECT_GE(duration, 0.19995);
+    EXPECT_NEAR(pacer.getAchievedRate(), targetRate, targetRate * 0.05);
+    EXPECT_EQ(pacer.getTargetRate(), targetRate);
+}
+
+/**
+ * @brief a late event shortens the following waits, so the schedule is kept
+ */
+TEST_F(RatePacerTest, compensateLateEvent) {
+    Util::RatePacer pacer(1000, std::chrono::microseconds(100), std::chrono::milliseconds(50));
+    auto start = Util::RatePacer::Clock::now();
+    pacer.waitForNextEvent();
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    auto afterSleep = Util::RatePacer::Clock::now();
+    // the events up to 10ms are due already, so they do not wait, while waiting for each of them would take 10ms
+    for (uint64_t i = 0; i < 10; ++i) {
+        pacer.waitForNextEvent();
+    }
+    EXPECT_LT(Util::RatePacer::Clock::now() - afterSleep, std::chrono::milliseconds(9));
+    for (uint64_t i = 0; i < 10; ++i) {
+        pacer.waitForNextEvent();
+    }
+    // the schedule is kept, so the pacer is never faster than the target rate, however late the sleep returned
+    EXPECT_GE(Util::RatePacer::Clock::now() - start, std::chrono::milliseconds(20));
+    EXPECT_EQ(pacer.getNumberOfEvents(), 21u);
+    EXPECT_EQ(pacer.getNumberOfRestarts(), 0u);
+    EXPECT_GT(pacer.getAchievedRate(), 0);
+    EXPECT_LE(pacer.getAchievedRate(), 1000 * 1.05);
+}
+
+/**
+ * @brief a lag above maxLag restarts the schedule instead of emitting a burst
+ */
+TEST_F(RatePacerTest, restartAfterLag) {
+    Util::RatePacer pacer(1000, std::chrono::microseconds(100), std::chrono::milliseconds(5));
+    pacer.waitForNextEvent();
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    pacer.waitForNextEvent();
+    EXPECT_EQ(pacer.getNumberOfRestarts(), 1u);
+    auto start = Util::RatePacer::Clock::now();
+    pacer.waitForNextEvent();
+    EXPECT_GE(Util::RatePacer::Clock::now() - start, std::chrono::microseconds(900));
+}
+
+TEST_F(RatePacerTest, rejectInvalidRate) {
+    EXPECT_THROW(Util::RatePacer(0), Exceptions::RuntimeException);
+    Util::RatePacer pacer(10);
+    EXPECT_EQ(pacer.getAchievedRate(), 0);
+}
+
+}// namespace x
@@ -0,0 +1,81 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+#include <BaseIntegrationTest.hpp>
+#include <Util/TimerWheel.hpp>
+#include <gtest/gtest.h>
+#include <map>
+#include <vector>
+
+namespace x {
+
+class TimerWheelTest : public Testing::BaseUnitTest {
+  public:
+    static void SetUpTestCase() {
+        x::Logger::setupLogging("TimerWheelTest.log", x::LogLevel::LOG_DEBUG);
+        x_INFO("Setup TimerWheelTest test class.");
+    }
+};
+
+/**
+ * @brief timers expire after their delay, also if the delay spans several rotations of the wheel
+ */
+TEST_F(TimerWheelTest, timersExpireAfterTheirDelay) {
+    Util::TimerWheel<uint64_t> timerWheel(8);
+    std::vector<uint64_t> delays = {1, 3, 7, 8, 9, 16, 17, 42};
+    for (auto delay : delays) {
+        timerWheel.schedule(delay, delay);
+    }
+    EXPECT_EQ(timerWheel.size(), delays.size());
+
+    std::map<uint64_t, uint64_t> expiredAt;
+    std::vector<uint64_t> expired;
+    for (uint64_t tick = 1; tick <= 50; ++tick) {
+        expired.clear();
+        timerWheel.advance(expired);
+        for (auto payload : expired) {
+            expiredAt[payload] = tick;
+        }
+    }
+    EXPECT_TRUE(timerWheel.empty());
+    EXPECT_EQ(timerWheel.getCurrentTick(), 50UL);
+    for (auto delay : delays) {
+        EXPECT_EQ(expiredAt[delay], delay);
+    }
+}
+
+/**
+ * @brief a delay of zero expires on the next tick, timers scheduled later are relative to the current tick
+ */
+TEST_F(TimerWheelTest, delaysAreRelativeToCurrentTick) {
+    Util::TimerWheel<int> timerWheel(4);
+    std::vector<int> expired;
+    timerWheel.schedule(1, 0);
+    timerWheel.advance(expired);
+    ASSERT_EQ(expired.size(), 1UL);
+    EXPECT_EQ(expired[0], 1);
+
+    timerWheel.advance(expired);
+    timerWheel.advance(expired);
+    timerWheel.schedule(2, 5);
+    expired.clear();
+    for (int i = 0; i < 4; ++i) {
+        timerWheel.advance(expired);
+    }
+    EXPECT_TRUE(expired.empty());
+    timerWheel.advance(expired);
+    ASSERT_EQ(expired.size(), 1UL);
+    EXPECT_EQ(expired[0], 2);
+}
+
+}// namespace x
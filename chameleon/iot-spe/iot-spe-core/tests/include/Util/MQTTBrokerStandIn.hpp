@@ -0,0 +1,109 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#ifndef x_x_CORE_TESTS_INCLUDE_UTIL_MQTTBROKERSTANDIN_HPP_
+#define x_x_CORE_TESTS_INCLUDE_UTIL_MQTTBROKERSTANDIN_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace x::Testing {
+
+/**
+ * @brief in-process MQTT 3.1.1 broker that stands in for a real broker in the tests of the MQTT source and sink.
+ * It listens on an ephemeral port of the loopback interface, records every message that clients publish, acknowledges
+ * messages of QoS 1 and 2, and forwards messages with QoS 0 to the clients that subscribed to their exact topic.
+ * The acknowledgements of QoS 1 messages can be held back to simulate a slow broker.
+ */
+class MQTTBrokerStandIn {
+  public:
+    MQTTBrokerStandIn();
+    ~MQTTBrokerStandIn();
+
+    /**
+     * @brief the address that MQTT clients connect to
+     */
+    std::string getAddress() const;
+
+    /**
+     * @brief publishes a message to all clients that subscribed to the topic
+     */
+    void publish(const std::string& topic, const std::string& payload);
+
+    /**
+     * @brief the payloads that clients published to the topic in the order of their arrival
+     */
+    std::vector<std::string> getPublishedPayloads(const std::string& topic) const;
+
+    /**
+     * @brief waits until clients published at least numberOfPayloads messages to the topic
+     * @return false if the timeout expired before
+     */
+    bool waitForPublishedPayloads(const std::string& topic, uint64_t numberOfPayloads, std::chrono::milliseconds timeout);
+
+    /**
+     * @brief waits until a client subscribed to the topic
+     * @return false if the timeout expired before
+     */
+    bool waitForSubscription(const std::string& topic, std::chrono::milliseconds timeout);
+
+    /**
+     * @brief holds back the acknowledgements of QoS 1 messages until releaseAcknowledgements is called
+     */
+    void holdAcknowledgements();
+
+    /**
+     * @brief sends the held back acknowledgements in the order of the messages and acknowledges further messages directly
+     */
+    void releaseAcknowledgements();
+
+  private:
+    struct Client {
+        explicit Client(int socket) : socket(socket) {}
+        int socket;
+        std::mutex writeMutex;
+        std::set<std::string> subscriptions;
+    };
+    using ClientPtr = std::shared_ptr<Client>;
+
+    void acceptRoutine();
+    void clientRoutine(const ClientPtr& client);
+    static void send(Client& client, uint8_t header, const std::string& body);
+
+    int listenSocket;
+    uint16_t port;
+    std::atomic<bool> running{true};
+    std::thread acceptThread;
+
+    mutable std::mutex mutex;
+    std::condition_variable stateChanged;
+    std::vector<ClientPtr> clients;
+    std::vector<std::thread> clientThreads;
+    std::map<std::string, std::vector<std::string>> publishedPayloads;
+    bool acknowledgementsHeld{false};
+    std::vector<std::pair<ClientPtr, std::string>> heldAcknowledgements;
+};
+
+}// namespace x::Testing
+
+#endif// x_x_CORE_TESTS_INCLUDE_UTIL_MQTTBROKERSTANDIN_HPP_
@@ -0,0 +1,304 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Util/Logger/Logger.hpp>
+#include <Util/MQTTBrokerStandIn.hpp>
+#include <arpa/inet.h>
+#include <cerrno>
+#include <cstring>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace x::Testing {
+
+namespace {
+// control packet types of MQTT 3.1.1 in the upper four bits of the fixed header
+constexpr uint8_t CONNECT = 1;
+constexpr uint8_t PUBLISH = 3;
+constexpr uint8_t PUBREL = 6;
+constexpr uint8_t SUBSCRIBE = 8;
+constexpr uint8_t UNSUBSCRIBE = 10;
+constexpr uint8_t PINGREQ = 12;
+constexpr uint8_t DISCONNECT = 14;
+
+constexpr uint8_t CONNACK_HEADER = 0x20;
+constexpr uint8_t PUBLISH_HEADER = 0x30;
+constexpr uint8_t PUBACK_HEADER = 0x40;
+constexpr uint8_t PUBREC_HEADER = 0x50;
+constexpr uint8_t PUBCOMP_HEADER = 0x70;
+constexpr uint8_t SUBACK_HEADER = 0x90;
+constexpr uint8_t UNSUBACK_HEADER = 0xB0;
+constexpr uint8_t PINGRESP_HEADER = 0xD0;
+
+bool readFully(int socket, char* data, size_t size) {
+    while (size > 0) {
+        auto bytesRead = ::recv(socket, data, size, 0);
+        if (bytesRead <= 0) {
+            return false;
+        }
+        data += bytesRead;
+        size -= bytesRead;
+    }
+    return true;
+}
+
+uint16_t readUInt16(const std::string& body, size_t& position) {
+    auto value = static_cast<uint16_t>((static_cast<uint8_t>(body[position]) << 8) | static_cast<uint8_t>(body[position + 1]));
+    position += 2;
+    return value;
+}
+
+std::string readString(const std::string& body, size_t& position) {
+    auto length = readUInt16(body, position);
+    auto value = body.substr(position, length);
+    position += length;
+    return value;
+}
+
+std::string encodeString(const std::string& value) {
+    std::string encoded;
+    encoded.push_back(static_cast<char>(value.size() >> 8));
+    encoded.push_back(static_cast<char>(value.size() & 0xFF));
+    return encoded + value;
+}
+}// namespace
+
+MQTTBrokerStandIn::MQTTBrokerStandIn() {
+    listenSocket = ::socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = 0;
+    socklen_t addressLength = sizeof(address);
+    if (listenSocket < 0 || ::bind(listenSocket, reinterpret_cast<sockaddr*>(&address), addressLength) != 0
+        || ::listen(listenSocket, 16) != 0
+        || ::getsockname(listenSocket, reinterpret_cast<sockaddr*>(&address), &addressLength) != 0) {
+        x_THROW_RUNTIME_ERROR("MQTTBrokerStandIn: cannot listen on the loopback interface: " << strerror(errno));
+    }
+    port = ntohs(address.sin_port);
+    acceptThread = std::thread([this]() {
+        acceptRoutine();
+    });
+}
+
+MQTTBrokerStandIn::~MQTTBrokerStandIn() {
+    running = false;
+    ::shutdown(listenSocket, SHUT_RDWR);
+    acceptThread.join();
+    ::close(listenSocket);
+    {
+        std::unique_lock lock(mutex);
+        for (const auto& client : clients) {
+            ::shutdown(client->socket, SHUT_RDWR);
+        }
+    }
+    for (auto& clientThread : clientThreads) {
+        clientThread.join();
+    }
+    for (const auto& client : clients) {
+        ::close(client->socket);
+    }
+}
+
+std::string MQTTBrokerStandIn::getAddress() const { return "tcp://127.0.0.1:" + std::to_string(port); }
+
+void MQTTBrokerStandIn::acceptRoutine() {
+    while (running) {
+        auto socket = ::accept(listenSocket, nullptr, nullptr);
+        if (socket < 0) {
+            continue;
+        }
+        std::unique_lock lock(mutex);
+        if (!running) {
+            ::close(socket);
+            return;
+        }
+        auto client = std::make_shared<Client>(socket);
+        clients.emplace_back(client);
+        clientThreads.emplace_back([this, client]() {
+            clientRoutine(client);
+        });
+    }
+}
+
+void MQTTBrokerStandIn::clientRoutine(const ClientPtr& client) {
+    while (true) {
+        char header;
+        if (!readFully(client->socket, &header, 1)) {
+            return;
+        }
+        // the remaining length is encoded in up to four bytes with seven bits each
+        uint64_t remainingLength = 0;
+        for (uint64_t multiplier = 1;; multiplier *= 128) {
+            char encodedByte;
+            if (!readFully(client->socket, &encodedByte, 1)) {
+                return;
+            }
+            remainingLength += (encodedByte & 0x7F) * multiplier;
+            if (!(encodedByte & 0x80)) {
+                break;
+            }
+        }
+        std::string body(remainingLength, '\0');
+        if (!readFully(client->socket, body.data(), remainingLength)) {
+            return;
+        }
+
+        size_t position = 0;
+        switch (static_cast<uint8_t>(header) >> 4) {
+            case CONNECT: send(*client, CONNACK_HEADER, std::string(2, '\0')); break;
+            case PUBLISH: {
+                auto qualityOfService = (header >> 1) & 0x03;
+                auto topic = readString(body, position);
+                std::string packetId;
+                if (qualityOfService > 0) {
+                    packetId = body.substr(position, 2);
+                    position += 2;
+                }
+                std::unique_lock lock(mutex);
+                publishedPayloads[topic].emplace_back(body.substr(position));
+                stateChanged.notify_all();
+                if (qualityOfService == 1 && acknowledgementsHeld) {
+                    heldAcknowledgements.emplace_back(client, packetId);
+                } else if (qualityOfService > 0) {
+                    lock.unlock();
+                    send(*client, qualityOfService == 1 ? PUBACK_HEADER : PUBREC_HEADER, packetId);
+                }
+                break;
+            }
+            case PUBREL: send(*client, PUBCOMP_HEADER, body.substr(0, 2)); break;
+            case SUBSCRIBE: {
+                auto packetId = body.substr(0, 2);
+                position = 2;
+                // every subscription is granted with QoS 0
+                std::string grantedQualities;
+                std::unique_lock lock(mutex);
+                while (position < body.size()) {
+                    client->subscriptions.emplace(readString(body, position));
+                    ++position;
+                    grantedQualities.push_back('\0');
+                }
+                stateChanged.notify_all();
+                lock.unlock();
+                send(*client, SUBACK_HEADER, packetId + grantedQualities);
+                break;
+            }
+            case UNSUBSCRIBE: {
+                position = 2;
+                std::unique_lock lock(mutex);
+                while (position < body.size()) {
+                    client->subscriptions.erase(readString(body, position));
+                }
+                lock.unlock();
+                send(*client, UNSUBACK_HEADER, body.substr(0, 2));
+                break;
+            }
+            case PINGREQ: send(*client, PINGRESP_HEADER, ""); break;
+            case DISCONNECT: {
+                std::unique_lock lock(mutex);
+                client->subscriptions.clear();
+                return;
+            }
+            default: break;
+        }
+    }
+}
+
+void MQTTBrokerStandIn::send(Client& client, uint8_t header, const std::string& body) {
+    std::string packet(1, static_cast<char>(header));
+    auto remainingLength = body.size();
+    do {
+        char encodedByte = static_cast<char>(remainingLength % 128);
+        remainingLength /= 128;
+        if (remainingLength > 0) {
+            encodedByte = static_cast<char>(encodedByte | 0x80);
+        }
+        packet.push_back(encodedByte);
+    } while (remainingLength > 0);
+    packet += body;
+
+    std::unique_lock lock(client.writeMutex);
+    size_t bytesSent = 0;
+    while (bytesSent < packet.size()) {
+        auto result = ::send(client.socket, packet.data() + bytesSent, packet.size() - bytesSent, MSG_NOSIGNAL);
+        if (result <= 0) {
+            x_DEBUG("MQTTBrokerStandIn: client disconnected while sending");
+            return;
+        }
+        bytesSent += result;
+    }
+}
+
+void MQTTBrokerStandIn::publish(const std::string& topic, const std::string& payload) {
+    std::vector<ClientPtr> subscribers;
+    {
+        std::unique_lock lock(mutex);
+        for (const auto& client : clients) {
+            if (client->subscriptions.contains(topic)) {
+                subscribers.emplace_back(client);
+            }
+        }
+    }
+    auto body = encodeString(topic) + payload;
+    for (const auto& subscriber : subscribers) {
+        send(*subscriber, PUBLISH_HEADER, body);
+    }
+}
+
+std::vector<std::string> MQTTBrokerStandIn::getPublishedPayloads(const std::string& topic) const {
+    std::unique_lock lock(mutex);
+    auto payloads = publishedPayloads.find(topic);
+    return payloads == publishedPayloads.end() ? std::vector<std::string>{} : payloads->second;
+}
+
+bool MQTTBrokerStandIn::waitForPublishedPayloads(const std::string& topic,
+                                                 uint64_t numberOfPayloads,
+                                                 std::chrono::milliseconds timeout) {
+    std::unique_lock lock(mutex);
+    return stateChanged.wait_for(lock, timeout, [&]() {
+        return publishedPayloads[topic].size() >= numberOfPayloads;
+    });
+}
+
+bool MQTTBrokerStandIn::waitForSubscription(const std::string& topic, std::chrono::milliseconds timeout) {
+    std::unique_lock lock(mutex);
+    return stateChanged.wait_for(lock, timeout, [&]() {
+        for (const auto& client : clients) {
+            if (client->subscriptions.contains(topic)) {
+                return true;
+            }
+        }
+        return false;
+    });
+}
+
+void MQTTBrokerStandIn::holdAcknowledgements() {
+    std::unique_lock lock(mutex);
+    acknowledgementsHeld = true;
+}
+
+void MQTTBrokerStandIn::releaseAcknowledgements() {
+    std::vector<std::pair<ClientPtr, std::string>> acknowledgements;
+    {
+        std::unique_lock lock(mutex);
+        acknowledgementsHeld = false;
+        acknowledgements.swap(heldAcknowledgements);
+    }
+    for (const auto& [client, packetId] : acknowledgements) {
+        send(*client, PUBACK_HEADER, packetId);
+    }
+}
+
+}// namespace x::Testing
@@ -0,0 +1,62 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+#include <Util/Common.hpp>
+#include <Util/SlidingDFT.hpp>
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <deque>
+#include <vector>
+
+namespace x::Util {
+
+/**
+ * @brief Compares the per-sample cost of the adaptive gathering spectrum analysis.
+ * The FFT path rebuilds the window and runs computeNyquistAndEnergy for every sample,
+ * the sliding path pushes the sample into a SlidingDFT and queries it.
+ */
+static double sensorValue(uint64_t i) { return std::sin(0.3 * i) + (i % 7 == 0 ? 3. : 0.); }
+
+static void BM_FFTNyquistPerSample(benchmark::State& state) {
+    auto windowSize = static_cast<uint64_t>(state.range(0));
+    std::deque<double> window;
+    uint64_t i = 0;
+    for (auto _ : state) {
+        window.push_back(sensorValue(i++));
+        if (window.size() > windowSize) {
+            window.pop_front();
+        }
+        auto res = computeNyquistAndEnergy(std::vector<double>(window.begin(), window.end()), 0.5);
+        benchmark::DoNotOptimize(res);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_SlidingDFTNyquistPerSample(benchmark::State& state) {
+    auto windowSize = static_cast<uint64_t>(state.range(0));
+    SlidingDFT slidingDft(windowSize);
+    uint64_t i = 0;
+    for (auto _ : state) {
+        slidingDft.push(sensorValue(i++));
+        auto res = slidingDft.computeNyquistAndEnergy(0.5);
+        benchmark::DoNotOptimize(res);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_FFTNyquistPerSample)->Arg(20)->Arg(64)->Arg(256);
+BENCHMARK(BM_SlidingDFTNyquistPerSample)->Arg(20)->Arg(64)->Arg(256);
+
+}// namespace x::Util
+
+BENCHMARK_MAIN();
@@ -0,0 +1,59 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#ifndef x_RUNTIME_INCLUDE_EXECUTION_OPERATORS_STREAMING_SIGNALRECONSTRUCTION_SIGNALRECONSTRUCTION_HPP_
+#define x_RUNTIME_INCLUDE_EXECUTION_OPERATORS_STREAMING_SIGNALRECONSTRUCTION_SIGNALRECONSTRUCTION_HPP_
+
+#include <Execution/Operators/ExecutableOperator.hpp>
+#include <Nautilus/Interface/Record.hpp>
+#include <vector>
+
+namespace x::Runtime::Execution::Operators {
+class TimeFunction;
+using TimeFunctionPtr = std::unique_ptr<TimeFunction>;
+
+/**
+ * @brief SignalReconstruction operator that turns an adaptively sampled stream into a stream with a regular rate.
+ * It emits one record per grid point between two consecutive samples of an origin, see SignalReconstructionOperatorHandler.
+ * The samples of a buffer are collected in execute and reconstructed in close, once the buffers of the origin with smaller
+ * sequence numbers were reconstructed. Emitted records contain the timestamp field and the value fields as doubles.
+ */
+class SignalReconstruction : public ExecutableOperator {
+  public:
+    /**
+     * @brief Creates a SignalReconstruction operator
+     * @param operatorHandlerIndex index of the SignalReconstructionOperatorHandler
+     * @param timeFunction derives the timestamp of a sample
+     * @param valueFields the numeric fields that are reconstructed
+     * @param timestampField the field that holds the timestamp of a reconstructed record
+     */
+    SignalReconstruction(uint64_t operatorHandlerIndex,
+                         TimeFunctionPtr timeFunction,
+                         std::vector<Record::RecordFieldIdentifier> valueFields,
+                         Record::RecordFieldIdentifier timestampField);
+    void setup(ExecutionContext& executionCtx) const override;
+    void open(ExecutionContext& ctx, RecordBuffer& recordBuffer) const override;
+    void execute(ExecutionContext& ctx, Record& record) const override;
+    void close(ExecutionContext& ctx, RecordBuffer& recordBuffer) const override;
+
+  private:
+    const uint64_t operatorHandlerIndex;
+    const TimeFunctionPtr timeFunction;
+    const std::vector<Record::RecordFieldIdentifier> valueFields;
+    const Record::RecordFieldIdentifier timestampField;
+};
+
+}// namespace x::Runtime::Execution::Operators
+
+#endif// x_RUNTIME_INCLUDE_EXECUTION_OPERATORS_STREAMING_SIGNALRECONSTRUCTION_SIGNALRECONSTRUCTION_HPP_
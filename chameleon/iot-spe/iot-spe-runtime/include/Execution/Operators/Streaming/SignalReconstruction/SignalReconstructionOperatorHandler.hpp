@@ -0,0 +1,201 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#ifndef x_RUNTIME_INCLUDE_EXECUTION_OPERATORS_STREAMING_SIGNALRECONSTRUCTION_SIGNALRECONSTRUCTIONOPERATORHANDLER_HPP_
+#define x_RUNTIME_INCLUDE_EXECUTION_OPERATORS_STREAMING_SIGNALRECONSTRUCTION_SIGNALRECONSTRUCTIONOPERATORHANDLER_HPP_
+
+#include <Runtime/Execution/OperatorHandler.hpp>
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace x::Runtime::Execution::Operators {
+
+/**
+ * @brief Defines how the values between two received samples are reconstructed.
+ */
+enum class ReconstructionMethod : uint8_t {
+    /// linear interpolation between the previous and the current sample
+    LINEAR,
+    /// the previous sample is held until the current sample arrives
+    SAMPLE_AND_HOLD,
+    /// the prediction of a constant velocity kalman filter that was updated with the previous samples
+    KALMAN
+};
+
+class SignalReconstructionOperatorHandler;
+using SignalReconstructionOperatorHandlerPtr = std::shared_ptr<SignalReconstructionOperatorHandler>;
+
+/**
+ * @brief Operator handler of the SignalReconstruction operator.
+ * It keeps one reconstructed stream per origin, i.e., the previous sample and the next point of the regular time grid,
+ * and computes the reconstructed points for the incoming samples.
+ * A worker collects the samples of a buffer in a thread local batch and hands the batch over when it closes the buffer.
+ * The batches of an origin are reconstructed in the order of their sequence numbers, so buffers that the workers finish
+ * out of order are not dropped. The worker that hands over the next batch of an origin reconstructs it together with all
+ * batches that waited for it. The points are written to thread local output buffers, such that the stream state is only
+ * locked while the points are computed and not while they are emitted to the downstream operators.
+ */
+class SignalReconstructionOperatorHandler : public OperatorHandler {
+  public:
+    /**
+     * @brief Creates the operator handler
+     * @param numberOfValues the number of reconstructed value fields
+     * @param intervalInMs the interval of the regular time grid, grid points are multiples of the interval
+     * @param method the reconstruction method
+     * @param maxGapInMs grid points between two samples that are further apart are not reconstructed, 0 disables the check
+     * @param processNoise process noise of the kalman filter, i.e., the variance of the acceleration per second
+     * @param measurementNoise measurement noise of the kalman filter
+     */
+    SignalReconstructionOperatorHandler(uint64_t numberOfValues,
+                                        uint64_t intervalInMs,
+                                        ReconstructionMethod method,
+                                        uint64_t maxGapInMs = 0,
+                                        double processNoise = 1.0,
+                                        double measurementNoise = 1.0);
+
+    static SignalReconstructionOperatorHandlerPtr create(uint64_t numberOfValues,
+                                                         uint64_t intervalInMs,
+                                                         ReconstructionMethod method,
+                                                         uint64_t maxGapInMs = 0);
+
+    void start(PipelineExecutionContextPtr pipelineExecutionContext,
+               StateManagerPtr stateManager,
+               uint32_t localStateVariableId) override;
+
+    void stop(QueryTerminationType queryTerminationType, PipelineExecutionContextPtr pipelineExecutionContext) override;
+
+    /**
+     * @brief Initializes the thread local sample, batch, and output buffers
+     * @param numberOfWorkerThreads
+     */
+    void setup(uint64_t numberOfWorkerThreads);
+
+    /**
+     * @brief Sets a value of the next sample of a worker
+     * @param workerId
+     * @param index the index of the value field
+     * @param value
+     */
+    void setSampleValue(uint64_t workerId, uint64_t index, double value);
+
+    /**
+     * @brief Appends the next sample of a worker with the given timestamp to the batch of its current buffer
+     * @param workerId
+     * @param timestamp
+     */
+    void addSample(uint64_t workerId, uint64_t timestamp);
+
+    /**
+     * @brief Hands over the batch of the current buffer of a worker and reconstructs all batches of the origin that are
+     * next in sequence order. Of these, samples that are not newer than the previous sample of the origin are dropped.
+     * A batch with a sequence number that was already reconstructed is reconstructed right away.
+     * @param workerId
+     * @param originId the origin of the buffer
+     * @param sequenceNumber the sequence number of the buffer, the first buffer of an origin has the sequence number 1
+     * @return the number of reconstructed points in the output buffers of the worker
+     */
+    uint64_t reconstruct(uint64_t workerId, uint64_t originId, uint64_t sequenceNumber);
+
+    /**
+     * @param workerId
+     * @return the timestamps of the reconstructed points of the last call of reconstruct()
+     */
+    uint64_t* getTimestamps(uint64_t workerId);
+
+    /**
+     * @param workerId
+     * @return the values of the reconstructed points of the last call of reconstruct() point by point,
+     * i.e., values[pointIndex * numberOfValues + valueIndex]
+     */
+    double* getValues(uint64_t workerId);
+
+    /**
+     * @return the number of samples that were dropped because they were not newer than the previous sample of their origin
+     */
+    [[nodiscard]] uint64_t getNumberOfDroppedSamples() const;
+
+    /**
+     * @return the number of batches that wait for a batch with a smaller sequence number of their origin
+     */
+    [[nodiscard]] uint64_t getNumberOfPendingBatches() const;
+
+    [[nodiscard]] uint64_t getNumberOfValues() const;
+
+  private:
+    /// the samples of a buffer in the order of the buffer, values sample by sample
+    struct SampleBatch {
+        std::vector<uint64_t> timestamps;
+        std::vector<double> values;
+    };
+
+    struct WorkerBuffers {
+        std::vector<double> sample;
+        SampleBatch batch;
+        std::vector<uint64_t> timestamps;
+        std::vector<double> values;
+    };
+
+    /// state of a constant velocity kalman filter with the symmetric covariance p
+    struct KalmanState {
+        double position;
+        double velocity;
+        double p00;
+        double p01;
+        double p11;
+    };
+
+    /// the reconstructed stream of an origin, guarded by its mutex
+    struct StreamState {
+        std::mutex mutex;
+        uint64_t nextSequenceNumber{1};
+        std::map<uint64_t, SampleBatch> pendingBatches;
+        bool hasPreviousSample{false};
+        uint64_t previousTimestamp{0};
+        uint64_t nextGridPoint{0};
+        std::vector<double> previousSample;
+        std::vector<KalmanState> kalmanStates;
+    };
+
+    StreamState& getStreamState(uint64_t originId);
+    void reconstructBatch(StreamState& stream, WorkerBuffers& buffers, const SampleBatch& batch);
+    void reconstructSample(StreamState& stream, WorkerBuffers& buffers, uint64_t timestamp, const double* sample);
+    void resetKalmanStates(StreamState& stream, const double* sample) const;
+    void predictKalmanStates(StreamState& stream, double dt) const;
+    void updateKalmanStates(StreamState& stream, const double* sample) const;
+    /// appends a point to the output buffers and returns the location of its values
+    double* appendPoint(WorkerBuffers& buffers, uint64_t timestamp) const;
+    uint64_t firstGridPointAtOrAfter(uint64_t timestamp) const;
+
+    const uint64_t numberOfValues;
+    const uint64_t intervalInMs;
+    const ReconstructionMethod method;
+    const uint64_t maxGapInMs;
+    const double processNoise;
+    const double measurementNoise;
+
+    std::vector<WorkerBuffers> workerBuffers;
+
+    mutable std::mutex streamsMutex;
+    std::unordered_map<uint64_t, std::unique_ptr<StreamState>> streams;
+    std::atomic<uint64_t> numberOfDroppedSamples{0};
+};
+
+}// namespace x::Runtime::Execution::Operators
+
+#endif// x_RUNTIME_INCLUDE_EXECUTION_OPERATORS_STREAMING_SIGNALRECONSTRUCTION_SIGNALRECONSTRUCTIONOPERATORHANDLER_HPP_
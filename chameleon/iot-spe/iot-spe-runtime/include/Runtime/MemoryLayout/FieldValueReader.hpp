@@ -0,0 +1,87 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#ifndef x_RUNTIME_INCLUDE_RUNTIME_MEMORYLAYOUT_FIELDVALUEREADER_HPP_
+#define x_RUNTIME_INCLUDE_RUNTIME_MEMORYLAYOUT_FIELDVALUEREADER_HPP_
+
+#include <Common/PhysicalTypes/BasicPhysicalType.hpp>
+#include <Runtime/RuntimeForwardRefs.hpp>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace x::Runtime::MemoryLayouts {
+
+/**
+ * @brief Reads a fixed set of numeric fields of all tuples in a tuple buffer as double values.
+ * Field indexes, native types, first offsets, and strides are resolved once against the memory layout,
+ * so that read() only runs one strided loop per field, for the row layout as well as for the column layout.
+ */
+class FieldValueReader {
+  public:
+    /**
+     * @brief Creates a reader for the given fields
+     * @param memoryLayout the memory layout of the buffers that are read
+     * @param fieldNames fully or partly qualified names of numeric fields
+     * @throws RuntimeException if a field does not exist or is not numeric
+     */
+    FieldValueReader(const MemoryLayoutPtr& memoryLayout, const std::vector<std::string>& fieldNames);
+
+    /**
+     * @brief Reads the fields of all tuples in the buffer
+     * @param buffer the tuple buffer
+     * @param values is resized to numberOfTuples * getNumberOfFields() and holds the values row by row,
+     * i.e., values[tupleIndex * getNumberOfFields() + fieldIndex]
+     */
+    void read(const TupleBuffer& buffer, std::vector<double>& values) const;
+
+    /**
+     * @return the number of fields read per tuple
+     */
+    [[nodiscard]] uint64_t getNumberOfFields() const;
+
+    /**
+     * @return the fully qualified names of the fields read per tuple
+     */
+    [[nodiscard]] const std::vector<std::string>& getFieldNames() const;
+
+    /**
+     * @brief finds the index of a field in the memory layout
+     * @param memoryLayout
+     * @param fieldName fully or partly qualified field name
+     * @return the field index or an empty optional
+     */
+    static std::optional<uint64_t> findFieldIndex(const MemoryLayoutPtr& memoryLayout, const std::string& fieldName);
+
+    /**
+     * @brief checks if a physical type can be read by the FieldValueReader
+     * @param physicalType
+     * @return true if the physical type is a basic integer or floating point type
+     */
+    static bool isNumeric(const PhysicalTypePtr& physicalType);
+
+  private:
+    struct Field {
+        BasicPhysicalType::NativeType nativeType;
+        uint64_t offset;
+        uint64_t stride;
+    };
+
+    std::vector<Field> fields;
+    std::vector<std::string> fieldNames;
+};
+
+}// namespace x::Runtime::MemoryLayouts
+
+#endif// x_RUNTIME_INCLUDE_RUNTIME_MEMORYLAYOUT_FIELDVALUEREADER_HPP_
@@ -0,0 +1,148 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+#include <Execution/Operators/ExecutionContext.hpp>
+#include <Execution/Operators/Streaming/SignalReconstruction/SignalReconstruction.hpp>
+#include <Execution/Operators/Streaming/SignalReconstruction/SignalReconstructionOperatorHandler.hpp>
+#include <Execution/Operators/Streaming/TimeFunction.hpp>
+#include <Execution/RecordBuffer.hpp>
+#include <Nautilus/Interface/FunctionCall.hpp>
+#include <Runtime/Execution/PipelineExecutionContext.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/StdInt.hpp>
+#include <utility>
+
+namespace x::Runtime::Execution::Operators {
+
+void setupSignalReconstructionHandler(void* op, void* ctx) {
+    auto handler = static_cast<SignalReconstructionOperatorHandler*>(op);
+    auto pipelineExecutionContext = static_cast<PipelineExecutionContext*>(ctx);
+    handler->setup(pipelineExecutionContext->getNumberOfWorkerThreads());
+}
+
+template<class T>
+void setSampleValueProxy(void* op, uint64_t workerId, uint64_t index, T value) {
+    auto handler = static_cast<SignalReconstructionOperatorHandler*>(op);
+    handler->setSampleValue(workerId, index, static_cast<double>(value));
+}
+
+void addSampleProxy(void* op, uint64_t workerId, uint64_t timestamp) {
+    auto handler = static_cast<SignalReconstructionOperatorHandler*>(op);
+    handler->addSample(workerId, timestamp);
+}
+
+uint64_t reconstructSignalProxy(void* op, uint64_t workerId, uint64_t originId, uint64_t sequenceNumber) {
+    auto handler = static_cast<SignalReconstructionOperatorHandler*>(op);
+    return handler->reconstruct(workerId, originId, sequenceNumber);
+}
+
+void* getReconstructedTimestampsProxy(void* op, uint64_t workerId) {
+    auto handler = static_cast<SignalReconstructionOperatorHandler*>(op);
+    return handler->getTimestamps(workerId);
+}
+
+void* getReconstructedValuesProxy(void* op, uint64_t workerId) {
+    auto handler = static_cast<SignalReconstructionOperatorHandler*>(op);
+    return handler->getValues(workerId);
+}
+
+SignalReconstruction::SignalReconstruction(uint64_t operatorHandlerIndex,
+                                           TimeFunctionPtr timeFunction,
+                                           std::vector<Record::RecordFieldIdentifier> valueFields,
+                                           Record::RecordFieldIdentifier timestampField)
+    : operatorHandlerIndex(operatorHandlerIndex), timeFunction(std::move(timeFunction)), valueFields(std::move(valueFields)),
+      timestampField(std::move(timestampField)) {}
+
+void SignalReconstruction::setup(ExecutionContext& executionCtx) const {
+    auto globalOperatorHandler = executionCtx.getGlobalOperatorHandler(operatorHandlerIndex);
+    Nautilus::FunctionCall("setupSignalReconstructionHandler",
+                           setupSignalReconstructionHandler,
+                           globalOperatorHandler,
+                           executionCtx.getPipelineContext());
+}
+
+void SignalReconstruction::open(ExecutionContext& ctx, RecordBuffer& rb) const {
+    Operator::open(ctx, rb);
+    timeFunction->open(ctx, rb);
+}
+
+void SignalReconstruction::execute(ExecutionContext& ctx, Record& record) const {
+    auto handler = ctx.getGlobalOperatorHandler(operatorHandlerIndex);
+    auto workerId = ctx.getWorkerId();
+    // derive the timestamp and pass the values of the sample to the thread local sample of the handler
+    auto timestamp = timeFunction->getTs(ctx, record);
+    for (uint64_t i = 0; i < valueFields.size(); ++i) {
+        Value<> value = record.read(valueFields[i]);
+        Value<UInt64> index = i;
+        if (value->isType<Double>()) {
+            FunctionCall("setSampleValueProxy", setSampleValueProxy<double>, handler, workerId, index, value.as<Double>());
+        } else if (value->isType<Float>()) {
+            FunctionCall("setSampleValueProxy", setSampleValueProxy<float>, handler, workerId, index, value.as<Float>());
+        } else if (value->isType<UInt64>()) {
+            FunctionCall("setSampleValueProxy", setSampleValueProxy<uint64_t>, handler, workerId, index, value.as<UInt64>());
+        } else if (value->isType<UInt32>()) {
+            FunctionCall("setSampleValueProxy", setSampleValueProxy<uint32_t>, handler, workerId, index, value.as<UInt32>());
+        } else if (value->isType<UInt16>()) {
+            FunctionCall("setSampleValueProxy", setSampleValueProxy<uint16_t>, handler, workerId, index, value.as<UInt16>());
+        } else if (value->isType<UInt8>()) {
+            FunctionCall("setSampleValueProxy", setSampleValueProxy<uint8_t>, handler, workerId, index, value.as<UInt8>());
+        } else if (value->isType<Int64>()) {
+            FunctionCall("setSampleValueProxy", setSampleValueProxy<int64_t>, handler, workerId, index, value.as<Int64>());
+        } else if (value->isType<Int32>()) {
+            FunctionCall("setSampleValueProxy", setSampleValueProxy<int32_t>, handler, workerId, index, value.as<Int32>());
+        } else if (value->isType<Int16>()) {
+            FunctionCall("setSampleValueProxy", setSampleValueProxy<int16_t>, handler, workerId, index, value.as<Int16>());
+        } else if (value->isType<Int8>()) {
+            FunctionCall("setSampleValueProxy", setSampleValueProxy<int8_t>, handler, workerId, index, value.as<Int8>());
+        } else {
+            x_THROW_RUNTIME_ERROR("SignalReconstruction: field " << valueFields[i] << " is not numeric");
+        }
+    }
+
+    // append the sample to the batch of the current buffer, it is reconstructed when the buffer is closed
+    Nautilus::FunctionCall("addSampleProxy", addSampleProxy, handler, workerId, timestamp);
+}
+
+void SignalReconstruction::close(ExecutionContext& ctx, RecordBuffer& rb) const {
+    auto handler = ctx.getGlobalOperatorHandler(operatorHandlerIndex);
+    auto workerId = ctx.getWorkerId();
+    // 1. reconstruct the grid points of all batches of the origin that are next in sequence order
+    auto numberOfPoints = Nautilus::FunctionCall("reconstructSignalProxy",
+                                                 reconstructSignalProxy,
+                                                 handler,
+                                                 workerId,
+                                                 rb.getOriginId(),
+                                                 rb.getSequenceNr());
+    auto timestamps =
+        Nautilus::FunctionCall("getReconstructedTimestampsProxy", getReconstructedTimestampsProxy, handler, workerId);
+    auto values = Nautilus::FunctionCall("getReconstructedValuesProxy", getReconstructedValuesProxy, handler, workerId);
+
+    // 2. emit one record per reconstructed point
+    const uint64_t numberOfValues = valueFields.size();
+    for (Value<UInt64> point = 0_u64; point < numberOfPoints; point = point + 1_u64) {
+        Record reconstructed;
+        auto timestampRef = timestamps + point * sizeof(uint64_t);
+        reconstructed.write(timestampField, timestampRef.as<MemRef>().load<UInt64>());
+        auto valueRef = values + point * (numberOfValues * sizeof(double));
+        for (const auto& valueField : valueFields) {
+            reconstructed.write(valueField, valueRef.as<MemRef>().load<Double>());
+            valueRef = valueRef + sizeof(double);
+        }
+        child->execute(ctx, reconstructed);
+    }
+
+    // 3. the child emits the reconstructed records when it is closed
+    Operator::close(ctx, rb);
+}
+
+}// namespace x::Runtime::Execution::Operators
@@ -0,0 +1,250 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+#include <Execution/Operators/Streaming/SignalReconstruction/SignalReconstructionOperatorHandler.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <algorithm>
+
+namespace x::Runtime::Execution::Operators {
+
+namespace {
+/// the velocity of a new kalman filter is unknown, so its first update derives it from the first two samples
+constexpr double INITIAL_VELOCITY_VARIANCE = 1e6;
+}// namespace
+
+SignalReconstructionOperatorHandlerPtr SignalReconstructionOperatorHandler::create(uint64_t numberOfValues,
+                                                                                   uint64_t intervalInMs,
+                                                                                   ReconstructionMethod method,
+                                                                                   uint64_t maxGapInMs) {
+    return std::make_shared<SignalReconstructionOperatorHandler>(numberOfValues, intervalInMs, method, maxGapInMs);
+}
+
+SignalReconstructionOperatorHandler::SignalReconstructionOperatorHandler(uint64_t numberOfValues,
+                                                                         uint64_t intervalInMs,
+                                                                         ReconstructionMethod method,
+                                                                         uint64_t maxGapInMs,
+                                                                         double processNoise,
+                                                                         double measurementNoise)
+    : numberOfValues(numberOfValues), intervalInMs(intervalInMs), method(method), maxGapInMs(maxGapInMs),
+      processNoise(processNoise), measurementNoise(measurementNoise) {
+    x_ASSERT(intervalInMs > 0, "SignalReconstructionOperatorHandler: the interval has to be larger than 0");
+}
+
+void SignalReconstructionOperatorHandler::start(PipelineExecutionContextPtr, StateManagerPtr, uint32_t) {
+    x_DEBUG("start SignalReconstructionOperatorHandler");
+}
+
+void SignalReconstructionOperatorHandler::stop(QueryTerminationType, PipelineExecutionContextPtr) {
+    x_DEBUG("stop SignalReconstructionOperatorHandler, dropped {} out of order samples, {} batches were never reconstructed",
+            numberOfDroppedSamples.load(),
+            getNumberOfPendingBatches());
+}
+
+void SignalReconstructionOperatorHandler::setup(uint64_t numberOfWorkerThreads) {
+    workerBuffers.resize(numberOfWorkerThreads);
+    for (auto& buffers : workerBuffers) {
+        buffers.sample.resize(numberOfValues);
+    }
+}
+
+void SignalReconstructionOperatorHandler::setSampleValue(uint64_t workerId, uint64_t index, double value) {
+    workerBuffers[workerId].sample[index] = value;
+}
+
+void SignalReconstructionOperatorHandler::addSample(uint64_t workerId, uint64_t timestamp) {
+    auto& buffers = workerBuffers[workerId];
+    buffers.batch.timestamps.emplace_back(timestamp);
+    buffers.batch.values.insert(buffers.batch.values.end(), buffers.sample.begin(), buffers.sample.end());
+}
+
+uint64_t SignalReconstructionOperatorHandler::reconstruct(uint64_t workerId, uint64_t originId, uint64_t sequenceNumber) {
+    auto& buffers = workerBuffers[workerId];
+    buffers.timestamps.clear();
+    buffers.values.clear();
+    auto& stream = getStreamState(originId);
+
+    std::unique_lock lock(stream.mutex);
+    if (sequenceNumber < stream.nextSequenceNumber) {
+        // e.g., an upstream emit that split a buffer passes its sequence number on to all parts
+        reconstructBatch(stream, buffers, buffers.batch);
+    } else {
+        auto& pendingBatch = stream.pendingBatches[sequenceNumber];
+        auto& batch = buffers.batch;
+        pendingBatch.timestamps.insert(pendingBatch.timestamps.end(), batch.timestamps.begin(), batch.timestamps.end());
+        pendingBatch.values.insert(pendingBatch.values.end(), batch.values.begin(), batch.values.end());
+        for (auto it = stream.pendingBatches.begin();
+             it != stream.pendingBatches.end() && it->first == stream.nextSequenceNumber;
+             it = stream.pendingBatches.erase(it)) {
+            reconstructBatch(stream, buffers, it->second);
+            ++stream.nextSequenceNumber;
+        }
+    }
+    lock.unlock();
+
+    buffers.batch.timestamps.clear();
+    buffers.batch.values.clear();
+    return buffers.timestamps.size();
+}
+
+SignalReconstructionOperatorHandler::StreamState& SignalReconstructionOperatorHandler::getStreamState(uint64_t originId) {
+    std::unique_lock lock(streamsMutex);
+    auto& stream = streams[originId];
+    if (!stream) {
+        stream = std::make_unique<StreamState>();
+        stream->previousSample.resize(numberOfValues);
+        stream->kalmanStates.resize(numberOfValues);
+    }
+    return *stream;
+}
+
+void SignalReconstructionOperatorHandler::reconstructBatch(StreamState& stream,
+                                                           WorkerBuffers& buffers,
+                                                           const SampleBatch& batch) {
+    for (uint64_t i = 0; i < batch.timestamps.size(); ++i) {
+        reconstructSample(stream, buffers, batch.timestamps[i], batch.values.data() + i * numberOfValues);
+    }
+}
+
+void SignalReconstructionOperatorHandler::reconstructSample(StreamState& stream,
+                                                            WorkerBuffers& buffers,
+                                                            uint64_t timestamp,
+                                                            const double* sample) {
+    if (stream.hasPreviousSample && timestamp <= stream.previousTimestamp) {
+        ++numberOfDroppedSamples;
+        return;
+    }
+
+    auto gap = timestamp - stream.previousTimestamp;
+    if (!stream.hasPreviousSample || (maxGapInMs > 0 && gap > maxGapInMs)) {
+        // the grid restarts at the current sample, points inside of the gap are not reconstructed
+        stream.nextGridPoint = firstGridPointAtOrAfter(timestamp);
+        resetKalmanStates(stream, sample);
+    } else {
+        const auto* previous = stream.previousSample.data();
+        switch (method) {
+            case ReconstructionMethod::LINEAR: {
+                for (; stream.nextGridPoint < timestamp; stream.nextGridPoint += intervalInMs) {
+                    auto weight = static_cast<double>(stream.nextGridPoint - stream.previousTimestamp) / static_cast<double>(gap);
+                    auto* values = appendPoint(buffers, stream.nextGridPoint);
+                    // contiguous and branch free, so that the compiler vectorizes the interpolation of all values
+                    for (uint64_t i = 0; i < numberOfValues; ++i) {
+                        values[i] = previous[i] + weight * (sample[i] - previous[i]);
+                    }
+                }
+                break;
+            }
+            case ReconstructionMethod::SAMPLE_AND_HOLD: {
+                for (; stream.nextGridPoint < timestamp; stream.nextGridPoint += intervalInMs) {
+                    std::copy_n(previous, numberOfValues, appendPoint(buffers, stream.nextGridPoint));
+                }
+                break;
+            }
+            case ReconstructionMethod::KALMAN: {
+                for (; stream.nextGridPoint < timestamp; stream.nextGridPoint += intervalInMs) {
+                    auto dt = static_cast<double>(stream.nextGridPoint - stream.previousTimestamp) / 1000.0;
+                    auto* values = appendPoint(buffers, stream.nextGridPoint);
+                    for (uint64_t i = 0; i < numberOfValues; ++i) {
+                        values[i] = stream.kalmanStates[i].position + stream.kalmanStates[i].velocity * dt;
+                    }
+                }
+                predictKalmanStates(stream, static_cast<double>(gap) / 1000.0);
+                updateKalmanStates(stream, sample);
+                break;
+            }
+        }
+    }
+
+    if (stream.nextGridPoint == timestamp) {
+        auto* values = appendPoint(buffers, timestamp);
+        if (method == ReconstructionMethod::KALMAN) {
+            for (uint64_t i = 0; i < numberOfValues; ++i) {
+                values[i] = stream.kalmanStates[i].position;
+            }
+        } else {
+            std::copy_n(sample, numberOfValues, values);
+        }
+        stream.nextGridPoint += intervalInMs;
+    }
+
+    stream.hasPreviousSample = true;
+    stream.previousTimestamp = timestamp;
+    std::copy_n(sample, numberOfValues, stream.previousSample.begin());
+}
+
+uint64_t* SignalReconstructionOperatorHandler::getTimestamps(uint64_t workerId) {
+    return workerBuffers[workerId].timestamps.data();
+}
+
+double* SignalReconstructionOperatorHandler::getValues(uint64_t workerId) { return workerBuffers[workerId].values.data(); }
+
+uint64_t SignalReconstructionOperatorHandler::getNumberOfDroppedSamples() const { return numberOfDroppedSamples; }
+
+uint64_t SignalReconstructionOperatorHandler::getNumberOfPendingBatches() const {
+    std::unique_lock lock(streamsMutex);
+    uint64_t numberOfPendingBatches = 0;
+    for (const auto& [originId, stream] : streams) {
+        std::unique_lock streamLock(stream->mutex);
+        numberOfPendingBatches += stream->pendingBatches.size();
+    }
+    return numberOfPendingBatches;
+}
+
+uint64_t SignalReconstructionOperatorHandler::getNumberOfValues() const { return numberOfValues; }
+
+double* SignalReconstructionOperatorHandler::appendPoint(WorkerBuffers& buffers, uint64_t timestamp) const {
+    buffers.timestamps.emplace_back(timestamp);
+    auto offset = buffers.values.size();
+    buffers.values.resize(offset + numberOfValues);
+    return buffers.values.data() + offset;
+}
+
+uint64_t SignalReconstructionOperatorHandler::firstGridPointAtOrAfter(uint64_t timestamp) const {
+    return (timestamp + intervalInMs - 1) / intervalInMs * intervalInMs;
+}
+
+void SignalReconstructionOperatorHandler::resetKalmanStates(StreamState& stream, const double* sample) const {
+    for (uint64_t i = 0; i < numberOfValues; ++i) {
+        stream.kalmanStates[i] = KalmanState{sample[i], 0.0, measurementNoise, 0.0, INITIAL_VELOCITY_VARIANCE};
+    }
+}
+
+void SignalReconstructionOperatorHandler::predictKalmanStates(StreamState& stream, double dt) const {
+    // constant velocity model, the acceleration is white noise with the variance processNoise per second
+    auto q00 = processNoise * dt * dt * dt / 3.0;
+    auto q01 = processNoise * dt * dt / 2.0;
+    auto q11 = processNoise * dt;
+    for (auto& state : stream.kalmanStates) {
+        state.position += state.velocity * dt;
+        state.p00 += 2.0 * dt * state.p01 + dt * dt * state.p11 + q00;
+        state.p01 += dt * state.p11 + q01;
+        state.p11 += q11;
+    }
+}
+
+void SignalReconstructionOperatorHandler::updateKalmanStates(StreamState& stream, const double* sample) const {
+    // only the position is measured
+    for (uint64_t i = 0; i < numberOfValues; ++i) {
+        auto& state = stream.kalmanStates[i];
+        auto innovationCovariance = state.p00 + measurementNoise;
+        auto positionGain = state.p00 / innovationCovariance;
+        auto velocityGain = state.p01 / innovationCovariance;
+        auto innovation = sample[i] - state.position;
+        state.position += positionGain * innovation;
+        state.velocity += velocityGain * innovation;
+        state.p11 -= velocityGain * state.p01;
+        state.p00 *= 1.0 - positionGain;
+        state.p01 *= 1.0 - positionGain;
+    }
+}
+
+}// namespace x::Runtime::Execution::Operators
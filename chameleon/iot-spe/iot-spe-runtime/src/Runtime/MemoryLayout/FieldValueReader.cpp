@@ -0,0 +1,142 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <API/AttributeField.hpp>
+#include <API/Schema.hpp>
+#include <Runtime/MemoryLayout/ColumnLayout.hpp>
+#include <Runtime/MemoryLayout/FieldValueReader.hpp>
+#include <Runtime/MemoryLayout/RowLayout.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <cstring>
+
+namespace x::Runtime::MemoryLayouts {
+
+namespace {
+/**
+ * @brief copies one field of numberOfTuples tuples into every numberOfFields-th value
+ */
+template<typename T>
+void readField(const uint8_t* source, uint64_t stride, uint64_t numberOfTuples, double* target, uint64_t numberOfFields) {
+    for (uint64_t i = 0; i < numberOfTuples; ++i) {
+        T value;
+        std::memcpy(&value, source + i * stride, sizeof(T));// fields in the row layout are not aligned
+        target[i * numberOfFields] = static_cast<double>(value);
+    }
+}
+}// namespace
+
+FieldValueReader::FieldValueReader(const MemoryLayoutPtr& memoryLayout, const std::vector<std::string>& fieldNames) {
+    x_ASSERT(memoryLayout, "FieldValueReader: invalid memory layout");
+    auto& schema = memoryLayout->getSchema();
+    auto rowLayout = std::dynamic_pointer_cast<RowLayout>(memoryLayout);
+    for (const auto& fieldName : fieldNames) {
+        auto fieldIndex = findFieldIndex(memoryLayout, fieldName);
+        if (!fieldIndex.has_value()) {
+            x_THROW_RUNTIME_ERROR("FieldValueReader: field " << fieldName << " does not exist in schema " << schema->toString());
+        }
+        auto& physicalType = memoryLayout->getPhysicalTypes()[fieldIndex.value()];
+        if (!isNumeric(physicalType)) {
+            x_THROW_RUNTIME_ERROR("FieldValueReader: field " << fieldName << " of type " << physicalType->toString()
+                                                             << " is not numeric");
+        }
+        // the row layout strides over whole tuples, the column layout over the values of one column
+        auto stride = rowLayout ? memoryLayout->getTupleSize() : memoryLayout->getFieldSizes()[fieldIndex.value()];
+        fields.emplace_back(Field{std::dynamic_pointer_cast<BasicPhysicalType>(physicalType)->nativeType,
+                                  memoryLayout->getFieldOffset(0, fieldIndex.value()),
+                                  stride});
+        this->fieldNames.emplace_back(schema->fields[fieldIndex.value()]->getName());
+    }
+}
+
+void FieldValueReader::read(const TupleBuffer& buffer, std::vector<double>& values) const {
+    auto numberOfTuples = buffer.getNumberOfTuples();
+    auto numberOfFields = fields.size();
+    values.resize(numberOfTuples * numberOfFields);
+    auto* bufferStart = buffer.getBuffer<uint8_t>();
+    for (uint64_t fieldIndex = 0; fieldIndex < numberOfFields; ++fieldIndex) {
+        const auto& field = fields[fieldIndex];
+        auto* source = bufferStart + field.offset;
+        auto* target = values.data() + fieldIndex;
+        switch (field.nativeType) {
+            case BasicPhysicalType::NativeType::UINT_8:
+                readField<uint8_t>(source, field.stride, numberOfTuples, target, numberOfFields);
+                break;
+            case BasicPhysicalType::NativeType::UINT_16:
+                readField<uint16_t>(source, field.stride, numberOfTuples, target, numberOfFields);
+                break;
+            case BasicPhysicalType::NativeType::UINT_32:
+                readField<uint32_t>(source, field.stride, numberOfTuples, target, numberOfFields);
+                break;
+            case BasicPhysicalType::NativeType::UINT_64:
+                readField<uint64_t>(source, field.stride, numberOfTuples, target, numberOfFields);
+                break;
+            case BasicPhysicalType::NativeType::INT_8:
+                readField<int8_t>(source, field.stride, numberOfTuples, target, numberOfFields);
+                break;
+            case BasicPhysicalType::NativeType::INT_16:
+                readField<int16_t>(source, field.stride, numberOfTuples, target, numberOfFields);
+                break;
+            case BasicPhysicalType::NativeType::INT_32:
+                readField<int32_t>(source, field.stride, numberOfTuples, target, numberOfFields);
+                break;
+            case BasicPhysicalType::NativeType::INT_64:
+                readField<int64_t>(source, field.stride, numberOfTuples, target, numberOfFields);
+                break;
+            case BasicPhysicalType::NativeType::FLOAT:
+                readField<float>(source, field.stride, numberOfTuples, target, numberOfFields);
+                break;
+            case BasicPhysicalType::NativeType::DOUBLE:
+                readField<double>(source, field.stride, numberOfTuples, target, numberOfFields);
+                break;
+            default: x_NOT_IMPLEMENTED();
+        }
+    }
+}
+
+uint64_t FieldValueReader::getNumberOfFields() const { return fields.size(); }
+
+const std::vector<std::string>& FieldValueReader::getFieldNames() const { return fieldNames; }
+
+std::optional<uint64_t> FieldValueReader::findFieldIndex(const MemoryLayoutPtr& memoryLayout, const std::string& fieldName) {
+    auto fieldIndex = memoryLayout->getFieldIndexFromName(fieldName);
+    if (!fieldIndex.has_value()) {
+        // resolve partly qualified names, e.g., value for car$value
+        if (auto attributeField = memoryLayout->getSchema()->hasFieldName(fieldName)) {
+            fieldIndex = memoryLayout->getFieldIndexFromName(attributeField->getName());
+        }
+    }
+    return fieldIndex;
+}
+
+bool FieldValueReader::isNumeric(const PhysicalTypePtr& physicalType) {
+    if (!physicalType->isBasicType()) {
+        return false;
+    }
+    switch (std::dynamic_pointer_cast<BasicPhysicalType>(physicalType)->nativeType) {
+        case BasicPhysicalType::NativeType::UINT_8:
+        case BasicPhysicalType::NativeType::UINT_16:
+        case BasicPhysicalType::NativeType::UINT_32:
+        case BasicPhysicalType::NativeType::UINT_64:
+        case BasicPhysicalType::NativeType::INT_8:
+        case BasicPhysicalType::NativeType::INT_16:
+        case BasicPhysicalType::NativeType::INT_32:
+        case BasicPhysicalType::NativeType::INT_64:
+        case BasicPhysicalType::NativeType::FLOAT:
+        case BasicPhysicalType::NativeType::DOUBLE: return true;
+        default: return false;
+    }
+}
+
+}// namespace x::Runtime::MemoryLayouts
@@ -0,0 +1,242 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <BaseIntegrationTest.hpp>
+#include <Execution/Expressions/ReadFieldExpression.hpp>
+#include <Execution/Operators/ExecutionContext.hpp>
+#include <Execution/Operators/Streaming/SignalReconstruction/SignalReconstruction.hpp>
+#include <Execution/Operators/Streaming/SignalReconstruction/SignalReconstructionOperatorHandler.hpp>
+#include <Execution/Operators/Streaming/TimeFunction.hpp>
+#include <Execution/RecordBuffer.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <Runtime/WorkerContext.hpp>
+#include <TestUtils/MockedPipelineExecutionContext.hpp>
+#include <TestUtils/RecordCollectOperator.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/StdInt.hpp>
+#include <atomic>
+#include <gtest/gtest.h>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace x::Runtime::Execution::Operators {
+
+class SignalReconstructionOperatorTest : public Testing::BaseUnitTest {
+  public:
+    std::shared_ptr<BufferManager> bm;
+    std::shared_ptr<WorkerContext> wc;
+
+    /* Will be called before any test in this class are executed. */
+    static void SetUpTestCase() {
+        x::Logger::setupLogging("SignalReconstructionOperatorTest.log", x::LogLevel::LOG_DEBUG);
+        x_INFO("Setup SignalReconstructionOperatorTest test class.");
+    }
+
+    /* Will be called before a test is executed. */
+    void SetUp() override {
+        Testing::BaseUnitTest::SetUp();
+        bm = std::make_shared<BufferManager>();
+        wc = std::make_shared<WorkerContext>(0, bm, 100);
+    }
+
+    /* Will be called after all tests in this class are finished. */
+    static void TearDownTestCase() { x_INFO("Tear down SignalReconstructionOperatorTest test class."); }
+
+    /**
+     * @brief the samples of a buffer of an origin
+     */
+    struct InputBuffer {
+        uint64_t originId;
+        uint64_t sequenceNumber;
+        std::vector<Record> samples;
+    };
+
+    /**
+     * @brief runs the operator on buffers with samples of the form {ts, v}, one buffer after the other
+     * @return the collected reconstructed records
+     */
+    std::vector<Record> reconstructBuffers(const SignalReconstructionOperatorHandlerPtr& handler,
+                                           std::vector<InputBuffer> inputBuffers) {
+        auto readTs = std::make_shared<Expressions::ReadFieldExpression>("ts");
+        auto signalReconstruction =
+            SignalReconstruction(0 /*handler index*/, std::make_unique<EventTimeFunction>(readTs), {"v"}, "ts");
+        auto collector = std::make_shared<CollectOperator>();
+        signalReconstruction.setChild(collector);
+
+        auto pipelineContext = MockedPipelineExecutionContext({handler});
+        auto ctx = ExecutionContext(Value<MemRef>((int8_t*) wc.get()), Value<MemRef>((int8_t*) &pipelineContext));
+        signalReconstruction.setup(ctx);
+        for (auto& inputBuffer : inputBuffers) {
+            auto buffer = bm->getBufferBlocking();
+            buffer.setOriginId(inputBuffer.originId);
+            buffer.setSequenceNumber(inputBuffer.sequenceNumber);
+            auto rb = RecordBuffer(Value<MemRef>((int8_t*) std::addressof(buffer)));
+            signalReconstruction.open(ctx, rb);
+            for (auto& sample : inputBuffer.samples) {
+                signalReconstruction.execute(ctx, sample);
+            }
+            signalReconstruction.close(ctx, rb);
+        }
+        return collector->records;
+    }
+
+    /**
+     * @brief runs the operator on a single buffer with samples of the form {ts, v}
+     * @return the collected reconstructed records
+     */
+    std::vector<Record> reconstruct(const SignalReconstructionOperatorHandlerPtr& handler, std::vector<Record> samples) {
+        return reconstructBuffers(handler, {{1, 1, std::move(samples)}});
+    }
+
+    static uint64_t readTs(Record& record) { return record.read("ts").as<UInt64>().getValue().getValue(); }
+
+    static double readValue(Record& record) { return record.read("v").as<Double>().getValue().getValue(); }
+};
+
+/**
+ * @brief Tests that the points between two samples are linearly interpolated on a grid of multiples of the interval.
+ */
+TEST_F(SignalReconstructionOperatorTest, linearInterpolation) {
+    auto handler = SignalReconstructionOperatorHandler::create(1, 10, ReconstructionMethod::LINEAR);
+    auto records = reconstruct(handler,
+                               {Record({{"ts", 5_u64}, {"v", +0_s64}}),
+                                Record({{"ts", 45_u64}, {"v", +40_s64}}),
+                                Record({{"ts", 50_u64}, {"v", +0_s64}})});
+    // grid points 10, 20, 30, 40 between the first two samples and the sample at 50
+    ASSERT_EQ(records.size(), 5);
+    for (uint64_t i = 0; i < 4; ++i) {
+        EXPECT_EQ(readTs(records[i]), (i + 1) * 10);
+        EXPECT_DOUBLE_EQ(readValue(records[i]), (i + 1) * 10 - 5.0);
+    }
+    EXPECT_EQ(readTs(records[4]), 50);
+    EXPECT_DOUBLE_EQ(readValue(records[4]), 0.0);
+}
+
+/**
+ * @brief Tests that sample and hold repeats the previous sample until the next one arrives.
+ */
+TEST_F(SignalReconstructionOperatorTest, sampleAndHold) {
+    auto handler = SignalReconstructionOperatorHandler::create(1, 10, ReconstructionMethod::SAMPLE_AND_HOLD);
+    auto records = reconstruct(handler,
+                               {Record({{"ts", 10_u64}, {"v", Value<Double>(1.5)}}),
+                                Record({{"ts", 35_u64}, {"v", Value<Double>(3.0)}})});
+    ASSERT_EQ(records.size(), 3);
+    EXPECT_EQ(readTs(records[0]), 10);
+    EXPECT_EQ(readTs(records[1]), 20);
+    EXPECT_EQ(readTs(records[2]), 30);
+    for (auto& record : records) {
+        EXPECT_DOUBLE_EQ(readValue(record), 1.5);
+    }
+}
+
+/**
+ * @brief Tests that gaps larger than the maximum gap are not reconstructed and that out of order samples are dropped.
+ */
+TEST_F(SignalReconstructionOperatorTest, skipGapsAndDropOutOfOrderSamples) {
+    auto handler = SignalReconstructionOperatorHandler::create(1, 10, ReconstructionMethod::LINEAR, 50);
+    auto records = reconstruct(handler,
+                               {Record({{"ts", 10_u64}, {"v", Value<Double>(1.0)}}),
+                                Record({{"ts", 200_u64}, {"v", Value<Double>(2.0)}}),
+                                Record({{"ts", 150_u64}, {"v", Value<Double>(3.0)}}),
+                                Record({{"ts", 220_u64}, {"v", Value<Double>(4.0)}})});
+    ASSERT_EQ(records.size(), 4);
+    EXPECT_EQ(readTs(records[0]), 10);
+    EXPECT_EQ(readTs(records[1]), 200);
+    EXPECT_EQ(readTs(records[2]), 210);
+    EXPECT_DOUBLE_EQ(readValue(records[2]), 3.0);
+    EXPECT_EQ(readTs(records[3]), 220);
+    EXPECT_EQ(handler->getNumberOfDroppedSamples(), 1);
+}
+
+/**
+ * @brief Tests that the kalman filter extrapolates a signal with a constant slope.
+ */
+TEST_F(SignalReconstructionOperatorTest, kalmanPrediction) {
+    auto handler = std::make_shared<SignalReconstructionOperatorHandler>(1, 100, ReconstructionMethod::KALMAN, 0, 1e-6, 1e-6);
+    std::vector<Record> samples;
+    for (uint64_t ts = 0; ts <= 2000; ts += 500) {
+        samples.emplace_back(Record({{"ts", Value<UInt64>(ts)}, {"v", Value<Double>(ts / 1000.0)}}));
+    }
+    auto records = reconstruct(handler, samples);
+    ASSERT_EQ(records.size(), 21);
+    // after two samples the filter has learned the slope of 1 per second
+    for (uint64_t i = 11; i < records.size(); ++i) {
+        EXPECT_EQ(readTs(records[i]), i * 100);
+        EXPECT_NEAR(readValue(records[i]), i * 0.1, 1e-2);
+    }
+}
+
+/**
+ * @brief Tests that buffers that are closed in reverse order are reconstructed in the order of their sequence numbers,
+ * independently for each origin, instead of dropping the samples of the buffers that arrive late.
+ */
+TEST_F(SignalReconstructionOperatorTest, reorderInterleavedBuffersOfOrigins) {
+    auto handler = SignalReconstructionOperatorHandler::create(1, 5, ReconstructionMethod::LINEAR);
+    auto samples = [](uint64_t firstTs, double offset) {
+        return std::vector<Record>{Record({{"ts", Value<UInt64>(firstTs)}, {"v", Value<Double>(offset + firstTs)}}),
+                                   Record({{"ts", Value<UInt64>(firstTs + 10)}, {"v", Value<Double>(offset + firstTs + 10)}})};
+    };
+    // the samples of origin 2 are offset by 1000 to tell the origins apart
+    auto records = reconstructBuffers(
+        handler,
+        {{1, 2, samples(20, 0)}, {2, 2, samples(20, 1000)}, {1, 1, samples(0, 0)}, {2, 1, samples(0, 1000)}});
+
+    // each origin emits its complete grid 0, 5, ..., 30 once its first buffer arrives
+    ASSERT_EQ(records.size(), 14);
+    for (uint64_t i = 0; i < records.size(); ++i) {
+        auto expectedTs = (i % 7) * 5;
+        auto offset = i < 7 ? 0.0 : 1000.0;
+        EXPECT_EQ(readTs(records[i]), expectedTs);
+        EXPECT_DOUBLE_EQ(readValue(records[i]), offset + expectedTs);
+    }
+    EXPECT_EQ(handler->getNumberOfDroppedSamples(), 0);
+    EXPECT_EQ(handler->getNumberOfPendingBatches(), 0);
+}
+
+/**
+ * @brief Tests that two workers that alternately hand over the buffers of an origin reconstruct every sample exactly once.
+ */
+TEST_F(SignalReconstructionOperatorTest, concurrentWorkers) {
+    constexpr uint64_t numberOfBuffers = 10000;
+    auto handler = SignalReconstructionOperatorHandler::create(1, 10, ReconstructionMethod::SAMPLE_AND_HOLD);
+    handler->setup(2);
+
+    std::atomic<uint64_t> numberOfPoints = 0;
+    std::vector<std::thread> workers;
+    for (uint64_t workerId = 0; workerId < 2; ++workerId) {
+        workers.emplace_back([&, workerId]() {
+            // every sample is on the grid, so each buffer reconstructs its own sample once its predecessors are done
+            for (uint64_t sequenceNumber = workerId + 1; sequenceNumber <= numberOfBuffers; sequenceNumber += 2) {
+                handler->setSampleValue(workerId, 0, static_cast<double>(sequenceNumber));
+                handler->addSample(workerId, sequenceNumber * 10);
+                auto points = handler->reconstruct(workerId, 1, sequenceNumber);
+                auto* timestamps = handler->getTimestamps(workerId);
+                auto* values = handler->getValues(workerId);
+                for (uint64_t i = 0; i < points; ++i) {
+                    EXPECT_DOUBLE_EQ(values[i], static_cast<double>(timestamps[i] / 10));
+                }
+                numberOfPoints += points;
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    EXPECT_EQ(numberOfPoints, numberOfBuffers);
+    EXPECT_EQ(handler->getNumberOfDroppedSamples(), 0);
+    EXPECT_EQ(handler->getNumberOfPendingBatches(), 0);
+}
+
+}// namespace x::Runtime::Execution::Operators